@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Input and timing shared by the lookup benchmarks.
+namespace bench
+{
+    constexpr std::size_t text_size = std::size_t(1) << 16;
+
+    // text_size code points picked from alphabet with a fixed seed
+    inline std::u32string make_text(const std::u32string& alphabet)
+    {
+        std::u32string text(text_size, U'\0');
+        uint32_t seed = 1;
+        for (auto& ch : text)
+        {
+            seed = seed * 1103515245u + 12345u;
+            ch = alphabet[(seed >> 16) % alphabet.size()];
+        }
+        return text;
+    }
+
+    inline std::u32string range(char32_t first, char32_t last)
+    {
+        std::u32string str;
+        for (auto ch = first; ch <= last; ++ch)
+        {
+            str += ch;
+        }
+        return str;
+    }
+
+    // named alphabets the benchmark texts are drawn from
+    inline std::vector<std::pair<const char*, std::u32string>> alphabets()
+    {
+        const auto ascii = range(U' ', U'~');
+        return {
+            {"ascii", ascii},
+            {"latin1", ascii + range(0xa0, 0xff)},
+            {"cyrillic", U" ,." + range(0x400, 0x4ff)},
+            {"mixed", ascii + range(0xc0, 0x24f) + range(0x391, 0x3c9) + range(0x410, 0x44f) + U"中文字\U0001F600"},
+        };
+    }
+
+    // best of 3 runs in ns per code point
+    template<typename Func>
+    double time_per_char(const std::u32string& text, Func func, unsigned& sink)
+    {
+        double best {};
+        for (int run = 0; run < 3; ++run)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (auto ch : text)
+            {
+                sink += func(ch);
+            }
+            const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            best = run == 0 ? elapsed : std::min(best, elapsed);
+        }
+        return best / double(text.size());
+    }
+}
@@ -0,0 +1,52 @@
+// Times toupper, tolower, is_upper and is_lower against the std::unordered_map lookups the
+// two-stage case tables replaced. The maps are rebuilt from the library's own results, with
+// an entry for every code point that changes, like the original upper_map and lower_map.
+
+#include <cstdio>
+#include <unordered_map>
+
+#include <u32string_utils/u32caps.h>
+
+#include "bench_text.h"
+
+int main()
+{
+    std::unordered_map<char32_t, char32_t> upper_map;
+    std::unordered_map<char32_t, char32_t> lower_map;
+    for (char32_t ch = 0; ch < 0x110000; ++ch)
+    {
+        if (u32::toupper(ch) != ch)
+        {
+            upper_map.emplace(ch, u32::toupper(ch));
+        }
+        if (u32::tolower(ch) != ch)
+        {
+            lower_map.emplace(ch, u32::tolower(ch));
+        }
+    }
+
+    const auto by_maps = [&](char32_t ch) {
+        auto upper = upper_map.find(ch);
+        auto lower = lower_map.find(ch);
+        return unsigned(upper != upper_map.end() ? upper->second : ch) + unsigned(lower != lower_map.end() ? lower->second : ch)
+               + (lower != lower_map.end()) + (upper != upper_map.end());
+    };
+    const auto by_tables = [](char32_t ch) {
+        return unsigned(u32::toupper(ch)) + unsigned(u32::tolower(ch)) + u32::is_upper(ch) + u32::is_lower(ch);
+    };
+
+    unsigned sink {};
+    std::printf("ns per code point: toupper + tolower + is_upper + is_lower\n");
+    std::printf("%-10s %8s %8s\n", "", "maps", "tables");
+    for (const auto& entry : bench::alphabets())
+    {
+        const auto text = bench::make_text(entry.second);
+        const auto maps = bench::time_per_char(text, by_maps, sink);
+        const auto tables = bench::time_per_char(text, by_tables, sink);
+        std::printf("%-10s %8.1f %8.1f\n", entry.first, maps, tables);
+    }
+
+    // keeps the lookups from being optimized out
+    std::printf("checksum %u\n", sink);
+    return 0;
+}
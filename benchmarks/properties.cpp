@@ -0,0 +1,60 @@
+// Times is_alpha, is_space, is_punctuation, is_other_symbol and is_currency_symbol against
+// the std::map range lookups the two-stage property tables replaced. The map is rebuilt from
+// the library's own results with one entry per run of equal results, keyed by the end of the
+// run and searched with upper_bound like the original general_category_range. It has fewer
+// runs than the per category original, so the maps come out somewhat faster than they were.
+
+#include <cstdio>
+#include <map>
+
+#include <u32string_utils/u32caps.h>
+
+#include "bench_text.h"
+
+int main()
+{
+    // bit per predicate
+    const auto classify = [](char32_t ch) {
+        return unsigned(u32::is_alpha(ch)) | unsigned(u32::is_space(ch)) << 1 | unsigned(u32::is_punctuation(ch)) << 2
+               | unsigned(u32::is_other_symbol(ch)) << 3 | unsigned(u32::is_currency_symbol(ch)) << 4;
+    };
+
+    std::map<char32_t, unsigned> range_map;
+    auto current = classify(0);
+    for (char32_t ch = 1; ch <= 0x110000; ++ch)
+    {
+        const auto bits = ch < 0x110000 ? classify(ch) : ~0u;
+        if (bits != current)
+        {
+            range_map.emplace(ch, current);
+            current = bits;
+        }
+    }
+
+    const auto has = [&](char32_t ch, unsigned bit) {
+        auto it = range_map.upper_bound(ch);
+        return it != range_map.end() && (it->second & bit) != 0;
+    };
+    const auto by_maps = [&](char32_t ch) {
+        return unsigned(has(ch, 1)) + has(ch, 2) + has(ch, 4) + has(ch, 8) + has(ch, 16);
+    };
+    const auto by_tables = [](char32_t ch) {
+        return unsigned(u32::is_alpha(ch)) + u32::is_space(ch) + u32::is_punctuation(ch) + u32::is_other_symbol(ch)
+               + u32::is_currency_symbol(ch);
+    };
+
+    unsigned sink {};
+    std::printf("ns per code point: is_alpha + is_space + is_punctuation + is_other_symbol + is_currency_symbol\n");
+    std::printf("%-10s %8s %8s\n", "", "maps", "tables");
+    for (const auto& entry : bench::alphabets())
+    {
+        const auto text = bench::make_text(entry.second);
+        const auto maps = bench::time_per_char(text, by_maps, sink);
+        const auto tables = bench::time_per_char(text, by_tables, sink);
+        std::printf("%-10s %8.1f %8.1f\n", entry.first, maps, tables);
+    }
+
+    // keeps the lookups from being optimized out
+    std::printf("checksum %u\n", sink);
+    return 0;
+}
@@ -0,0 +1,67 @@
+// Counts the heap allocations made before main and times the first lookups.
+// Every table of the library is constant initialized, so the count must be
+// zero; the exit code is non-zero otherwise.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include <u32string_utils/u32caps.h>
+#include <u32string_utils/u32charset.h>
+#include <u32string_utils/u32utils.h>
+
+namespace
+{
+    // zero-initialized, so valid before any dynamic initialization runs
+    size_t allocations;
+    size_t allocated_bytes;
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    allocated_bytes += size;
+    if (auto ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+int main()
+{
+    const auto startup_allocations = allocations;
+    const auto startup_bytes = allocated_bytes;
+
+    // the calls also pull every table's object file out of the static library
+    const auto start = std::chrono::steady_clock::now();
+    unsigned hits {};
+    for (char32_t ch = 0; ch < 0x3000; ++ch)
+    {
+        hits += u32::toupper(ch) != ch;
+        hits += u32::tolower(ch) != ch;
+        hits += u32::is_alpha(ch) + u32::is_digit(ch) + u32::is_space(ch);
+        hits += u32::is_punctuation(ch) + u32::is_other_symbol(ch) + u32::is_currency_symbol(ch);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const auto text = u32::convert(std::string("\xc0\xe8\xf0"), u32::charset_t::WINDOWS_1251);
+    hits += u32::convert(text).size();
+
+    std::printf("allocations before main: %zu (%zu bytes)\n", startup_allocations, startup_bytes);
+    std::printf("first lookups: %.1f us (%u hits)\n",
+                std::chrono::duration<double, std::micro>(elapsed).count(), hits);
+    return startup_allocations == 0 ? 0 : 1;
+}
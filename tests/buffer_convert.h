@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cassert>
+#include <string>
+
+#include <u32string_utils/u32charset.h>
+#include <u32string_utils/u32utils.h>
+
+inline void check_buffer_convert()
+{
+    const std::string utf8 = u8"resumable Привет \U0001F600 conversion with a long ascii part in the middle, 中文";
+    const std::u32string utf32 = U"resumable Привет \U0001F600 conversion with a long ascii part in the middle, 中文";
+
+    // decode in pieces through a tiny output buffer
+    for (size_t capacity = 1; capacity < 40; ++capacity)
+    {
+        std::u32string decoded;
+        char32_t buffer[40] {};
+        size_t pos {};
+        for (;;)
+        {
+            auto result = u32::convert(utf8.data() + pos, utf8.size() - pos, buffer, capacity);
+            assert(result.written <= capacity);
+            decoded.append(buffer, result.written);
+            pos += result.read;
+            if (result.status == u32::conversion_status::ok)
+            {
+                break;
+            }
+            assert(result.status == u32::conversion_status::output_too_small);
+        }
+        assert(decoded == utf32);
+    }
+
+    // encode in pieces, multi-byte sequences and surrogate pairs are never split
+    const std::u32string with_pair = {U'a', 0xd83d, 0xde00, U'Ж', U'b'};
+    for (size_t capacity = 4; capacity < 40; ++capacity)
+    {
+        for (const auto& input : {utf32, with_pair})
+        {
+            std::string encoded;
+            char buffer[40] {};
+            size_t pos {};
+            for (;;)
+            {
+                auto result = u32::convert(input.data() + pos, input.size() - pos, buffer, capacity);
+                assert(result.written <= capacity);
+                encoded.append(buffer, result.written);
+                pos += result.read;
+                if (result.status == u32::conversion_status::ok)
+                {
+                    break;
+                }
+                assert(result.status == u32::conversion_status::output_too_small);
+            }
+            assert(encoded == u32::convert(input));
+        }
+    }
+
+    {
+        char buffer[3] {};
+        auto result = u32::convert(U"ab中", 3, buffer, sizeof(buffer));
+        assert(result.read == 2 && result.written == 2);
+        assert(result.status == u32::conversion_status::output_too_small);
+    }
+
+    {
+        char32_t buffer[8] {};
+        auto result = u32::convert("ab\x80", 3, buffer, 8);
+        assert(result.read == 2 && result.written == 2);
+        assert(result.status == u32::conversion_status::invalid_input);
+    }
+
+    {
+        char32_t wide[4] {};
+        auto result = u32::convert("a\xc0\xe0", 3, wide, 2, u32::charset_t::WINDOWS_1251);
+        assert(result.read == 2 && result.written == 2);
+        assert(result.status == u32::conversion_status::output_too_small);
+        assert(wide[0] == U'a' && wide[1] == U'А');
+
+        char narrow[4] {};
+        result = u32::convert(U"aА中b", 4, narrow, 4, u32::charset_t::WINDOWS_1251);
+        assert(result.read == 4 && result.written == 3);
+        assert(result.status == u32::conversion_status::ok);
+        assert(std::string(narrow, 3) == "a\xc0" "b");
+
+        result = u32::convert(U"\u00e9\u00e9", 2, narrow, 1, u32::charset_t::US_ASCII);
+        assert(result.read == 1 && result.written == 1);
+        assert(result.status == u32::conversion_status::output_too_small);
+        assert(narrow[0] == '\0');
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cassert>
+#include <string>
+
+#include <u32string_utils/u32utils.h>
+
+inline std::string utf16_bytes(const std::u16string& str, bool big_endian)
+{
+    std::string bytes;
+    for (auto unit : str)
+    {
+        char pair[2] {char(unit & 0xff), char(unit >> 8)};
+        bytes.append(1, pair[big_endian ? 1 : 0]).append(1, pair[big_endian ? 0 : 1]);
+    }
+    return bytes;
+}
+
+inline std::string utf32_bytes(const std::u32string& str, bool big_endian)
+{
+    std::string bytes;
+    for (auto ch : str)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            bytes.append(1, char(ch >> (8 * (big_endian ? 3 - i : i))));
+        }
+    }
+    return bytes;
+}
+
+inline void check_byte_stream_decode()
+{
+    const std::u32string text = std::u32string(21, U'a') + U"Това събщение е на кирилица! 中文 \U0001F600\U0010FFFF" + std::u32string(13, U'b');
+    const auto utf16 = u32::convert_to_u16(text);
+
+    struct sample
+    {
+        u32::unicode_t encoding;
+        std::string bytes;
+        std::string bom;
+    };
+
+    const sample samples[] {
+        {u32::unicode_t::UTF_8, u32::convert(text), "\xef\xbb\xbf"},
+        {u32::unicode_t::UTF_16LE, utf16_bytes(utf16, false), "\xff\xfe"},
+        {u32::unicode_t::UTF_16BE, utf16_bytes(utf16, true), "\xfe\xff"},
+        {u32::unicode_t::UTF_32LE, utf32_bytes(text, false), std::string("\xff\xfe\0\0", 4)},
+        {u32::unicode_t::UTF_32BE, utf32_bytes(text, true), std::string("\0\0\xfe\xff", 4)},
+    };
+
+    for (const auto& s : samples)
+    {
+        assert(u32::convert(s.bytes, s.encoding) == text);
+
+        // the mark selects the encoding and is skipped
+        const auto with_bom = s.bom + s.bytes;
+        size_t bom_length {};
+        auto encoding = u32::detect_bom(with_bom.data(), with_bom.size(), &bom_length, u32::unicode_t::UTF_16BE);
+        assert(encoding == s.encoding && bom_length == s.bom.size());
+        assert(u32::convert(with_bom.substr(bom_length), encoding) == text);
+
+        // unaligned input
+        const auto shifted = "x" + s.bytes;
+        char32_t buffer[128] {};
+        auto result = u32::convert(shifted.data() + 1, s.bytes.size(), buffer, 128, s.encoding);
+        assert(result.status == u32::conversion_status::ok && result.read == s.bytes.size());
+        assert(std::u32string(buffer, result.written) == text);
+
+        // resumable with a small output buffer
+        std::u32string resumed;
+        for (size_t pos = 0; pos < s.bytes.size();)
+        {
+            char32_t small[5] {};
+            auto part = u32::convert(s.bytes.data() + pos, s.bytes.size() - pos, small, 5, s.encoding);
+            assert(part.status != u32::conversion_status::invalid_input && part.read != 0);
+            resumed.append(small, part.written);
+            pos += part.read;
+        }
+        assert(resumed == text);
+    }
+
+    size_t bom_length {1};
+    assert(u32::detect_bom("abc", 3, &bom_length) == u32::unicode_t::UTF_8 && bom_length == 0);
+    assert(u32::detect_bom("\xff\xfe", 2, &bom_length) == u32::unicode_t::UTF_16LE && bom_length == 2);
+
+    // unpaired surrogates stop like the char16_t overload, so does an incomplete unit
+    std::u16string unpaired = u"0123456789";
+    unpaired += char16_t(0xdc00);
+    unpaired += u"tail";
+    assert(u32::convert(utf16_bytes(unpaired, true), u32::unicode_t::UTF_16BE) == U"0123456789");
+    assert(u32::convert(utf16_bytes(u"ab\U0001F600", false).substr(0, 7), u32::unicode_t::UTF_16LE) == U"ab");
+
+    char32_t buffer[4] {};
+    auto result = u32::convert("a\0\0\0b", 5, buffer, 4, u32::unicode_t::UTF_32LE);
+    assert(result.read == 4 && result.written == 1 && result.status == u32::conversion_status::invalid_input);
+}
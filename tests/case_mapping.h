@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+#include <u32string_utils/u32caps.h>
+
+#include "test_random.h"
+
+inline void check_case_mapping()
+{
+    // ASCII, Latin-1 and the first and last blocks of the tables
+    assert(u32::toupper(U'a') == U'A' && u32::tolower(U'Z') == U'z');
+    assert(u32::toupper(U'@') == U'@' && u32::tolower(U'[') == U'[');
+    assert(u32::toupper(U'ÿ') == U'Ÿ' && u32::toupper(U'µ') == U'Μ' && u32::tolower(U'Ÿ') == U'ÿ');
+    assert(u32::toupper(U'ж') == U'Ж' && u32::tolower(U'Ж') == U'ж');
+    assert(u32::toupper(U'ꭰ') == U'Ꭰ' && u32::tolower(U'Ꭰ') == U'ꭰ');
+    assert(u32::toupper(U'\U0001E943') == U'\U0001E921' && u32::tolower(U'\U0001E921') == U'\U0001E943');
+    assert(u32::toupper(U'\U0001E944') == U'\U0001E944' && u32::tolower(0x10ffff) == 0x10ffff);
+    assert(u32::toupper(0xffffffff) == 0xffffffff && u32::tolower(0x110000) == 0x110000);
+
+    assert(u32::is_upper(U'Ǆ') && !u32::is_lower(U'Ǆ'));
+    assert(u32::is_upper(U'ǅ') && u32::is_lower(U'ǅ'));
+    assert(!u32::is_upper(U'1') && !u32::is_lower(U'中'));
+
+    char32_t ch = U'ß';
+    assert(!u32::toupper_case(ch) && ch == U'ß');
+    ch = U'ω';
+    assert(u32::toupper_case(ch) && ch == U'Ω' && u32::tolower_case(ch) && ch == U'ω');
+
+    // a code point with a mapping is of the other case
+    for (char32_t code = 0; code < 0x20000; ++code)
+    {
+        assert((u32::toupper(code) != code) == u32::is_lower(code));
+        assert((u32::tolower(code) != code) == u32::is_upper(code));
+    }
+
+    // bulk conversion agrees with the per character one at every position of the vector blocks
+    const char32_t samples[] {U'a', U'Z', U'@', U'[', U'`', U'{', U'µ', U'ÿ', U'×', U'÷', U'À', U'Þ', U'ß', U'à', U'þ',
+                              0xbf, 0xc0, 0xdf, 0xe0, U'ж', U'Ж', U'ǅ', U'\U0001E943', 0x110000, 0xffffffff};
+
+    test_random next(12345);
+
+    for (int round = 0; round < 2000; ++round)
+    {
+        std::u32string str(next() % 40, U'\0');
+        for (auto& ch : str)
+        {
+            ch = next() % 4 ? char32_t(next() % 0x100) : samples[next() % (sizeof(samples) / sizeof(samples[0]))];
+        }
+
+        auto upper = str;
+        auto lower = str;
+        u32::to_upper(upper);
+        u32::to_lower(lower);
+        for (size_t i = 0; i < str.size(); ++i)
+        {
+            assert(upper[i] == u32::toupper(str[i]));
+            assert(lower[i] == u32::tolower(str[i]));
+        }
+    }
+
+    std::u32string text = U"Ça m'étonne, ÿ µ ß ǅ Straße";
+    u32::to_upper(&text[0], 11);
+    assert(text == U"ÇA M'ÉTONNE, ÿ µ ß ǅ Straße");
+    u32::to_upper(text);
+    assert(text == U"ÇA M'ÉTONNE, Ÿ Μ ß Ǆ STRAßE");
+    u32::to_lower(text);
+    assert(text == U"ça m'étonne, ÿ μ ß ǆ straße");
+
+    std::u32string empty;
+    u32::to_upper(empty);
+    u32::to_lower(nullptr, 0);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cassert>
+#include <string>
+
+#include <u32string_utils/u32utils.h>
+
+inline void check_cesu8_convert()
+{
+    // BMP text is plain UTF-8, long enough for the vector paths
+    const std::u32string text = std::u32string(40, U'a') + U"Това събщение е на кирилица! 中文";
+    const auto utf8 = u32::convert(text);
+    assert(u32::convert(text, u32::cesu8) == utf8);
+    assert(u32::convert(text, u32::modified_utf8) == utf8);
+    assert(u32::convert(utf8, u32::cesu8) == text);
+    assert(u32::convert(utf8, u32::modified_utf8) == text);
+
+    // supplementary characters as two 3 byte surrogates, U+0000 as C0 80 in Modified UTF-8
+    const std::u32string mixed = std::u32string(20, U'x') + U"\U0001F600" + U'\0' + U"\U0010FFFF" + std::u32string(20, U'y');
+    const std::string cesu8 = std::string(20, 'x') + "\xed\xa0\xbd\xed\xb8\x80" + '\0' + "\xed\xaf\xbf\xed\xbf\xbf" + std::string(20, 'y');
+    const std::string modified = std::string(20, 'x') + "\xed\xa0\xbd\xed\xb8\x80\xc0\x80\xed\xaf\xbf\xed\xbf\xbf" + std::string(20, 'y');
+    assert(u32::convert(mixed, u32::cesu8) == cesu8);
+    assert(u32::convert(mixed, u32::modified_utf8) == modified);
+    assert(modified.find('\0') == std::string::npos);
+    assert(u32::convert(cesu8, u32::cesu8) == mixed);
+    assert(u32::convert(modified, u32::modified_utf8) == mixed);
+    assert(u32::convert(cesu8, u32::modified_utf8) == mixed);
+
+    // C0 80 is only NUL in Modified UTF-8, 4 byte sequences and lone surrogates decode like convert
+    assert(u32::convert(std::string("\xc0\x80"), u32::cesu8) == U"�");
+    assert(u32::convert(std::string("\xf0\x9f\x98\x80"), u32::cesu8) == U"\U0001F600");
+    assert(u32::convert(std::string("\xed\xa0\xbdz"), u32::modified_utf8) == U"�z");
+    assert(u32::convert(std::string("\xed\xb8\x80\xed\xa0\xbd"), u32::cesu8) == U"��");
+    assert(u32::convert(std::string("a\x80" "b"), u32::cesu8) == U"a");
+    assert(u32::convert(std::u32string {0x110000}, u32::cesu8) == "\xef\xbf\xbd");
+
+    // buffer forms stop before a sequence that does not fit
+    char out[8] {};
+    auto encoded = u32::convert(U"ab\U0001F600", 3, out, sizeof(out) - 1, u32::cesu8);
+    assert(encoded.status == u32::conversion_status::output_too_small && encoded.read == 2 && encoded.written == 2);
+    encoded = u32::convert(U"ab\0", 3, out, 3, u32::modified_utf8);
+    assert(encoded.status == u32::conversion_status::output_too_small && encoded.read == 2 && encoded.written == 2);
+    encoded = u32::convert(U"ab\0", 3, out, 4, u32::modified_utf8);
+    assert(encoded.status == u32::conversion_status::ok && encoded.written == 4 && std::string(out, 4) == "ab\xc0\x80");
+
+    char32_t decoded[2] {};
+    auto result = u32::convert(modified.data() + 19, 7, decoded, 2, u32::modified_utf8);
+    assert(result.status == u32::conversion_status::ok && result.read == 7 && result.written == 2);
+    assert(decoded[0] == U'x' && decoded[1] == U'\U0001F600');
+
+    // a pair cut short is a lone surrogate
+    result = u32::convert(modified.data() + 20, 5, decoded, 1, u32::modified_utf8);
+    assert(result.read == 3 && decoded[0] == 0xfffd);
+}
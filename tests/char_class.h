@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cassert>
+#include <initializer_list>
+
+#include <u32string_utils/u32caps.h>
+
+inline void check_char_class()
+{
+    assert(u32::is_alpha(U'a') && u32::is_alpha(U'Ж') && u32::is_alpha(U'中') && u32::is_alpha(U'ǅ'));
+    assert(!u32::is_alpha(U'1') && !u32::is_alpha(U' ') && !u32::is_alpha(U'€'));
+    assert(u32::is_alpha(U'\U00020000') && !u32::is_alpha(U'\U0001F600'));
+
+    // decimal and digit numeric types, not other numerics
+    assert(u32::is_digit(U'0') && u32::is_digit(U'9') && u32::is_digit(U'٣') && u32::is_digit(U'²'));
+    assert(!u32::is_digit(U'a') && !u32::is_digit(U'½') && !u32::is_digit(U'Ⅻ'));
+
+    // Zs, or bidi class B, S or WS
+    assert(u32::is_space(U' ') && u32::is_space(U'\t') && u32::is_space(U'\n') && u32::is_space(0x1f));
+    assert(u32::is_space(0xa0) && u32::is_space(0x3000) && u32::is_space(0x2029));
+    assert(!u32::is_space(U'x') && !u32::is_space(0x200b));
+
+    assert(u32::is_punctuation(U'!') && u32::is_punctuation(U'«') && u32::is_punctuation(U'。'));
+    assert(!u32::is_punctuation(U'+') && !u32::is_punctuation(U'a'));
+    assert(u32::is_other_symbol(U'©') && u32::is_other_symbol(U'\U0001F600') && !u32::is_other_symbol(U'+'));
+    assert(u32::is_currency_symbol(U'$') && u32::is_currency_symbol(U'€') && u32::is_currency_symbol(U'₹'));
+    assert(!u32::is_currency_symbol(U'%'));
+
+    // past the last code point nothing is classified
+    for (char32_t ch : {char32_t(0x110000), char32_t(0x7fffffff), char32_t(0xffffffff)})
+    {
+        assert(!u32::is_alpha(ch) && !u32::is_digit(ch) && !u32::is_space(ch) && !u32::is_punctuation(ch));
+        assert(!u32::is_other_symbol(ch) && !u32::is_currency_symbol(ch));
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cassert>
+#include <string>
+
+#include <u32string_utils/u32charset.h>
+
+inline void check_charset_convert()
+{
+    // "Привет, мир" in windows-1251 surrounded by ascii long enough for the vector paths
+    const std::string cp1251 = "ascii prefix for the block scanner: \xcf\xf0\xe8\xe2\xe5\xf2, \xec\xe8\xf0 and an ascii tail";
+    const std::u32string expected = U"ascii prefix for the block scanner: Привет, мир and an ascii tail";
+
+    auto u32_str = u32::convert(cp1251, u32::charset_t::WINDOWS_1251);
+    assert(u32_str == expected);
+    assert(u32::convert(u32_str, u32::charset_t::WINDOWS_1251) == cp1251);
+
+    assert(u32::charset_to_utf32('\xc0', u32::charset_t::WINDOWS_1251) == U'А');
+    assert(u32::utf32_to_charset(U'А', u32::charset_t::WINDOWS_1251) == '\xc0');
+    assert(u32::utf32_to_charset(U'中', u32::charset_t::WINDOWS_1251) == '\0');
+
+    // US_ASCII has no table and writes EOS for everything else, characters missing from a table are dropped
+    assert(u32::convert(std::u32string(U"a中b"), u32::charset_t::US_ASCII) == std::string("a\0b", 3));
+    assert(u32::convert(std::u32string(U"a中b"), u32::charset_t::WINDOWS_1251) == "ab");
+    assert(u32::convert(std::string("a\xe9"), u32::charset_t::US_ASCII) == std::u32string(U"a\0", 2));
+}
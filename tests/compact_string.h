@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <unordered_set>
+
+#include <u32string_utils/u32caps.h>
+#include <u32string_utils/u32compact.h>
+#include <u32string_utils/u32strlib.h>
+
+inline void check_compact_string()
+{
+    const std::u32string samples[] {
+        U"",
+        U"plain ascii",
+        U"Latin-1 café ÿ",
+        U"Това събщение е на кирилица! 中文",
+        U"astral \U0001F600 code point",
+        {0xd83d, 0xde00, U'a'},
+    };
+    const unsigned widths[] {1, 1, 1, 2, 4, 2};
+
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); ++i)
+    {
+        const auto& sample = samples[i];
+        const u32::compact_string str(sample);
+        assert(str.width() == widths[i]);
+        assert(str.size() == sample.size() && str.empty() == sample.empty());
+        assert(str.str() == sample);
+        assert(std::u32string(str.begin(), str.end()) == sample);
+        for (size_t pos = 0; pos < sample.size(); ++pos)
+        {
+            assert(str[pos] == sample[pos] && str.begin()[std::ptrdiff_t(pos)] == sample[pos]);
+        }
+
+        assert(u32::convert(str) == u32::convert(sample));
+        assert(u32::convert_to_compact(u32::convert(sample)) == u32::compact_string(u32::convert(u32::convert(sample))));
+    }
+
+    // surrogate pairs are merged across the encoding buffer
+    std::u32string pairs;
+    for (int i = 0; i < 300; ++i)
+    {
+        pairs += {0xd83d, 0xde00, U'ж'};
+    }
+    assert(u32::convert(u32::compact_string(pairs)) == u32::convert(pairs));
+
+    // decoded through a buffer, widening the code points stored before a wider one
+    const auto mixed = std::u32string(300, U'a') + std::u32string(300, U'ж') + U"\U0001F600" + std::u32string(300, U'b');
+    const auto compact = u32::convert_to_compact(u32::convert(mixed));
+    assert(compact.width() == 4 && compact.str() == mixed);
+    assert(u32::convert_to_compact(std::string(300, 'a') + "\xd0") == u32::compact_string(u32::convert(std::string(300, 'a') + "\xd0")));
+
+    // random access iterator operations
+    auto first = compact.begin();
+    auto last = compact.end();
+    assert(first < last && last > first && first <= first && first >= first && !(first > last) && !(last <= first));
+    assert(2 + first == first + 2 && *(300 + first) == U'ж' && last - first == std::ptrdiff_t(compact.size()));
+
+    // works with the code point functions
+    const u32::compact_string number(U"12345");
+    assert(std::all_of(number.begin(), number.end(), u32::is_digit));
+    assert(std::lower_bound(number.begin(), number.end(), U'3') - number.begin() == 2);
+    assert(u32::stoi(number.str()) == 12345);
+    assert(u32::toupper(u32::compact_string(U"ж")[0]) == U'Ж');
+
+    std::unordered_set<u32::compact_string> set {u32::compact_string(U"a"), u32::compact_string(U"ж")};
+    assert(set.count(u32::compact_string(U"ж")) == 1 && set.count(u32::compact_string(U"b")) == 0);
+    assert(u32::compact_string(U"ab") != u32::compact_string(U"a"));
+
+    const u32::compact_string empty;
+    assert(empty.begin() == empty.end() && empty.str().empty());
+}
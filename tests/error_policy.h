@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+#include <u32string_utils/u32utils.h>
+
+#include "test_random.h"
+
+inline void check_error_policy()
+{
+    using namespace u32::error_policy;
+    const char32_t fffd = u32::get_unicode_invalid_codepoint_char_id();
+
+    // one replacement per maximal invalid subpart
+    size_t errors {};
+    assert(u32::convert<replace>(std::string("a\xc3x"), &errors) == std::u32string({U'a', fffd, U'x'}));
+    assert(u32::convert<replace>(std::string("\xe2\x82"), &errors) == std::u32string(1, fffd));
+    assert(u32::convert<replace>(std::string("\xf0\x80\x80"), &errors) == std::u32string(3, fffd));
+    assert(u32::convert<replace>(std::string("\xed\xa0\x80z"), &errors) == std::u32string({fffd, fffd, fffd, U'z'}));
+    assert(u32::convert<replace>(std::string("\x80\xff"), &errors) == std::u32string(2, fffd));
+    assert(errors == 10);
+
+    errors = 0;
+    assert(u32::convert<skip>(std::string("a\xc3x \x80\xff b"), &errors) == U"ax  b");
+    assert(errors == 3);
+
+    // stop reports the offset validate_utf8 finds
+    {
+        const std::string str = std::string(40, 'a') + u8"Ж" + "\xe2\x82" + "tail";
+        char32_t buffer[64] {};
+        auto result = u32::convert<stop>(str.data(), str.size(), buffer, 64);
+        assert(result.status == u32::conversion_status::invalid_input);
+        assert(result.read == u32::validate_utf8(str.data(), str.size()) && result.read == 42);
+        assert(result.written == 41);
+        assert(u32::convert<stop>(str) == std::u32string(40, U'a') + U"Ж");
+    }
+
+    try
+    {
+        u32::convert<raise>(std::string("ok \xc0\xaf"));
+        assert(false);
+    }
+    catch (const u32::conversion_error& e)
+    {
+        assert(e.offset() == 3);
+    }
+
+    // all policies agree on valid input and report no errors
+    const std::string valid = std::string(30, 'x') + u8"Това събщение е на кирилица! 中文 \U0001F600";
+    errors = 0;
+    assert(u32::convert<replace>(valid, &errors) == u32::convert(valid));
+    assert(u32::convert<skip>(valid, &errors) == u32::convert(valid));
+    assert(u32::convert<stop>(valid, &errors) == u32::convert(valid));
+    assert(u32::convert<raise>(valid, &errors) == u32::convert(valid));
+    assert(u32::utf8_to_utf16<raise>(valid, &errors) == u32::utf8_to_utf16(valid));
+    assert(errors == 0);
+
+    const char* pieces[] {
+        "a", "0123456789abcdef", u8"Ж", u8"中", u8"\U0001F600", "\x80", "\xc0\xaf", "\xe0\x80\x80",
+        "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xff", "\xc3", "\xe2\x82", "\xf0\x9f\x98",
+    };
+    constexpr size_t piece_count = sizeof(pieces) / sizeof(pieces[0]);
+
+    test_random next(4321);
+
+    for (int round = 0; round < 2000; ++round)
+    {
+        std::string str;
+        auto count = next() % 30;
+        for (size_t i = 0; i < count; ++i)
+        {
+            str += pieces[next() % piece_count];
+        }
+
+        size_t replaced {}, skipped {};
+        auto with_replacements = u32::convert<replace>(str, &replaced);
+        auto without = u32::convert<skip>(str, &skipped);
+        assert(replaced == skipped);
+        assert(size_t(std::count(with_replacements.begin(), with_replacements.end(), fffd)) == replaced);
+
+        with_replacements.erase(std::remove(with_replacements.begin(), with_replacements.end(), fffd), with_replacements.end());
+        assert(with_replacements == without);
+
+        assert(u32::utf8_to_utf16<replace>(str) == u32::convert_to_u16(u32::convert<replace>(str)));
+
+        char32_t buffer[128] {};
+        auto stopped = u32::convert<stop>(str.data(), str.size(), buffer, 128);
+        assert(stopped.read == u32::validate_utf8(str.data(), str.size()));
+        assert((stopped.status == u32::conversion_status::ok) == (replaced == 0));
+    }
+
+    // unpaired utf-16 surrogates
+    std::u16string utf16 = u"ab";
+    utf16 += char16_t(0xdc00);
+    utf16 += u"\U0001F600";
+    utf16 += char16_t(0xd83d);
+
+    errors = 0;
+    assert(u32::convert<replace>(utf16, &errors) == std::u32string({U'a', U'b', fffd, U'\U0001F600', fffd}));
+    assert(u32::convert<skip>(utf16, &errors) == U"ab\U0001F600");
+    assert(u32::convert<stop>(utf16, &errors) == U"ab");
+    assert(errors == 5);
+    errors = 0;
+    assert(u32::utf16_to_utf8<replace>(utf16, &errors) == u8"ab�\U0001F600�");
+    assert(errors == 2);
+    errors = 0;
+    assert(u32::utf16_to_utf8<replace>(std::u16string(1, char16_t(0xdc00)), &errors) == u8"�");
+    assert(errors == 1);
+
+    // a replacement that does not fit is neither written nor counted
+    char bytes[4] {};
+    errors = 0;
+    auto partial = u32::utf16_to_utf8<replace>(u"a\xdc00", 2, bytes, 3, &errors);
+    assert(partial.read == 1 && partial.written == 1 && errors == 0);
+    assert(partial.status == u32::conversion_status::output_too_small);
+    assert(u32::utf16_to_utf8<skip>(std::u16string(3, char16_t(0xdfff))).empty());
+
+    try
+    {
+        u32::utf16_to_utf8<raise>(utf16);
+        assert(false);
+    }
+    catch (const u32::conversion_error& e)
+    {
+        assert(e.offset() == 2);
+    }
+}
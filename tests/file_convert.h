@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <system_error>
+
+#include <u32string_utils/u32file.h>
+
+// directory for the scratch files, taken from the environment like the C library does
+inline std::string test_temp_dir()
+{
+    for (auto name : {"TMPDIR", "TEMP", "TMP"})
+    {
+        auto dir = std::getenv(name);
+        if (dir && *dir)
+        {
+            return dir;
+        }
+    }
+#if defined(_WIN32)
+    return ".";
+#else
+    return "/tmp";
+#endif
+}
+
+inline void write_test_file(const std::string& path, const std::string& bytes)
+{
+    std::ofstream(path, std::ios::binary).write(bytes.data(), std::streamsize(bytes.size()));
+}
+
+inline std::string read_test_file(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+inline void check_file_convert()
+{
+    const auto dir = test_temp_dir();
+    const auto src = dir + "/u32_file_convert_src.tmp";
+    const auto mid = dir + "/u32_file_convert_mid.tmp";
+    const auto dst = dir + "/u32_file_convert_dst.tmp";
+
+    // larger than a mapping window, with sequences across the window and buffer ends
+    std::string text;
+    while (text.size() < (size_t(1) << 24) + 1000)
+    {
+        text += u8"Това събщение е на кирилица! 中文 \U0001F600 ascii ";
+    }
+    write_test_file(src, text);
+
+    assert(u32::convert_file(src, u32::unicode_t::UTF_8, mid, u32::unicode_t::UTF_16BE) == u32::conversion_status::ok);
+    const auto utf16 = u32::utf8_to_utf16(text);
+    const auto utf16_bytes = read_test_file(mid);
+    assert(utf16_bytes.size() == utf16.size() * 2);
+    assert(utf16_bytes[0] == char(0x04) && utf16_bytes[1] == char(0x22));
+
+    assert(u32::convert_file(mid, u32::unicode_t::UTF_16BE, dst, u32::unicode_t::UTF_32LE) == u32::conversion_status::ok);
+    assert(u32::convert_file(dst, u32::unicode_t::UTF_32LE, mid, u32::unicode_t::UTF_8) == u32::conversion_status::ok);
+    assert(read_test_file(mid) == text);
+
+    // legacy charsets
+    write_test_file(src, u8"Това събщение е на кирилица!");
+    assert(u32::convert_file(src, u32::unicode_t::UTF_8, mid, u32::charset_t::WINDOWS_1251) == u32::conversion_status::ok);
+    assert(read_test_file(mid) == u32::convert(U"Това събщение е на кирилица!", u32::charset_t::WINDOWS_1251));
+    assert(u32::convert_file(mid, u32::charset_t::WINDOWS_1251, dst, u32::unicode_t::UTF_8) == u32::conversion_status::ok);
+    assert(read_test_file(dst) == u8"Това събщение е на кирилица!");
+
+    // malformed input, everything before it is converted
+    write_test_file(src, "stops at \x80 this");
+    assert(u32::convert_file(src, u32::unicode_t::UTF_8, dst, u32::unicode_t::UTF_32BE) == u32::conversion_status::invalid_input);
+    assert(read_test_file(dst).size() == 9 * 4);
+
+    write_test_file(src, "truncated \xe2\x82");
+    assert(u32::convert_file(src, u32::unicode_t::UTF_8, dst, u32::unicode_t::UTF_8) == u32::conversion_status::invalid_input);
+    assert(read_test_file(dst) == u8"truncated �");
+
+    write_test_file(src, std::string("a\0b\0c", 5));
+    assert(u32::convert_file(src, u32::unicode_t::UTF_16LE, dst, u32::unicode_t::UTF_8) == u32::conversion_status::invalid_input);
+    assert(read_test_file(dst) == "ab");
+
+    write_test_file(src, "");
+    assert(u32::convert_file(src, u32::unicode_t::UTF_8, dst, u32::unicode_t::UTF_16LE) == u32::conversion_status::ok);
+    assert(read_test_file(dst).empty());
+
+    bool thrown = false;
+    try
+    {
+        u32::convert_file(dir + "/u32_file_convert_missing.tmp", u32::unicode_t::UTF_8, dst, u32::unicode_t::UTF_8);
+    }
+    catch (const std::system_error& e)
+    {
+        thrown = e.code() == std::errc::no_such_file_or_directory;
+    }
+    assert(thrown);
+
+    std::remove(src.c_str());
+    std::remove(mid.c_str());
+    std::remove(dst.c_str());
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cassert>
+#include <string>
+
+#include <u32string_utils/u32caps.h>
+
+inline void check_full_case_mapping()
+{
+    // SpecialCasing expansions
+    assert(u32::to_upper_full(U"Straße") == U"STRASSE");
+    assert(u32::to_upper_full(U"ŉ ǰ ΐ ﬃ և") == U"\u02bcN J\u030c \u0399\u0308\u0301 FFI \u0535\u0552");
+    assert(u32::to_upper_full(U"ᾳ ᾷ") == U"\u0391\u0399 \u0391\u0342\u0399");
+    assert(u32::to_lower_full(U"İstanbul") == U"i\u0307stanbul");
+    assert(u32::to_lower_full(U"ᾼ") == U"ᾳ");
+
+    // Final_Sigma, case-ignorable code points do not end a word
+    assert(u32::to_lower_full(U"ΟΔΥΣΣΕΥΣ") == U"οδυσσευς");
+    assert(u32::to_lower_full(U"ΣΑ Σ ΑΣ. ΑΣ'Α ΑΣ'") == U"σα σ ας. ασ'α ας'");
+    assert(u32::to_lower_full(U"ΑΣ\u0301Β ΑΣ\u0301") == U"ασ\u0301β ας\u0301");
+
+    // titlecase of the first cased code point of each word
+    assert(u32::to_title_full(U"hello wORLD, don't stop") == U"Hello World, Don't Stop");
+    assert(u32::to_title_full(U"ǆemal ﬁsh ßa ᾳ ΣΑΣ") == U"ǅemal Fish Ssa ᾼ Σας");
+    assert(u32::to_title_full(U"1st 'quoted' x-ray") == U"1St 'Quoted' X-Ray");
+    assert(u32::to_title_full(U"") == U"");
+
+    // without expansions the results agree with the simple mapping
+    std::u32string text = U"Ça m'étonne, ꭰ Ж ǅ \U0001E921 ÿ µ, a long enough text for the vector paths";
+    auto upper = text;
+    auto lower = text;
+    u32::to_upper(upper);
+    u32::to_lower(lower);
+    assert(u32::to_upper_full(text) == upper);
+    assert(u32::to_lower_full(text) == lower);
+
+    // the buffer form writes at most full_case_capacity code points
+    const std::u32string ligatures(10, U'ﬃ');
+    std::u32string out(u32::full_case_capacity(ligatures.size()), U'\0');
+    assert(u32::to_upper_full(ligatures.data(), ligatures.size(), &out[0]) == out.size());
+    assert(out == u32::to_upper_full(ligatures) && out.substr(0, 3) == U"FFI");
+
+    // the string forms do not keep the room for expansions that did not happen
+    const std::u32string words = U"Straße " + std::u32string(200, U'a');
+    assert(u32::to_upper_full(words).capacity() < words.size() + 8);
+    assert(u32::to_lower_full(text).capacity() < text.size() + 8);
+    assert(u32::to_title_full(words).capacity() < words.size() + 8);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+#include <u32string_utils/u32parallel.h>
+
+#include "test_random.h"
+
+inline void check_parallel_convert()
+{
+    const char* pieces[] {
+        "plain ascii text ", u8"Това събщение е на кирилица! ", u8"中文", u8"\U0001F600", "\xc3x", "\xe2\x82",
+        "\xc0\xaf", "\xf0\x9f\x98", "\xf4\x90\x80\x80",
+    };
+    constexpr size_t piece_count = sizeof(pieces) / sizeof(pieces[0]);
+    constexpr size_t valid_pieces = 4;
+
+    test_random next(2024);
+
+    for (int round = 0; round < 40; ++round)
+    {
+        // mostly valid text, a third of the rounds end at a byte that stops the decoder
+        std::string str;
+        auto size = 500 + next() % 3000;
+        while (str.size() < size)
+        {
+            str += pieces[next() % 8 ? next() % valid_pieces : next() % piece_count];
+        }
+
+        if (round % 3 == 0)
+        {
+            str.insert(next() % str.size(), 1, '\x80');
+        }
+
+        u32::parallel_options options;
+        options.thread_count = 1 + round % 8;
+        options.min_chunk_size = 1 + next() % 200;
+        assert(u32::convert_parallel(str, options) == u32::convert(str));
+
+        // chunks run by the caller's executor, in reverse order
+        options.executor = [](size_t task_count, const std::function<void(size_t)>& task) {
+            for (auto i = task_count; i != 0; --i)
+            {
+                task(i - 1);
+            }
+        };
+        assert(u32::convert_parallel(str, options) == u32::convert(str));
+    }
+
+    assert(u32::convert_parallel("").empty());
+    assert(u32::convert_parallel(u8"small inputs convert serially: Ж") == U"small inputs convert serially: Ж");
+}
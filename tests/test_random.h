@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+// Linear congruential generator for the randomized tests, a fixed seed gives the same
+// input on every platform and run.
+class test_random
+{
+public:
+    explicit test_random(uint32_t seed)
+        : seed_(seed)
+    {
+    }
+
+    // next value in [0, 0x7fff]
+    uint32_t operator()()
+    {
+        seed_ = seed_ * 1103515245u + 12345u;
+        return (seed_ >> 16) & 0x7fff;
+    }
+
+private:
+    uint32_t seed_;
+};
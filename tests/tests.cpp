@@ -4,6 +4,26 @@
 
 #include "atoX_real.h"
 
+#include "utf8_convert.h"
+#include "charset_convert.h"
+#include "buffer_convert.h"
+#include "utf8_decoder.h"
+#include "utf8_validate.h"
+#include "utf_length.h"
+#include "utf16_convert.h"
+#include "error_policy.h"
+#include "utf8_view.h"
+#include "utf8_offset_index.h"
+#include "parallel_convert.h"
+#include "file_convert.h"
+#include "byte_stream_decode.h"
+#include "compact_string.h"
+#include "wtf8_convert.h"
+#include "cesu8_convert.h"
+#include "case_mapping.h"
+#include "char_class.h"
+#include "full_case_mapping.h"
+
 int main()
 {
     // check atoX
@@ -32,5 +52,62 @@ int main()
     // check atoX
     check_atoX_real<double>(u32::atof);
 
+    // check utf-8 decoding
+    check_utf8_convert();
+
+    // check legacy charsets
+    check_charset_convert();
+
+    // check conversions into caller-provided buffers
+    check_buffer_convert();
+
+    // check chunked utf-8 decoding
+    check_utf8_decoder();
+
+    // check utf-8 validation
+    check_utf8_validate();
+
+    // check output size queries
+    check_utf_length();
+
+    // check utf-16 conversion
+    check_utf16_convert();
+
+    // check decoder error policies
+    check_error_policy();
+
+    // check utf-8 code point iteration
+    check_utf8_view();
+
+    // check code point <-> byte offset index
+    check_utf8_offset_index();
+
+    // check multi-threaded decoding
+    check_parallel_convert();
+
+    // check file transcoding
+    check_file_convert();
+
+    // check utf-16/utf-32 byte stream decoding
+    check_byte_stream_decode();
+
+    // check compact strings
+    check_compact_string();
+
+    // check wtf-8 conversion
+    check_wtf8_convert();
+
+    // check cesu-8 and modified utf-8 conversion
+    check_cesu8_convert();
+
+    // check case mapping
+    check_case_mapping();
+
+    // check character classification
+    check_char_class();
+
+    // check full case mapping
+    check_full_case_mapping();
+
     return 0;
 }
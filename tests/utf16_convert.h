@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cassert>
+#include <string>
+
+#include <u32string_utils/u32utils.h>
+
+inline void check_utf16_convert()
+{
+    const std::u16string utf16 = std::u16string(20, u'a') + u"Това събщение е на кирилица! 中文 \U0001F600\U0010FFFF" + std::u16string(20, u'b');
+    const std::u32string utf32 = std::u32string(20, U'a') + U"Това събщение е на кирилица! 中文 \U0001F600\U0010FFFF" + std::u32string(20, U'b');
+
+    assert(u32::convert(utf16) == utf32);
+    assert(u32::convert_to_u16(utf32) == utf16);
+
+    // per character conversion gives the same result
+    std::u16string per_char;
+    for (auto ch : utf32)
+    {
+        per_char += u32::u32_to_utf16(ch);
+    }
+    assert(per_char == utf16);
+
+    {
+        char16_t buffer[2] {};
+        assert(u32::encode_utf16(U'\U0010FFFF', buffer) == 2 && buffer[0] == 0xdbff && buffer[1] == 0xdfff);
+        assert(u32::encode_utf16(0xdc00, buffer) == 1 && buffer[0] == 0xdc00);
+        assert(u32::encode_utf16(0x110000, buffer) == 0);
+        assert(u32::u32_to_utf16(0x110000).empty());
+    }
+
+    // decoding stops at an unpaired surrogate, like utf16_to_u32
+    std::u16string unpaired = u"0123456789";
+    unpaired += char16_t(0xdc00);
+    unpaired += u"tail";
+    assert(u32::convert(unpaired) == U"0123456789");
+
+    std::u16string trailing_high = u"ab";
+    trailing_high += char16_t(0xd83d);
+    assert(u32::convert(trailing_high) == U"ab");
+
+    {
+        char16_t buffer[3] {};
+        auto result = u32::convert(U"ab\U0001F600", 3, buffer, 3);
+        assert(result.read == 2 && result.written == 2);
+        assert(result.status == u32::conversion_status::output_too_small);
+    }
+
+    // direct utf-8 <-> utf-16
+    const auto utf8 = u32::convert(utf32);
+    assert(u32::utf8_to_utf16(utf8) == utf16);
+    assert(u32::utf16_to_utf8(utf16) == utf8);
+    assert(u32::utf8_length_in_utf16(utf8.data(), utf8.size()) == utf16.size());
+    assert(u32::utf16_length_in_utf8(utf16.data(), utf16.size()) == utf8.size());
+
+    for (const std::string invalid : {"\xc3x \xe2\x82", "ok \xed\xa0\x80 \x80 stop"})
+    {
+        assert(u32::utf8_to_utf16(invalid) == u32::convert_to_u16(u32::convert(invalid)));
+    }
+    assert(u32::utf16_to_utf8(unpaired) == "0123456789");
+
+    {
+        char buffer[5] {};
+        auto result = u32::utf16_to_utf8(u"abc\U0001F600", 5, buffer, 5);
+        assert(result.read == 3 && result.written == 3);
+        assert(result.status == u32::conversion_status::output_too_small);
+    }
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <cassert>
+#include <string>
+
+#include <u32string_utils/u32utils.h>
+
+inline std::u32string utf8_reference_decode(const std::string& str)
+{
+    std::u32string result {};
+    size_t move {};
+    while (move < str.size())
+    {
+        char32_t out {};
+        auto readed = u32::utf8_to_u32(&out, str.data() + move, str.data() + str.size());
+        if (readed == 0)
+        {
+            break;
+        }
+
+        move += readed;
+        result.push_back(out);
+    }
+    return result;
+}
+
+inline std::string utf8_reference_encode(const std::u32string& str)
+{
+    std::string out;
+    char32_t codepoint = 0;
+    for (auto ch : str)
+    {
+        if (ch >= 0xd800 && ch <= 0xdbff)
+        {
+            codepoint = ((ch - 0xd800) << 10) + 0x10000;
+            continue;
+        }
+
+        codepoint = (ch >= 0xdc00 && ch <= 0xdfff) ? codepoint | (ch - 0xdc00) : ch;
+        if (codepoint <= 0x7f)
+        {
+            out.append(1, static_cast<char>(codepoint));
+        }
+        else if (codepoint <= 0x7ff)
+        {
+            out.append(1, static_cast<char>(0xc0 | ((codepoint >> 6) & 0x1f)));
+            out.append(1, static_cast<char>(0x80 | (codepoint & 0x3f)));
+        }
+        else if (codepoint <= 0xffff)
+        {
+            out.append(1, static_cast<char>(0xe0 | ((codepoint >> 12) & 0x0f)));
+            out.append(1, static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+            out.append(1, static_cast<char>(0x80 | (codepoint & 0x3f)));
+        }
+        else
+        {
+            out.append(1, static_cast<char>(0xf0 | ((codepoint >> 18) & 0x07)));
+            out.append(1, static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f)));
+            out.append(1, static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
+            out.append(1, static_cast<char>(0x80 | (codepoint & 0x3f)));
+        }
+        codepoint = 0;
+    }
+    return out;
+}
+
+// first byte of the encoded code point, evaluated at compile time below
+inline constexpr unsigned encoded_utf8_lead(char32_t ch)
+{
+    char buffer[4] {};
+    return u32::encode_utf8(ch, buffer) ? static_cast<unsigned char>(buffer[0]) : 0;
+}
+
+static_assert(encoded_utf8_lead(U'a') == 'a', "");
+static_assert(encoded_utf8_lead(U'Ж') == 0xd0, "");
+static_assert(encoded_utf8_lead(U'\U0001F600') == 0xf0, "");
+static_assert(encoded_utf8_lead(0xdc00) == 0, "");
+
+// per character decoding and literals at compile time
+inline constexpr char32_t decoded_utf8(const char* str)
+{
+    char32_t ch {};
+    u32::utf8_to_u32(&ch, str, nullptr);
+    return ch;
+}
+
+static_assert(decoded_utf8(u8"Ж") == U'Ж', "");
+static_assert(decoded_utf8("\xc0\xaf") == 0xfffd, "");
+static_assert(u32::decode_literal(u8"ключ").size == 4 && u32::decode_literal(u8"ключ").data[3] == U'ч', "");
+static_assert(u32::decode_literal(u"a\U0001F600").size == 2 && u32::decode_literal(u"a\U0001F600").data[1] == U'\U0001F600', "");
+static_assert(u32::decode_literal("stops \x80 here").size == 6, "");
+
+inline void check_utf8_convert()
+{
+    const std::string samples[] {
+        "",
+        "plain ascii",
+        u8"Това събщение е на кирилица!",
+        u8"mixed é中\U0001F600 text with a long enough ascii tail to hit the vector loops",
+        "\xc3",                         // truncated 2 byte sequence
+        "\xe2\x82",                     // truncated 3 byte sequence
+        "\xc0\xaf overlong",
+        "\xed\xa0\x80 surrogate",
+        "\xf4\x90\x80\x80 too big",
+        "\xf5\x80\x80\x80 bad lead",
+        "\xc3x consumed ascii",
+        "stops at \x80 continuation byte",
+        "stops at \xff invalid lead",
+    };
+
+    for (const auto& sample : samples)
+    {
+        assert(u32::convert(sample) == utf8_reference_decode(sample));
+    }
+
+    // non-ASCII bytes at every position of the vector blocks
+    for (size_t len = 1; len < 80; ++len)
+    {
+        for (size_t pos = 0; pos < len; pos += 3)
+        {
+            std::string str(len, 'a');
+            str.insert(pos, u8"Ж");
+            assert(u32::convert(str) == utf8_reference_decode(str));
+
+            str[pos] = '\x80';
+            assert(u32::convert(str) == utf8_reference_decode(str));
+        }
+    }
+
+    // utf-32 -> utf-8, including the surrogate merging of the encoder
+    const std::u32string u32_samples[] {
+        U"",
+        U"plain ascii that is long enough to use the vector paths of the encoder",
+        U"Това събщение е на кирилица!",
+        U"mixed é中\U0001F600 text",
+        {0xd83d, 0xde00, U'a'},
+        {0xdc41, U'b', 0xd800},
+        {0xd800, U'c', 0xd801, 0xd802, 0xdc00},
+        {0x110000, 0xffffffff, 0x7ff, 0x800, 0xffff, 0x10000},
+    };
+
+    for (const auto& sample : u32_samples)
+    {
+        assert(u32::convert(sample) == utf8_reference_encode(sample));
+        for (size_t pos = 0; pos <= 40; ++pos)
+        {
+            std::u32string str(40, U'x');
+            str.insert(pos, sample);
+            assert(u32::convert(str) == utf8_reference_encode(str));
+        }
+    }
+
+    assert(u32::decode_literal(u8"mixed é中\U0001F600").str() == u32::convert(std::string(u8"mixed é中\U0001F600")));
+    assert(u32::u32_to_utf8(U'Ж') == u8"Ж");
+    assert(u32::u32_to_utf8(0xd800).empty());
+    assert(u32::u32_to_utf8(0xdfff).empty());
+    assert(u32::u32_to_utf8(0x110000).empty());
+
+    // the single code point encoder agrees with the bulk one on scalar values
+    for (char32_t ch : {0x0u, 0x7fu, 0x80u, 0x7ffu, 0x800u, 0xd7ffu, 0xe000u, 0xfffdu, 0xffffu, 0x10000u, 0x10ffffu})
+    {
+        char buffer[4] {};
+        auto len = u32::encode_utf8(ch, buffer);
+        assert(std::string(buffer, len) == u32::convert(std::u32string(1, ch)));
+        assert(u32::u32_to_utf8(ch) == std::string(buffer, len));
+    }
+}
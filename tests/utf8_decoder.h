@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+#include <u32string_utils/u32utils.h>
+
+inline std::u32string decode_in_chunks(const std::string& str, size_t chunk)
+{
+    u32::utf8_decoder decoder;
+    std::u32string out;
+    for (size_t pos = 0; pos < str.size(); pos += chunk)
+    {
+        auto status = decoder.feed(str.data() + pos, std::min(chunk, str.size() - pos), out);
+        if (status == u32::conversion_status::invalid_input)
+        {
+            return out;
+        }
+        assert(status == u32::conversion_status::ok);
+    }
+
+    decoder.finish(out);
+    assert(!decoder.has_pending());
+    return out;
+}
+
+inline void check_utf8_decoder()
+{
+    const std::string samples[] {
+        u8"Това събщение е на кирилица! 中文 \U0001F600 and some ascii",
+        "\xc3x consumed ascii \xe2\x82",
+        "truncated tail \xf0\x9f\x98",
+        "overlong \xc0\xaf and surrogate \xed\xa0\x80",
+        "stray \x80 continuation",
+    };
+
+    for (const auto& sample : samples)
+    {
+        for (size_t chunk = 1; chunk <= sample.size(); ++chunk)
+        {
+            assert(decode_in_chunks(sample, chunk) == u32::convert(sample));
+        }
+    }
+
+    {
+        u32::utf8_decoder decoder;
+        std::u32string out;
+        assert(decoder.feed("a\xd0", 2, out) == u32::conversion_status::ok);
+        assert(out == U"a" && decoder.has_pending());
+        assert(decoder.feed("\x96", 1, out) == u32::conversion_status::ok);
+        assert(out == U"aЖ" && !decoder.has_pending());
+
+        assert(decoder.feed("\xe4\xb8", 2, out) == u32::conversion_status::ok);
+        assert(decoder.finish(out) == u32::conversion_status::invalid_input);
+        assert(out == U"aЖ�");
+    }
+
+    {
+        // sink receiving blocks of decoded code points
+        u32::utf8_decoder decoder;
+        std::string text(1000, 'x');
+        text += u8"Ж";
+        size_t count {};
+        auto status = decoder.feed(text.data(), text.size(), [&count](const char32_t*, size_t n) { count += n; });
+        assert(status == u32::conversion_status::ok);
+        assert(count == 1001);
+    }
+}
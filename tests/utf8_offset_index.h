@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <u32string_utils/u32utils.h>
+
+#include "test_random.h"
+
+inline void check_utf8_offset_index()
+{
+    const char* pieces[] {
+        "a", "0123456789abcdef0123456789abcdef", u8"Ж", u8"中", u8"\U0001F600", "\x80", "\xc3",
+    };
+    constexpr size_t piece_count = sizeof(pieces) / sizeof(pieces[0]);
+
+    test_random next(99);
+
+    for (size_t stride : {1, 3, 32, 100})
+    {
+        std::string text;
+        while (text.size() < 3000)
+        {
+            text += pieces[next() % piece_count];
+        }
+
+        // reference: offsets of the bytes that are not continuation bytes
+        std::vector<size_t> starts;
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            if ((static_cast<uint8_t>(text[i]) & 0xc0) != 0x80)
+            {
+                starts.push_back(i);
+            }
+        }
+
+        // appended in uneven chunks, splitting sequences
+        u32::utf8_offset_index index(stride);
+        for (size_t pos = 0; pos < text.size();)
+        {
+            auto len = std::min<size_t>(next() % 70, text.size() - pos);
+            index.append(text.data() + pos, len);
+            pos += len;
+        }
+
+        const u32::utf8_offset_index whole(text.data(), text.size(), stride);
+        assert(index.size() == text.size() && whole.size() == text.size());
+        assert(index.codepoints() == starts.size() && whole.codepoints() == starts.size());
+
+        for (size_t n = 0; n < starts.size(); ++n)
+        {
+            assert(index.byte_offset(text.data(), n) == starts[n]);
+            assert(whole.byte_offset(text.data(), n) == starts[n]);
+        }
+        assert(index.byte_offset(text.data(), starts.size()) == text.size());
+
+        size_t before {};
+        for (size_t offset = 0; offset <= text.size(); ++offset)
+        {
+            assert(index.codepoint_index(text.data(), offset) == before);
+            if (offset < text.size() && (static_cast<uint8_t>(text[offset]) & 0xc0) != 0x80)
+            {
+                ++before;
+            }
+        }
+    }
+
+    u32::utf8_offset_index empty;
+    assert(empty.byte_offset("", 0) == 0 && empty.codepoint_index("", 0) == 0);
+}
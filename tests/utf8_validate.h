@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+#include <u32string_utils/u32utils.h>
+
+#include "test_random.h"
+
+// first byte for which utf8_to_u32 substitutes U+FFFD or stops
+inline size_t utf8_reference_validate(const std::string& str)
+{
+    size_t pos {};
+    while (pos < str.size())
+    {
+        char32_t out {};
+        auto readed = u32::utf8_to_u32(&out, str.data() + pos, str.data() + str.size());
+        if (readed == 0)
+        {
+            return pos;
+        }
+
+        if (out == u32::get_unicode_invalid_codepoint_char_id() && str.compare(pos, 3, "\xef\xbf\xbd") != 0)
+        {
+            return pos;
+        }
+        pos += readed;
+    }
+    return str.size();
+}
+
+inline void check_utf8_validate()
+{
+    const char* pieces[] {
+        "a", "0123456789abcdef", u8"Ж", u8"中", u8"\U0001F600", u8"�", u8"\U0010FFFF",
+        "\x80", "\xc0\xaf", "\xc1\xbf", "\xe0\x80\x80", "\xed\xa0\x80", "\xf0\x80\x80\x80",
+        "\xf4\x90\x80\x80", "\xf5\x80\x80\x80", "\xff", "\xc3", "\xe2\x82", "\xf0\x9f\x98",
+    };
+    constexpr size_t valid_pieces = 7;
+    constexpr size_t piece_count = sizeof(pieces) / sizeof(pieces[0]);
+
+    test_random next(12345);
+
+    for (int round = 0; round < 3000; ++round)
+    {
+        std::string str;
+        auto count = next() % 40;
+        for (size_t i = 0; i < count; ++i)
+        {
+            // mostly valid text with an occasional error
+            auto idx = next() % 16 ? next() % valid_pieces : next() % piece_count;
+            str += pieces[idx];
+        }
+        assert(u32::validate_utf8(str.data(), str.size()) == utf8_reference_validate(str));
+    }
+
+    assert(u32::validate_utf8("", 0) == 0);
+    const std::string long_valid = std::string(100, 'x') + u8"Това събщение е на кирилица!" + std::string(100, 'y');
+    assert(u32::validate_utf8(long_valid.data(), long_valid.size()) == long_valid.size());
+}
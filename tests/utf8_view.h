@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+#include <u32string_utils/u32utf8view.h>
+#include <u32string_utils/u32utils.h>
+
+#include "test_random.h"
+
+inline void check_utf8_view()
+{
+    const std::string text = u8"Това събщение е на кирилица! 中文 \U0001F600";
+    u32::utf8_view view(text);
+
+    assert(std::u32string(view.begin(), view.end()) == u32::convert(text));
+    assert(size_t(std::distance(view.begin(), view.end())) == u32::utf8_length_in_codepoints(text.data(), text.size()));
+
+    std::u32string reversed(view.rbegin(), view.rend());
+    assert(std::u32string(reversed.rbegin(), reversed.rend()) == u32::convert(text));
+
+    // base() gives the byte offsets of the code points
+    auto it = view.begin();
+    std::advance(it, 4);
+    assert(*it == U' ' && it.base() == text.data() + 8);
+    assert(*--it == U'а' && it.base() == text.data() + 6);
+
+    assert(u32::utf8_view().begin() == u32::utf8_view().end());
+
+    const char* pieces[] {
+        "a", "0123456789abcdef", u8"Ж", u8"中", u8"\U0001F600", "\x80", "\xbf\xbf", "\xc0\xaf", "\xe0\x80\x80",
+        "\xed\xa0\x80", "\xf4\x90\x80\x80", "\xff", "\xc3", "\xe2\x82", "\xf0\x9f\x98",
+    };
+    constexpr size_t piece_count = sizeof(pieces) / sizeof(pieces[0]);
+
+    test_random next(777);
+
+    // both directions split malformed text on the same boundaries as the replace policy
+    for (int round = 0; round < 2000; ++round)
+    {
+        std::string str;
+        auto count = next() % 20;
+        for (size_t i = 0; i < count; ++i)
+        {
+            str += pieces[next() % piece_count];
+        }
+
+        u32::utf8_view fuzz(str);
+        const auto expected = u32::convert<u32::error_policy::replace>(str);
+        assert(std::u32string(fuzz.begin(), fuzz.end()) == expected);
+
+        std::u32string backwards(fuzz.rbegin(), fuzz.rend());
+        assert(std::u32string(backwards.rbegin(), backwards.rend()) == expected);
+
+        // a view starting inside a sequence
+        if (!str.empty())
+        {
+            u32::utf8_view tail(str.data() + 1, str.size() - 1);
+            std::u32string tail_backwards(tail.rbegin(), tail.rend());
+            assert(std::u32string(tail_backwards.rbegin(), tail_backwards.rend()) == std::u32string(tail.begin(), tail.end()));
+        }
+    }
+}
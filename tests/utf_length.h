@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cassert>
+#include <string>
+
+#include <u32string_utils/u32utils.h>
+
+inline void check_utf_length()
+{
+    const std::string utf8 = std::string(70, 'a') + u8"Това събщение е на кирилица! 中文 \U0001F600" + std::string(40, 'b');
+    const auto utf32 = u32::convert(utf8);
+    const std::u16string utf16 = std::u16string(70, u'a') + u"Това събщение е на кирилица! 中文 \U0001F600" + std::u16string(40, u'b');
+
+    assert(u32::utf8_length_in_codepoints(utf8.data(), utf8.size()) == utf32.size());
+    assert(u32::utf32_length_in_utf8(utf32.data(), utf32.size()) == utf8.size());
+    assert(u32::utf32_length_in_utf16(utf32.data(), utf32.size()) == utf16.size());
+    assert(u32::utf16_length_in_codepoints(utf16.data(), utf16.size()) == utf32.size());
+
+    assert(u32::utf8_length_in_codepoints("", 0) == 0);
+    assert(u32::get_utf8_char_len(u8"\U0001F600") == 4);
+    assert(u32::get_utf8_char_len("\x80") == 0);
+
+    const std::string invalid = "\xc3x \xe2\x82 \x80";
+    assert(u32::utf8_length_in_codepoints(invalid.data(), invalid.size()) >= u32::convert(invalid).size());
+}
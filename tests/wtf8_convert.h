@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+#include <u32string_utils/u32utils.h>
+
+#include "test_random.h"
+
+inline void check_wtf8_convert()
+{
+    // well-formed text encodes and decodes as UTF-8
+    const std::u32string text = std::u32string(20, U'a') + U"Това събщение е на кирилица! 中文 \U0001F600";
+    const auto utf8 = u32::convert(text);
+    assert(u32::convert(text, u32::wtf8) == utf8);
+    assert(u32::convert(utf8, u32::wtf8) == text);
+    assert(u32::utf8_to_utf16(utf8, u32::wtf8) == u32::utf8_to_utf16(utf8));
+    assert(u32::utf16_to_utf8(u32::utf8_to_utf16(utf8), u32::wtf8) == utf8);
+
+    // unpaired surrogates get their 3 byte form, pairs are still merged
+    assert(u32::convert(std::u32string {0xd800}, u32::wtf8) == "\xed\xa0\x80");
+    assert(u32::convert(std::u32string {U'x', 0xdfff, 0xd83d, 0xde00}, u32::wtf8) == "x\xed\xbf\xbf\xf0\x9f\x98\x80");
+    assert(u32::convert(std::string("\xed\xa0\x80z"), u32::wtf8) == std::u32string({0xd800, U'z'}));
+    assert(u32::convert(std::string("\xed\xa0\x80z")) == U"�z");
+
+    std::u16string name = u"file";
+    name += char16_t(0xdc00);
+    name += u".txt";
+    assert(u32::utf16_to_utf8(name, u32::wtf8) == "file\xed\xb0\x80.txt");
+    assert(u32::utf16_to_utf8(name) == "file");
+
+    const char16_t units[] {u'a', u'Ж', 0xd800, 0xdbff, 0xdc00, 0xdfff, 0xd83d, 0xde00};
+    const char32_t codepoints[] {U'a', U'Ж', 0xd800, 0xdfff, U'\U0001F600', 0xfffd};
+
+    test_random next(31337);
+
+    for (int round = 0; round < 1000; ++round)
+    {
+        // any UTF-16 unit sequence survives the round trip
+        std::u16string utf16;
+        std::u32string utf32;
+        auto count = next() % 40;
+        for (size_t i = 0; i < count; ++i)
+        {
+            utf16 += units[next() % (sizeof(units) / sizeof(units[0]))];
+
+            // high followed by low would be merged into one code point
+            auto ch = codepoints[next() % (sizeof(codepoints) / sizeof(codepoints[0]))];
+            if (!(ch >= 0xdc00 && ch <= 0xdfff && !utf32.empty() && utf32.back() >= 0xd800 && utf32.back() <= 0xdbff))
+            {
+                utf32 += ch;
+            }
+        }
+
+        const auto wtf8 = u32::utf16_to_utf8(utf16, u32::wtf8);
+        assert(u32::utf8_to_utf16(wtf8, u32::wtf8) == utf16);
+        assert(u32::convert(u32::convert(utf32, u32::wtf8), u32::wtf8) == utf32);
+    }
+}
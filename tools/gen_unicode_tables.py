@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+"""Regenerates the Unicode tables of u32string_utils/u32caps.cpp from the Unicode Character Database.
+
+    python3 tools/gen_unicode_tables.py UCD_DIR [u32string_utils/u32caps.cpp]
+
+UCD_DIR holds the files of the wanted Unicode version from https://www.unicode.org/Public/<version>/ucd/:
+
+    UnicodeData.txt                 simple case mappings, general category
+    SpecialCasing.txt               full case mappings and the context rules of the language-independent ones
+    extracted/DerivedBidiClass.txt  bidi class, including the defaults of unassigned code points
+
+Every table sits between a "begin generated <name>" and an "end generated <name>" comment in
+u32caps.cpp. Only those lines are rewritten, the rest of the file is kept as it is.
+"""
+
+import os
+import re
+import sys
+
+CODE_POINTS = 0x110000
+
+# case mappings: rows of deltas for blocks of 1 << CASE_BLOCK_SHIFT code points
+CASE_BLOCK_SHIFT = 5
+
+# properties: rows of values for blocks of 1 << PROPERTY_BLOCK_SHIFT code points
+PROPERTY_BLOCK_SHIFT = 7
+
+# the general_category bit positions and bidi_class enumerators of u32caps.cpp, in order
+GENERAL_CATEGORIES = ["None", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd", "Nl", "No", "Pc", "Pd", "Ps", "Pe",
+                      "Pi", "Pf", "Po", "Sm", "Sc", "Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co", "Cn"]
+BIDI_CLASSES = ["None", "L", "R", "AL", "EN", "ES", "ET", "AN", "CS", "NSM", "BN", "B", "S", "WS", "ON", "LRE", "LRO",
+                "RLE", "RLO", "PDF", "LRI", "RLI", "FSI", "PDI"]
+
+
+def read_unicode_data(ucd_dir):
+    """Fields of UnicodeData.txt per code point, the First/Last ranges expanded."""
+    entries = {}
+    first = None
+    with open(os.path.join(ucd_dir, "UnicodeData.txt"), encoding="utf-8") as data:
+        for line in data:
+            fields = line.rstrip("\n").split(";")
+            if len(fields) < 15:
+                continue
+
+            code = int(fields[0], 16)
+            if fields[1].endswith(", First>"):
+                first = code
+                continue
+
+            if fields[1].endswith(", Last>"):
+                for ch in range(first, code + 1):
+                    entries[ch] = fields
+                first = None
+                continue
+
+            entries[code] = fields
+    return entries
+
+
+def read_ranges(path):
+    """(first, last, value) of each data line of a UCD property file."""
+    ranges = []
+    with open(path, encoding="utf-8") as data:
+        for line in data:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+
+            code_points, value = (field.strip() for field in line.split(";")[:2])
+            first, _, last = code_points.partition("..")
+            ranges.append((int(first, 16), int(last or first, 16), value))
+    return ranges
+
+
+def find_ucd_file(ucd_dir, name):
+    for path in (os.path.join(ucd_dir, "extracted", name), os.path.join(ucd_dir, name)):
+        if os.path.exists(path):
+            return path
+    sys.exit("%s not found in %s" % (name, ucd_dir))
+
+
+def read_special_casing(ucd_dir):
+    """The unconditional full mappings of SpecialCasing.txt as code point -> (lower, title, upper),
+    and the code points with a context rule that applies to every language."""
+    mappings = {}
+    context = set()
+    with open(os.path.join(ucd_dir, "SpecialCasing.txt"), encoding="utf-8") as data:
+        for line in data:
+            fields = [field.strip() for field in line.split("#", 1)[0].split(";")]
+            if len(fields) < 5:
+                continue
+
+            ch = int(fields[0], 16)
+            conditions = fields[4].split()
+            if not conditions:
+                mappings[ch] = tuple([int(unit, 16) for unit in field.split()] for field in fields[1:4])
+            elif not any(condition.islower() for condition in conditions):
+                # language tags are lowercase, the context names are not
+                context.add(ch)
+    return mappings, context
+
+
+def simple_mappings(entries, field):
+    """Code point -> simple case mapping, only for the ones that change."""
+    mappings = {}
+    for ch, fields in entries.items():
+        if fields[field]:
+            mapped = int(fields[field], 16)
+            if mapped != ch:
+                mappings[ch] = mapped
+    return mappings
+
+
+def two_stage(values, shift, size):
+    """Splits values[0, size) into blocks of 1 << shift and stores equal blocks once.
+    Returns the row index of each block and the rows in order of first use."""
+    rows = []
+    row_index = {}
+    blocks = []
+    for start in range(0, size, 1 << shift):
+        row = tuple(values[start:start + (1 << shift)])
+        if row not in row_index:
+            row_index[row] = len(rows)
+            rows.append(row)
+        blocks.append(row_index[row])
+    return blocks, rows
+
+
+def format_list(values, per_line, fmt, indent):
+    lines = []
+    for start in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(fmt % value for value in values[start:start + per_line]) + ",")
+    return lines
+
+
+def format_blocks(name, blocks):
+    assert max(blocks) < 0x100, name + " has too many rows for uint8_t"
+    lines = ["        constexpr uint8_t %s[]" % name, "        {"]
+    lines += format_list(blocks, 16, "0x%02x", " " * 12)
+    lines.append("        };")
+    return lines
+
+
+def format_rows(declaration, rows, per_line):
+    lines = ["        " + declaration, "        {"]
+    for row in rows:
+        lines.append("            {")
+        lines += format_list(row, per_line, "%d", " " * 16)
+        lines.append("            },")
+    lines.append("        };")
+    return lines
+
+
+def case_table(name, mappings):
+    deltas = [0] * CODE_POINTS
+    for ch, mapped in mappings.items():
+        deltas[ch] = mapped - ch
+
+    # code points after the last block with a mapping map to themselves
+    size = ((max(mappings) >> CASE_BLOCK_SHIFT) + 1) << CASE_BLOCK_SHIFT
+    blocks, rows = two_stage(deltas, CASE_BLOCK_SHIFT, size)
+    return (format_blocks(name + "_blocks", blocks) + [""]
+            + format_rows("constexpr int32_t %s_deltas[][case_block_size]" % name, rows, 8))
+
+
+def property_table(name, values):
+    blocks, rows = two_stage(values, PROPERTY_BLOCK_SHIFT, CODE_POINTS)
+    return (format_blocks(name + "_blocks", blocks) + [""]
+            + format_rows("constexpr uint8_t %s_values[][property_block_size]" % name, rows, 32))
+
+
+def general_categories(entries):
+    """Bit position of each code point's category, unassigned ones are Cn."""
+    values = [GENERAL_CATEGORIES.index("Cn")] * CODE_POINTS
+    for ch, fields in entries.items():
+        values[ch] = GENERAL_CATEGORIES.index(fields[2])
+    return values
+
+
+def bidi_classes(ucd_dir):
+    """Enumerator of each code point's bidi class. Code points missing from the file, the
+    unassigned ones that default to L, are None like values past U+10FFFF."""
+    values = [0] * CODE_POINTS
+    for first, last, value in read_ranges(find_ucd_file(ucd_dir, "DerivedBidiClass.txt")):
+        values[first:last + 1] = [BIDI_CLASSES.index(value)] * (last + 1 - first)
+    return values
+
+
+def special_casings(entries, ucd_dir):
+    """The special_casings entries and the code points whose bit is set in special_casing_bits."""
+    full, context = read_special_casing(ucd_dir)
+
+    def simple(ch, field):
+        fields = entries.get(ch)
+        return [int(fields[field], 16)] if fields and fields[field] else [ch]
+
+    casings = {}
+    for ch in entries:
+        lower, upper, title = simple(ch, 13), simple(ch, 12), simple(ch, 14)
+        if ch in full:
+            lower, title, upper = full[ch]
+        elif title == upper:
+            continue
+        casings[ch] = (lower, upper, title)
+
+    lines = ["        constexpr special_casing special_casings[]", "        {"]
+    for ch in sorted(casings):
+        assert all(len(units) <= 3 for units in casings[ch]), "%04X expands to more than 3 code points" % ch
+        lines.append("            {0x%x, %s}," % (ch, ", ".join("{%s}" % ", ".join("0x%x" % unit for unit in units)
+                                                                for units in casings[ch])))
+    lines.append("        };")
+    return lines, set(casings) | context
+
+
+def special_casing_bits(code_points):
+    """One bit per code point in rows of 1 << CASE_BLOCK_SHIFT, stopping at the last block with a bit."""
+    size = ((max(code_points) >> CASE_BLOCK_SHIFT) + 1) << CASE_BLOCK_SHIFT
+    bits = [0] * size
+    for ch in code_points:
+        bits[ch] = 1
+    blocks, rows = two_stage(bits, CASE_BLOCK_SHIFT, size)
+    words = [sum(bit << i for i, bit in enumerate(row)) for row in rows]
+    return (format_blocks("special_casing_blocks", blocks) + ["", "        constexpr uint32_t special_casing_bits[]", "        {"]
+            + format_list(words, 6, "0x%08x", " " * 12) + ["        };"])
+
+
+def replace_section(source, name, lines):
+    pattern = re.compile(r"(        // begin generated %s\b[^\n]*\n).*?(        // end generated %s\n)" % (name, name), re.S)
+    source, count = pattern.subn(lambda match: match.group(1) + "\n".join(lines) + "\n" + match.group(2), source)
+    if count != 1:
+        sys.exit("no generated section %s in the source" % name)
+    return source
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.exit(__doc__)
+
+    ucd_dir = sys.argv[1]
+    target = sys.argv[2] if len(sys.argv) == 3 else os.path.join(os.path.dirname(__file__), "..", "u32string_utils", "u32caps.cpp")
+
+    entries = read_unicode_data(ucd_dir)
+
+    with open(target, encoding="utf-8") as source_file:
+        source = source_file.read()
+
+    source = replace_section(source, "upper_case", case_table("upper", simple_mappings(entries, 12)))
+    source = replace_section(source, "lower_case", case_table("lower", simple_mappings(entries, 13)))
+    casings, special = special_casings(entries, ucd_dir)
+    source = replace_section(source, "special_casing", casings)
+    source = replace_section(source, "special_casing_bits", special_casing_bits(special))
+    source = replace_section(source, "general_category", property_table("general_category", general_categories(entries)))
+    source = replace_section(source, "bidi_class", property_table("bidi_class", bidi_classes(ucd_dir)))
+
+    with open(target, "w", encoding="utf-8", newline="\n") as source_file:
+        source_file.write(source)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "simd.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace details
+{
+    // Length of the leading ASCII run of [in, in + len), checking up to 64 bytes per step.
+    inline std::size_t ascii_prefix_length(const char* in, std::size_t len) noexcept
+    {
+        std::size_t i {};
+#if defined(U32_SIMD_SSE2)
+        for (; i + 64 <= len; i += 64)
+        {
+            auto src = reinterpret_cast<const __m128i*>(in + i);
+            auto any = _mm_or_si128(_mm_or_si128(_mm_loadu_si128(src), _mm_loadu_si128(src + 1)),
+                                    _mm_or_si128(_mm_loadu_si128(src + 2), _mm_loadu_si128(src + 3)));
+            if (_mm_movemask_epi8(any))
+            {
+                break;
+            }
+        }
+        for (; i + 16 <= len; i += 16)
+        {
+            auto mask = uint32_t(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+            if (mask)
+            {
+                return i + count_trailing_zeros(mask);
+            }
+        }
+#endif
+        while (i < len && !(in[i] & 0x80))
+        {
+            ++i;
+        }
+        return i;
+    }
+
+    // Widens the leading ASCII run of [in, in + len) into out and returns its length.
+    // The vector paths may also write the lanes after the run, but never past out + len.
+    inline std::size_t widen_ascii(const char* in, std::size_t len, char32_t* out) noexcept
+    {
+        std::size_t i {};
+#if defined(U32_SIMD_AVX2)
+        for (; i + 32 <= len; i += 32)
+        {
+            auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            auto lo = _mm256_castsi256_si128(v);
+            auto hi = _mm256_extracti128_si256(v, 1);
+            auto dst = reinterpret_cast<__m256i*>(out + i);
+            _mm256_storeu_si256(dst, _mm256_cvtepu8_epi32(lo));
+            _mm256_storeu_si256(dst + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+            _mm256_storeu_si256(dst + 2, _mm256_cvtepu8_epi32(hi));
+            _mm256_storeu_si256(dst + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+
+            auto mask = uint32_t(_mm256_movemask_epi8(v));
+            if (mask)
+            {
+                return i + count_trailing_zeros(mask);
+            }
+        }
+#endif
+#if defined(U32_SIMD_SSE2)
+        const auto zero = _mm_setzero_si128();
+        for (; i + 16 <= len; i += 16)
+        {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            auto lo = _mm_unpacklo_epi8(v, zero);
+            auto hi = _mm_unpackhi_epi8(v, zero);
+            auto dst = reinterpret_cast<__m128i*>(out + i);
+            _mm_storeu_si128(dst, _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+
+            auto mask = uint32_t(_mm_movemask_epi8(v));
+            if (mask)
+            {
+                return i + count_trailing_zeros(mask);
+            }
+        }
+#endif
+        for (; i < len && !(in[i] & 0x80); ++i)
+        {
+            out[i] = char32_t(in[i]);
+        }
+        return i;
+    }
+
+    // Narrows the leading ASCII run of [in, in + len) into out and returns its length.
+    // Only complete ASCII blocks are stored by the vector paths, so out needs room for
+    // the returned count only.
+    inline std::size_t narrow_ascii(const char32_t* in, std::size_t len, char* out) noexcept
+    {
+        std::size_t i {};
+#if defined(U32_SIMD_AVX2)
+        const auto wide_high_bits = _mm256_set1_epi32(~0x7f);
+        const auto order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        for (; i + 32 <= len; i += 32)
+        {
+            auto src = reinterpret_cast<const __m256i*>(in + i);
+            auto a = _mm256_loadu_si256(src);
+            auto b = _mm256_loadu_si256(src + 1);
+            auto c = _mm256_loadu_si256(src + 2);
+            auto d = _mm256_loadu_si256(src + 3);
+            auto any = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+            if (!_mm256_testz_si256(any, wide_high_bits))
+            {
+                break;
+            }
+
+            auto packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permutevar8x32_epi32(packed, order));
+        }
+#endif
+#if defined(U32_SIMD_SSE2)
+        const auto high_bits = _mm_set1_epi32(~0x7f);
+        const auto zero = _mm_setzero_si128();
+        for (; i + 16 <= len; i += 16)
+        {
+            auto src = reinterpret_cast<const __m128i*>(in + i);
+            auto a = _mm_loadu_si128(src);
+            auto b = _mm_loadu_si128(src + 1);
+            auto c = _mm_loadu_si128(src + 2);
+            auto d = _mm_loadu_si128(src + 3);
+            auto any = _mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), high_bits);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(any, zero)) != 0xffff)
+            {
+                break;
+            }
+
+            auto packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), packed);
+        }
+#endif
+        for (; i < len && in[i] < 0x80; ++i)
+        {
+            out[i] = static_cast<char>(in[i]);
+        }
+        return i;
+    }
+
+    // UTF-16 variant of widen_ascii, the vector path may write past the run up to out + len.
+    inline std::size_t widen_ascii(const char* in, std::size_t len, char16_t* out) noexcept
+    {
+        std::size_t i {};
+#if defined(U32_SIMD_SSE2)
+        const auto zero = _mm_setzero_si128();
+        for (; i + 16 <= len; i += 16)
+        {
+            auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            auto dst = reinterpret_cast<__m128i*>(out + i);
+            _mm_storeu_si128(dst, _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(dst + 1, _mm_unpackhi_epi8(v, zero));
+
+            auto mask = uint32_t(_mm_movemask_epi8(v));
+            if (mask)
+            {
+                return i + count_trailing_zeros(mask);
+            }
+        }
+#endif
+        for (; i < len && !(in[i] & 0x80); ++i)
+        {
+            out[i] = char16_t(in[i]);
+        }
+        return i;
+    }
+
+    // UTF-16 variant of narrow_ascii, only complete ASCII blocks are stored by the vector path.
+    inline std::size_t narrow_ascii(const char16_t* in, std::size_t len, char* out) noexcept
+    {
+        std::size_t i {};
+#if defined(U32_SIMD_SSE2)
+        const auto high_bits = _mm_set1_epi16(int16_t(0xff80));
+        const auto zero = _mm_setzero_si128();
+        for (; i + 16 <= len; i += 16)
+        {
+            auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8));
+            auto any = _mm_and_si128(_mm_or_si128(a, b), high_bits);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(any, zero)) != 0xffff)
+            {
+                break;
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(a, b));
+        }
+#endif
+        for (; i < len && in[i] < 0x80; ++i)
+        {
+            out[i] = static_cast<char>(in[i]);
+        }
+        return i;
+    }
+}
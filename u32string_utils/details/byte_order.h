@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+namespace details
+{
+    // Reads a UTF-16 code unit stored in the given byte order, in may be unaligned.
+    template<bool BigEndian>
+    inline char16_t load_utf16_unit(const char* in) noexcept
+    {
+        auto bytes = reinterpret_cast<const std::uint8_t*>(in);
+        return BigEndian ? char16_t(bytes[0] << 8 | bytes[1]) : char16_t(bytes[1] << 8 | bytes[0]);
+    }
+
+    template<bool BigEndian>
+    inline char32_t load_utf32_unit(const char* in) noexcept
+    {
+        auto bytes = reinterpret_cast<const std::uint8_t*>(in);
+        return BigEndian ? char32_t(bytes[0]) << 24 | char32_t(bytes[1]) << 16 | char32_t(bytes[2]) << 8 | bytes[3]
+                         : char32_t(bytes[3]) << 24 | char32_t(bytes[2]) << 16 | char32_t(bytes[1]) << 8 | bytes[0];
+    }
+}
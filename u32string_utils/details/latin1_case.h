@@ -0,0 +1,141 @@
+#pragma once
+
+#include "simd.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace details
+{
+    // True if ch is Latin-1 and its simple case mapping stays in Latin-1. For uppercase µ and ÿ
+    // map outside of it, everything else moves by 0x20 or stays.
+    template<bool Upper>
+    constexpr bool is_latin1_case(char32_t ch) noexcept
+    {
+        return ch < 0x100 && (!Upper || (ch != 0xb5 && ch != 0xff));
+    }
+
+    template<bool Upper>
+    constexpr char32_t change_latin1_case(char32_t ch) noexcept
+    {
+        return Upper ? ((ch >= U'a' && ch <= U'z') || (ch >= 0xe0 && ch <= 0xfe && ch != 0xf7) ? ch - 0x20 : ch)
+                     : ((ch >= U'A' && ch <= U'Z') || (ch >= 0xc0 && ch <= 0xde && ch != 0xd7) ? ch + 0x20 : ch);
+    }
+
+    // Length of the leading run of [str, str + len) below limit, checking 4 code points per step.
+    inline std::size_t below_prefix_length(const char32_t* str, std::size_t len, char32_t limit) noexcept
+    {
+        std::size_t i {};
+#if defined(U32_SIMD_SSE2)
+        // flipping the sign bits makes the signed compare an unsigned one
+        const auto sign = _mm_set1_epi32(int(0x80000000u));
+        const auto last = _mm_xor_si128(_mm_set1_epi32(int(limit - 1)), sign);
+        for (; i + 4 <= len; i += 4)
+        {
+            auto v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(str + i)), sign);
+            auto mask = uint32_t(_mm_movemask_epi8(_mm_cmpgt_epi32(v, last)));
+            if (mask)
+            {
+                return i + count_trailing_zeros(mask) / 4;
+            }
+        }
+#endif
+        while (i < len && str[i] < limit)
+        {
+            ++i;
+        }
+        return i;
+    }
+
+    // Writes [in, in + len) with changed case to out, which may be in. Blocks of 4 or 8 code
+    // points that all pass is_latin1_case are converted in vector registers, the others through
+    // map, which has to handle any code point.
+    template<bool Upper, typename Map>
+    void change_case(const char32_t* in, std::size_t len, char32_t* out, Map map)
+    {
+        std::size_t i {};
+#if defined(U32_SIMD_AVX2)
+        {
+            const auto zero = _mm256_setzero_si256();
+            const auto micro = _mm256_set1_epi32(0xb5);
+            const auto y_diaeresis = _mm256_set1_epi32(0xff);
+            const auto ascii_first = _mm256_set1_epi32(Upper ? 'a' - 1 : 'A' - 1);
+            const auto ascii_last = _mm256_set1_epi32(Upper ? 'z' + 1 : 'Z' + 1);
+            const auto latin1_first = _mm256_set1_epi32(Upper ? 0xdf : 0xbf);
+            const auto latin1_last = _mm256_set1_epi32(Upper ? 0xff : 0xdf);
+            const auto excluded = _mm256_set1_epi32(Upper ? 0xf7 : 0xd7);
+            const auto delta = _mm256_set1_epi32(0x20);
+            for (; i + 8 <= len; i += 8)
+            {
+                auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                auto latin1 = _mm256_cmpeq_epi32(_mm256_srli_epi32(v, 8), zero);
+                if (Upper)
+                {
+                    latin1 = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpeq_epi32(v, micro), _mm256_cmpeq_epi32(v, y_diaeresis)),
+                                                 latin1);
+                }
+
+                if (_mm256_movemask_ps(_mm256_castsi256_ps(latin1)) != 0xff)
+                {
+                    // blocks with other code points go through map lane by lane
+                    for (auto lane = i; lane != i + 8; ++lane)
+                    {
+                        out[lane] = map(in[lane]);
+                    }
+                }
+                else
+                {
+                    // the compares are signed, every lane is below 0x100 here
+                    auto ascii = _mm256_and_si256(_mm256_cmpgt_epi32(v, ascii_first), _mm256_cmpgt_epi32(ascii_last, v));
+                    auto letters = _mm256_andnot_si256(_mm256_cmpeq_epi32(v, excluded),
+                                                       _mm256_and_si256(_mm256_cmpgt_epi32(v, latin1_first), _mm256_cmpgt_epi32(latin1_last, v)));
+                    auto change = _mm256_and_si256(_mm256_or_si256(ascii, letters), delta);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), Upper ? _mm256_sub_epi32(v, change) : _mm256_add_epi32(v, change));
+                }
+            }
+        }
+#endif
+#if defined(U32_SIMD_SSE2)
+        {
+            const auto zero = _mm_setzero_si128();
+            const auto micro = _mm_set1_epi32(0xb5);
+            const auto y_diaeresis = _mm_set1_epi32(0xff);
+            const auto ascii_first = _mm_set1_epi32(Upper ? 'a' - 1 : 'A' - 1);
+            const auto ascii_last = _mm_set1_epi32(Upper ? 'z' + 1 : 'Z' + 1);
+            const auto latin1_first = _mm_set1_epi32(Upper ? 0xdf : 0xbf);
+            const auto latin1_last = _mm_set1_epi32(Upper ? 0xff : 0xdf);
+            const auto excluded = _mm_set1_epi32(Upper ? 0xf7 : 0xd7);
+            const auto delta = _mm_set1_epi32(0x20);
+            for (; i + 4 <= len; i += 4)
+            {
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                auto latin1 = _mm_cmpeq_epi32(_mm_srli_epi32(v, 8), zero);
+                if (Upper)
+                {
+                    latin1 = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi32(v, micro), _mm_cmpeq_epi32(v, y_diaeresis)), latin1);
+                }
+
+                if (_mm_movemask_ps(_mm_castsi128_ps(latin1)) != 0xf)
+                {
+                    for (auto lane = i; lane != i + 4; ++lane)
+                    {
+                        out[lane] = map(in[lane]);
+                    }
+                }
+                else
+                {
+                    auto ascii = _mm_and_si128(_mm_cmpgt_epi32(v, ascii_first), _mm_cmplt_epi32(v, ascii_last));
+                    auto letters = _mm_andnot_si128(_mm_cmpeq_epi32(v, excluded),
+                                                    _mm_and_si128(_mm_cmpgt_epi32(v, latin1_first), _mm_cmplt_epi32(v, latin1_last)));
+                    auto change = _mm_and_si128(_mm_or_si128(ascii, letters), delta);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), Upper ? _mm_sub_epi32(v, change) : _mm_add_epi32(v, change));
+                }
+            }
+        }
+#endif
+        for (; i < len; ++i)
+        {
+            out[i] = is_latin1_case<Upper>(in[i]) ? change_latin1_case<Upper>(in[i]) : map(in[i]);
+        }
+    }
+}
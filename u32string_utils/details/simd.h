@@ -0,0 +1,57 @@
+#pragma once
+
+// Instruction set selection for the vectorized code paths. Everything is chosen
+// at compile time from the compiler's target flags, the scalar code is always
+// available as a fallback.
+
+#if defined(__AVX2__)
+    #define U32_SIMD_AVX2 1
+#endif
+
+#if defined(__SSSE3__) || defined(U32_SIMD_AVX2)
+    #define U32_SIMD_SSSE3 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define U32_SIMD_SSE2 1
+#endif
+
+#if defined(U32_SIMD_AVX2)
+    #include <immintrin.h>
+#elif defined(U32_SIMD_SSSE3)
+    #include <tmmintrin.h>
+#elif defined(U32_SIMD_SSE2)
+    #include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+#include <cstdint>
+
+namespace details
+{
+    inline unsigned count_trailing_zeros(uint32_t mask) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long idx {};
+        _BitScanForward(&idx, mask);
+        return unsigned(idx);
+#else
+        return unsigned(__builtin_ctz(mask));
+#endif
+    }
+
+    inline unsigned popcount(uint32_t mask) noexcept
+    {
+#if defined(_MSC_VER)
+        // __popcnt needs a POPCNT capable CPU, which is not implied by the target flags
+        mask = mask - ((mask >> 1) & 0x55555555u);
+        mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+        return unsigned((((mask + (mask >> 4)) & 0x0f0f0f0fu) * 0x01010101u) >> 24);
+#else
+        return unsigned(__builtin_popcount(mask));
+#endif
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace details
+{
+    // A sequence decoded with the maximal subpart rules: a malformed one covers its lead
+    // and the continuation bytes that were still acceptable, and decodes to U+FFFD.
+    struct decoded_char
+    {
+        char32_t ch;
+        std::size_t len;
+        bool valid;
+    };
+
+    // Decodes the sequence at in, in_len has to be at least 1.
+    inline decoded_char decode_utf8_strict(const char* in, std::size_t in_len) noexcept
+    {
+        auto str = reinterpret_cast<const uint8_t*>(in);
+        const decoded_char invalid {char32_t(0xFFFD), 1, false};
+
+        const auto lead = str[0];
+        std::size_t n {};
+        char32_t ch {};
+        uint8_t lower {0x80}, upper {0xbf};
+        if (lead < 0x80)
+        {
+            return {lead, 1, true};
+        }
+        else if (lead >= 0xc2 && lead <= 0xdf)
+        {
+            n = 2;
+            ch = lead & 0x1f;
+        }
+        else if ((lead & 0xf0) == 0xe0)
+        {
+            n = 3;
+            ch = lead & 0x0f;
+            lower = lead == 0xe0 ? 0xa0 : lower;
+            upper = lead == 0xed ? 0x9f : upper;
+        }
+        else if (lead >= 0xf0 && lead <= 0xf4)
+        {
+            n = 4;
+            ch = lead & 0x07;
+            lower = lead == 0xf0 ? 0x90 : lower;
+            upper = lead == 0xf4 ? 0x8f : upper;
+        }
+        else
+        {
+            return invalid;
+        }
+
+        if (in_len < 2 || str[1] < lower || str[1] > upper)
+        {
+            return invalid;
+        }
+
+        ch = (ch << 6) | (str[1] & 0x3f);
+        for (std::size_t k = 2; k < n; ++k)
+        {
+            if (k == in_len || (str[k] & 0xc0) != 0x80)
+            {
+                return {invalid.ch, k, false};
+            }
+            ch = (ch << 6) | (str[k] & 0x3f);
+        }
+        return {ch, n, true};
+    }
+
+    // Start of the sequence decode_utf8_strict splits [begin, end) into that ends at pos,
+    // begin < pos. Only a multi byte sequence has continuation bytes after its first byte,
+    // so the candidate start is the last other byte among the 4 before pos.
+    inline const char* previous_utf8_sequence(const char* begin, const char* pos, const char* end) noexcept
+    {
+        auto start = pos - 1;
+        const auto limit = pos - begin > 4 ? pos - 4 : begin;
+        while (start != limit && (static_cast<uint8_t>(*start) & 0xc0) == 0x80)
+        {
+            --start;
+        }
+
+        if ((static_cast<uint8_t>(*start) & 0xc0) != 0x80
+            && decode_utf8_strict(start, std::size_t(end - start)).len == std::size_t(pos - start))
+        {
+            return start;
+        }
+        return pos - 1;
+    }
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include "ascii.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace details
+{
+    // Offset of the first byte in [in + pos, in + len) that starts an invalid sequence, len if
+    // there is none. pos has to be the start of a sequence. The rules are the ones utf8_to_u32
+    // substitutes U+FFFD for: overlong forms, surrogates, values above U+10FFFF, bad or missing
+    // continuation bytes.
+    inline std::size_t validate_utf8_scalar(const char* in, std::size_t pos, std::size_t len) noexcept
+    {
+        auto str = reinterpret_cast<const uint8_t*>(in);
+        while (pos < len)
+        {
+            const auto lead = str[pos];
+            if (lead < 0x80)
+            {
+                pos += ascii_prefix_length(in + pos, len - pos);
+                continue;
+            }
+
+            std::size_t n {};
+            uint8_t lower {0x80}, upper {0xbf};
+            if (lead >= 0xc2 && lead <= 0xdf)
+            {
+                n = 2;
+            }
+            else if ((lead & 0xf0) == 0xe0)
+            {
+                n = 3;
+                lower = lead == 0xe0 ? 0xa0 : lower;
+                upper = lead == 0xed ? 0x9f : upper;
+            }
+            else if (lead >= 0xf0 && lead <= 0xf4)
+            {
+                n = 4;
+                lower = lead == 0xf0 ? 0x90 : lower;
+                upper = lead == 0xf4 ? 0x8f : upper;
+            }
+            else
+            {
+                return pos;
+            }
+
+            if (len - pos < n || str[pos + 1] < lower || str[pos + 1] > upper)
+            {
+                return pos;
+            }
+
+            for (std::size_t k = 2; k < n; ++k)
+            {
+                if ((str[pos + k] & 0xc0) != 0x80)
+                {
+                    return pos;
+                }
+            }
+            pos += n;
+        }
+        return len;
+    }
+
+#if defined(U32_SIMD_SSSE3)
+    // Lookup tables of the "Validating UTF-8 In Less Than One Instruction Per Byte" algorithm
+    // (Keiser, Lemire). Each table maps a nibble of the previous or current byte to the set of
+    // errors it can take part in, a byte pair is invalid when all three agree on one error.
+    namespace utf8_lookup
+    {
+        constexpr char TOO_SHORT = 1 << 0;
+        constexpr char TOO_LONG = 1 << 1;
+        constexpr char OVERLONG_3 = 1 << 2;
+        constexpr char TOO_LARGE = 1 << 3;
+        constexpr char SURROGATE = 1 << 4;
+        constexpr char OVERLONG_2 = 1 << 5;
+        constexpr char TOO_LARGE_1000 = 1 << 6;
+        constexpr char OVERLONG_4 = 1 << 6;
+        constexpr char TWO_CONTS = char(1 << 7);
+        constexpr char CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+        inline __m128i byte_1_high() noexcept
+        {
+            return _mm_setr_epi8(TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                                 TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                                 TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+                                 TOO_SHORT | OVERLONG_2,
+                                 TOO_SHORT,
+                                 TOO_SHORT | OVERLONG_3 | SURROGATE,
+                                 TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4);
+        }
+
+        inline __m128i byte_1_low() noexcept
+        {
+            return _mm_setr_epi8(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+                                 CARRY | OVERLONG_2,
+                                 CARRY,
+                                 CARRY,
+                                 CARRY | TOO_LARGE,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                 CARRY | TOO_LARGE | TOO_LARGE_1000);
+        }
+
+        inline __m128i byte_2_high() noexcept
+        {
+            return _mm_setr_epi8(TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                                 TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                                 TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+                                 TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+                                 TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                                 TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                                 TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT);
+        }
+    }
+#endif
+
+#if defined(U32_SIMD_AVX2)
+    class utf8_block_checker
+    {
+    public:
+        static constexpr std::size_t block_size {32};
+
+        // Errors of the block, including sequences started in the previous blocks.
+        __m256i check(__m256i input) noexcept
+        {
+            __m256i error;
+            if (_mm256_movemask_epi8(input) == 0)
+            {
+                error = prev_incomplete_;
+                prev_incomplete_ = _mm256_setzero_si256();
+            }
+            else
+            {
+                const auto nibble = _mm256_set1_epi8(0x0f);
+                const auto carried = _mm256_permute2x128_si256(prev_input_, input, 0x21);
+                const auto prev1 = _mm256_alignr_epi8(input, carried, 15);
+                const auto prev2 = _mm256_alignr_epi8(input, carried, 14);
+                const auto prev3 = _mm256_alignr_epi8(input, carried, 13);
+
+                auto special = _mm256_shuffle_epi8(byte_1_high_, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+                special = _mm256_and_si256(special, _mm256_shuffle_epi8(byte_1_low_, _mm256_and_si256(prev1, nibble)));
+                special = _mm256_and_si256(special, _mm256_shuffle_epi8(byte_2_high_, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+
+                const auto is_third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(char(0xe0 - 1)));
+                const auto is_fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(char(0xf0 - 1)));
+                const auto must_be_continuation = _mm256_and_si256(
+                    _mm256_cmpgt_epi8(_mm256_or_si256(is_third, is_fourth), _mm256_setzero_si256()), _mm256_set1_epi8(char(0x80)));
+
+                error = _mm256_xor_si256(must_be_continuation, special);
+                prev_incomplete_ = _mm256_subs_epu8(input, incomplete_limit_);
+            }
+            prev_input_ = input;
+            return error;
+        }
+
+        static bool has_error(__m256i error) noexcept
+        {
+            return !_mm256_testz_si256(error, error);
+        }
+
+        static __m256i load(const char* in) noexcept
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+        }
+
+    private:
+        __m256i byte_1_high_ {_mm256_broadcastsi128_si256(utf8_lookup::byte_1_high())};
+        __m256i byte_1_low_ {_mm256_broadcastsi128_si256(utf8_lookup::byte_1_low())};
+        __m256i byte_2_high_ {_mm256_broadcastsi128_si256(utf8_lookup::byte_2_high())};
+        __m256i incomplete_limit_ {_mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                    char(0xf0 - 1), char(0xe0 - 1), char(0xc0 - 1))};
+        __m256i prev_input_ {_mm256_setzero_si256()};
+        __m256i prev_incomplete_ {_mm256_setzero_si256()};
+    };
+#elif defined(U32_SIMD_SSSE3)
+    class utf8_block_checker
+    {
+    public:
+        static constexpr std::size_t block_size {16};
+
+        // Errors of the block, including sequences started in the previous blocks.
+        __m128i check(__m128i input) noexcept
+        {
+            __m128i error;
+            if (_mm_movemask_epi8(input) == 0)
+            {
+                error = prev_incomplete_;
+                prev_incomplete_ = _mm_setzero_si128();
+            }
+            else
+            {
+                const auto nibble = _mm_set1_epi8(0x0f);
+                const auto prev1 = _mm_alignr_epi8(input, prev_input_, 15);
+                const auto prev2 = _mm_alignr_epi8(input, prev_input_, 14);
+                const auto prev3 = _mm_alignr_epi8(input, prev_input_, 13);
+
+                auto special = _mm_shuffle_epi8(byte_1_high_, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+                special = _mm_and_si128(special, _mm_shuffle_epi8(byte_1_low_, _mm_and_si128(prev1, nibble)));
+                special = _mm_and_si128(special, _mm_shuffle_epi8(byte_2_high_, _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+
+                const auto is_third = _mm_subs_epu8(prev2, _mm_set1_epi8(char(0xe0 - 1)));
+                const auto is_fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(char(0xf0 - 1)));
+                const auto must_be_continuation = _mm_and_si128(
+                    _mm_cmpgt_epi8(_mm_or_si128(is_third, is_fourth), _mm_setzero_si128()), _mm_set1_epi8(char(0x80)));
+
+                error = _mm_xor_si128(must_be_continuation, special);
+                prev_incomplete_ = _mm_subs_epu8(input, incomplete_limit_);
+            }
+            prev_input_ = input;
+            return error;
+        }
+
+        static bool has_error(__m128i error) noexcept
+        {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xffff;
+        }
+
+        static __m128i load(const char* in) noexcept
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+        }
+
+    private:
+        __m128i byte_1_high_ {utf8_lookup::byte_1_high()};
+        __m128i byte_1_low_ {utf8_lookup::byte_1_low()};
+        __m128i byte_2_high_ {utf8_lookup::byte_2_high()};
+        __m128i incomplete_limit_ {_mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                 char(0xf0 - 1), char(0xe0 - 1), char(0xc0 - 1))};
+        __m128i prev_input_ {_mm_setzero_si128()};
+        __m128i prev_incomplete_ {_mm_setzero_si128()};
+    };
+#endif
+
+    inline std::size_t validate_utf8(const char* in, std::size_t len) noexcept
+    {
+#if defined(U32_SIMD_SSSE3)
+        utf8_block_checker checker;
+        constexpr auto block_size = utf8_block_checker::block_size;
+        for (std::size_t pos = 0;; pos += block_size)
+        {
+            // the zero padding of the last block flags sequences truncated by the end of input
+            const bool last = len - pos < block_size;
+            char tail[block_size] {};
+            if (last && len != pos)
+            {
+                std::memcpy(tail, in + pos, len - pos);
+            }
+
+            auto error = checker.check(utf8_block_checker::load(last ? tail : in + pos));
+            if (utf8_block_checker::has_error(error))
+            {
+                // the first error starts at most 3 bytes before the block, find it with the scalar rules
+                auto start = pos < 3 ? 0 : pos - 3;
+                while (start > 0 && (uint8_t(in[start]) & 0xc0) == 0x80)
+                {
+                    --start;
+                }
+                return validate_utf8_scalar(in, start, len);
+            }
+
+            if (last)
+            {
+                return len;
+            }
+        }
+#else
+        return validate_utf8_scalar(in, 0, len);
+#endif
+    }
+}
@@ -1,957 +1,1705 @@
 #include "u32caps.h"
 
+#include "details/latin1_case.h"
+
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
-#include <map>
-#include <unordered_map>
+#include <iterator>
 
 namespace u32
 {
     namespace
     {
-        const std::unordered_map<char32_t, char32_t> upper_map
+        // Simple case mappings as two-stage tables: the code point's block of 32 selects a row
+        // of deltas that is added to it. Code points past the end of a table map to themselves.
+        constexpr unsigned case_block_shift = 5;
+        constexpr size_t case_block_size = size_t(1) << case_block_shift;
+
+        // uppercase mapping, equal delta rows are stored once
+        // begin generated upper_case, see tools/gen_unicode_tables.py
+        constexpr uint8_t upper_blocks[]
+        {
+            0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+            0x04, 0x0c, 0x0d, 0x0e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x00, 0x12, 0x13, 0x14,
+            0x00, 0x15, 0x16, 0x04, 0x17, 0x04, 0x18, 0x04, 0x04, 0x19, 0x00, 0x1a, 0x1b, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x21, 0x00, 0x00, 0x00,
+            0x04, 0x04, 0x04, 0x04, 0x22, 0x04, 0x04, 0x04, 0x23, 0x24, 0x25, 0x26, 0x24, 0x27, 0x28, 0x29,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2b, 0x2c, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x2f, 0x30, 0x31, 0x04, 0x04, 0x04, 0x32, 0x33, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x04, 0x35, 0x36, 0x00, 0x00, 0x00, 0x00, 0x37, 0x04, 0x38, 0x39, 0x3a, 0x3b, 0x3c,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x3e, 0x3f, 0x3f, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x40, 0x41, 0x00, 0x00, 0x00, 0x42, 0x43, 0x00, 0x00, 0x00, 0x00, 0x44, 0x45, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4a,
+        };
+
+        constexpr int32_t upper_deltas[][case_block_size]
+        {
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 743, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, 0,
+                -32, -32, -32, -32, -32, -32, -32, 121,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -232, 0, -1, 0, -1, 0, -1,
+                0, 0, -1, 0, -1, 0, -1, 0,
+            },
+            {
+                -1, 0, -1, 0, -1, 0, -1, 0,
+                -1, 0, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, 0, -1, 0, -1, 0, -1, -300,
+            },
+            {
+                195, 0, 0, -1, 0, -1, 0, 0,
+                -1, 0, 0, 0, -1, 0, 0, 0,
+                0, 0, -1, 0, 0, 97, 0, 0,
+                0, -1, 163, 0, 0, 0, 130, 0,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, 0,
+                -1, 0, 0, 0, 0, -1, 0, 0,
+                -1, 0, 0, 0, -1, 0, -1, 0,
+                0, -1, 0, 0, 0, -1, 0, 56,
+            },
+            {
+                0, 0, 0, 0, 0, -1, -2, 0,
+                -1, -2, 0, -1, -2, 0, -1, 0,
+                -1, 0, -1, 0, -1, 0, -1, 0,
+                -1, 0, -1, 0, -1, -79, 0, -1,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, 0, -1, -2, 0, -1, 0, 0,
+                0, -1, 0, -1, 0, -1, 0, -1,
+            },
+            {
+                0, 0, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, 0, 0, 0,
+                0, 0, 0, 0, -1, 0, 0, 10815,
+            },
+            {
+                10815, 0, -1, 0, 0, 0, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                10783, 10780, 10782, -210, -206, 0, -205, -205,
+                0, -202, 0, -203, 42319, 0, 0, 0,
+            },
+            {
+                -205, 42315, 0, -207, 0, 42280, 42308, 0,
+                -209, -211, 42308, 10743, 42305, 0, 0, -211,
+                0, 10749, -213, 0, 0, -214, 0, 0,
+                0, 0, 0, 0, 0, 10727, 0, 0,
+            },
+            {
+                -218, 0, 42307, -218, 0, 0, 0, 42282,
+                -218, -69, -217, -217, -71, 0, 0, 0,
+                0, 0, -219, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 42261, 42258, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 84, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, -1, 0, -1, 0, 0, 0, -1,
+                0, 0, 0, 130, 130, 130, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, -38, -37, -37, -37,
+                0, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+            },
+            {
+                -32, -32, -31, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -64, -63, -63, 0,
+                -62, -57, 0, 0, 0, -47, -54, -8,
+                0, -1, 0, -1, 0, -1, 0, -1,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                -86, -80, 7, -116, 0, -96, 0, 0,
+                -1, 0, 0, -1, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+            },
+            {
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -80, -80, -80, -80, -80, -80, -80, -80,
+                -80, -80, -80, -80, -80, -80, -80, -80,
+            },
+            {
+                0, -1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+            },
+            {
+                0, 0, -1, 0, -1, 0, -1, 0,
+                -1, 0, -1, 0, -1, 0, -1, -15,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, -48, -48, -48, -48, -48, -48, -48,
+                -48, -48, -48, -48, -48, -48, -48, -48,
+                -48, -48, -48, -48, -48, -48, -48, -48,
+                -48, -48, -48, -48, -48, -48, -48, -48,
+            },
+            {
+                -48, -48, -48, -48, -48, -48, -48, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
+                3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
+            },
+            {
+                3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
+                3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
+                3008, 3008, 3008, 3008, 3008, 3008, 3008, 3008,
+                3008, 3008, 3008, 0, 0, 3008, 3008, 3008,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -8, -8, -8, -8, 0, 0,
+            },
+            {
+                -6254, -6253, -6244, -6242, -6242, -6243, -6236, -6181,
+                35266, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 35332, 0, 0, 0, 3814, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 35384, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, 0,
+                0, 0, 0, -59, 0, 0, 0, 0,
+            },
+            {
+                8, 8, 8, 8, 8, 8, 8, 8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                8, 8, 8, 8, 8, 8, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                8, 8, 8, 8, 8, 8, 8, 8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                8, 8, 8, 8, 8, 8, 8, 8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                8, 8, 8, 8, 8, 8, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 8, 0, 8, 0, 8, 0, 8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                8, 8, 8, 8, 8, 8, 8, 8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                74, 74, 86, 86, 86, 86, 100, 100,
+                128, 128, 112, 112, 126, 126, 0, 0,
+            },
+            {
+                8, 8, 8, 8, 8, 8, 8, 8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                8, 8, 0, 9, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, -7205, 0,
+            },
+            {
+                0, 0, 0, 9, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                8, 8, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                8, 8, 0, 0, 0, 7, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 9, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, -28, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -16, -16, -16, -16, -16, -16, -16, -16,
+                -16, -16, -16, -16, -16, -16, -16, -16,
+            },
+            {
+                0, 0, 0, 0, -1, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -26, -26, -26, -26, -26, -26, -26, -26,
+                -26, -26, -26, -26, -26, -26, -26, -26,
+            },
+            {
+                -26, -26, -26, -26, -26, -26, -26, -26,
+                -26, -26, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -48, -48, -48, -48, -48, -48, -48, -48,
+                -48, -48, -48, -48, -48, -48, -48, -48,
+            },
+            {
+                -48, -48, -48, -48, -48, -48, -48, -48,
+                -48, -48, -48, -48, -48, -48, -48, -48,
+                -48, -48, -48, -48, -48, -48, -48, -48,
+                -48, -48, -48, -48, -48, -48, -48, -48,
+            },
+            {
+                0, -1, 0, 0, 0, -10795, -10792, 0,
+                -1, 0, -1, 0, -1, 0, 0, 0,
+                0, 0, 0, -1, 0, 0, -1, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, -1, 0, -1, 0, 0, 0, 0,
+                0, 0, 0, 0, -1, 0, -1, 0,
+                0, 0, 0, -1, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                -7264, -7264, -7264, -7264, -7264, -7264, -7264, -7264,
+                -7264, -7264, -7264, -7264, -7264, -7264, -7264, -7264,
+                -7264, -7264, -7264, -7264, -7264, -7264, -7264, -7264,
+                -7264, -7264, -7264, -7264, -7264, -7264, -7264, -7264,
+            },
+            {
+                -7264, -7264, -7264, -7264, -7264, -7264, 0, -7264,
+                0, 0, 0, 0, 0, -7264, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, 0, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, -1, 0, -1, 0, 0, -1,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, 0, 0, 0, -1, 0, 0, 0,
+                0, -1, 0, -1, 48, 0, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+            },
+            {
+                0, -1, 0, -1, 0, -1, 0, -1,
+                0, -1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, -1, 0, -1,
+                0, -1, 0, -1, 0, -1, 0, -1,
+            },
+            {
+                0, -1, 0, -1, 0, 0, 0, 0,
+                -1, 0, -1, 0, 0, 0, 0, 0,
+                0, -1, 0, 0, 0, 0, 0, -1,
+                0, -1, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, -1, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, -928, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+                -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+            },
+            {
+                -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+                -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+                -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+                -38864, -38864, -38864, -38864, -38864, -38864, -38864, -38864,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -40, -40, -40, -40, -40, -40, -40, -40,
+                -40, -40, -40, -40, -40, -40, -40, -40,
+                -40, -40, -40, -40, -40, -40, -40, -40,
+            },
+            {
+                -40, -40, -40, -40, -40, -40, -40, -40,
+                -40, -40, -40, -40, -40, -40, -40, -40,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -40, -40, -40, -40, -40, -40, -40, -40,
+            },
+            {
+                -40, -40, -40, -40, -40, -40, -40, -40,
+                -40, -40, -40, -40, -40, -40, -40, -40,
+                -40, -40, -40, -40, -40, -40, -40, -40,
+                -40, -40, -40, -40, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, -39,
+                -39, -39, -39, -39, -39, -39, -39, -39,
+            },
+            {
+                -39, -39, 0, -39, -39, -39, -39, -39,
+                -39, -39, -39, -39, -39, -39, -39, -39,
+                -39, -39, 0, -39, -39, -39, -39, -39,
+                -39, -39, 0, -39, -39, 0, 0, 0,
+            },
+            {
+                -64, -64, -64, -64, -64, -64, -64, -64,
+                -64, -64, -64, -64, -64, -64, -64, -64,
+                -64, -64, -64, -64, -64, -64, -64, -64,
+                -64, -64, -64, -64, -64, -64, -64, -64,
+            },
+            {
+                -64, -64, -64, -64, -64, -64, -64, -64,
+                -64, -64, -64, -64, -64, -64, -64, -64,
+                -64, -64, -64, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+                -32, -32, -32, -32, -32, -32, -32, -32,
+            },
+            {
+                0, 0, -34, -34, -34, -34, -34, -34,
+                -34, -34, -34, -34, -34, -34, -34, -34,
+                -34, -34, -34, -34, -34, -34, -34, -34,
+                -34, -34, -34, -34, -34, -34, -34, -34,
+            },
+            {
+                -34, -34, -34, -34, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+        };
+        // end generated upper_case
+
+        // lowercase mapping, equal delta rows are stored once
+        // begin generated lower_case, see tools/gen_unicode_tables.py
+        constexpr uint8_t lower_blocks[]
+        {
+            0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+            0x03, 0x0b, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x0e, 0x0f, 0x10, 0x11,
+            0x12, 0x13, 0x00, 0x03, 0x14, 0x03, 0x15, 0x03, 0x03, 0x16, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x1a, 0x1b,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x1c, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x03, 0x03, 0x03, 0x03, 0x1e, 0x03, 0x03, 0x03, 0x1f, 0x20, 0x21, 0x22, 0x20, 0x23, 0x24, 0x25,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x27, 0x28, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x2b, 0x2c, 0x00, 0x2d, 0x03, 0x03, 0x03, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x03, 0x2f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x31, 0x03, 0x32, 0x33, 0x34, 0x35, 0x36,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x37, 0x38, 0x00, 0x00, 0x00, 0x39, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x3c, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x3d, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x41,
+        };
+
+        constexpr int32_t lower_deltas[][case_block_size]
         {
-            {0x61, 0x41},       {0x62, 0x42},       {0x63, 0x43},
-            {0x64, 0x44},       {0x65, 0x45},       {0x66, 0x46},
-            {0x67, 0x47},       {0x68, 0x48},       {0x69, 0x49},
-            {0x6a, 0x4a},       {0x6b, 0x4b},       {0x6c, 0x4c},
-            {0x6d, 0x4d},       {0x6e, 0x4e},       {0x6f, 0x4f},
-            {0x70, 0x50},       {0x71, 0x51},       {0x72, 0x52},
-            {0x73, 0x53},       {0x74, 0x54},       {0x75, 0x55},
-            {0x76, 0x56},       {0x77, 0x57},       {0x78, 0x58},
-            {0x79, 0x59},       {0x7a, 0x5a},       {0xb5, 0x39c},
-            {0xe0, 0xc0},       {0xe1, 0xc1},       {0xe2, 0xc2},
-            {0xe3, 0xc3},       {0xe4, 0xc4},       {0xe5, 0xc5},
-            {0xe6, 0xc6},       {0xe7, 0xc7},       {0xe8, 0xc8},
-            {0xe9, 0xc9},       {0xea, 0xca},       {0xeb, 0xcb},
-            {0xec, 0xcc},       {0xed, 0xcd},       {0xee, 0xce},
-            {0xef, 0xcf},       {0xf0, 0xd0},       {0xf1, 0xd1},
-            {0xf2, 0xd2},       {0xf3, 0xd3},       {0xf4, 0xd4},
-            {0xf5, 0xd5},       {0xf6, 0xd6},       {0xf8, 0xd8},
-            {0xf9, 0xd9},       {0xfa, 0xda},       {0xfb, 0xdb},
-            {0xfc, 0xdc},       {0xfd, 0xdd},       {0xfe, 0xde},
-            {0xff, 0x178},      {0x101, 0x100},     {0x103, 0x102},
-            {0x105, 0x104},     {0x107, 0x106},     {0x109, 0x108},
-            {0x10b, 0x10a},     {0x10d, 0x10c},     {0x10f, 0x10e},
-            {0x111, 0x110},     {0x113, 0x112},     {0x115, 0x114},
-            {0x117, 0x116},     {0x119, 0x118},     {0x11b, 0x11a},
-            {0x11d, 0x11c},     {0x11f, 0x11e},     {0x121, 0x120},
-            {0x123, 0x122},     {0x125, 0x124},     {0x127, 0x126},
-            {0x129, 0x128},     {0x12b, 0x12a},     {0x12d, 0x12c},
-            {0x12f, 0x12e},     {0x131, 0x49},      {0x133, 0x132},
-            {0x135, 0x134},     {0x137, 0x136},     {0x13a, 0x139},
-            {0x13c, 0x13b},     {0x13e, 0x13d},     {0x140, 0x13f},
-            {0x142, 0x141},     {0x144, 0x143},     {0x146, 0x145},
-            {0x148, 0x147},     {0x14b, 0x14a},     {0x14d, 0x14c},
-            {0x14f, 0x14e},     {0x151, 0x150},     {0x153, 0x152},
-            {0x155, 0x154},     {0x157, 0x156},     {0x159, 0x158},
-            {0x15b, 0x15a},     {0x15d, 0x15c},     {0x15f, 0x15e},
-            {0x161, 0x160},     {0x163, 0x162},     {0x165, 0x164},
-            {0x167, 0x166},     {0x169, 0x168},     {0x16b, 0x16a},
-            {0x16d, 0x16c},     {0x16f, 0x16e},     {0x171, 0x170},
-            {0x173, 0x172},     {0x175, 0x174},     {0x177, 0x176},
-            {0x17a, 0x179},     {0x17c, 0x17b},     {0x17e, 0x17d},
-            {0x17f, 0x53},      {0x180, 0x243},     {0x183, 0x182},
-            {0x185, 0x184},     {0x188, 0x187},     {0x18c, 0x18b},
-            {0x192, 0x191},     {0x195, 0x1f6},     {0x199, 0x198},
-            {0x19a, 0x23d},     {0x19e, 0x220},     {0x1a1, 0x1a0},
-            {0x1a3, 0x1a2},     {0x1a5, 0x1a4},     {0x1a8, 0x1a7},
-            {0x1ad, 0x1ac},     {0x1b0, 0x1af},     {0x1b4, 0x1b3},
-            {0x1b6, 0x1b5},     {0x1b9, 0x1b8},     {0x1bd, 0x1bc},
-            {0x1bf, 0x1f7},     {0x1c5, 0x1c4},     {0x1c6, 0x1c4},
-            {0x1c8, 0x1c7},     {0x1c9, 0x1c7},     {0x1cb, 0x1ca},
-            {0x1cc, 0x1ca},     {0x1ce, 0x1cd},     {0x1d0, 0x1cf},
-            {0x1d2, 0x1d1},     {0x1d4, 0x1d3},     {0x1d6, 0x1d5},
-            {0x1d8, 0x1d7},     {0x1da, 0x1d9},     {0x1dc, 0x1db},
-            {0x1dd, 0x18e},     {0x1df, 0x1de},     {0x1e1, 0x1e0},
-            {0x1e3, 0x1e2},     {0x1e5, 0x1e4},     {0x1e7, 0x1e6},
-            {0x1e9, 0x1e8},     {0x1eb, 0x1ea},     {0x1ed, 0x1ec},
-            {0x1ef, 0x1ee},     {0x1f2, 0x1f1},     {0x1f3, 0x1f1},
-            {0x1f5, 0x1f4},     {0x1f9, 0x1f8},     {0x1fb, 0x1fa},
-            {0x1fd, 0x1fc},     {0x1ff, 0x1fe},     {0x201, 0x200},
-            {0x203, 0x202},     {0x205, 0x204},     {0x207, 0x206},
-            {0x209, 0x208},     {0x20b, 0x20a},     {0x20d, 0x20c},
-            {0x20f, 0x20e},     {0x211, 0x210},     {0x213, 0x212},
-            {0x215, 0x214},     {0x217, 0x216},     {0x219, 0x218},
-            {0x21b, 0x21a},     {0x21d, 0x21c},     {0x21f, 0x21e},
-            {0x223, 0x222},     {0x225, 0x224},     {0x227, 0x226},
-            {0x229, 0x228},     {0x22b, 0x22a},     {0x22d, 0x22c},
-            {0x22f, 0x22e},     {0x231, 0x230},     {0x233, 0x232},
-            {0x23c, 0x23b},     {0x23f, 0x2c7e},    {0x240, 0x2c7f},
-            {0x242, 0x241},     {0x247, 0x246},     {0x249, 0x248},
-            {0x24b, 0x24a},     {0x24d, 0x24c},     {0x24f, 0x24e},
-            {0x250, 0x2c6f},    {0x251, 0x2c6d},    {0x252, 0x2c70},
-            {0x253, 0x181},     {0x254, 0x186},     {0x256, 0x189},
-            {0x257, 0x18a},     {0x259, 0x18f},     {0x25b, 0x190},
-            {0x25c, 0xa7ab},    {0x260, 0x193},     {0x261, 0xa7ac},
-            {0x263, 0x194},     {0x265, 0xa78d},    {0x266, 0xa7aa},
-            {0x268, 0x197},     {0x269, 0x196},     {0x26a, 0xa7ae},
-            {0x26b, 0x2c62},    {0x26c, 0xa7ad},    {0x26f, 0x19c},
-            {0x271, 0x2c6e},    {0x272, 0x19d},     {0x275, 0x19f},
-            {0x27d, 0x2c64},    {0x280, 0x1a6},     {0x282, 0xa7c5},
-            {0x283, 0x1a9},     {0x287, 0xa7b1},    {0x288, 0x1ae},
-            {0x289, 0x244},     {0x28a, 0x1b1},     {0x28b, 0x1b2},
-            {0x28c, 0x245},     {0x292, 0x1b7},     {0x29d, 0xa7b2},
-            {0x29e, 0xa7b0},    {0x345, 0x399},     {0x371, 0x370},
-            {0x373, 0x372},     {0x377, 0x376},     {0x37b, 0x3fd},
-            {0x37c, 0x3fe},     {0x37d, 0x3ff},     {0x3ac, 0x386},
-            {0x3ad, 0x388},     {0x3ae, 0x389},     {0x3af, 0x38a},
-            {0x3b1, 0x391},     {0x3b2, 0x392},     {0x3b3, 0x393},
-            {0x3b4, 0x394},     {0x3b5, 0x395},     {0x3b6, 0x396},
-            {0x3b7, 0x397},     {0x3b8, 0x398},     {0x3b9, 0x399},
-            {0x3ba, 0x39a},     {0x3bb, 0x39b},     {0x3bc, 0x39c},
-            {0x3bd, 0x39d},     {0x3be, 0x39e},     {0x3bf, 0x39f},
-            {0x3c0, 0x3a0},     {0x3c1, 0x3a1},     {0x3c2, 0x3a3},
-            {0x3c3, 0x3a3},     {0x3c4, 0x3a4},     {0x3c5, 0x3a5},
-            {0x3c6, 0x3a6},     {0x3c7, 0x3a7},     {0x3c8, 0x3a8},
-            {0x3c9, 0x3a9},     {0x3ca, 0x3aa},     {0x3cb, 0x3ab},
-            {0x3cc, 0x38c},     {0x3cd, 0x38e},     {0x3ce, 0x38f},
-            {0x3d0, 0x392},     {0x3d1, 0x398},     {0x3d5, 0x3a6},
-            {0x3d6, 0x3a0},     {0x3d7, 0x3cf},     {0x3d9, 0x3d8},
-            {0x3db, 0x3da},     {0x3dd, 0x3dc},     {0x3df, 0x3de},
-            {0x3e1, 0x3e0},     {0x3e3, 0x3e2},     {0x3e5, 0x3e4},
-            {0x3e7, 0x3e6},     {0x3e9, 0x3e8},     {0x3eb, 0x3ea},
-            {0x3ed, 0x3ec},     {0x3ef, 0x3ee},     {0x3f0, 0x39a},
-            {0x3f1, 0x3a1},     {0x3f2, 0x3f9},     {0x3f3, 0x37f},
-            {0x3f5, 0x395},     {0x3f8, 0x3f7},     {0x3fb, 0x3fa},
-            {0x430, 0x410},     {0x431, 0x411},     {0x432, 0x412},
-            {0x433, 0x413},     {0x434, 0x414},     {0x435, 0x415},
-            {0x436, 0x416},     {0x437, 0x417},     {0x438, 0x418},
-            {0x439, 0x419},     {0x43a, 0x41a},     {0x43b, 0x41b},
-            {0x43c, 0x41c},     {0x43d, 0x41d},     {0x43e, 0x41e},
-            {0x43f, 0x41f},     {0x440, 0x420},     {0x441, 0x421},
-            {0x442, 0x422},     {0x443, 0x423},     {0x444, 0x424},
-            {0x445, 0x425},     {0x446, 0x426},     {0x447, 0x427},
-            {0x448, 0x428},     {0x449, 0x429},     {0x44a, 0x42a},
-            {0x44b, 0x42b},     {0x44c, 0x42c},     {0x44d, 0x42d},
-            {0x44e, 0x42e},     {0x44f, 0x42f},     {0x450, 0x400},
-            {0x451, 0x401},     {0x452, 0x402},     {0x453, 0x403},
-            {0x454, 0x404},     {0x455, 0x405},     {0x456, 0x406},
-            {0x457, 0x407},     {0x458, 0x408},     {0x459, 0x409},
-            {0x45a, 0x40a},     {0x45b, 0x40b},     {0x45c, 0x40c},
-            {0x45d, 0x40d},     {0x45e, 0x40e},     {0x45f, 0x40f},
-            {0x461, 0x460},     {0x463, 0x462},     {0x465, 0x464},
-            {0x467, 0x466},     {0x469, 0x468},     {0x46b, 0x46a},
-            {0x46d, 0x46c},     {0x46f, 0x46e},     {0x471, 0x470},
-            {0x473, 0x472},     {0x475, 0x474},     {0x477, 0x476},
-            {0x479, 0x478},     {0x47b, 0x47a},     {0x47d, 0x47c},
-            {0x47f, 0x47e},     {0x481, 0x480},     {0x48b, 0x48a},
-            {0x48d, 0x48c},     {0x48f, 0x48e},     {0x491, 0x490},
-            {0x493, 0x492},     {0x495, 0x494},     {0x497, 0x496},
-            {0x499, 0x498},     {0x49b, 0x49a},     {0x49d, 0x49c},
-            {0x49f, 0x49e},     {0x4a1, 0x4a0},     {0x4a3, 0x4a2},
-            {0x4a5, 0x4a4},     {0x4a7, 0x4a6},     {0x4a9, 0x4a8},
-            {0x4ab, 0x4aa},     {0x4ad, 0x4ac},     {0x4af, 0x4ae},
-            {0x4b1, 0x4b0},     {0x4b3, 0x4b2},     {0x4b5, 0x4b4},
-            {0x4b7, 0x4b6},     {0x4b9, 0x4b8},     {0x4bb, 0x4ba},
-            {0x4bd, 0x4bc},     {0x4bf, 0x4be},     {0x4c2, 0x4c1},
-            {0x4c4, 0x4c3},     {0x4c6, 0x4c5},     {0x4c8, 0x4c7},
-            {0x4ca, 0x4c9},     {0x4cc, 0x4cb},     {0x4ce, 0x4cd},
-            {0x4cf, 0x4c0},     {0x4d1, 0x4d0},     {0x4d3, 0x4d2},
-            {0x4d5, 0x4d4},     {0x4d7, 0x4d6},     {0x4d9, 0x4d8},
-            {0x4db, 0x4da},     {0x4dd, 0x4dc},     {0x4df, 0x4de},
-            {0x4e1, 0x4e0},     {0x4e3, 0x4e2},     {0x4e5, 0x4e4},
-            {0x4e7, 0x4e6},     {0x4e9, 0x4e8},     {0x4eb, 0x4ea},
-            {0x4ed, 0x4ec},     {0x4ef, 0x4ee},     {0x4f1, 0x4f0},
-            {0x4f3, 0x4f2},     {0x4f5, 0x4f4},     {0x4f7, 0x4f6},
-            {0x4f9, 0x4f8},     {0x4fb, 0x4fa},     {0x4fd, 0x4fc},
-            {0x4ff, 0x4fe},     {0x501, 0x500},     {0x503, 0x502},
-            {0x505, 0x504},     {0x507, 0x506},     {0x509, 0x508},
-            {0x50b, 0x50a},     {0x50d, 0x50c},     {0x50f, 0x50e},
-            {0x511, 0x510},     {0x513, 0x512},     {0x515, 0x514},
-            {0x517, 0x516},     {0x519, 0x518},     {0x51b, 0x51a},
-            {0x51d, 0x51c},     {0x51f, 0x51e},     {0x521, 0x520},
-            {0x523, 0x522},     {0x525, 0x524},     {0x527, 0x526},
-            {0x529, 0x528},     {0x52b, 0x52a},     {0x52d, 0x52c},
-            {0x52f, 0x52e},     {0x561, 0x531},     {0x562, 0x532},
-            {0x563, 0x533},     {0x564, 0x534},     {0x565, 0x535},
-            {0x566, 0x536},     {0x567, 0x537},     {0x568, 0x538},
-            {0x569, 0x539},     {0x56a, 0x53a},     {0x56b, 0x53b},
-            {0x56c, 0x53c},     {0x56d, 0x53d},     {0x56e, 0x53e},
-            {0x56f, 0x53f},     {0x570, 0x540},     {0x571, 0x541},
-            {0x572, 0x542},     {0x573, 0x543},     {0x574, 0x544},
-            {0x575, 0x545},     {0x576, 0x546},     {0x577, 0x547},
-            {0x578, 0x548},     {0x579, 0x549},     {0x57a, 0x54a},
-            {0x57b, 0x54b},     {0x57c, 0x54c},     {0x57d, 0x54d},
-            {0x57e, 0x54e},     {0x57f, 0x54f},     {0x580, 0x550},
-            {0x581, 0x551},     {0x582, 0x552},     {0x583, 0x553},
-            {0x584, 0x554},     {0x585, 0x555},     {0x586, 0x556},
-            {0x10d0, 0x1c90},   {0x10d1, 0x1c91},   {0x10d2, 0x1c92},
-            {0x10d3, 0x1c93},   {0x10d4, 0x1c94},   {0x10d5, 0x1c95},
-            {0x10d6, 0x1c96},   {0x10d7, 0x1c97},   {0x10d8, 0x1c98},
-            {0x10d9, 0x1c99},   {0x10da, 0x1c9a},   {0x10db, 0x1c9b},
-            {0x10dc, 0x1c9c},   {0x10dd, 0x1c9d},   {0x10de, 0x1c9e},
-            {0x10df, 0x1c9f},   {0x10e0, 0x1ca0},   {0x10e1, 0x1ca1},
-            {0x10e2, 0x1ca2},   {0x10e3, 0x1ca3},   {0x10e4, 0x1ca4},
-            {0x10e5, 0x1ca5},   {0x10e6, 0x1ca6},   {0x10e7, 0x1ca7},
-            {0x10e8, 0x1ca8},   {0x10e9, 0x1ca9},   {0x10ea, 0x1caa},
-            {0x10eb, 0x1cab},   {0x10ec, 0x1cac},   {0x10ed, 0x1cad},
-            {0x10ee, 0x1cae},   {0x10ef, 0x1caf},   {0x10f0, 0x1cb0},
-            {0x10f1, 0x1cb1},   {0x10f2, 0x1cb2},   {0x10f3, 0x1cb3},
-            {0x10f4, 0x1cb4},   {0x10f5, 0x1cb5},   {0x10f6, 0x1cb6},
-            {0x10f7, 0x1cb7},   {0x10f8, 0x1cb8},   {0x10f9, 0x1cb9},
-            {0x10fa, 0x1cba},   {0x10fd, 0x1cbd},   {0x10fe, 0x1cbe},
-            {0x10ff, 0x1cbf},   {0x13f8, 0x13f0},   {0x13f9, 0x13f1},
-            {0x13fa, 0x13f2},   {0x13fb, 0x13f3},   {0x13fc, 0x13f4},
-            {0x13fd, 0x13f5},   {0x1c80, 0x412},    {0x1c81, 0x414},
-            {0x1c82, 0x41e},    {0x1c83, 0x421},    {0x1c84, 0x422},
-            {0x1c85, 0x422},    {0x1c86, 0x42a},    {0x1c87, 0x462},
-            {0x1c88, 0xa64a},   {0x1d79, 0xa77d},   {0x1d7d, 0x2c63},
-            {0x1d8e, 0xa7c6},   {0x1e01, 0x1e00},   {0x1e03, 0x1e02},
-            {0x1e05, 0x1e04},   {0x1e07, 0x1e06},   {0x1e09, 0x1e08},
-            {0x1e0b, 0x1e0a},   {0x1e0d, 0x1e0c},   {0x1e0f, 0x1e0e},
-            {0x1e11, 0x1e10},   {0x1e13, 0x1e12},   {0x1e15, 0x1e14},
-            {0x1e17, 0x1e16},   {0x1e19, 0x1e18},   {0x1e1b, 0x1e1a},
-            {0x1e1d, 0x1e1c},   {0x1e1f, 0x1e1e},   {0x1e21, 0x1e20},
-            {0x1e23, 0x1e22},   {0x1e25, 0x1e24},   {0x1e27, 0x1e26},
-            {0x1e29, 0x1e28},   {0x1e2b, 0x1e2a},   {0x1e2d, 0x1e2c},
-            {0x1e2f, 0x1e2e},   {0x1e31, 0x1e30},   {0x1e33, 0x1e32},
-            {0x1e35, 0x1e34},   {0x1e37, 0x1e36},   {0x1e39, 0x1e38},
-            {0x1e3b, 0x1e3a},   {0x1e3d, 0x1e3c},   {0x1e3f, 0x1e3e},
-            {0x1e41, 0x1e40},   {0x1e43, 0x1e42},   {0x1e45, 0x1e44},
-            {0x1e47, 0x1e46},   {0x1e49, 0x1e48},   {0x1e4b, 0x1e4a},
-            {0x1e4d, 0x1e4c},   {0x1e4f, 0x1e4e},   {0x1e51, 0x1e50},
-            {0x1e53, 0x1e52},   {0x1e55, 0x1e54},   {0x1e57, 0x1e56},
-            {0x1e59, 0x1e58},   {0x1e5b, 0x1e5a},   {0x1e5d, 0x1e5c},
-            {0x1e5f, 0x1e5e},   {0x1e61, 0x1e60},   {0x1e63, 0x1e62},
-            {0x1e65, 0x1e64},   {0x1e67, 0x1e66},   {0x1e69, 0x1e68},
-            {0x1e6b, 0x1e6a},   {0x1e6d, 0x1e6c},   {0x1e6f, 0x1e6e},
-            {0x1e71, 0x1e70},   {0x1e73, 0x1e72},   {0x1e75, 0x1e74},
-            {0x1e77, 0x1e76},   {0x1e79, 0x1e78},   {0x1e7b, 0x1e7a},
-            {0x1e7d, 0x1e7c},   {0x1e7f, 0x1e7e},   {0x1e81, 0x1e80},
-            {0x1e83, 0x1e82},   {0x1e85, 0x1e84},   {0x1e87, 0x1e86},
-            {0x1e89, 0x1e88},   {0x1e8b, 0x1e8a},   {0x1e8d, 0x1e8c},
-            {0x1e8f, 0x1e8e},   {0x1e91, 0x1e90},   {0x1e93, 0x1e92},
-            {0x1e95, 0x1e94},   {0x1e9b, 0x1e60},   {0x1ea1, 0x1ea0},
-            {0x1ea3, 0x1ea2},   {0x1ea5, 0x1ea4},   {0x1ea7, 0x1ea6},
-            {0x1ea9, 0x1ea8},   {0x1eab, 0x1eaa},   {0x1ead, 0x1eac},
-            {0x1eaf, 0x1eae},   {0x1eb1, 0x1eb0},   {0x1eb3, 0x1eb2},
-            {0x1eb5, 0x1eb4},   {0x1eb7, 0x1eb6},   {0x1eb9, 0x1eb8},
-            {0x1ebb, 0x1eba},   {0x1ebd, 0x1ebc},   {0x1ebf, 0x1ebe},
-            {0x1ec1, 0x1ec0},   {0x1ec3, 0x1ec2},   {0x1ec5, 0x1ec4},
-            {0x1ec7, 0x1ec6},   {0x1ec9, 0x1ec8},   {0x1ecb, 0x1eca},
-            {0x1ecd, 0x1ecc},   {0x1ecf, 0x1ece},   {0x1ed1, 0x1ed0},
-            {0x1ed3, 0x1ed2},   {0x1ed5, 0x1ed4},   {0x1ed7, 0x1ed6},
-            {0x1ed9, 0x1ed8},   {0x1edb, 0x1eda},   {0x1edd, 0x1edc},
-            {0x1edf, 0x1ede},   {0x1ee1, 0x1ee0},   {0x1ee3, 0x1ee2},
-            {0x1ee5, 0x1ee4},   {0x1ee7, 0x1ee6},   {0x1ee9, 0x1ee8},
-            {0x1eeb, 0x1eea},   {0x1eed, 0x1eec},   {0x1eef, 0x1eee},
-            {0x1ef1, 0x1ef0},   {0x1ef3, 0x1ef2},   {0x1ef5, 0x1ef4},
-            {0x1ef7, 0x1ef6},   {0x1ef9, 0x1ef8},   {0x1efb, 0x1efa},
-            {0x1efd, 0x1efc},   {0x1eff, 0x1efe},   {0x1f00, 0x1f08},
-            {0x1f01, 0x1f09},   {0x1f02, 0x1f0a},   {0x1f03, 0x1f0b},
-            {0x1f04, 0x1f0c},   {0x1f05, 0x1f0d},   {0x1f06, 0x1f0e},
-            {0x1f07, 0x1f0f},   {0x1f10, 0x1f18},   {0x1f11, 0x1f19},
-            {0x1f12, 0x1f1a},   {0x1f13, 0x1f1b},   {0x1f14, 0x1f1c},
-            {0x1f15, 0x1f1d},   {0x1f20, 0x1f28},   {0x1f21, 0x1f29},
-            {0x1f22, 0x1f2a},   {0x1f23, 0x1f2b},   {0x1f24, 0x1f2c},
-            {0x1f25, 0x1f2d},   {0x1f26, 0x1f2e},   {0x1f27, 0x1f2f},
-            {0x1f30, 0x1f38},   {0x1f31, 0x1f39},   {0x1f32, 0x1f3a},
-            {0x1f33, 0x1f3b},   {0x1f34, 0x1f3c},   {0x1f35, 0x1f3d},
-            {0x1f36, 0x1f3e},   {0x1f37, 0x1f3f},   {0x1f40, 0x1f48},
-            {0x1f41, 0x1f49},   {0x1f42, 0x1f4a},   {0x1f43, 0x1f4b},
-            {0x1f44, 0x1f4c},   {0x1f45, 0x1f4d},   {0x1f51, 0x1f59},
-            {0x1f53, 0x1f5b},   {0x1f55, 0x1f5d},   {0x1f57, 0x1f5f},
-            {0x1f60, 0x1f68},   {0x1f61, 0x1f69},   {0x1f62, 0x1f6a},
-            {0x1f63, 0x1f6b},   {0x1f64, 0x1f6c},   {0x1f65, 0x1f6d},
-            {0x1f66, 0x1f6e},   {0x1f67, 0x1f6f},   {0x1f70, 0x1fba},
-            {0x1f71, 0x1fbb},   {0x1f72, 0x1fc8},   {0x1f73, 0x1fc9},
-            {0x1f74, 0x1fca},   {0x1f75, 0x1fcb},   {0x1f76, 0x1fda},
-            {0x1f77, 0x1fdb},   {0x1f78, 0x1ff8},   {0x1f79, 0x1ff9},
-            {0x1f7a, 0x1fea},   {0x1f7b, 0x1feb},   {0x1f7c, 0x1ffa},
-            {0x1f7d, 0x1ffb},   {0x1f80, 0x1f88},   {0x1f81, 0x1f89},
-            {0x1f82, 0x1f8a},   {0x1f83, 0x1f8b},   {0x1f84, 0x1f8c},
-            {0x1f85, 0x1f8d},   {0x1f86, 0x1f8e},   {0x1f87, 0x1f8f},
-            {0x1f90, 0x1f98},   {0x1f91, 0x1f99},   {0x1f92, 0x1f9a},
-            {0x1f93, 0x1f9b},   {0x1f94, 0x1f9c},   {0x1f95, 0x1f9d},
-            {0x1f96, 0x1f9e},   {0x1f97, 0x1f9f},   {0x1fa0, 0x1fa8},
-            {0x1fa1, 0x1fa9},   {0x1fa2, 0x1faa},   {0x1fa3, 0x1fab},
-            {0x1fa4, 0x1fac},   {0x1fa5, 0x1fad},   {0x1fa6, 0x1fae},
-            {0x1fa7, 0x1faf},   {0x1fb0, 0x1fb8},   {0x1fb1, 0x1fb9},
-            {0x1fb3, 0x1fbc},   {0x1fbe, 0x399},    {0x1fc3, 0x1fcc},
-            {0x1fd0, 0x1fd8},   {0x1fd1, 0x1fd9},   {0x1fe0, 0x1fe8},
-            {0x1fe1, 0x1fe9},   {0x1fe5, 0x1fec},   {0x1ff3, 0x1ffc},
-            {0x214e, 0x2132},   {0x2170, 0x2160},   {0x2171, 0x2161},
-            {0x2172, 0x2162},   {0x2173, 0x2163},   {0x2174, 0x2164},
-            {0x2175, 0x2165},   {0x2176, 0x2166},   {0x2177, 0x2167},
-            {0x2178, 0x2168},   {0x2179, 0x2169},   {0x217a, 0x216a},
-            {0x217b, 0x216b},   {0x217c, 0x216c},   {0x217d, 0x216d},
-            {0x217e, 0x216e},   {0x217f, 0x216f},   {0x2184, 0x2183},
-            {0x24d0, 0x24b6},   {0x24d1, 0x24b7},   {0x24d2, 0x24b8},
-            {0x24d3, 0x24b9},   {0x24d4, 0x24ba},   {0x24d5, 0x24bb},
-            {0x24d6, 0x24bc},   {0x24d7, 0x24bd},   {0x24d8, 0x24be},
-            {0x24d9, 0x24bf},   {0x24da, 0x24c0},   {0x24db, 0x24c1},
-            {0x24dc, 0x24c2},   {0x24dd, 0x24c3},   {0x24de, 0x24c4},
-            {0x24df, 0x24c5},   {0x24e0, 0x24c6},   {0x24e1, 0x24c7},
-            {0x24e2, 0x24c8},   {0x24e3, 0x24c9},   {0x24e4, 0x24ca},
-            {0x24e5, 0x24cb},   {0x24e6, 0x24cc},   {0x24e7, 0x24cd},
-            {0x24e8, 0x24ce},   {0x24e9, 0x24cf},   {0x2c30, 0x2c00},
-            {0x2c31, 0x2c01},   {0x2c32, 0x2c02},   {0x2c33, 0x2c03},
-            {0x2c34, 0x2c04},   {0x2c35, 0x2c05},   {0x2c36, 0x2c06},
-            {0x2c37, 0x2c07},   {0x2c38, 0x2c08},   {0x2c39, 0x2c09},
-            {0x2c3a, 0x2c0a},   {0x2c3b, 0x2c0b},   {0x2c3c, 0x2c0c},
-            {0x2c3d, 0x2c0d},   {0x2c3e, 0x2c0e},   {0x2c3f, 0x2c0f},
-            {0x2c40, 0x2c10},   {0x2c41, 0x2c11},   {0x2c42, 0x2c12},
-            {0x2c43, 0x2c13},   {0x2c44, 0x2c14},   {0x2c45, 0x2c15},
-            {0x2c46, 0x2c16},   {0x2c47, 0x2c17},   {0x2c48, 0x2c18},
-            {0x2c49, 0x2c19},   {0x2c4a, 0x2c1a},   {0x2c4b, 0x2c1b},
-            {0x2c4c, 0x2c1c},   {0x2c4d, 0x2c1d},   {0x2c4e, 0x2c1e},
-            {0x2c4f, 0x2c1f},   {0x2c50, 0x2c20},   {0x2c51, 0x2c21},
-            {0x2c52, 0x2c22},   {0x2c53, 0x2c23},   {0x2c54, 0x2c24},
-            {0x2c55, 0x2c25},   {0x2c56, 0x2c26},   {0x2c57, 0x2c27},
-            {0x2c58, 0x2c28},   {0x2c59, 0x2c29},   {0x2c5a, 0x2c2a},
-            {0x2c5b, 0x2c2b},   {0x2c5c, 0x2c2c},   {0x2c5d, 0x2c2d},
-            {0x2c5e, 0x2c2e},   {0x2c61, 0x2c60},   {0x2c65, 0x23a},
-            {0x2c66, 0x23e},    {0x2c68, 0x2c67},   {0x2c6a, 0x2c69},
-            {0x2c6c, 0x2c6b},   {0x2c73, 0x2c72},   {0x2c76, 0x2c75},
-            {0x2c81, 0x2c80},   {0x2c83, 0x2c82},   {0x2c85, 0x2c84},
-            {0x2c87, 0x2c86},   {0x2c89, 0x2c88},   {0x2c8b, 0x2c8a},
-            {0x2c8d, 0x2c8c},   {0x2c8f, 0x2c8e},   {0x2c91, 0x2c90},
-            {0x2c93, 0x2c92},   {0x2c95, 0x2c94},   {0x2c97, 0x2c96},
-            {0x2c99, 0x2c98},   {0x2c9b, 0x2c9a},   {0x2c9d, 0x2c9c},
-            {0x2c9f, 0x2c9e},   {0x2ca1, 0x2ca0},   {0x2ca3, 0x2ca2},
-            {0x2ca5, 0x2ca4},   {0x2ca7, 0x2ca6},   {0x2ca9, 0x2ca8},
-            {0x2cab, 0x2caa},   {0x2cad, 0x2cac},   {0x2caf, 0x2cae},
-            {0x2cb1, 0x2cb0},   {0x2cb3, 0x2cb2},   {0x2cb5, 0x2cb4},
-            {0x2cb7, 0x2cb6},   {0x2cb9, 0x2cb8},   {0x2cbb, 0x2cba},
-            {0x2cbd, 0x2cbc},   {0x2cbf, 0x2cbe},   {0x2cc1, 0x2cc0},
-            {0x2cc3, 0x2cc2},   {0x2cc5, 0x2cc4},   {0x2cc7, 0x2cc6},
-            {0x2cc9, 0x2cc8},   {0x2ccb, 0x2cca},   {0x2ccd, 0x2ccc},
-            {0x2ccf, 0x2cce},   {0x2cd1, 0x2cd0},   {0x2cd3, 0x2cd2},
-            {0x2cd5, 0x2cd4},   {0x2cd7, 0x2cd6},   {0x2cd9, 0x2cd8},
-            {0x2cdb, 0x2cda},   {0x2cdd, 0x2cdc},   {0x2cdf, 0x2cde},
-            {0x2ce1, 0x2ce0},   {0x2ce3, 0x2ce2},   {0x2cec, 0x2ceb},
-            {0x2cee, 0x2ced},   {0x2cf3, 0x2cf2},   {0x2d00, 0x10a0},
-            {0x2d01, 0x10a1},   {0x2d02, 0x10a2},   {0x2d03, 0x10a3},
-            {0x2d04, 0x10a4},   {0x2d05, 0x10a5},   {0x2d06, 0x10a6},
-            {0x2d07, 0x10a7},   {0x2d08, 0x10a8},   {0x2d09, 0x10a9},
-            {0x2d0a, 0x10aa},   {0x2d0b, 0x10ab},   {0x2d0c, 0x10ac},
-            {0x2d0d, 0x10ad},   {0x2d0e, 0x10ae},   {0x2d0f, 0x10af},
-            {0x2d10, 0x10b0},   {0x2d11, 0x10b1},   {0x2d12, 0x10b2},
-            {0x2d13, 0x10b3},   {0x2d14, 0x10b4},   {0x2d15, 0x10b5},
-            {0x2d16, 0x10b6},   {0x2d17, 0x10b7},   {0x2d18, 0x10b8},
-            {0x2d19, 0x10b9},   {0x2d1a, 0x10ba},   {0x2d1b, 0x10bb},
-            {0x2d1c, 0x10bc},   {0x2d1d, 0x10bd},   {0x2d1e, 0x10be},
-            {0x2d1f, 0x10bf},   {0x2d20, 0x10c0},   {0x2d21, 0x10c1},
-            {0x2d22, 0x10c2},   {0x2d23, 0x10c3},   {0x2d24, 0x10c4},
-            {0x2d25, 0x10c5},   {0x2d27, 0x10c7},   {0x2d2d, 0x10cd},
-            {0xa641, 0xa640},   {0xa643, 0xa642},   {0xa645, 0xa644},
-            {0xa647, 0xa646},   {0xa649, 0xa648},   {0xa64b, 0xa64a},
-            {0xa64d, 0xa64c},   {0xa64f, 0xa64e},   {0xa651, 0xa650},
-            {0xa653, 0xa652},   {0xa655, 0xa654},   {0xa657, 0xa656},
-            {0xa659, 0xa658},   {0xa65b, 0xa65a},   {0xa65d, 0xa65c},
-            {0xa65f, 0xa65e},   {0xa661, 0xa660},   {0xa663, 0xa662},
-            {0xa665, 0xa664},   {0xa667, 0xa666},   {0xa669, 0xa668},
-            {0xa66b, 0xa66a},   {0xa66d, 0xa66c},   {0xa681, 0xa680},
-            {0xa683, 0xa682},   {0xa685, 0xa684},   {0xa687, 0xa686},
-            {0xa689, 0xa688},   {0xa68b, 0xa68a},   {0xa68d, 0xa68c},
-            {0xa68f, 0xa68e},   {0xa691, 0xa690},   {0xa693, 0xa692},
-            {0xa695, 0xa694},   {0xa697, 0xa696},   {0xa699, 0xa698},
-            {0xa69b, 0xa69a},   {0xa723, 0xa722},   {0xa725, 0xa724},
-            {0xa727, 0xa726},   {0xa729, 0xa728},   {0xa72b, 0xa72a},
-            {0xa72d, 0xa72c},   {0xa72f, 0xa72e},   {0xa733, 0xa732},
-            {0xa735, 0xa734},   {0xa737, 0xa736},   {0xa739, 0xa738},
-            {0xa73b, 0xa73a},   {0xa73d, 0xa73c},   {0xa73f, 0xa73e},
-            {0xa741, 0xa740},   {0xa743, 0xa742},   {0xa745, 0xa744},
-            {0xa747, 0xa746},   {0xa749, 0xa748},   {0xa74b, 0xa74a},
-            {0xa74d, 0xa74c},   {0xa74f, 0xa74e},   {0xa751, 0xa750},
-            {0xa753, 0xa752},   {0xa755, 0xa754},   {0xa757, 0xa756},
-            {0xa759, 0xa758},   {0xa75b, 0xa75a},   {0xa75d, 0xa75c},
-            {0xa75f, 0xa75e},   {0xa761, 0xa760},   {0xa763, 0xa762},
-            {0xa765, 0xa764},   {0xa767, 0xa766},   {0xa769, 0xa768},
-            {0xa76b, 0xa76a},   {0xa76d, 0xa76c},   {0xa76f, 0xa76e},
-            {0xa77a, 0xa779},   {0xa77c, 0xa77b},   {0xa77f, 0xa77e},
-            {0xa781, 0xa780},   {0xa783, 0xa782},   {0xa785, 0xa784},
-            {0xa787, 0xa786},   {0xa78c, 0xa78b},   {0xa791, 0xa790},
-            {0xa793, 0xa792},   {0xa794, 0xa7c4},   {0xa797, 0xa796},
-            {0xa799, 0xa798},   {0xa79b, 0xa79a},   {0xa79d, 0xa79c},
-            {0xa79f, 0xa79e},   {0xa7a1, 0xa7a0},   {0xa7a3, 0xa7a2},
-            {0xa7a5, 0xa7a4},   {0xa7a7, 0xa7a6},   {0xa7a9, 0xa7a8},
-            {0xa7b5, 0xa7b4},   {0xa7b7, 0xa7b6},   {0xa7b9, 0xa7b8},
-            {0xa7bb, 0xa7ba},   {0xa7bd, 0xa7bc},   {0xa7bf, 0xa7be},
-            {0xa7c3, 0xa7c2},   {0xa7c8, 0xa7c7},   {0xa7ca, 0xa7c9},
-            {0xa7f6, 0xa7f5},   {0xab53, 0xa7b3},   {0xab70, 0x13a0},
-            {0xab71, 0x13a1},   {0xab72, 0x13a2},   {0xab73, 0x13a3},
-            {0xab74, 0x13a4},   {0xab75, 0x13a5},   {0xab76, 0x13a6},
-            {0xab77, 0x13a7},   {0xab78, 0x13a8},   {0xab79, 0x13a9},
-            {0xab7a, 0x13aa},   {0xab7b, 0x13ab},   {0xab7c, 0x13ac},
-            {0xab7d, 0x13ad},   {0xab7e, 0x13ae},   {0xab7f, 0x13af},
-            {0xab80, 0x13b0},   {0xab81, 0x13b1},   {0xab82, 0x13b2},
-            {0xab83, 0x13b3},   {0xab84, 0x13b4},   {0xab85, 0x13b5},
-            {0xab86, 0x13b6},   {0xab87, 0x13b7},   {0xab88, 0x13b8},
-            {0xab89, 0x13b9},   {0xab8a, 0x13ba},   {0xab8b, 0x13bb},
-            {0xab8c, 0x13bc},   {0xab8d, 0x13bd},   {0xab8e, 0x13be},
-            {0xab8f, 0x13bf},   {0xab90, 0x13c0},   {0xab91, 0x13c1},
-            {0xab92, 0x13c2},   {0xab93, 0x13c3},   {0xab94, 0x13c4},
-            {0xab95, 0x13c5},   {0xab96, 0x13c6},   {0xab97, 0x13c7},
-            {0xab98, 0x13c8},   {0xab99, 0x13c9},   {0xab9a, 0x13ca},
-            {0xab9b, 0x13cb},   {0xab9c, 0x13cc},   {0xab9d, 0x13cd},
-            {0xab9e, 0x13ce},   {0xab9f, 0x13cf},   {0xaba0, 0x13d0},
-            {0xaba1, 0x13d1},   {0xaba2, 0x13d2},   {0xaba3, 0x13d3},
-            {0xaba4, 0x13d4},   {0xaba5, 0x13d5},   {0xaba6, 0x13d6},
-            {0xaba7, 0x13d7},   {0xaba8, 0x13d8},   {0xaba9, 0x13d9},
-            {0xabaa, 0x13da},   {0xabab, 0x13db},   {0xabac, 0x13dc},
-            {0xabad, 0x13dd},   {0xabae, 0x13de},   {0xabaf, 0x13df},
-            {0xabb0, 0x13e0},   {0xabb1, 0x13e1},   {0xabb2, 0x13e2},
-            {0xabb3, 0x13e3},   {0xabb4, 0x13e4},   {0xabb5, 0x13e5},
-            {0xabb6, 0x13e6},   {0xabb7, 0x13e7},   {0xabb8, 0x13e8},
-            {0xabb9, 0x13e9},   {0xabba, 0x13ea},   {0xabbb, 0x13eb},
-            {0xabbc, 0x13ec},   {0xabbd, 0x13ed},   {0xabbe, 0x13ee},
-            {0xabbf, 0x13ef},   {0xff41, 0xff21},   {0xff42, 0xff22},
-            {0xff43, 0xff23},   {0xff44, 0xff24},   {0xff45, 0xff25},
-            {0xff46, 0xff26},   {0xff47, 0xff27},   {0xff48, 0xff28},
-            {0xff49, 0xff29},   {0xff4a, 0xff2a},   {0xff4b, 0xff2b},
-            {0xff4c, 0xff2c},   {0xff4d, 0xff2d},   {0xff4e, 0xff2e},
-            {0xff4f, 0xff2f},   {0xff50, 0xff30},   {0xff51, 0xff31},
-            {0xff52, 0xff32},   {0xff53, 0xff33},   {0xff54, 0xff34},
-            {0xff55, 0xff35},   {0xff56, 0xff36},   {0xff57, 0xff37},
-            {0xff58, 0xff38},   {0xff59, 0xff39},   {0xff5a, 0xff3a},
-            {0x10428, 0x10400}, {0x10429, 0x10401}, {0x1042a, 0x10402},
-            {0x1042b, 0x10403}, {0x1042c, 0x10404}, {0x1042d, 0x10405},
-            {0x1042e, 0x10406}, {0x1042f, 0x10407}, {0x10430, 0x10408},
-            {0x10431, 0x10409}, {0x10432, 0x1040a}, {0x10433, 0x1040b},
-            {0x10434, 0x1040c}, {0x10435, 0x1040d}, {0x10436, 0x1040e},
-            {0x10437, 0x1040f}, {0x10438, 0x10410}, {0x10439, 0x10411},
-            {0x1043a, 0x10412}, {0x1043b, 0x10413}, {0x1043c, 0x10414},
-            {0x1043d, 0x10415}, {0x1043e, 0x10416}, {0x1043f, 0x10417},
-            {0x10440, 0x10418}, {0x10441, 0x10419}, {0x10442, 0x1041a},
-            {0x10443, 0x1041b}, {0x10444, 0x1041c}, {0x10445, 0x1041d},
-            {0x10446, 0x1041e}, {0x10447, 0x1041f}, {0x10448, 0x10420},
-            {0x10449, 0x10421}, {0x1044a, 0x10422}, {0x1044b, 0x10423},
-            {0x1044c, 0x10424}, {0x1044d, 0x10425}, {0x1044e, 0x10426},
-            {0x1044f, 0x10427}, {0x104d8, 0x104b0}, {0x104d9, 0x104b1},
-            {0x104da, 0x104b2}, {0x104db, 0x104b3}, {0x104dc, 0x104b4},
-            {0x104dd, 0x104b5}, {0x104de, 0x104b6}, {0x104df, 0x104b7},
-            {0x104e0, 0x104b8}, {0x104e1, 0x104b9}, {0x104e2, 0x104ba},
-            {0x104e3, 0x104bb}, {0x104e4, 0x104bc}, {0x104e5, 0x104bd},
-            {0x104e6, 0x104be}, {0x104e7, 0x104bf}, {0x104e8, 0x104c0},
-            {0x104e9, 0x104c1}, {0x104ea, 0x104c2}, {0x104eb, 0x104c3},
-            {0x104ec, 0x104c4}, {0x104ed, 0x104c5}, {0x104ee, 0x104c6},
-            {0x104ef, 0x104c7}, {0x104f0, 0x104c8}, {0x104f1, 0x104c9},
-            {0x104f2, 0x104ca}, {0x104f3, 0x104cb}, {0x104f4, 0x104cc},
-            {0x104f5, 0x104cd}, {0x104f6, 0x104ce}, {0x104f7, 0x104cf},
-            {0x104f8, 0x104d0}, {0x104f9, 0x104d1}, {0x104fa, 0x104d2},
-            {0x104fb, 0x104d3}, {0x10cc0, 0x10c80}, {0x10cc1, 0x10c81},
-            {0x10cc2, 0x10c82}, {0x10cc3, 0x10c83}, {0x10cc4, 0x10c84},
-            {0x10cc5, 0x10c85}, {0x10cc6, 0x10c86}, {0x10cc7, 0x10c87},
-            {0x10cc8, 0x10c88}, {0x10cc9, 0x10c89}, {0x10cca, 0x10c8a},
-            {0x10ccb, 0x10c8b}, {0x10ccc, 0x10c8c}, {0x10ccd, 0x10c8d},
-            {0x10cce, 0x10c8e}, {0x10ccf, 0x10c8f}, {0x10cd0, 0x10c90},
-            {0x10cd1, 0x10c91}, {0x10cd2, 0x10c92}, {0x10cd3, 0x10c93},
-            {0x10cd4, 0x10c94}, {0x10cd5, 0x10c95}, {0x10cd6, 0x10c96},
-            {0x10cd7, 0x10c97}, {0x10cd8, 0x10c98}, {0x10cd9, 0x10c99},
-            {0x10cda, 0x10c9a}, {0x10cdb, 0x10c9b}, {0x10cdc, 0x10c9c},
-            {0x10cdd, 0x10c9d}, {0x10cde, 0x10c9e}, {0x10cdf, 0x10c9f},
-            {0x10ce0, 0x10ca0}, {0x10ce1, 0x10ca1}, {0x10ce2, 0x10ca2},
-            {0x10ce3, 0x10ca3}, {0x10ce4, 0x10ca4}, {0x10ce5, 0x10ca5},
-            {0x10ce6, 0x10ca6}, {0x10ce7, 0x10ca7}, {0x10ce8, 0x10ca8},
-            {0x10ce9, 0x10ca9}, {0x10cea, 0x10caa}, {0x10ceb, 0x10cab},
-            {0x10cec, 0x10cac}, {0x10ced, 0x10cad}, {0x10cee, 0x10cae},
-            {0x10cef, 0x10caf}, {0x10cf0, 0x10cb0}, {0x10cf1, 0x10cb1},
-            {0x10cf2, 0x10cb2}, {0x118c0, 0x118a0}, {0x118c1, 0x118a1},
-            {0x118c2, 0x118a2}, {0x118c3, 0x118a3}, {0x118c4, 0x118a4},
-            {0x118c5, 0x118a5}, {0x118c6, 0x118a6}, {0x118c7, 0x118a7},
-            {0x118c8, 0x118a8}, {0x118c9, 0x118a9}, {0x118ca, 0x118aa},
-            {0x118cb, 0x118ab}, {0x118cc, 0x118ac}, {0x118cd, 0x118ad},
-            {0x118ce, 0x118ae}, {0x118cf, 0x118af}, {0x118d0, 0x118b0},
-            {0x118d1, 0x118b1}, {0x118d2, 0x118b2}, {0x118d3, 0x118b3},
-            {0x118d4, 0x118b4}, {0x118d5, 0x118b5}, {0x118d6, 0x118b6},
-            {0x118d7, 0x118b7}, {0x118d8, 0x118b8}, {0x118d9, 0x118b9},
-            {0x118da, 0x118ba}, {0x118db, 0x118bb}, {0x118dc, 0x118bc},
-            {0x118dd, 0x118bd}, {0x118de, 0x118be}, {0x118df, 0x118bf},
-            {0x16e60, 0x16e40}, {0x16e61, 0x16e41}, {0x16e62, 0x16e42},
-            {0x16e63, 0x16e43}, {0x16e64, 0x16e44}, {0x16e65, 0x16e45},
-            {0x16e66, 0x16e46}, {0x16e67, 0x16e47}, {0x16e68, 0x16e48},
-            {0x16e69, 0x16e49}, {0x16e6a, 0x16e4a}, {0x16e6b, 0x16e4b},
-            {0x16e6c, 0x16e4c}, {0x16e6d, 0x16e4d}, {0x16e6e, 0x16e4e},
-            {0x16e6f, 0x16e4f}, {0x16e70, 0x16e50}, {0x16e71, 0x16e51},
-            {0x16e72, 0x16e52}, {0x16e73, 0x16e53}, {0x16e74, 0x16e54},
-            {0x16e75, 0x16e55}, {0x16e76, 0x16e56}, {0x16e77, 0x16e57},
-            {0x16e78, 0x16e58}, {0x16e79, 0x16e59}, {0x16e7a, 0x16e5a},
-            {0x16e7b, 0x16e5b}, {0x16e7c, 0x16e5c}, {0x16e7d, 0x16e5d},
-            {0x16e7e, 0x16e5e}, {0x16e7f, 0x16e5f}, {0x1e922, 0x1e900},
-            {0x1e923, 0x1e901}, {0x1e924, 0x1e902}, {0x1e925, 0x1e903},
-            {0x1e926, 0x1e904}, {0x1e927, 0x1e905}, {0x1e928, 0x1e906},
-            {0x1e929, 0x1e907}, {0x1e92a, 0x1e908}, {0x1e92b, 0x1e909},
-            {0x1e92c, 0x1e90a}, {0x1e92d, 0x1e90b}, {0x1e92e, 0x1e90c},
-            {0x1e92f, 0x1e90d}, {0x1e930, 0x1e90e}, {0x1e931, 0x1e90f},
-            {0x1e932, 0x1e910}, {0x1e933, 0x1e911}, {0x1e934, 0x1e912},
-            {0x1e935, 0x1e913}, {0x1e936, 0x1e914}, {0x1e937, 0x1e915},
-            {0x1e938, 0x1e916}, {0x1e939, 0x1e917}, {0x1e93a, 0x1e918},
-            {0x1e93b, 0x1e919}, {0x1e93c, 0x1e91a}, {0x1e93d, 0x1e91b},
-            {0x1e93e, 0x1e91c}, {0x1e93f, 0x1e91d}, {0x1e940, 0x1e91e},
-            {0x1e941, 0x1e91f}, {0x1e942, 0x1e920}, {0x1e943, 0x1e921},
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 0, 0, 0, 0, 0,
+            },
+            {
+                32, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 0,
+                32, 32, 32, 32, 32, 32, 32, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                -199, 0, 1, 0, 1, 0, 1, 0,
+                0, 1, 0, 1, 0, 1, 0, 1,
+            },
+            {
+                0, 1, 0, 1, 0, 1, 0, 1,
+                0, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                -121, 1, 0, 1, 0, 1, 0, 0,
+            },
+            {
+                0, 210, 1, 0, 1, 0, 206, 1,
+                0, 205, 205, 1, 0, 0, 79, 202,
+                203, 1, 0, 205, 207, 0, 211, 209,
+                1, 0, 0, 0, 211, 213, 0, 214,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 218, 1,
+                0, 218, 0, 0, 1, 0, 218, 1,
+                0, 217, 217, 1, 0, 1, 0, 219,
+                1, 0, 0, 0, 1, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 2, 1, 0, 2,
+                1, 0, 2, 1, 0, 1, 0, 1,
+                0, 1, 0, 1, 0, 1, 0, 1,
+                0, 1, 0, 1, 0, 0, 1, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                0, 2, 1, 0, 1, 0, -97, -56,
+                1, 0, 1, 0, 1, 0, 1, 0,
+            },
+            {
+                -130, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 0, 0, 0, 0,
+                0, 0, 10795, 1, 0, -163, 10792, 0,
+            },
+            {
+                0, 1, 0, -195, 69, 71, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                1, 0, 1, 0, 0, 0, 1, 0,
+                0, 0, 0, 0, 0, 0, 0, 116,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 38, 0,
+                37, 37, 37, 0, 64, 0, 63, 63,
+                0, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 32,
+            },
+            {
+                32, 32, 0, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                0, 0, 0, 0, -60, 0, 0, 1,
+                0, -7, 1, 0, 0, -130, -130, -130,
+            },
+            {
+                80, 80, 80, 80, 80, 80, 80, 80,
+                80, 80, 80, 80, 80, 80, 80, 80,
+                32, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 32,
+            },
+            {
+                32, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 32,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+            },
+            {
+                15, 1, 0, 1, 0, 1, 0, 1,
+                0, 1, 0, 1, 0, 1, 0, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                0, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48,
+            },
+            {
+                48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+                7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+                7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+                7264, 7264, 7264, 7264, 7264, 7264, 7264, 7264,
+            },
+            {
+                7264, 7264, 7264, 7264, 7264, 7264, 0, 7264,
+                0, 0, 0, 0, 0, 7264, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                38864, 38864, 38864, 38864, 38864, 38864, 38864, 38864,
+                38864, 38864, 38864, 38864, 38864, 38864, 38864, 38864,
+                38864, 38864, 38864, 38864, 38864, 38864, 38864, 38864,
+                38864, 38864, 38864, 38864, 38864, 38864, 38864, 38864,
+            },
+            {
+                38864, 38864, 38864, 38864, 38864, 38864, 38864, 38864,
+                38864, 38864, 38864, 38864, 38864, 38864, 38864, 38864,
+                8, 8, 8, 8, 8, 8, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008,
+                -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008,
+            },
+            {
+                -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008,
+                -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008,
+                -3008, -3008, -3008, -3008, -3008, -3008, -3008, -3008,
+                -3008, -3008, -3008, 0, 0, -3008, -3008, -3008,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, -7615, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -8, -8, -8, -8, -8, -8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -8, -8, -8, -8, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -8, -8, -8, -8, -8, -8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -8, -8, -8, -8, -8, -8,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -8, -8, -8, -8, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, -8, 0, -8, 0, -8, 0, -8,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -8, -8, -8, -8, -8, -8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -8, -8, -8, -8, -8, -8,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -74, -74, -9, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -86, -86, -86, -86, -9, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -100, -100, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -8, -8, -112, -112, -7, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                -128, -128, -126, -126, -9, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, -7517, 0,
+                0, 0, -8383, -8262, 0, 0, 0, 0,
+                0, 0, 28, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                16, 16, 16, 16, 16, 16, 16, 16,
+                16, 16, 16, 16, 16, 16, 16, 16,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 1, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 26, 26,
+                26, 26, 26, 26, 26, 26, 26, 26,
+            },
+            {
+                26, 26, 26, 26, 26, 26, 26, 26,
+                26, 26, 26, 26, 26, 26, 26, 26,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48,
+            },
+            {
+                48, 48, 48, 48, 48, 48, 48, 48,
+                48, 48, 48, 48, 48, 48, 48, 48,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 0, -10743, -3814, -10727, 0, 0, 1,
+                0, 1, 0, 1, 0, -10780, -10749, -10783,
+                -10782, 0, 1, 0, 0, 1, 0, 0,
+                0, 0, 0, 0, 0, 0, -10815, -10815,
+            },
+            {
+                1, 0, 1, 0, 0, 0, 0, 0,
+                0, 0, 0, 1, 0, 1, 0, 0,
+                0, 0, 1, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                0, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 1, 0, 1, 0, -35332, 1, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                0, 0, 0, 1, 0, -42280, 0, 0,
+                1, 0, 1, 0, 0, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+            },
+            {
+                1, 0, 1, 0, 1, 0, 1, 0,
+                1, 0, -42308, -42319, -42315, -42305, -42308, 0,
+                -42258, -42282, -42261, 928, 1, 0, 1, 0,
+                1, 0, 1, 0, 1, 0, 1, 0,
+            },
+            {
+                1, 0, 1, 0, -48, -42307, -35384, 1,
+                0, 1, 0, 0, 0, 0, 0, 0,
+                1, 0, 0, 0, 0, 0, 1, 0,
+                1, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 1, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                40, 40, 40, 40, 40, 40, 40, 40,
+                40, 40, 40, 40, 40, 40, 40, 40,
+                40, 40, 40, 40, 40, 40, 40, 40,
+                40, 40, 40, 40, 40, 40, 40, 40,
+            },
+            {
+                40, 40, 40, 40, 40, 40, 40, 40,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                40, 40, 40, 40, 40, 40, 40, 40,
+                40, 40, 40, 40, 40, 40, 40, 40,
+            },
+            {
+                40, 40, 40, 40, 40, 40, 40, 40,
+                40, 40, 40, 40, 40, 40, 40, 40,
+                40, 40, 40, 40, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                39, 39, 39, 39, 39, 39, 39, 39,
+                39, 39, 39, 0, 39, 39, 39, 39,
+            },
+            {
+                39, 39, 39, 39, 39, 39, 39, 39,
+                39, 39, 39, 0, 39, 39, 39, 39,
+                39, 39, 39, 0, 39, 39, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64,
+            },
+            {
+                64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 64, 64, 64, 64, 64,
+                64, 64, 64, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                32, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 32,
+                32, 32, 32, 32, 32, 32, 32, 32,
+            },
+            {
+                34, 34, 34, 34, 34, 34, 34, 34,
+                34, 34, 34, 34, 34, 34, 34, 34,
+                34, 34, 34, 34, 34, 34, 34, 34,
+                34, 34, 34, 34, 34, 34, 34, 34,
+            },
+            {
+                34, 34, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0,
+            },
         };
+        // end generated lower_case
+
+        template<size_t Blocks, size_t Rows>
+        int32_t case_delta(char32_t ch, const uint8_t (&blocks)[Blocks], const int32_t (&deltas)[Rows][case_block_size])
+        {
+            const auto block = ch >> case_block_shift;
+            return block < Blocks ? deltas[blocks[block]][ch & (case_block_size - 1)] : 0;
+        }
 
-        const std::unordered_map<char32_t, char32_t> lower_map
+        // Full case mappings that differ from the simple ones: the expansions of SpecialCasing.txt
+        // without the conditional rules, and titlecase where it is not the uppercase. Unused
+        // code units are 0.
+        struct special_casing
         {
-            {0x41, 0x61},       {0x42, 0x62},       {0x43, 0x63},
-            {0x44, 0x64},       {0x45, 0x65},       {0x46, 0x66},
-            {0x47, 0x67},       {0x48, 0x68},       {0x49, 0x69},
-            {0x4a, 0x6a},       {0x4b, 0x6b},       {0x4c, 0x6c},
-            {0x4d, 0x6d},       {0x4e, 0x6e},       {0x4f, 0x6f},
-            {0x50, 0x70},       {0x51, 0x71},       {0x52, 0x72},
-            {0x53, 0x73},       {0x54, 0x74},       {0x55, 0x75},
-            {0x56, 0x76},       {0x57, 0x77},       {0x58, 0x78},
-            {0x59, 0x79},       {0x5a, 0x7a},       {0xc0, 0xe0},
-            {0xc1, 0xe1},       {0xc2, 0xe2},       {0xc3, 0xe3},
-            {0xc4, 0xe4},       {0xc5, 0xe5},       {0xc6, 0xe6},
-            {0xc7, 0xe7},       {0xc8, 0xe8},       {0xc9, 0xe9},
-            {0xca, 0xea},       {0xcb, 0xeb},       {0xcc, 0xec},
-            {0xcd, 0xed},       {0xce, 0xee},       {0xcf, 0xef},
-            {0xd0, 0xf0},       {0xd1, 0xf1},       {0xd2, 0xf2},
-            {0xd3, 0xf3},       {0xd4, 0xf4},       {0xd5, 0xf5},
-            {0xd6, 0xf6},       {0xd8, 0xf8},       {0xd9, 0xf9},
-            {0xda, 0xfa},       {0xdb, 0xfb},       {0xdc, 0xfc},
-            {0xdd, 0xfd},       {0xde, 0xfe},       {0x100, 0x101},
-            {0x102, 0x103},     {0x104, 0x105},     {0x106, 0x107},
-            {0x108, 0x109},     {0x10a, 0x10b},     {0x10c, 0x10d},
-            {0x10e, 0x10f},     {0x110, 0x111},     {0x112, 0x113},
-            {0x114, 0x115},     {0x116, 0x117},     {0x118, 0x119},
-            {0x11a, 0x11b},     {0x11c, 0x11d},     {0x11e, 0x11f},
-            {0x120, 0x121},     {0x122, 0x123},     {0x124, 0x125},
-            {0x126, 0x127},     {0x128, 0x129},     {0x12a, 0x12b},
-            {0x12c, 0x12d},     {0x12e, 0x12f},     {0x130, 0x69},
-            {0x132, 0x133},     {0x134, 0x135},     {0x136, 0x137},
-            {0x139, 0x13a},     {0x13b, 0x13c},     {0x13d, 0x13e},
-            {0x13f, 0x140},     {0x141, 0x142},     {0x143, 0x144},
-            {0x145, 0x146},     {0x147, 0x148},     {0x14a, 0x14b},
-            {0x14c, 0x14d},     {0x14e, 0x14f},     {0x150, 0x151},
-            {0x152, 0x153},     {0x154, 0x155},     {0x156, 0x157},
-            {0x158, 0x159},     {0x15a, 0x15b},     {0x15c, 0x15d},
-            {0x15e, 0x15f},     {0x160, 0x161},     {0x162, 0x163},
-            {0x164, 0x165},     {0x166, 0x167},     {0x168, 0x169},
-            {0x16a, 0x16b},     {0x16c, 0x16d},     {0x16e, 0x16f},
-            {0x170, 0x171},     {0x172, 0x173},     {0x174, 0x175},
-            {0x176, 0x177},     {0x178, 0xff},      {0x179, 0x17a},
-            {0x17b, 0x17c},     {0x17d, 0x17e},     {0x181, 0x253},
-            {0x182, 0x183},     {0x184, 0x185},     {0x186, 0x254},
-            {0x187, 0x188},     {0x189, 0x256},     {0x18a, 0x257},
-            {0x18b, 0x18c},     {0x18e, 0x1dd},     {0x18f, 0x259},
-            {0x190, 0x25b},     {0x191, 0x192},     {0x193, 0x260},
-            {0x194, 0x263},     {0x196, 0x269},     {0x197, 0x268},
-            {0x198, 0x199},     {0x19c, 0x26f},     {0x19d, 0x272},
-            {0x19f, 0x275},     {0x1a0, 0x1a1},     {0x1a2, 0x1a3},
-            {0x1a4, 0x1a5},     {0x1a6, 0x280},     {0x1a7, 0x1a8},
-            {0x1a9, 0x283},     {0x1ac, 0x1ad},     {0x1ae, 0x288},
-            {0x1af, 0x1b0},     {0x1b1, 0x28a},     {0x1b2, 0x28b},
-            {0x1b3, 0x1b4},     {0x1b5, 0x1b6},     {0x1b7, 0x292},
-            {0x1b8, 0x1b9},     {0x1bc, 0x1bd},     {0x1c4, 0x1c6},
-            {0x1c5, 0x1c6},     {0x1c7, 0x1c9},     {0x1c8, 0x1c9},
-            {0x1ca, 0x1cc},     {0x1cb, 0x1cc},     {0x1cd, 0x1ce},
-            {0x1cf, 0x1d0},     {0x1d1, 0x1d2},     {0x1d3, 0x1d4},
-            {0x1d5, 0x1d6},     {0x1d7, 0x1d8},     {0x1d9, 0x1da},
-            {0x1db, 0x1dc},     {0x1de, 0x1df},     {0x1e0, 0x1e1},
-            {0x1e2, 0x1e3},     {0x1e4, 0x1e5},     {0x1e6, 0x1e7},
-            {0x1e8, 0x1e9},     {0x1ea, 0x1eb},     {0x1ec, 0x1ed},
-            {0x1ee, 0x1ef},     {0x1f1, 0x1f3},     {0x1f2, 0x1f3},
-            {0x1f4, 0x1f5},     {0x1f6, 0x195},     {0x1f7, 0x1bf},
-            {0x1f8, 0x1f9},     {0x1fa, 0x1fb},     {0x1fc, 0x1fd},
-            {0x1fe, 0x1ff},     {0x200, 0x201},     {0x202, 0x203},
-            {0x204, 0x205},     {0x206, 0x207},     {0x208, 0x209},
-            {0x20a, 0x20b},     {0x20c, 0x20d},     {0x20e, 0x20f},
-            {0x210, 0x211},     {0x212, 0x213},     {0x214, 0x215},
-            {0x216, 0x217},     {0x218, 0x219},     {0x21a, 0x21b},
-            {0x21c, 0x21d},     {0x21e, 0x21f},     {0x220, 0x19e},
-            {0x222, 0x223},     {0x224, 0x225},     {0x226, 0x227},
-            {0x228, 0x229},     {0x22a, 0x22b},     {0x22c, 0x22d},
-            {0x22e, 0x22f},     {0x230, 0x231},     {0x232, 0x233},
-            {0x23a, 0x2c65},    {0x23b, 0x23c},     {0x23d, 0x19a},
-            {0x23e, 0x2c66},    {0x241, 0x242},     {0x243, 0x180},
-            {0x244, 0x289},     {0x245, 0x28c},     {0x246, 0x247},
-            {0x248, 0x249},     {0x24a, 0x24b},     {0x24c, 0x24d},
-            {0x24e, 0x24f},     {0x370, 0x371},     {0x372, 0x373},
-            {0x376, 0x377},     {0x37f, 0x3f3},     {0x386, 0x3ac},
-            {0x388, 0x3ad},     {0x389, 0x3ae},     {0x38a, 0x3af},
-            {0x38c, 0x3cc},     {0x38e, 0x3cd},     {0x38f, 0x3ce},
-            {0x391, 0x3b1},     {0x392, 0x3b2},     {0x393, 0x3b3},
-            {0x394, 0x3b4},     {0x395, 0x3b5},     {0x396, 0x3b6},
-            {0x397, 0x3b7},     {0x398, 0x3b8},     {0x399, 0x3b9},
-            {0x39a, 0x3ba},     {0x39b, 0x3bb},     {0x39c, 0x3bc},
-            {0x39d, 0x3bd},     {0x39e, 0x3be},     {0x39f, 0x3bf},
-            {0x3a0, 0x3c0},     {0x3a1, 0x3c1},     {0x3a3, 0x3c3},
-            {0x3a4, 0x3c4},     {0x3a5, 0x3c5},     {0x3a6, 0x3c6},
-            {0x3a7, 0x3c7},     {0x3a8, 0x3c8},     {0x3a9, 0x3c9},
-            {0x3aa, 0x3ca},     {0x3ab, 0x3cb},     {0x3cf, 0x3d7},
-            {0x3d8, 0x3d9},     {0x3da, 0x3db},     {0x3dc, 0x3dd},
-            {0x3de, 0x3df},     {0x3e0, 0x3e1},     {0x3e2, 0x3e3},
-            {0x3e4, 0x3e5},     {0x3e6, 0x3e7},     {0x3e8, 0x3e9},
-            {0x3ea, 0x3eb},     {0x3ec, 0x3ed},     {0x3ee, 0x3ef},
-            {0x3f4, 0x3b8},     {0x3f7, 0x3f8},     {0x3f9, 0x3f2},
-            {0x3fa, 0x3fb},     {0x3fd, 0x37b},     {0x3fe, 0x37c},
-            {0x3ff, 0x37d},     {0x400, 0x450},     {0x401, 0x451},
-            {0x402, 0x452},     {0x403, 0x453},     {0x404, 0x454},
-            {0x405, 0x455},     {0x406, 0x456},     {0x407, 0x457},
-            {0x408, 0x458},     {0x409, 0x459},     {0x40a, 0x45a},
-            {0x40b, 0x45b},     {0x40c, 0x45c},     {0x40d, 0x45d},
-            {0x40e, 0x45e},     {0x40f, 0x45f},     {0x410, 0x430},
-            {0x411, 0x431},     {0x412, 0x432},     {0x413, 0x433},
-            {0x414, 0x434},     {0x415, 0x435},     {0x416, 0x436},
-            {0x417, 0x437},     {0x418, 0x438},     {0x419, 0x439},
-            {0x41a, 0x43a},     {0x41b, 0x43b},     {0x41c, 0x43c},
-            {0x41d, 0x43d},     {0x41e, 0x43e},     {0x41f, 0x43f},
-            {0x420, 0x440},     {0x421, 0x441},     {0x422, 0x442},
-            {0x423, 0x443},     {0x424, 0x444},     {0x425, 0x445},
-            {0x426, 0x446},     {0x427, 0x447},     {0x428, 0x448},
-            {0x429, 0x449},     {0x42a, 0x44a},     {0x42b, 0x44b},
-            {0x42c, 0x44c},     {0x42d, 0x44d},     {0x42e, 0x44e},
-            {0x42f, 0x44f},     {0x460, 0x461},     {0x462, 0x463},
-            {0x464, 0x465},     {0x466, 0x467},     {0x468, 0x469},
-            {0x46a, 0x46b},     {0x46c, 0x46d},     {0x46e, 0x46f},
-            {0x470, 0x471},     {0x472, 0x473},     {0x474, 0x475},
-            {0x476, 0x477},     {0x478, 0x479},     {0x47a, 0x47b},
-            {0x47c, 0x47d},     {0x47e, 0x47f},     {0x480, 0x481},
-            {0x48a, 0x48b},     {0x48c, 0x48d},     {0x48e, 0x48f},
-            {0x490, 0x491},     {0x492, 0x493},     {0x494, 0x495},
-            {0x496, 0x497},     {0x498, 0x499},     {0x49a, 0x49b},
-            {0x49c, 0x49d},     {0x49e, 0x49f},     {0x4a0, 0x4a1},
-            {0x4a2, 0x4a3},     {0x4a4, 0x4a5},     {0x4a6, 0x4a7},
-            {0x4a8, 0x4a9},     {0x4aa, 0x4ab},     {0x4ac, 0x4ad},
-            {0x4ae, 0x4af},     {0x4b0, 0x4b1},     {0x4b2, 0x4b3},
-            {0x4b4, 0x4b5},     {0x4b6, 0x4b7},     {0x4b8, 0x4b9},
-            {0x4ba, 0x4bb},     {0x4bc, 0x4bd},     {0x4be, 0x4bf},
-            {0x4c0, 0x4cf},     {0x4c1, 0x4c2},     {0x4c3, 0x4c4},
-            {0x4c5, 0x4c6},     {0x4c7, 0x4c8},     {0x4c9, 0x4ca},
-            {0x4cb, 0x4cc},     {0x4cd, 0x4ce},     {0x4d0, 0x4d1},
-            {0x4d2, 0x4d3},     {0x4d4, 0x4d5},     {0x4d6, 0x4d7},
-            {0x4d8, 0x4d9},     {0x4da, 0x4db},     {0x4dc, 0x4dd},
-            {0x4de, 0x4df},     {0x4e0, 0x4e1},     {0x4e2, 0x4e3},
-            {0x4e4, 0x4e5},     {0x4e6, 0x4e7},     {0x4e8, 0x4e9},
-            {0x4ea, 0x4eb},     {0x4ec, 0x4ed},     {0x4ee, 0x4ef},
-            {0x4f0, 0x4f1},     {0x4f2, 0x4f3},     {0x4f4, 0x4f5},
-            {0x4f6, 0x4f7},     {0x4f8, 0x4f9},     {0x4fa, 0x4fb},
-            {0x4fc, 0x4fd},     {0x4fe, 0x4ff},     {0x500, 0x501},
-            {0x502, 0x503},     {0x504, 0x505},     {0x506, 0x507},
-            {0x508, 0x509},     {0x50a, 0x50b},     {0x50c, 0x50d},
-            {0x50e, 0x50f},     {0x510, 0x511},     {0x512, 0x513},
-            {0x514, 0x515},     {0x516, 0x517},     {0x518, 0x519},
-            {0x51a, 0x51b},     {0x51c, 0x51d},     {0x51e, 0x51f},
-            {0x520, 0x521},     {0x522, 0x523},     {0x524, 0x525},
-            {0x526, 0x527},     {0x528, 0x529},     {0x52a, 0x52b},
-            {0x52c, 0x52d},     {0x52e, 0x52f},     {0x531, 0x561},
-            {0x532, 0x562},     {0x533, 0x563},     {0x534, 0x564},
-            {0x535, 0x565},     {0x536, 0x566},     {0x537, 0x567},
-            {0x538, 0x568},     {0x539, 0x569},     {0x53a, 0x56a},
-            {0x53b, 0x56b},     {0x53c, 0x56c},     {0x53d, 0x56d},
-            {0x53e, 0x56e},     {0x53f, 0x56f},     {0x540, 0x570},
-            {0x541, 0x571},     {0x542, 0x572},     {0x543, 0x573},
-            {0x544, 0x574},     {0x545, 0x575},     {0x546, 0x576},
-            {0x547, 0x577},     {0x548, 0x578},     {0x549, 0x579},
-            {0x54a, 0x57a},     {0x54b, 0x57b},     {0x54c, 0x57c},
-            {0x54d, 0x57d},     {0x54e, 0x57e},     {0x54f, 0x57f},
-            {0x550, 0x580},     {0x551, 0x581},     {0x552, 0x582},
-            {0x553, 0x583},     {0x554, 0x584},     {0x555, 0x585},
-            {0x556, 0x586},     {0x10a0, 0x2d00},   {0x10a1, 0x2d01},
-            {0x10a2, 0x2d02},   {0x10a3, 0x2d03},   {0x10a4, 0x2d04},
-            {0x10a5, 0x2d05},   {0x10a6, 0x2d06},   {0x10a7, 0x2d07},
-            {0x10a8, 0x2d08},   {0x10a9, 0x2d09},   {0x10aa, 0x2d0a},
-            {0x10ab, 0x2d0b},   {0x10ac, 0x2d0c},   {0x10ad, 0x2d0d},
-            {0x10ae, 0x2d0e},   {0x10af, 0x2d0f},   {0x10b0, 0x2d10},
-            {0x10b1, 0x2d11},   {0x10b2, 0x2d12},   {0x10b3, 0x2d13},
-            {0x10b4, 0x2d14},   {0x10b5, 0x2d15},   {0x10b6, 0x2d16},
-            {0x10b7, 0x2d17},   {0x10b8, 0x2d18},   {0x10b9, 0x2d19},
-            {0x10ba, 0x2d1a},   {0x10bb, 0x2d1b},   {0x10bc, 0x2d1c},
-            {0x10bd, 0x2d1d},   {0x10be, 0x2d1e},   {0x10bf, 0x2d1f},
-            {0x10c0, 0x2d20},   {0x10c1, 0x2d21},   {0x10c2, 0x2d22},
-            {0x10c3, 0x2d23},   {0x10c4, 0x2d24},   {0x10c5, 0x2d25},
-            {0x10c7, 0x2d27},   {0x10cd, 0x2d2d},   {0x13a0, 0xab70},
-            {0x13a1, 0xab71},   {0x13a2, 0xab72},   {0x13a3, 0xab73},
-            {0x13a4, 0xab74},   {0x13a5, 0xab75},   {0x13a6, 0xab76},
-            {0x13a7, 0xab77},   {0x13a8, 0xab78},   {0x13a9, 0xab79},
-            {0x13aa, 0xab7a},   {0x13ab, 0xab7b},   {0x13ac, 0xab7c},
-            {0x13ad, 0xab7d},   {0x13ae, 0xab7e},   {0x13af, 0xab7f},
-            {0x13b0, 0xab80},   {0x13b1, 0xab81},   {0x13b2, 0xab82},
-            {0x13b3, 0xab83},   {0x13b4, 0xab84},   {0x13b5, 0xab85},
-            {0x13b6, 0xab86},   {0x13b7, 0xab87},   {0x13b8, 0xab88},
-            {0x13b9, 0xab89},   {0x13ba, 0xab8a},   {0x13bb, 0xab8b},
-            {0x13bc, 0xab8c},   {0x13bd, 0xab8d},   {0x13be, 0xab8e},
-            {0x13bf, 0xab8f},   {0x13c0, 0xab90},   {0x13c1, 0xab91},
-            {0x13c2, 0xab92},   {0x13c3, 0xab93},   {0x13c4, 0xab94},
-            {0x13c5, 0xab95},   {0x13c6, 0xab96},   {0x13c7, 0xab97},
-            {0x13c8, 0xab98},   {0x13c9, 0xab99},   {0x13ca, 0xab9a},
-            {0x13cb, 0xab9b},   {0x13cc, 0xab9c},   {0x13cd, 0xab9d},
-            {0x13ce, 0xab9e},   {0x13cf, 0xab9f},   {0x13d0, 0xaba0},
-            {0x13d1, 0xaba1},   {0x13d2, 0xaba2},   {0x13d3, 0xaba3},
-            {0x13d4, 0xaba4},   {0x13d5, 0xaba5},   {0x13d6, 0xaba6},
-            {0x13d7, 0xaba7},   {0x13d8, 0xaba8},   {0x13d9, 0xaba9},
-            {0x13da, 0xabaa},   {0x13db, 0xabab},   {0x13dc, 0xabac},
-            {0x13dd, 0xabad},   {0x13de, 0xabae},   {0x13df, 0xabaf},
-            {0x13e0, 0xabb0},   {0x13e1, 0xabb1},   {0x13e2, 0xabb2},
-            {0x13e3, 0xabb3},   {0x13e4, 0xabb4},   {0x13e5, 0xabb5},
-            {0x13e6, 0xabb6},   {0x13e7, 0xabb7},   {0x13e8, 0xabb8},
-            {0x13e9, 0xabb9},   {0x13ea, 0xabba},   {0x13eb, 0xabbb},
-            {0x13ec, 0xabbc},   {0x13ed, 0xabbd},   {0x13ee, 0xabbe},
-            {0x13ef, 0xabbf},   {0x13f0, 0x13f8},   {0x13f1, 0x13f9},
-            {0x13f2, 0x13fa},   {0x13f3, 0x13fb},   {0x13f4, 0x13fc},
-            {0x13f5, 0x13fd},   {0x1c90, 0x10d0},   {0x1c91, 0x10d1},
-            {0x1c92, 0x10d2},   {0x1c93, 0x10d3},   {0x1c94, 0x10d4},
-            {0x1c95, 0x10d5},   {0x1c96, 0x10d6},   {0x1c97, 0x10d7},
-            {0x1c98, 0x10d8},   {0x1c99, 0x10d9},   {0x1c9a, 0x10da},
-            {0x1c9b, 0x10db},   {0x1c9c, 0x10dc},   {0x1c9d, 0x10dd},
-            {0x1c9e, 0x10de},   {0x1c9f, 0x10df},   {0x1ca0, 0x10e0},
-            {0x1ca1, 0x10e1},   {0x1ca2, 0x10e2},   {0x1ca3, 0x10e3},
-            {0x1ca4, 0x10e4},   {0x1ca5, 0x10e5},   {0x1ca6, 0x10e6},
-            {0x1ca7, 0x10e7},   {0x1ca8, 0x10e8},   {0x1ca9, 0x10e9},
-            {0x1caa, 0x10ea},   {0x1cab, 0x10eb},   {0x1cac, 0x10ec},
-            {0x1cad, 0x10ed},   {0x1cae, 0x10ee},   {0x1caf, 0x10ef},
-            {0x1cb0, 0x10f0},   {0x1cb1, 0x10f1},   {0x1cb2, 0x10f2},
-            {0x1cb3, 0x10f3},   {0x1cb4, 0x10f4},   {0x1cb5, 0x10f5},
-            {0x1cb6, 0x10f6},   {0x1cb7, 0x10f7},   {0x1cb8, 0x10f8},
-            {0x1cb9, 0x10f9},   {0x1cba, 0x10fa},   {0x1cbd, 0x10fd},
-            {0x1cbe, 0x10fe},   {0x1cbf, 0x10ff},   {0x1e00, 0x1e01},
-            {0x1e02, 0x1e03},   {0x1e04, 0x1e05},   {0x1e06, 0x1e07},
-            {0x1e08, 0x1e09},   {0x1e0a, 0x1e0b},   {0x1e0c, 0x1e0d},
-            {0x1e0e, 0x1e0f},   {0x1e10, 0x1e11},   {0x1e12, 0x1e13},
-            {0x1e14, 0x1e15},   {0x1e16, 0x1e17},   {0x1e18, 0x1e19},
-            {0x1e1a, 0x1e1b},   {0x1e1c, 0x1e1d},   {0x1e1e, 0x1e1f},
-            {0x1e20, 0x1e21},   {0x1e22, 0x1e23},   {0x1e24, 0x1e25},
-            {0x1e26, 0x1e27},   {0x1e28, 0x1e29},   {0x1e2a, 0x1e2b},
-            {0x1e2c, 0x1e2d},   {0x1e2e, 0x1e2f},   {0x1e30, 0x1e31},
-            {0x1e32, 0x1e33},   {0x1e34, 0x1e35},   {0x1e36, 0x1e37},
-            {0x1e38, 0x1e39},   {0x1e3a, 0x1e3b},   {0x1e3c, 0x1e3d},
-            {0x1e3e, 0x1e3f},   {0x1e40, 0x1e41},   {0x1e42, 0x1e43},
-            {0x1e44, 0x1e45},   {0x1e46, 0x1e47},   {0x1e48, 0x1e49},
-            {0x1e4a, 0x1e4b},   {0x1e4c, 0x1e4d},   {0x1e4e, 0x1e4f},
-            {0x1e50, 0x1e51},   {0x1e52, 0x1e53},   {0x1e54, 0x1e55},
-            {0x1e56, 0x1e57},   {0x1e58, 0x1e59},   {0x1e5a, 0x1e5b},
-            {0x1e5c, 0x1e5d},   {0x1e5e, 0x1e5f},   {0x1e60, 0x1e61},
-            {0x1e62, 0x1e63},   {0x1e64, 0x1e65},   {0x1e66, 0x1e67},
-            {0x1e68, 0x1e69},   {0x1e6a, 0x1e6b},   {0x1e6c, 0x1e6d},
-            {0x1e6e, 0x1e6f},   {0x1e70, 0x1e71},   {0x1e72, 0x1e73},
-            {0x1e74, 0x1e75},   {0x1e76, 0x1e77},   {0x1e78, 0x1e79},
-            {0x1e7a, 0x1e7b},   {0x1e7c, 0x1e7d},   {0x1e7e, 0x1e7f},
-            {0x1e80, 0x1e81},   {0x1e82, 0x1e83},   {0x1e84, 0x1e85},
-            {0x1e86, 0x1e87},   {0x1e88, 0x1e89},   {0x1e8a, 0x1e8b},
-            {0x1e8c, 0x1e8d},   {0x1e8e, 0x1e8f},   {0x1e90, 0x1e91},
-            {0x1e92, 0x1e93},   {0x1e94, 0x1e95},   {0x1e9e, 0xdf},
-            {0x1ea0, 0x1ea1},   {0x1ea2, 0x1ea3},   {0x1ea4, 0x1ea5},
-            {0x1ea6, 0x1ea7},   {0x1ea8, 0x1ea9},   {0x1eaa, 0x1eab},
-            {0x1eac, 0x1ead},   {0x1eae, 0x1eaf},   {0x1eb0, 0x1eb1},
-            {0x1eb2, 0x1eb3},   {0x1eb4, 0x1eb5},   {0x1eb6, 0x1eb7},
-            {0x1eb8, 0x1eb9},   {0x1eba, 0x1ebb},   {0x1ebc, 0x1ebd},
-            {0x1ebe, 0x1ebf},   {0x1ec0, 0x1ec1},   {0x1ec2, 0x1ec3},
-            {0x1ec4, 0x1ec5},   {0x1ec6, 0x1ec7},   {0x1ec8, 0x1ec9},
-            {0x1eca, 0x1ecb},   {0x1ecc, 0x1ecd},   {0x1ece, 0x1ecf},
-            {0x1ed0, 0x1ed1},   {0x1ed2, 0x1ed3},   {0x1ed4, 0x1ed5},
-            {0x1ed6, 0x1ed7},   {0x1ed8, 0x1ed9},   {0x1eda, 0x1edb},
-            {0x1edc, 0x1edd},   {0x1ede, 0x1edf},   {0x1ee0, 0x1ee1},
-            {0x1ee2, 0x1ee3},   {0x1ee4, 0x1ee5},   {0x1ee6, 0x1ee7},
-            {0x1ee8, 0x1ee9},   {0x1eea, 0x1eeb},   {0x1eec, 0x1eed},
-            {0x1eee, 0x1eef},   {0x1ef0, 0x1ef1},   {0x1ef2, 0x1ef3},
-            {0x1ef4, 0x1ef5},   {0x1ef6, 0x1ef7},   {0x1ef8, 0x1ef9},
-            {0x1efa, 0x1efb},   {0x1efc, 0x1efd},   {0x1efe, 0x1eff},
-            {0x1f08, 0x1f00},   {0x1f09, 0x1f01},   {0x1f0a, 0x1f02},
-            {0x1f0b, 0x1f03},   {0x1f0c, 0x1f04},   {0x1f0d, 0x1f05},
-            {0x1f0e, 0x1f06},   {0x1f0f, 0x1f07},   {0x1f18, 0x1f10},
-            {0x1f19, 0x1f11},   {0x1f1a, 0x1f12},   {0x1f1b, 0x1f13},
-            {0x1f1c, 0x1f14},   {0x1f1d, 0x1f15},   {0x1f28, 0x1f20},
-            {0x1f29, 0x1f21},   {0x1f2a, 0x1f22},   {0x1f2b, 0x1f23},
-            {0x1f2c, 0x1f24},   {0x1f2d, 0x1f25},   {0x1f2e, 0x1f26},
-            {0x1f2f, 0x1f27},   {0x1f38, 0x1f30},   {0x1f39, 0x1f31},
-            {0x1f3a, 0x1f32},   {0x1f3b, 0x1f33},   {0x1f3c, 0x1f34},
-            {0x1f3d, 0x1f35},   {0x1f3e, 0x1f36},   {0x1f3f, 0x1f37},
-            {0x1f48, 0x1f40},   {0x1f49, 0x1f41},   {0x1f4a, 0x1f42},
-            {0x1f4b, 0x1f43},   {0x1f4c, 0x1f44},   {0x1f4d, 0x1f45},
-            {0x1f59, 0x1f51},   {0x1f5b, 0x1f53},   {0x1f5d, 0x1f55},
-            {0x1f5f, 0x1f57},   {0x1f68, 0x1f60},   {0x1f69, 0x1f61},
-            {0x1f6a, 0x1f62},   {0x1f6b, 0x1f63},   {0x1f6c, 0x1f64},
-            {0x1f6d, 0x1f65},   {0x1f6e, 0x1f66},   {0x1f6f, 0x1f67},
-            {0x1f88, 0x1f80},   {0x1f89, 0x1f81},   {0x1f8a, 0x1f82},
-            {0x1f8b, 0x1f83},   {0x1f8c, 0x1f84},   {0x1f8d, 0x1f85},
-            {0x1f8e, 0x1f86},   {0x1f8f, 0x1f87},   {0x1f98, 0x1f90},
-            {0x1f99, 0x1f91},   {0x1f9a, 0x1f92},   {0x1f9b, 0x1f93},
-            {0x1f9c, 0x1f94},   {0x1f9d, 0x1f95},   {0x1f9e, 0x1f96},
-            {0x1f9f, 0x1f97},   {0x1fa8, 0x1fa0},   {0x1fa9, 0x1fa1},
-            {0x1faa, 0x1fa2},   {0x1fab, 0x1fa3},   {0x1fac, 0x1fa4},
-            {0x1fad, 0x1fa5},   {0x1fae, 0x1fa6},   {0x1faf, 0x1fa7},
-            {0x1fb8, 0x1fb0},   {0x1fb9, 0x1fb1},   {0x1fba, 0x1f70},
-            {0x1fbb, 0x1f71},   {0x1fbc, 0x1fb3},   {0x1fc8, 0x1f72},
-            {0x1fc9, 0x1f73},   {0x1fca, 0x1f74},   {0x1fcb, 0x1f75},
-            {0x1fcc, 0x1fc3},   {0x1fd8, 0x1fd0},   {0x1fd9, 0x1fd1},
-            {0x1fda, 0x1f76},   {0x1fdb, 0x1f77},   {0x1fe8, 0x1fe0},
-            {0x1fe9, 0x1fe1},   {0x1fea, 0x1f7a},   {0x1feb, 0x1f7b},
-            {0x1fec, 0x1fe5},   {0x1ff8, 0x1f78},   {0x1ff9, 0x1f79},
-            {0x1ffa, 0x1f7c},   {0x1ffb, 0x1f7d},   {0x1ffc, 0x1ff3},
-            {0x2126, 0x3c9},    {0x212a, 0x6b},     {0x212b, 0xe5},
-            {0x2132, 0x214e},   {0x2160, 0x2170},   {0x2161, 0x2171},
-            {0x2162, 0x2172},   {0x2163, 0x2173},   {0x2164, 0x2174},
-            {0x2165, 0x2175},   {0x2166, 0x2176},   {0x2167, 0x2177},
-            {0x2168, 0x2178},   {0x2169, 0x2179},   {0x216a, 0x217a},
-            {0x216b, 0x217b},   {0x216c, 0x217c},   {0x216d, 0x217d},
-            {0x216e, 0x217e},   {0x216f, 0x217f},   {0x2183, 0x2184},
-            {0x24b6, 0x24d0},   {0x24b7, 0x24d1},   {0x24b8, 0x24d2},
-            {0x24b9, 0x24d3},   {0x24ba, 0x24d4},   {0x24bb, 0x24d5},
-            {0x24bc, 0x24d6},   {0x24bd, 0x24d7},   {0x24be, 0x24d8},
-            {0x24bf, 0x24d9},   {0x24c0, 0x24da},   {0x24c1, 0x24db},
-            {0x24c2, 0x24dc},   {0x24c3, 0x24dd},   {0x24c4, 0x24de},
-            {0x24c5, 0x24df},   {0x24c6, 0x24e0},   {0x24c7, 0x24e1},
-            {0x24c8, 0x24e2},   {0x24c9, 0x24e3},   {0x24ca, 0x24e4},
-            {0x24cb, 0x24e5},   {0x24cc, 0x24e6},   {0x24cd, 0x24e7},
-            {0x24ce, 0x24e8},   {0x24cf, 0x24e9},   {0x2c00, 0x2c30},
-            {0x2c01, 0x2c31},   {0x2c02, 0x2c32},   {0x2c03, 0x2c33},
-            {0x2c04, 0x2c34},   {0x2c05, 0x2c35},   {0x2c06, 0x2c36},
-            {0x2c07, 0x2c37},   {0x2c08, 0x2c38},   {0x2c09, 0x2c39},
-            {0x2c0a, 0x2c3a},   {0x2c0b, 0x2c3b},   {0x2c0c, 0x2c3c},
-            {0x2c0d, 0x2c3d},   {0x2c0e, 0x2c3e},   {0x2c0f, 0x2c3f},
-            {0x2c10, 0x2c40},   {0x2c11, 0x2c41},   {0x2c12, 0x2c42},
-            {0x2c13, 0x2c43},   {0x2c14, 0x2c44},   {0x2c15, 0x2c45},
-            {0x2c16, 0x2c46},   {0x2c17, 0x2c47},   {0x2c18, 0x2c48},
-            {0x2c19, 0x2c49},   {0x2c1a, 0x2c4a},   {0x2c1b, 0x2c4b},
-            {0x2c1c, 0x2c4c},   {0x2c1d, 0x2c4d},   {0x2c1e, 0x2c4e},
-            {0x2c1f, 0x2c4f},   {0x2c20, 0x2c50},   {0x2c21, 0x2c51},
-            {0x2c22, 0x2c52},   {0x2c23, 0x2c53},   {0x2c24, 0x2c54},
-            {0x2c25, 0x2c55},   {0x2c26, 0x2c56},   {0x2c27, 0x2c57},
-            {0x2c28, 0x2c58},   {0x2c29, 0x2c59},   {0x2c2a, 0x2c5a},
-            {0x2c2b, 0x2c5b},   {0x2c2c, 0x2c5c},   {0x2c2d, 0x2c5d},
-            {0x2c2e, 0x2c5e},   {0x2c60, 0x2c61},   {0x2c62, 0x26b},
-            {0x2c63, 0x1d7d},   {0x2c64, 0x27d},    {0x2c67, 0x2c68},
-            {0x2c69, 0x2c6a},   {0x2c6b, 0x2c6c},   {0x2c6d, 0x251},
-            {0x2c6e, 0x271},    {0x2c6f, 0x250},    {0x2c70, 0x252},
-            {0x2c72, 0x2c73},   {0x2c75, 0x2c76},   {0x2c7e, 0x23f},
-            {0x2c7f, 0x240},    {0x2c80, 0x2c81},   {0x2c82, 0x2c83},
-            {0x2c84, 0x2c85},   {0x2c86, 0x2c87},   {0x2c88, 0x2c89},
-            {0x2c8a, 0x2c8b},   {0x2c8c, 0x2c8d},   {0x2c8e, 0x2c8f},
-            {0x2c90, 0x2c91},   {0x2c92, 0x2c93},   {0x2c94, 0x2c95},
-            {0x2c96, 0x2c97},   {0x2c98, 0x2c99},   {0x2c9a, 0x2c9b},
-            {0x2c9c, 0x2c9d},   {0x2c9e, 0x2c9f},   {0x2ca0, 0x2ca1},
-            {0x2ca2, 0x2ca3},   {0x2ca4, 0x2ca5},   {0x2ca6, 0x2ca7},
-            {0x2ca8, 0x2ca9},   {0x2caa, 0x2cab},   {0x2cac, 0x2cad},
-            {0x2cae, 0x2caf},   {0x2cb0, 0x2cb1},   {0x2cb2, 0x2cb3},
-            {0x2cb4, 0x2cb5},   {0x2cb6, 0x2cb7},   {0x2cb8, 0x2cb9},
-            {0x2cba, 0x2cbb},   {0x2cbc, 0x2cbd},   {0x2cbe, 0x2cbf},
-            {0x2cc0, 0x2cc1},   {0x2cc2, 0x2cc3},   {0x2cc4, 0x2cc5},
-            {0x2cc6, 0x2cc7},   {0x2cc8, 0x2cc9},   {0x2cca, 0x2ccb},
-            {0x2ccc, 0x2ccd},   {0x2cce, 0x2ccf},   {0x2cd0, 0x2cd1},
-            {0x2cd2, 0x2cd3},   {0x2cd4, 0x2cd5},   {0x2cd6, 0x2cd7},
-            {0x2cd8, 0x2cd9},   {0x2cda, 0x2cdb},   {0x2cdc, 0x2cdd},
-            {0x2cde, 0x2cdf},   {0x2ce0, 0x2ce1},   {0x2ce2, 0x2ce3},
-            {0x2ceb, 0x2cec},   {0x2ced, 0x2cee},   {0x2cf2, 0x2cf3},
-            {0xa640, 0xa641},   {0xa642, 0xa643},   {0xa644, 0xa645},
-            {0xa646, 0xa647},   {0xa648, 0xa649},   {0xa64a, 0xa64b},
-            {0xa64c, 0xa64d},   {0xa64e, 0xa64f},   {0xa650, 0xa651},
-            {0xa652, 0xa653},   {0xa654, 0xa655},   {0xa656, 0xa657},
-            {0xa658, 0xa659},   {0xa65a, 0xa65b},   {0xa65c, 0xa65d},
-            {0xa65e, 0xa65f},   {0xa660, 0xa661},   {0xa662, 0xa663},
-            {0xa664, 0xa665},   {0xa666, 0xa667},   {0xa668, 0xa669},
-            {0xa66a, 0xa66b},   {0xa66c, 0xa66d},   {0xa680, 0xa681},
-            {0xa682, 0xa683},   {0xa684, 0xa685},   {0xa686, 0xa687},
-            {0xa688, 0xa689},   {0xa68a, 0xa68b},   {0xa68c, 0xa68d},
-            {0xa68e, 0xa68f},   {0xa690, 0xa691},   {0xa692, 0xa693},
-            {0xa694, 0xa695},   {0xa696, 0xa697},   {0xa698, 0xa699},
-            {0xa69a, 0xa69b},   {0xa722, 0xa723},   {0xa724, 0xa725},
-            {0xa726, 0xa727},   {0xa728, 0xa729},   {0xa72a, 0xa72b},
-            {0xa72c, 0xa72d},   {0xa72e, 0xa72f},   {0xa732, 0xa733},
-            {0xa734, 0xa735},   {0xa736, 0xa737},   {0xa738, 0xa739},
-            {0xa73a, 0xa73b},   {0xa73c, 0xa73d},   {0xa73e, 0xa73f},
-            {0xa740, 0xa741},   {0xa742, 0xa743},   {0xa744, 0xa745},
-            {0xa746, 0xa747},   {0xa748, 0xa749},   {0xa74a, 0xa74b},
-            {0xa74c, 0xa74d},   {0xa74e, 0xa74f},   {0xa750, 0xa751},
-            {0xa752, 0xa753},   {0xa754, 0xa755},   {0xa756, 0xa757},
-            {0xa758, 0xa759},   {0xa75a, 0xa75b},   {0xa75c, 0xa75d},
-            {0xa75e, 0xa75f},   {0xa760, 0xa761},   {0xa762, 0xa763},
-            {0xa764, 0xa765},   {0xa766, 0xa767},   {0xa768, 0xa769},
-            {0xa76a, 0xa76b},   {0xa76c, 0xa76d},   {0xa76e, 0xa76f},
-            {0xa779, 0xa77a},   {0xa77b, 0xa77c},   {0xa77d, 0x1d79},
-            {0xa77e, 0xa77f},   {0xa780, 0xa781},   {0xa782, 0xa783},
-            {0xa784, 0xa785},   {0xa786, 0xa787},   {0xa78b, 0xa78c},
-            {0xa78d, 0x265},    {0xa790, 0xa791},   {0xa792, 0xa793},
-            {0xa796, 0xa797},   {0xa798, 0xa799},   {0xa79a, 0xa79b},
-            {0xa79c, 0xa79d},   {0xa79e, 0xa79f},   {0xa7a0, 0xa7a1},
-            {0xa7a2, 0xa7a3},   {0xa7a4, 0xa7a5},   {0xa7a6, 0xa7a7},
-            {0xa7a8, 0xa7a9},   {0xa7aa, 0x266},    {0xa7ab, 0x25c},
-            {0xa7ac, 0x261},    {0xa7ad, 0x26c},    {0xa7ae, 0x26a},
-            {0xa7b0, 0x29e},    {0xa7b1, 0x287},    {0xa7b2, 0x29d},
-            {0xa7b3, 0xab53},   {0xa7b4, 0xa7b5},   {0xa7b6, 0xa7b7},
-            {0xa7b8, 0xa7b9},   {0xa7ba, 0xa7bb},   {0xa7bc, 0xa7bd},
-            {0xa7be, 0xa7bf},   {0xa7c2, 0xa7c3},   {0xa7c4, 0xa794},
-            {0xa7c5, 0x282},    {0xa7c6, 0x1d8e},   {0xa7c7, 0xa7c8},
-            {0xa7c9, 0xa7ca},   {0xa7f5, 0xa7f6},   {0xff21, 0xff41},
-            {0xff22, 0xff42},   {0xff23, 0xff43},   {0xff24, 0xff44},
-            {0xff25, 0xff45},   {0xff26, 0xff46},   {0xff27, 0xff47},
-            {0xff28, 0xff48},   {0xff29, 0xff49},   {0xff2a, 0xff4a},
-            {0xff2b, 0xff4b},   {0xff2c, 0xff4c},   {0xff2d, 0xff4d},
-            {0xff2e, 0xff4e},   {0xff2f, 0xff4f},   {0xff30, 0xff50},
-            {0xff31, 0xff51},   {0xff32, 0xff52},   {0xff33, 0xff53},
-            {0xff34, 0xff54},   {0xff35, 0xff55},   {0xff36, 0xff56},
-            {0xff37, 0xff57},   {0xff38, 0xff58},   {0xff39, 0xff59},
-            {0xff3a, 0xff5a},   {0x10400, 0x10428}, {0x10401, 0x10429},
-            {0x10402, 0x1042a}, {0x10403, 0x1042b}, {0x10404, 0x1042c},
-            {0x10405, 0x1042d}, {0x10406, 0x1042e}, {0x10407, 0x1042f},
-            {0x10408, 0x10430}, {0x10409, 0x10431}, {0x1040a, 0x10432},
-            {0x1040b, 0x10433}, {0x1040c, 0x10434}, {0x1040d, 0x10435},
-            {0x1040e, 0x10436}, {0x1040f, 0x10437}, {0x10410, 0x10438},
-            {0x10411, 0x10439}, {0x10412, 0x1043a}, {0x10413, 0x1043b},
-            {0x10414, 0x1043c}, {0x10415, 0x1043d}, {0x10416, 0x1043e},
-            {0x10417, 0x1043f}, {0x10418, 0x10440}, {0x10419, 0x10441},
-            {0x1041a, 0x10442}, {0x1041b, 0x10443}, {0x1041c, 0x10444},
-            {0x1041d, 0x10445}, {0x1041e, 0x10446}, {0x1041f, 0x10447},
-            {0x10420, 0x10448}, {0x10421, 0x10449}, {0x10422, 0x1044a},
-            {0x10423, 0x1044b}, {0x10424, 0x1044c}, {0x10425, 0x1044d},
-            {0x10426, 0x1044e}, {0x10427, 0x1044f}, {0x104b0, 0x104d8},
-            {0x104b1, 0x104d9}, {0x104b2, 0x104da}, {0x104b3, 0x104db},
-            {0x104b4, 0x104dc}, {0x104b5, 0x104dd}, {0x104b6, 0x104de},
-            {0x104b7, 0x104df}, {0x104b8, 0x104e0}, {0x104b9, 0x104e1},
-            {0x104ba, 0x104e2}, {0x104bb, 0x104e3}, {0x104bc, 0x104e4},
-            {0x104bd, 0x104e5}, {0x104be, 0x104e6}, {0x104bf, 0x104e7},
-            {0x104c0, 0x104e8}, {0x104c1, 0x104e9}, {0x104c2, 0x104ea},
-            {0x104c3, 0x104eb}, {0x104c4, 0x104ec}, {0x104c5, 0x104ed},
-            {0x104c6, 0x104ee}, {0x104c7, 0x104ef}, {0x104c8, 0x104f0},
-            {0x104c9, 0x104f1}, {0x104ca, 0x104f2}, {0x104cb, 0x104f3},
-            {0x104cc, 0x104f4}, {0x104cd, 0x104f5}, {0x104ce, 0x104f6},
-            {0x104cf, 0x104f7}, {0x104d0, 0x104f8}, {0x104d1, 0x104f9},
-            {0x104d2, 0x104fa}, {0x104d3, 0x104fb}, {0x10c80, 0x10cc0},
-            {0x10c81, 0x10cc1}, {0x10c82, 0x10cc2}, {0x10c83, 0x10cc3},
-            {0x10c84, 0x10cc4}, {0x10c85, 0x10cc5}, {0x10c86, 0x10cc6},
-            {0x10c87, 0x10cc7}, {0x10c88, 0x10cc8}, {0x10c89, 0x10cc9},
-            {0x10c8a, 0x10cca}, {0x10c8b, 0x10ccb}, {0x10c8c, 0x10ccc},
-            {0x10c8d, 0x10ccd}, {0x10c8e, 0x10cce}, {0x10c8f, 0x10ccf},
-            {0x10c90, 0x10cd0}, {0x10c91, 0x10cd1}, {0x10c92, 0x10cd2},
-            {0x10c93, 0x10cd3}, {0x10c94, 0x10cd4}, {0x10c95, 0x10cd5},
-            {0x10c96, 0x10cd6}, {0x10c97, 0x10cd7}, {0x10c98, 0x10cd8},
-            {0x10c99, 0x10cd9}, {0x10c9a, 0x10cda}, {0x10c9b, 0x10cdb},
-            {0x10c9c, 0x10cdc}, {0x10c9d, 0x10cdd}, {0x10c9e, 0x10cde},
-            {0x10c9f, 0x10cdf}, {0x10ca0, 0x10ce0}, {0x10ca1, 0x10ce1},
-            {0x10ca2, 0x10ce2}, {0x10ca3, 0x10ce3}, {0x10ca4, 0x10ce4},
-            {0x10ca5, 0x10ce5}, {0x10ca6, 0x10ce6}, {0x10ca7, 0x10ce7},
-            {0x10ca8, 0x10ce8}, {0x10ca9, 0x10ce9}, {0x10caa, 0x10cea},
-            {0x10cab, 0x10ceb}, {0x10cac, 0x10cec}, {0x10cad, 0x10ced},
-            {0x10cae, 0x10cee}, {0x10caf, 0x10cef}, {0x10cb0, 0x10cf0},
-            {0x10cb1, 0x10cf1}, {0x10cb2, 0x10cf2}, {0x118a0, 0x118c0},
-            {0x118a1, 0x118c1}, {0x118a2, 0x118c2}, {0x118a3, 0x118c3},
-            {0x118a4, 0x118c4}, {0x118a5, 0x118c5}, {0x118a6, 0x118c6},
-            {0x118a7, 0x118c7}, {0x118a8, 0x118c8}, {0x118a9, 0x118c9},
-            {0x118aa, 0x118ca}, {0x118ab, 0x118cb}, {0x118ac, 0x118cc},
-            {0x118ad, 0x118cd}, {0x118ae, 0x118ce}, {0x118af, 0x118cf},
-            {0x118b0, 0x118d0}, {0x118b1, 0x118d1}, {0x118b2, 0x118d2},
-            {0x118b3, 0x118d3}, {0x118b4, 0x118d4}, {0x118b5, 0x118d5},
-            {0x118b6, 0x118d6}, {0x118b7, 0x118d7}, {0x118b8, 0x118d8},
-            {0x118b9, 0x118d9}, {0x118ba, 0x118da}, {0x118bb, 0x118db},
-            {0x118bc, 0x118dc}, {0x118bd, 0x118dd}, {0x118be, 0x118de},
-            {0x118bf, 0x118df}, {0x16e40, 0x16e60}, {0x16e41, 0x16e61},
-            {0x16e42, 0x16e62}, {0x16e43, 0x16e63}, {0x16e44, 0x16e64},
-            {0x16e45, 0x16e65}, {0x16e46, 0x16e66}, {0x16e47, 0x16e67},
-            {0x16e48, 0x16e68}, {0x16e49, 0x16e69}, {0x16e4a, 0x16e6a},
-            {0x16e4b, 0x16e6b}, {0x16e4c, 0x16e6c}, {0x16e4d, 0x16e6d},
-            {0x16e4e, 0x16e6e}, {0x16e4f, 0x16e6f}, {0x16e50, 0x16e70},
-            {0x16e51, 0x16e71}, {0x16e52, 0x16e72}, {0x16e53, 0x16e73},
-            {0x16e54, 0x16e74}, {0x16e55, 0x16e75}, {0x16e56, 0x16e76},
-            {0x16e57, 0x16e77}, {0x16e58, 0x16e78}, {0x16e59, 0x16e79},
-            {0x16e5a, 0x16e7a}, {0x16e5b, 0x16e7b}, {0x16e5c, 0x16e7c},
-            {0x16e5d, 0x16e7d}, {0x16e5e, 0x16e7e}, {0x16e5f, 0x16e7f},
-            {0x1e900, 0x1e922}, {0x1e901, 0x1e923}, {0x1e902, 0x1e924},
-            {0x1e903, 0x1e925}, {0x1e904, 0x1e926}, {0x1e905, 0x1e927},
-            {0x1e906, 0x1e928}, {0x1e907, 0x1e929}, {0x1e908, 0x1e92a},
-            {0x1e909, 0x1e92b}, {0x1e90a, 0x1e92c}, {0x1e90b, 0x1e92d},
-            {0x1e90c, 0x1e92e}, {0x1e90d, 0x1e92f}, {0x1e90e, 0x1e930},
-            {0x1e90f, 0x1e931}, {0x1e910, 0x1e932}, {0x1e911, 0x1e933},
-            {0x1e912, 0x1e934}, {0x1e913, 0x1e935}, {0x1e914, 0x1e936},
-            {0x1e915, 0x1e937}, {0x1e916, 0x1e938}, {0x1e917, 0x1e939},
-            {0x1e918, 0x1e93a}, {0x1e919, 0x1e93b}, {0x1e91a, 0x1e93c},
-            {0x1e91b, 0x1e93d}, {0x1e91c, 0x1e93e}, {0x1e91d, 0x1e93f},
-            {0x1e91e, 0x1e940}, {0x1e91f, 0x1e941}, {0x1e920, 0x1e942},
-            {0x1e921, 0x1e943},
+            char32_t ch;
+            char32_t lower[3];
+            char32_t upper[3];
+            char32_t title[3];
         };
 
+        // begin generated special_casing, see tools/gen_unicode_tables.py
+        constexpr special_casing special_casings[]
+        {
+            {0xdf, {0xdf}, {0x53, 0x53}, {0x53, 0x73}},
+            {0x130, {0x69, 0x307}, {0x130}, {0x130}},
+            {0x149, {0x149}, {0x2bc, 0x4e}, {0x2bc, 0x4e}},
+            {0x1c4, {0x1c6}, {0x1c4}, {0x1c5}},
+            {0x1c5, {0x1c6}, {0x1c4}, {0x1c5}},
+            {0x1c6, {0x1c6}, {0x1c4}, {0x1c5}},
+            {0x1c7, {0x1c9}, {0x1c7}, {0x1c8}},
+            {0x1c8, {0x1c9}, {0x1c7}, {0x1c8}},
+            {0x1c9, {0x1c9}, {0x1c7}, {0x1c8}},
+            {0x1ca, {0x1cc}, {0x1ca}, {0x1cb}},
+            {0x1cb, {0x1cc}, {0x1ca}, {0x1cb}},
+            {0x1cc, {0x1cc}, {0x1ca}, {0x1cb}},
+            {0x1f0, {0x1f0}, {0x4a, 0x30c}, {0x4a, 0x30c}},
+            {0x1f1, {0x1f3}, {0x1f1}, {0x1f2}},
+            {0x1f2, {0x1f3}, {0x1f1}, {0x1f2}},
+            {0x1f3, {0x1f3}, {0x1f1}, {0x1f2}},
+            {0x390, {0x390}, {0x399, 0x308, 0x301}, {0x399, 0x308, 0x301}},
+            {0x3b0, {0x3b0}, {0x3a5, 0x308, 0x301}, {0x3a5, 0x308, 0x301}},
+            {0x587, {0x587}, {0x535, 0x552}, {0x535, 0x582}},
+            {0x10d0, {0x10d0}, {0x1c90}, {0x10d0}},
+            {0x10d1, {0x10d1}, {0x1c91}, {0x10d1}},
+            {0x10d2, {0x10d2}, {0x1c92}, {0x10d2}},
+            {0x10d3, {0x10d3}, {0x1c93}, {0x10d3}},
+            {0x10d4, {0x10d4}, {0x1c94}, {0x10d4}},
+            {0x10d5, {0x10d5}, {0x1c95}, {0x10d5}},
+            {0x10d6, {0x10d6}, {0x1c96}, {0x10d6}},
+            {0x10d7, {0x10d7}, {0x1c97}, {0x10d7}},
+            {0x10d8, {0x10d8}, {0x1c98}, {0x10d8}},
+            {0x10d9, {0x10d9}, {0x1c99}, {0x10d9}},
+            {0x10da, {0x10da}, {0x1c9a}, {0x10da}},
+            {0x10db, {0x10db}, {0x1c9b}, {0x10db}},
+            {0x10dc, {0x10dc}, {0x1c9c}, {0x10dc}},
+            {0x10dd, {0x10dd}, {0x1c9d}, {0x10dd}},
+            {0x10de, {0x10de}, {0x1c9e}, {0x10de}},
+            {0x10df, {0x10df}, {0x1c9f}, {0x10df}},
+            {0x10e0, {0x10e0}, {0x1ca0}, {0x10e0}},
+            {0x10e1, {0x10e1}, {0x1ca1}, {0x10e1}},
+            {0x10e2, {0x10e2}, {0x1ca2}, {0x10e2}},
+            {0x10e3, {0x10e3}, {0x1ca3}, {0x10e3}},
+            {0x10e4, {0x10e4}, {0x1ca4}, {0x10e4}},
+            {0x10e5, {0x10e5}, {0x1ca5}, {0x10e5}},
+            {0x10e6, {0x10e6}, {0x1ca6}, {0x10e6}},
+            {0x10e7, {0x10e7}, {0x1ca7}, {0x10e7}},
+            {0x10e8, {0x10e8}, {0x1ca8}, {0x10e8}},
+            {0x10e9, {0x10e9}, {0x1ca9}, {0x10e9}},
+            {0x10ea, {0x10ea}, {0x1caa}, {0x10ea}},
+            {0x10eb, {0x10eb}, {0x1cab}, {0x10eb}},
+            {0x10ec, {0x10ec}, {0x1cac}, {0x10ec}},
+            {0x10ed, {0x10ed}, {0x1cad}, {0x10ed}},
+            {0x10ee, {0x10ee}, {0x1cae}, {0x10ee}},
+            {0x10ef, {0x10ef}, {0x1caf}, {0x10ef}},
+            {0x10f0, {0x10f0}, {0x1cb0}, {0x10f0}},
+            {0x10f1, {0x10f1}, {0x1cb1}, {0x10f1}},
+            {0x10f2, {0x10f2}, {0x1cb2}, {0x10f2}},
+            {0x10f3, {0x10f3}, {0x1cb3}, {0x10f3}},
+            {0x10f4, {0x10f4}, {0x1cb4}, {0x10f4}},
+            {0x10f5, {0x10f5}, {0x1cb5}, {0x10f5}},
+            {0x10f6, {0x10f6}, {0x1cb6}, {0x10f6}},
+            {0x10f7, {0x10f7}, {0x1cb7}, {0x10f7}},
+            {0x10f8, {0x10f8}, {0x1cb8}, {0x10f8}},
+            {0x10f9, {0x10f9}, {0x1cb9}, {0x10f9}},
+            {0x10fa, {0x10fa}, {0x1cba}, {0x10fa}},
+            {0x10fd, {0x10fd}, {0x1cbd}, {0x10fd}},
+            {0x10fe, {0x10fe}, {0x1cbe}, {0x10fe}},
+            {0x10ff, {0x10ff}, {0x1cbf}, {0x10ff}},
+            {0x1e96, {0x1e96}, {0x48, 0x331}, {0x48, 0x331}},
+            {0x1e97, {0x1e97}, {0x54, 0x308}, {0x54, 0x308}},
+            {0x1e98, {0x1e98}, {0x57, 0x30a}, {0x57, 0x30a}},
+            {0x1e99, {0x1e99}, {0x59, 0x30a}, {0x59, 0x30a}},
+            {0x1e9a, {0x1e9a}, {0x41, 0x2be}, {0x41, 0x2be}},
+            {0x1f50, {0x1f50}, {0x3a5, 0x313}, {0x3a5, 0x313}},
+            {0x1f52, {0x1f52}, {0x3a5, 0x313, 0x300}, {0x3a5, 0x313, 0x300}},
+            {0x1f54, {0x1f54}, {0x3a5, 0x313, 0x301}, {0x3a5, 0x313, 0x301}},
+            {0x1f56, {0x1f56}, {0x3a5, 0x313, 0x342}, {0x3a5, 0x313, 0x342}},
+            {0x1f80, {0x1f80}, {0x1f08, 0x399}, {0x1f88}},
+            {0x1f81, {0x1f81}, {0x1f09, 0x399}, {0x1f89}},
+            {0x1f82, {0x1f82}, {0x1f0a, 0x399}, {0x1f8a}},
+            {0x1f83, {0x1f83}, {0x1f0b, 0x399}, {0x1f8b}},
+            {0x1f84, {0x1f84}, {0x1f0c, 0x399}, {0x1f8c}},
+            {0x1f85, {0x1f85}, {0x1f0d, 0x399}, {0x1f8d}},
+            {0x1f86, {0x1f86}, {0x1f0e, 0x399}, {0x1f8e}},
+            {0x1f87, {0x1f87}, {0x1f0f, 0x399}, {0x1f8f}},
+            {0x1f88, {0x1f80}, {0x1f08, 0x399}, {0x1f88}},
+            {0x1f89, {0x1f81}, {0x1f09, 0x399}, {0x1f89}},
+            {0x1f8a, {0x1f82}, {0x1f0a, 0x399}, {0x1f8a}},
+            {0x1f8b, {0x1f83}, {0x1f0b, 0x399}, {0x1f8b}},
+            {0x1f8c, {0x1f84}, {0x1f0c, 0x399}, {0x1f8c}},
+            {0x1f8d, {0x1f85}, {0x1f0d, 0x399}, {0x1f8d}},
+            {0x1f8e, {0x1f86}, {0x1f0e, 0x399}, {0x1f8e}},
+            {0x1f8f, {0x1f87}, {0x1f0f, 0x399}, {0x1f8f}},
+            {0x1f90, {0x1f90}, {0x1f28, 0x399}, {0x1f98}},
+            {0x1f91, {0x1f91}, {0x1f29, 0x399}, {0x1f99}},
+            {0x1f92, {0x1f92}, {0x1f2a, 0x399}, {0x1f9a}},
+            {0x1f93, {0x1f93}, {0x1f2b, 0x399}, {0x1f9b}},
+            {0x1f94, {0x1f94}, {0x1f2c, 0x399}, {0x1f9c}},
+            {0x1f95, {0x1f95}, {0x1f2d, 0x399}, {0x1f9d}},
+            {0x1f96, {0x1f96}, {0x1f2e, 0x399}, {0x1f9e}},
+            {0x1f97, {0x1f97}, {0x1f2f, 0x399}, {0x1f9f}},
+            {0x1f98, {0x1f90}, {0x1f28, 0x399}, {0x1f98}},
+            {0x1f99, {0x1f91}, {0x1f29, 0x399}, {0x1f99}},
+            {0x1f9a, {0x1f92}, {0x1f2a, 0x399}, {0x1f9a}},
+            {0x1f9b, {0x1f93}, {0x1f2b, 0x399}, {0x1f9b}},
+            {0x1f9c, {0x1f94}, {0x1f2c, 0x399}, {0x1f9c}},
+            {0x1f9d, {0x1f95}, {0x1f2d, 0x399}, {0x1f9d}},
+            {0x1f9e, {0x1f96}, {0x1f2e, 0x399}, {0x1f9e}},
+            {0x1f9f, {0x1f97}, {0x1f2f, 0x399}, {0x1f9f}},
+            {0x1fa0, {0x1fa0}, {0x1f68, 0x399}, {0x1fa8}},
+            {0x1fa1, {0x1fa1}, {0x1f69, 0x399}, {0x1fa9}},
+            {0x1fa2, {0x1fa2}, {0x1f6a, 0x399}, {0x1faa}},
+            {0x1fa3, {0x1fa3}, {0x1f6b, 0x399}, {0x1fab}},
+            {0x1fa4, {0x1fa4}, {0x1f6c, 0x399}, {0x1fac}},
+            {0x1fa5, {0x1fa5}, {0x1f6d, 0x399}, {0x1fad}},
+            {0x1fa6, {0x1fa6}, {0x1f6e, 0x399}, {0x1fae}},
+            {0x1fa7, {0x1fa7}, {0x1f6f, 0x399}, {0x1faf}},
+            {0x1fa8, {0x1fa0}, {0x1f68, 0x399}, {0x1fa8}},
+            {0x1fa9, {0x1fa1}, {0x1f69, 0x399}, {0x1fa9}},
+            {0x1faa, {0x1fa2}, {0x1f6a, 0x399}, {0x1faa}},
+            {0x1fab, {0x1fa3}, {0x1f6b, 0x399}, {0x1fab}},
+            {0x1fac, {0x1fa4}, {0x1f6c, 0x399}, {0x1fac}},
+            {0x1fad, {0x1fa5}, {0x1f6d, 0x399}, {0x1fad}},
+            {0x1fae, {0x1fa6}, {0x1f6e, 0x399}, {0x1fae}},
+            {0x1faf, {0x1fa7}, {0x1f6f, 0x399}, {0x1faf}},
+            {0x1fb2, {0x1fb2}, {0x1fba, 0x399}, {0x1fba, 0x345}},
+            {0x1fb3, {0x1fb3}, {0x391, 0x399}, {0x1fbc}},
+            {0x1fb4, {0x1fb4}, {0x386, 0x399}, {0x386, 0x345}},
+            {0x1fb6, {0x1fb6}, {0x391, 0x342}, {0x391, 0x342}},
+            {0x1fb7, {0x1fb7}, {0x391, 0x342, 0x399}, {0x391, 0x342, 0x345}},
+            {0x1fbc, {0x1fb3}, {0x391, 0x399}, {0x1fbc}},
+            {0x1fc2, {0x1fc2}, {0x1fca, 0x399}, {0x1fca, 0x345}},
+            {0x1fc3, {0x1fc3}, {0x397, 0x399}, {0x1fcc}},
+            {0x1fc4, {0x1fc4}, {0x389, 0x399}, {0x389, 0x345}},
+            {0x1fc6, {0x1fc6}, {0x397, 0x342}, {0x397, 0x342}},
+            {0x1fc7, {0x1fc7}, {0x397, 0x342, 0x399}, {0x397, 0x342, 0x345}},
+            {0x1fcc, {0x1fc3}, {0x397, 0x399}, {0x1fcc}},
+            {0x1fd2, {0x1fd2}, {0x399, 0x308, 0x300}, {0x399, 0x308, 0x300}},
+            {0x1fd3, {0x1fd3}, {0x399, 0x308, 0x301}, {0x399, 0x308, 0x301}},
+            {0x1fd6, {0x1fd6}, {0x399, 0x342}, {0x399, 0x342}},
+            {0x1fd7, {0x1fd7}, {0x399, 0x308, 0x342}, {0x399, 0x308, 0x342}},
+            {0x1fe2, {0x1fe2}, {0x3a5, 0x308, 0x300}, {0x3a5, 0x308, 0x300}},
+            {0x1fe3, {0x1fe3}, {0x3a5, 0x308, 0x301}, {0x3a5, 0x308, 0x301}},
+            {0x1fe4, {0x1fe4}, {0x3a1, 0x313}, {0x3a1, 0x313}},
+            {0x1fe6, {0x1fe6}, {0x3a5, 0x342}, {0x3a5, 0x342}},
+            {0x1fe7, {0x1fe7}, {0x3a5, 0x308, 0x342}, {0x3a5, 0x308, 0x342}},
+            {0x1ff2, {0x1ff2}, {0x1ffa, 0x399}, {0x1ffa, 0x345}},
+            {0x1ff3, {0x1ff3}, {0x3a9, 0x399}, {0x1ffc}},
+            {0x1ff4, {0x1ff4}, {0x38f, 0x399}, {0x38f, 0x345}},
+            {0x1ff6, {0x1ff6}, {0x3a9, 0x342}, {0x3a9, 0x342}},
+            {0x1ff7, {0x1ff7}, {0x3a9, 0x342, 0x399}, {0x3a9, 0x342, 0x345}},
+            {0x1ffc, {0x1ff3}, {0x3a9, 0x399}, {0x1ffc}},
+            {0xfb00, {0xfb00}, {0x46, 0x46}, {0x46, 0x66}},
+            {0xfb01, {0xfb01}, {0x46, 0x49}, {0x46, 0x69}},
+            {0xfb02, {0xfb02}, {0x46, 0x4c}, {0x46, 0x6c}},
+            {0xfb03, {0xfb03}, {0x46, 0x46, 0x49}, {0x46, 0x66, 0x69}},
+            {0xfb04, {0xfb04}, {0x46, 0x46, 0x4c}, {0x46, 0x66, 0x6c}},
+            {0xfb05, {0xfb05}, {0x53, 0x54}, {0x53, 0x74}},
+            {0xfb06, {0xfb06}, {0x53, 0x54}, {0x53, 0x74}},
+            {0xfb13, {0xfb13}, {0x544, 0x546}, {0x544, 0x576}},
+            {0xfb14, {0xfb14}, {0x544, 0x535}, {0x544, 0x565}},
+            {0xfb15, {0xfb15}, {0x544, 0x53b}, {0x544, 0x56b}},
+            {0xfb16, {0xfb16}, {0x54e, 0x546}, {0x54e, 0x576}},
+            {0xfb17, {0xfb17}, {0x544, 0x53d}, {0x544, 0x56d}},
+        };
+        // end generated special_casing
+
+        // Code points with a special_casings entry or a context rule (capital sigma), one bit
+        // each in rows of 32 selected like the case delta rows.
+        // begin generated special_casing_bits, see tools/gen_unicode_tables.py
+        constexpr uint8_t special_casing_blocks[]
+        {
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x04, 0x05,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+        };
+
+        constexpr uint32_t special_casing_bits[]
+        {
+            0x00000000, 0x80000000, 0x00010000, 0x00000200, 0x00001ff0, 0x000f0000,
+            0x00010008, 0x00000080, 0xffff0000, 0xe7ffffff, 0x07c00000, 0x00550000,
+            0xffffffff, 0x10dcffff, 0x00cc10dc, 0x10dc00dc, 0x00f8007f,
+        };
+        // end generated special_casing_bits
+
         // https://www.compart.com/en/unicode/category
         enum class general_category : uint64_t {
             None = 0LL,
@@ -995,1947 +1743,2058 @@ namespace u32
             C = Cc | Cf | Cs | Co | Cn,
         };
 
-        const std::map<char32_t, general_category> general_category_range
+        constexpr unsigned property_block_shift = 7;
+        constexpr size_t property_block_size = size_t(1) << property_block_shift;
+
+        // General category of each code point as the bit position of its general_category value,
+        // bit 0 for None. Two-stage like the case tables, with blocks of 128 code points.
+        // begin generated general_category, see tools/gen_unicode_tables.py
+        constexpr uint8_t general_category_blocks[]
+        {
+            0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+            0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+            0x20, 0x21, 0x22, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x22, 0x22, 0x22, 0x28, 0x29, 0x2a, 0x2b,
+            0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+            0x3c, 0x3d, 0x3e, 0x3f, 0x40, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x45, 0x48, 0x49,
+            0x45, 0x45, 0x40, 0x4a, 0x40, 0x40, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x45, 0x53,
+            0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x45, 0x45, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x5a, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x5b, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x5c, 0x22, 0x22, 0x5d, 0x5e, 0x5f, 0x60,
+            0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x69,
+            0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x22, 0x22, 0x6c, 0x6d, 0x6e, 0x6f, 0x22, 0x22, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+            0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x22, 0x22, 0x82, 0x83,
+            0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x7a, 0x8f, 0x90, 0x91, 0x92,
+            0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x7a, 0x9a, 0x9b, 0x7a, 0x9c, 0x9d, 0x9e, 0x9f, 0x7a,
+            0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0x7a, 0x7a, 0xa6, 0xa7, 0xa8, 0xa9, 0x7a, 0xaa, 0x7a, 0xab,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xac, 0xad, 0x22, 0xae, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xaf,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xb0, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x22, 0x22, 0x22, 0x22, 0xb1, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x22, 0x22, 0x22, 0x22, 0xb2, 0xb3, 0xb4, 0xb5, 0x7a, 0x7a, 0x7a, 0x7a, 0xb6, 0xb7, 0xb8, 0xb9,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xba,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xbb, 0xbc, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xbd,
+            0x22, 0x22, 0xbe, 0x22, 0x22, 0xbf, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xc0, 0xc1, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xc2, 0xc3,
+            0x45, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0x7a, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0, 0xd1,
+            0x45, 0x45, 0x45, 0x45, 0xd2, 0xd3, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xd4, 0x7a,
+            0xd5, 0x7a, 0xd6, 0x7a, 0x7a, 0xd7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xd8,
+            0x22, 0xd9, 0xda, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xdb, 0xdc, 0xdd, 0x7a, 0xde, 0xdf, 0x7a, 0x7a,
+            0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0x7a, 0x45, 0xe5, 0x45, 0x45, 0x45, 0x45, 0x45, 0xe6, 0xe7, 0xe8,
+            0xe9, 0xea, 0x45, 0x45, 0xeb, 0xec, 0x45, 0xed, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xee, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xef, 0x22,
+            0xf0, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xf1, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xf2, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x22, 0x22, 0x22, 0x22, 0xf3, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+            0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xf4, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0xf5, 0x7a, 0xf6, 0xf7, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0xf8,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b,
+            0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0xf8,
+        };
+
+        constexpr uint8_t general_category_values[][property_block_size]
         {
-            {0x20, general_category::Cc},     {0x21, general_category::Zs},
-            {0x24, general_category::Po},     {0x25, general_category::Sc},
-            {0x28, general_category::Po},     {0x29, general_category::Ps},
-            {0x2a, general_category::Pe},     {0x2b, general_category::Po},
-            {0x2c, general_category::Sm},     {0x2d, general_category::Po},
-            {0x2e, general_category::Pd},     {0x30, general_category::Po},
-            {0x3a, general_category::Nd},     {0x3c, general_category::Po},
-            {0x3f, general_category::Sm},     {0x41, general_category::Po},
-            {0x5b, general_category::Lu},     {0x5c, general_category::Ps},
-            {0x5d, general_category::Po},     {0x5e, general_category::Pe},
-            {0x5f, general_category::Sk},     {0x60, general_category::Pc},
-            {0x61, general_category::Sk},     {0x7b, general_category::Ll},
-            {0x7c, general_category::Ps},     {0x7d, general_category::Sm},
-            {0x7e, general_category::Pe},     {0x7f, general_category::Sm},
-            {0xa0, general_category::Cc},     {0xa1, general_category::Zs},
-            {0xa2, general_category::Po},     {0xa6, general_category::Sc},
-            {0xa7, general_category::So},     {0xa8, general_category::Po},
-            {0xa9, general_category::Sk},     {0xaa, general_category::So},
-            {0xab, general_category::Lo},     {0xac, general_category::Pi},
-            {0xad, general_category::Sm},     {0xae, general_category::Cf},
-            {0xaf, general_category::So},     {0xb0, general_category::Sk},
-            {0xb1, general_category::So},     {0xb2, general_category::Sm},
-            {0xb4, general_category::No},     {0xb5, general_category::Sk},
-            {0xb6, general_category::Ll},     {0xb8, general_category::Po},
-            {0xb9, general_category::Sk},     {0xba, general_category::No},
-            {0xbb, general_category::Lo},     {0xbc, general_category::Pf},
-            {0xbf, general_category::No},     {0xc0, general_category::Po},
-            {0xd7, general_category::Lu},     {0xd8, general_category::Sm},
-            {0xdf, general_category::Lu},     {0xf7, general_category::Ll},
-            {0xf8, general_category::Sm},     {0x100, general_category::Ll},
-            {0x101, general_category::Lu},    {0x102, general_category::Ll},
-            {0x103, general_category::Lu},    {0x104, general_category::Ll},
-            {0x105, general_category::Lu},    {0x106, general_category::Ll},
-            {0x107, general_category::Lu},    {0x108, general_category::Ll},
-            {0x109, general_category::Lu},    {0x10a, general_category::Ll},
-            {0x10b, general_category::Lu},    {0x10c, general_category::Ll},
-            {0x10d, general_category::Lu},    {0x10e, general_category::Ll},
-            {0x10f, general_category::Lu},    {0x110, general_category::Ll},
-            {0x111, general_category::Lu},    {0x112, general_category::Ll},
-            {0x113, general_category::Lu},    {0x114, general_category::Ll},
-            {0x115, general_category::Lu},    {0x116, general_category::Ll},
-            {0x117, general_category::Lu},    {0x118, general_category::Ll},
-            {0x119, general_category::Lu},    {0x11a, general_category::Ll},
-            {0x11b, general_category::Lu},    {0x11c, general_category::Ll},
-            {0x11d, general_category::Lu},    {0x11e, general_category::Ll},
-            {0x11f, general_category::Lu},    {0x120, general_category::Ll},
-            {0x121, general_category::Lu},    {0x122, general_category::Ll},
-            {0x123, general_category::Lu},    {0x124, general_category::Ll},
-            {0x125, general_category::Lu},    {0x126, general_category::Ll},
-            {0x127, general_category::Lu},    {0x128, general_category::Ll},
-            {0x129, general_category::Lu},    {0x12a, general_category::Ll},
-            {0x12b, general_category::Lu},    {0x12c, general_category::Ll},
-            {0x12d, general_category::Lu},    {0x12e, general_category::Ll},
-            {0x12f, general_category::Lu},    {0x130, general_category::Ll},
-            {0x131, general_category::Lu},    {0x132, general_category::Ll},
-            {0x133, general_category::Lu},    {0x134, general_category::Ll},
-            {0x135, general_category::Lu},    {0x136, general_category::Ll},
-            {0x137, general_category::Lu},    {0x139, general_category::Ll},
-            {0x13a, general_category::Lu},    {0x13b, general_category::Ll},
-            {0x13c, general_category::Lu},    {0x13d, general_category::Ll},
-            {0x13e, general_category::Lu},    {0x13f, general_category::Ll},
-            {0x140, general_category::Lu},    {0x141, general_category::Ll},
-            {0x142, general_category::Lu},    {0x143, general_category::Ll},
-            {0x144, general_category::Lu},    {0x145, general_category::Ll},
-            {0x146, general_category::Lu},    {0x147, general_category::Ll},
-            {0x148, general_category::Lu},    {0x14a, general_category::Ll},
-            {0x14b, general_category::Lu},    {0x14c, general_category::Ll},
-            {0x14d, general_category::Lu},    {0x14e, general_category::Ll},
-            {0x14f, general_category::Lu},    {0x150, general_category::Ll},
-            {0x151, general_category::Lu},    {0x152, general_category::Ll},
-            {0x153, general_category::Lu},    {0x154, general_category::Ll},
-            {0x155, general_category::Lu},    {0x156, general_category::Ll},
-            {0x157, general_category::Lu},    {0x158, general_category::Ll},
-            {0x159, general_category::Lu},    {0x15a, general_category::Ll},
-            {0x15b, general_category::Lu},    {0x15c, general_category::Ll},
-            {0x15d, general_category::Lu},    {0x15e, general_category::Ll},
-            {0x15f, general_category::Lu},    {0x160, general_category::Ll},
-            {0x161, general_category::Lu},    {0x162, general_category::Ll},
-            {0x163, general_category::Lu},    {0x164, general_category::Ll},
-            {0x165, general_category::Lu},    {0x166, general_category::Ll},
-            {0x167, general_category::Lu},    {0x168, general_category::Ll},
-            {0x169, general_category::Lu},    {0x16a, general_category::Ll},
-            {0x16b, general_category::Lu},    {0x16c, general_category::Ll},
-            {0x16d, general_category::Lu},    {0x16e, general_category::Ll},
-            {0x16f, general_category::Lu},    {0x170, general_category::Ll},
-            {0x171, general_category::Lu},    {0x172, general_category::Ll},
-            {0x173, general_category::Lu},    {0x174, general_category::Ll},
-            {0x175, general_category::Lu},    {0x176, general_category::Ll},
-            {0x177, general_category::Lu},    {0x178, general_category::Ll},
-            {0x17a, general_category::Lu},    {0x17b, general_category::Ll},
-            {0x17c, general_category::Lu},    {0x17d, general_category::Ll},
-            {0x17e, general_category::Lu},    {0x181, general_category::Ll},
-            {0x183, general_category::Lu},    {0x184, general_category::Ll},
-            {0x185, general_category::Lu},    {0x186, general_category::Ll},
-            {0x188, general_category::Lu},    {0x189, general_category::Ll},
-            {0x18c, general_category::Lu},    {0x18e, general_category::Ll},
-            {0x192, general_category::Lu},    {0x193, general_category::Ll},
-            {0x195, general_category::Lu},    {0x196, general_category::Ll},
-            {0x199, general_category::Lu},    {0x19c, general_category::Ll},
-            {0x19e, general_category::Lu},    {0x19f, general_category::Ll},
-            {0x1a1, general_category::Lu},    {0x1a2, general_category::Ll},
-            {0x1a3, general_category::Lu},    {0x1a4, general_category::Ll},
-            {0x1a5, general_category::Lu},    {0x1a6, general_category::Ll},
-            {0x1a8, general_category::Lu},    {0x1a9, general_category::Ll},
-            {0x1aa, general_category::Lu},    {0x1ac, general_category::Ll},
-            {0x1ad, general_category::Lu},    {0x1ae, general_category::Ll},
-            {0x1b0, general_category::Lu},    {0x1b1, general_category::Ll},
-            {0x1b4, general_category::Lu},    {0x1b5, general_category::Ll},
-            {0x1b6, general_category::Lu},    {0x1b7, general_category::Ll},
-            {0x1b9, general_category::Lu},    {0x1bb, general_category::Ll},
-            {0x1bc, general_category::Lo},    {0x1bd, general_category::Lu},
-            {0x1c0, general_category::Ll},    {0x1c4, general_category::Lo},
-            {0x1c5, general_category::Lu},    {0x1c6, general_category::Lt},
-            {0x1c7, general_category::Ll},    {0x1c8, general_category::Lu},
-            {0x1c9, general_category::Lt},    {0x1ca, general_category::Ll},
-            {0x1cb, general_category::Lu},    {0x1cc, general_category::Lt},
-            {0x1cd, general_category::Ll},    {0x1ce, general_category::Lu},
-            {0x1cf, general_category::Ll},    {0x1d0, general_category::Lu},
-            {0x1d1, general_category::Ll},    {0x1d2, general_category::Lu},
-            {0x1d3, general_category::Ll},    {0x1d4, general_category::Lu},
-            {0x1d5, general_category::Ll},    {0x1d6, general_category::Lu},
-            {0x1d7, general_category::Ll},    {0x1d8, general_category::Lu},
-            {0x1d9, general_category::Ll},    {0x1da, general_category::Lu},
-            {0x1db, general_category::Ll},    {0x1dc, general_category::Lu},
-            {0x1de, general_category::Ll},    {0x1df, general_category::Lu},
-            {0x1e0, general_category::Ll},    {0x1e1, general_category::Lu},
-            {0x1e2, general_category::Ll},    {0x1e3, general_category::Lu},
-            {0x1e4, general_category::Ll},    {0x1e5, general_category::Lu},
-            {0x1e6, general_category::Ll},    {0x1e7, general_category::Lu},
-            {0x1e8, general_category::Ll},    {0x1e9, general_category::Lu},
-            {0x1ea, general_category::Ll},    {0x1eb, general_category::Lu},
-            {0x1ec, general_category::Ll},    {0x1ed, general_category::Lu},
-            {0x1ee, general_category::Ll},    {0x1ef, general_category::Lu},
-            {0x1f1, general_category::Ll},    {0x1f2, general_category::Lu},
-            {0x1f3, general_category::Lt},    {0x1f4, general_category::Ll},
-            {0x1f5, general_category::Lu},    {0x1f6, general_category::Ll},
-            {0x1f9, general_category::Lu},    {0x1fa, general_category::Ll},
-            {0x1fb, general_category::Lu},    {0x1fc, general_category::Ll},
-            {0x1fd, general_category::Lu},    {0x1fe, general_category::Ll},
-            {0x1ff, general_category::Lu},    {0x200, general_category::Ll},
-            {0x201, general_category::Lu},    {0x202, general_category::Ll},
-            {0x203, general_category::Lu},    {0x204, general_category::Ll},
-            {0x205, general_category::Lu},    {0x206, general_category::Ll},
-            {0x207, general_category::Lu},    {0x208, general_category::Ll},
-            {0x209, general_category::Lu},    {0x20a, general_category::Ll},
-            {0x20b, general_category::Lu},    {0x20c, general_category::Ll},
-            {0x20d, general_category::Lu},    {0x20e, general_category::Ll},
-            {0x20f, general_category::Lu},    {0x210, general_category::Ll},
-            {0x211, general_category::Lu},    {0x212, general_category::Ll},
-            {0x213, general_category::Lu},    {0x214, general_category::Ll},
-            {0x215, general_category::Lu},    {0x216, general_category::Ll},
-            {0x217, general_category::Lu},    {0x218, general_category::Ll},
-            {0x219, general_category::Lu},    {0x21a, general_category::Ll},
-            {0x21b, general_category::Lu},    {0x21c, general_category::Ll},
-            {0x21d, general_category::Lu},    {0x21e, general_category::Ll},
-            {0x21f, general_category::Lu},    {0x220, general_category::Ll},
-            {0x221, general_category::Lu},    {0x222, general_category::Ll},
-            {0x223, general_category::Lu},    {0x224, general_category::Ll},
-            {0x225, general_category::Lu},    {0x226, general_category::Ll},
-            {0x227, general_category::Lu},    {0x228, general_category::Ll},
-            {0x229, general_category::Lu},    {0x22a, general_category::Ll},
-            {0x22b, general_category::Lu},    {0x22c, general_category::Ll},
-            {0x22d, general_category::Lu},    {0x22e, general_category::Ll},
-            {0x22f, general_category::Lu},    {0x230, general_category::Ll},
-            {0x231, general_category::Lu},    {0x232, general_category::Ll},
-            {0x233, general_category::Lu},    {0x23a, general_category::Ll},
-            {0x23c, general_category::Lu},    {0x23d, general_category::Ll},
-            {0x23f, general_category::Lu},    {0x241, general_category::Ll},
-            {0x242, general_category::Lu},    {0x243, general_category::Ll},
-            {0x247, general_category::Lu},    {0x248, general_category::Ll},
-            {0x249, general_category::Lu},    {0x24a, general_category::Ll},
-            {0x24b, general_category::Lu},    {0x24c, general_category::Ll},
-            {0x24d, general_category::Lu},    {0x24e, general_category::Ll},
-            {0x24f, general_category::Lu},    {0x294, general_category::Ll},
-            {0x295, general_category::Lo},    {0x2b0, general_category::Ll},
-            {0x2c2, general_category::Lm},    {0x2c6, general_category::Sk},
-            {0x2d2, general_category::Lm},    {0x2e0, general_category::Sk},
-            {0x2e5, general_category::Lm},    {0x2ec, general_category::Sk},
-            {0x2ed, general_category::Lm},    {0x2ee, general_category::Sk},
-            {0x2ef, general_category::Lm},    {0x300, general_category::Sk},
-            {0x370, general_category::Mn},    {0x371, general_category::Lu},
-            {0x372, general_category::Ll},    {0x373, general_category::Lu},
-            {0x374, general_category::Ll},    {0x375, general_category::Lm},
-            {0x376, general_category::Sk},    {0x377, general_category::Lu},
-            {0x378, general_category::Ll},    {0x37a, general_category::Cn},
-            {0x37b, general_category::Lm},    {0x37e, general_category::Ll},
-            {0x37f, general_category::Po},    {0x380, general_category::Lu},
-            {0x384, general_category::Cn},    {0x386, general_category::Sk},
-            {0x387, general_category::Lu},    {0x388, general_category::Po},
-            {0x38b, general_category::Lu},    {0x38c, general_category::Cn},
-            {0x38d, general_category::Lu},    {0x38e, general_category::Cn},
-            {0x390, general_category::Lu},    {0x391, general_category::Ll},
-            {0x3a2, general_category::Lu},    {0x3a3, general_category::Cn},
-            {0x3ac, general_category::Lu},    {0x3cf, general_category::Ll},
-            {0x3d0, general_category::Lu},    {0x3d2, general_category::Ll},
-            {0x3d5, general_category::Lu},    {0x3d8, general_category::Ll},
-            {0x3d9, general_category::Lu},    {0x3da, general_category::Ll},
-            {0x3db, general_category::Lu},    {0x3dc, general_category::Ll},
-            {0x3dd, general_category::Lu},    {0x3de, general_category::Ll},
-            {0x3df, general_category::Lu},    {0x3e0, general_category::Ll},
-            {0x3e1, general_category::Lu},    {0x3e2, general_category::Ll},
-            {0x3e3, general_category::Lu},    {0x3e4, general_category::Ll},
-            {0x3e5, general_category::Lu},    {0x3e6, general_category::Ll},
-            {0x3e7, general_category::Lu},    {0x3e8, general_category::Ll},
-            {0x3e9, general_category::Lu},    {0x3ea, general_category::Ll},
-            {0x3eb, general_category::Lu},    {0x3ec, general_category::Ll},
-            {0x3ed, general_category::Lu},    {0x3ee, general_category::Ll},
-            {0x3ef, general_category::Lu},    {0x3f4, general_category::Ll},
-            {0x3f5, general_category::Lu},    {0x3f6, general_category::Ll},
-            {0x3f7, general_category::Sm},    {0x3f8, general_category::Lu},
-            {0x3f9, general_category::Ll},    {0x3fb, general_category::Lu},
-            {0x3fd, general_category::Ll},    {0x430, general_category::Lu},
-            {0x460, general_category::Ll},    {0x461, general_category::Lu},
-            {0x462, general_category::Ll},    {0x463, general_category::Lu},
-            {0x464, general_category::Ll},    {0x465, general_category::Lu},
-            {0x466, general_category::Ll},    {0x467, general_category::Lu},
-            {0x468, general_category::Ll},    {0x469, general_category::Lu},
-            {0x46a, general_category::Ll},    {0x46b, general_category::Lu},
-            {0x46c, general_category::Ll},    {0x46d, general_category::Lu},
-            {0x46e, general_category::Ll},    {0x46f, general_category::Lu},
-            {0x470, general_category::Ll},    {0x471, general_category::Lu},
-            {0x472, general_category::Ll},    {0x473, general_category::Lu},
-            {0x474, general_category::Ll},    {0x475, general_category::Lu},
-            {0x476, general_category::Ll},    {0x477, general_category::Lu},
-            {0x478, general_category::Ll},    {0x479, general_category::Lu},
-            {0x47a, general_category::Ll},    {0x47b, general_category::Lu},
-            {0x47c, general_category::Ll},    {0x47d, general_category::Lu},
-            {0x47e, general_category::Ll},    {0x47f, general_category::Lu},
-            {0x480, general_category::Ll},    {0x481, general_category::Lu},
-            {0x482, general_category::Ll},    {0x483, general_category::So},
-            {0x488, general_category::Mn},    {0x48a, general_category::Me},
-            {0x48b, general_category::Lu},    {0x48c, general_category::Ll},
-            {0x48d, general_category::Lu},    {0x48e, general_category::Ll},
-            {0x48f, general_category::Lu},    {0x490, general_category::Ll},
-            {0x491, general_category::Lu},    {0x492, general_category::Ll},
-            {0x493, general_category::Lu},    {0x494, general_category::Ll},
-            {0x495, general_category::Lu},    {0x496, general_category::Ll},
-            {0x497, general_category::Lu},    {0x498, general_category::Ll},
-            {0x499, general_category::Lu},    {0x49a, general_category::Ll},
-            {0x49b, general_category::Lu},    {0x49c, general_category::Ll},
-            {0x49d, general_category::Lu},    {0x49e, general_category::Ll},
-            {0x49f, general_category::Lu},    {0x4a0, general_category::Ll},
-            {0x4a1, general_category::Lu},    {0x4a2, general_category::Ll},
-            {0x4a3, general_category::Lu},    {0x4a4, general_category::Ll},
-            {0x4a5, general_category::Lu},    {0x4a6, general_category::Ll},
-            {0x4a7, general_category::Lu},    {0x4a8, general_category::Ll},
-            {0x4a9, general_category::Lu},    {0x4aa, general_category::Ll},
-            {0x4ab, general_category::Lu},    {0x4ac, general_category::Ll},
-            {0x4ad, general_category::Lu},    {0x4ae, general_category::Ll},
-            {0x4af, general_category::Lu},    {0x4b0, general_category::Ll},
-            {0x4b1, general_category::Lu},    {0x4b2, general_category::Ll},
-            {0x4b3, general_category::Lu},    {0x4b4, general_category::Ll},
-            {0x4b5, general_category::Lu},    {0x4b6, general_category::Ll},
-            {0x4b7, general_category::Lu},    {0x4b8, general_category::Ll},
-            {0x4b9, general_category::Lu},    {0x4ba, general_category::Ll},
-            {0x4bb, general_category::Lu},    {0x4bc, general_category::Ll},
-            {0x4bd, general_category::Lu},    {0x4be, general_category::Ll},
-            {0x4bf, general_category::Lu},    {0x4c0, general_category::Ll},
-            {0x4c2, general_category::Lu},    {0x4c3, general_category::Ll},
-            {0x4c4, general_category::Lu},    {0x4c5, general_category::Ll},
-            {0x4c6, general_category::Lu},    {0x4c7, general_category::Ll},
-            {0x4c8, general_category::Lu},    {0x4c9, general_category::Ll},
-            {0x4ca, general_category::Lu},    {0x4cb, general_category::Ll},
-            {0x4cc, general_category::Lu},    {0x4cd, general_category::Ll},
-            {0x4ce, general_category::Lu},    {0x4d0, general_category::Ll},
-            {0x4d1, general_category::Lu},    {0x4d2, general_category::Ll},
-            {0x4d3, general_category::Lu},    {0x4d4, general_category::Ll},
-            {0x4d5, general_category::Lu},    {0x4d6, general_category::Ll},
-            {0x4d7, general_category::Lu},    {0x4d8, general_category::Ll},
-            {0x4d9, general_category::Lu},    {0x4da, general_category::Ll},
-            {0x4db, general_category::Lu},    {0x4dc, general_category::Ll},
-            {0x4dd, general_category::Lu},    {0x4de, general_category::Ll},
-            {0x4df, general_category::Lu},    {0x4e0, general_category::Ll},
-            {0x4e1, general_category::Lu},    {0x4e2, general_category::Ll},
-            {0x4e3, general_category::Lu},    {0x4e4, general_category::Ll},
-            {0x4e5, general_category::Lu},    {0x4e6, general_category::Ll},
-            {0x4e7, general_category::Lu},    {0x4e8, general_category::Ll},
-            {0x4e9, general_category::Lu},    {0x4ea, general_category::Ll},
-            {0x4eb, general_category::Lu},    {0x4ec, general_category::Ll},
-            {0x4ed, general_category::Lu},    {0x4ee, general_category::Ll},
-            {0x4ef, general_category::Lu},    {0x4f0, general_category::Ll},
-            {0x4f1, general_category::Lu},    {0x4f2, general_category::Ll},
-            {0x4f3, general_category::Lu},    {0x4f4, general_category::Ll},
-            {0x4f5, general_category::Lu},    {0x4f6, general_category::Ll},
-            {0x4f7, general_category::Lu},    {0x4f8, general_category::Ll},
-            {0x4f9, general_category::Lu},    {0x4fa, general_category::Ll},
-            {0x4fb, general_category::Lu},    {0x4fc, general_category::Ll},
-            {0x4fd, general_category::Lu},    {0x4fe, general_category::Ll},
-            {0x4ff, general_category::Lu},    {0x500, general_category::Ll},
-            {0x501, general_category::Lu},    {0x502, general_category::Ll},
-            {0x503, general_category::Lu},    {0x504, general_category::Ll},
-            {0x505, general_category::Lu},    {0x506, general_category::Ll},
-            {0x507, general_category::Lu},    {0x508, general_category::Ll},
-            {0x509, general_category::Lu},    {0x50a, general_category::Ll},
-            {0x50b, general_category::Lu},    {0x50c, general_category::Ll},
-            {0x50d, general_category::Lu},    {0x50e, general_category::Ll},
-            {0x50f, general_category::Lu},    {0x510, general_category::Ll},
-            {0x511, general_category::Lu},    {0x512, general_category::Ll},
-            {0x513, general_category::Lu},    {0x514, general_category::Ll},
-            {0x515, general_category::Lu},    {0x516, general_category::Ll},
-            {0x517, general_category::Lu},    {0x518, general_category::Ll},
-            {0x519, general_category::Lu},    {0x51a, general_category::Ll},
-            {0x51b, general_category::Lu},    {0x51c, general_category::Ll},
-            {0x51d, general_category::Lu},    {0x51e, general_category::Ll},
-            {0x51f, general_category::Lu},    {0x520, general_category::Ll},
-            {0x521, general_category::Lu},    {0x522, general_category::Ll},
-            {0x523, general_category::Lu},    {0x524, general_category::Ll},
-            {0x525, general_category::Lu},    {0x526, general_category::Ll},
-            {0x527, general_category::Lu},    {0x528, general_category::Ll},
-            {0x529, general_category::Lu},    {0x52a, general_category::Ll},
-            {0x52b, general_category::Lu},    {0x52c, general_category::Ll},
-            {0x52d, general_category::Lu},    {0x52e, general_category::Ll},
-            {0x52f, general_category::Lu},    {0x530, general_category::Ll},
-            {0x531, general_category::Cn},    {0x557, general_category::Lu},
-            {0x559, general_category::Cn},    {0x55a, general_category::Lm},
-            {0x560, general_category::Po},    {0x589, general_category::Ll},
-            {0x58a, general_category::Po},    {0x58b, general_category::Pd},
-            {0x58d, general_category::Cn},    {0x58f, general_category::So},
-            {0x590, general_category::Sc},    {0x591, general_category::Cn},
-            {0x5be, general_category::Mn},    {0x5bf, general_category::Pd},
-            {0x5c0, general_category::Mn},    {0x5c1, general_category::Po},
-            {0x5c3, general_category::Mn},    {0x5c4, general_category::Po},
-            {0x5c6, general_category::Mn},    {0x5c7, general_category::Po},
-            {0x5c8, general_category::Mn},    {0x5d0, general_category::Cn},
-            {0x5eb, general_category::Lo},    {0x5ef, general_category::Cn},
-            {0x5f3, general_category::Lo},    {0x5f5, general_category::Po},
-            {0x600, general_category::Cn},    {0x606, general_category::Cf},
-            {0x609, general_category::Sm},    {0x60b, general_category::Po},
-            {0x60c, general_category::Sc},    {0x60e, general_category::Po},
-            {0x610, general_category::So},    {0x61b, general_category::Mn},
-            {0x61c, general_category::Po},    {0x61d, general_category::Cf},
-            {0x61e, general_category::Cn},    {0x620, general_category::Po},
-            {0x640, general_category::Lo},    {0x641, general_category::Lm},
-            {0x64b, general_category::Lo},    {0x660, general_category::Mn},
-            {0x66a, general_category::Nd},    {0x66e, general_category::Po},
-            {0x670, general_category::Lo},    {0x671, general_category::Mn},
-            {0x6d4, general_category::Lo},    {0x6d5, general_category::Po},
-            {0x6d6, general_category::Lo},    {0x6dd, general_category::Mn},
-            {0x6de, general_category::Cf},    {0x6df, general_category::So},
-            {0x6e5, general_category::Mn},    {0x6e7, general_category::Lm},
-            {0x6e9, general_category::Mn},    {0x6ea, general_category::So},
-            {0x6ee, general_category::Mn},    {0x6f0, general_category::Lo},
-            {0x6fa, general_category::Nd},    {0x6fd, general_category::Lo},
-            {0x6ff, general_category::So},    {0x700, general_category::Lo},
-            {0x70e, general_category::Po},    {0x70f, general_category::Cn},
-            {0x710, general_category::Cf},    {0x711, general_category::Lo},
-            {0x712, general_category::Mn},    {0x730, general_category::Lo},
-            {0x74b, general_category::Mn},    {0x74d, general_category::Cn},
-            {0x7a6, general_category::Lo},    {0x7b1, general_category::Mn},
-            {0x7b2, general_category::Lo},    {0x7c0, general_category::Cn},
-            {0x7ca, general_category::Nd},    {0x7eb, general_category::Lo},
-            {0x7f4, general_category::Mn},    {0x7f6, general_category::Lm},
-            {0x7f7, general_category::So},    {0x7fa, general_category::Po},
-            {0x7fb, general_category::Lm},    {0x7fd, general_category::Cn},
-            {0x7fe, general_category::Mn},    {0x800, general_category::Sc},
-            {0x816, general_category::Lo},    {0x81a, general_category::Mn},
-            {0x81b, general_category::Lm},    {0x824, general_category::Mn},
-            {0x825, general_category::Lm},    {0x828, general_category::Mn},
-            {0x829, general_category::Lm},    {0x82e, general_category::Mn},
-            {0x830, general_category::Cn},    {0x83f, general_category::Po},
-            {0x840, general_category::Cn},    {0x859, general_category::Lo},
-            {0x85c, general_category::Mn},    {0x85e, general_category::Cn},
-            {0x85f, general_category::Po},    {0x860, general_category::Cn},
-            {0x86b, general_category::Lo},    {0x8a0, general_category::Cn},
-            {0x8b5, general_category::Lo},    {0x8b6, general_category::Cn},
-            {0x8c8, general_category::Lo},    {0x8d3, general_category::Cn},
-            {0x8e2, general_category::Mn},    {0x8e3, general_category::Cf},
-            {0x903, general_category::Mn},    {0x904, general_category::Mc},
-            {0x93a, general_category::Lo},    {0x93b, general_category::Mn},
-            {0x93c, general_category::Mc},    {0x93d, general_category::Mn},
-            {0x93e, general_category::Lo},    {0x941, general_category::Mc},
-            {0x949, general_category::Mn},    {0x94d, general_category::Mc},
-            {0x94e, general_category::Mn},    {0x950, general_category::Mc},
-            {0x951, general_category::Lo},    {0x958, general_category::Mn},
-            {0x962, general_category::Lo},    {0x964, general_category::Mn},
-            {0x966, general_category::Po},    {0x970, general_category::Nd},
-            {0x971, general_category::Po},    {0x972, general_category::Lm},
-            {0x981, general_category::Lo},    {0x982, general_category::Mn},
-            {0x984, general_category::Mc},    {0x985, general_category::Cn},
-            {0x98d, general_category::Lo},    {0x98f, general_category::Cn},
-            {0x991, general_category::Lo},    {0x993, general_category::Cn},
-            {0x9a9, general_category::Lo},    {0x9aa, general_category::Cn},
-            {0x9b1, general_category::Lo},    {0x9b2, general_category::Cn},
-            {0x9b3, general_category::Lo},    {0x9b6, general_category::Cn},
-            {0x9ba, general_category::Lo},    {0x9bc, general_category::Cn},
-            {0x9bd, general_category::Mn},    {0x9be, general_category::Lo},
-            {0x9c1, general_category::Mc},    {0x9c5, general_category::Mn},
-            {0x9c7, general_category::Cn},    {0x9c9, general_category::Mc},
-            {0x9cb, general_category::Cn},    {0x9cd, general_category::Mc},
-            {0x9ce, general_category::Mn},    {0x9cf, general_category::Lo},
-            {0x9d7, general_category::Cn},    {0x9d8, general_category::Mc},
-            {0x9dc, general_category::Cn},    {0x9de, general_category::Lo},
-            {0x9df, general_category::Cn},    {0x9e2, general_category::Lo},
-            {0x9e4, general_category::Mn},    {0x9e6, general_category::Cn},
-            {0x9f0, general_category::Nd},    {0x9f2, general_category::Lo},
-            {0x9f4, general_category::Sc},    {0x9fa, general_category::No},
-            {0x9fb, general_category::So},    {0x9fc, general_category::Sc},
-            {0x9fd, general_category::Lo},    {0x9fe, general_category::Po},
-            {0x9ff, general_category::Mn},    {0xa01, general_category::Cn},
-            {0xa03, general_category::Mn},    {0xa04, general_category::Mc},
-            {0xa05, general_category::Cn},    {0xa0b, general_category::Lo},
-            {0xa0f, general_category::Cn},    {0xa11, general_category::Lo},
-            {0xa13, general_category::Cn},    {0xa29, general_category::Lo},
-            {0xa2a, general_category::Cn},    {0xa31, general_category::Lo},
-            {0xa32, general_category::Cn},    {0xa34, general_category::Lo},
-            {0xa35, general_category::Cn},    {0xa37, general_category::Lo},
-            {0xa38, general_category::Cn},    {0xa3a, general_category::Lo},
-            {0xa3c, general_category::Cn},    {0xa3d, general_category::Mn},
-            {0xa3e, general_category::Cn},    {0xa41, general_category::Mc},
-            {0xa43, general_category::Mn},    {0xa47, general_category::Cn},
-            {0xa49, general_category::Mn},    {0xa4b, general_category::Cn},
-            {0xa4e, general_category::Mn},    {0xa51, general_category::Cn},
-            {0xa52, general_category::Mn},    {0xa59, general_category::Cn},
-            {0xa5d, general_category::Lo},    {0xa5e, general_category::Cn},
-            {0xa5f, general_category::Lo},    {0xa66, general_category::Cn},
-            {0xa70, general_category::Nd},    {0xa72, general_category::Mn},
-            {0xa75, general_category::Lo},    {0xa76, general_category::Mn},
-            {0xa77, general_category::Po},    {0xa81, general_category::Cn},
-            {0xa83, general_category::Mn},    {0xa84, general_category::Mc},
-            {0xa85, general_category::Cn},    {0xa8e, general_category::Lo},
-            {0xa8f, general_category::Cn},    {0xa92, general_category::Lo},
-            {0xa93, general_category::Cn},    {0xaa9, general_category::Lo},
-            {0xaaa, general_category::Cn},    {0xab1, general_category::Lo},
-            {0xab2, general_category::Cn},    {0xab4, general_category::Lo},
-            {0xab5, general_category::Cn},    {0xaba, general_category::Lo},
-            {0xabc, general_category::Cn},    {0xabd, general_category::Mn},
-            {0xabe, general_category::Lo},    {0xac1, general_category::Mc},
-            {0xac6, general_category::Mn},    {0xac7, general_category::Cn},
-            {0xac9, general_category::Mn},    {0xaca, general_category::Mc},
-            {0xacb, general_category::Cn},    {0xacd, general_category::Mc},
-            {0xace, general_category::Mn},    {0xad0, general_category::Cn},
-            {0xad1, general_category::Lo},    {0xae0, general_category::Cn},
-            {0xae2, general_category::Lo},    {0xae4, general_category::Mn},
-            {0xae6, general_category::Cn},    {0xaf0, general_category::Nd},
-            {0xaf1, general_category::Po},    {0xaf2, general_category::Sc},
-            {0xaf9, general_category::Cn},    {0xafa, general_category::Lo},
-            {0xb00, general_category::Mn},    {0xb01, general_category::Cn},
-            {0xb02, general_category::Mn},    {0xb04, general_category::Mc},
-            {0xb05, general_category::Cn},    {0xb0d, general_category::Lo},
-            {0xb0f, general_category::Cn},    {0xb11, general_category::Lo},
-            {0xb13, general_category::Cn},    {0xb29, general_category::Lo},
-            {0xb2a, general_category::Cn},    {0xb31, general_category::Lo},
-            {0xb32, general_category::Cn},    {0xb34, general_category::Lo},
-            {0xb35, general_category::Cn},    {0xb3a, general_category::Lo},
-            {0xb3c, general_category::Cn},    {0xb3d, general_category::Mn},
-            {0xb3e, general_category::Lo},    {0xb3f, general_category::Mc},
-            {0xb40, general_category::Mn},    {0xb41, general_category::Mc},
-            {0xb45, general_category::Mn},    {0xb47, general_category::Cn},
-            {0xb49, general_category::Mc},    {0xb4b, general_category::Cn},
-            {0xb4d, general_category::Mc},    {0xb4e, general_category::Mn},
-            {0xb55, general_category::Cn},    {0xb57, general_category::Mn},
-            {0xb58, general_category::Mc},    {0xb5c, general_category::Cn},
-            {0xb5e, general_category::Lo},    {0xb5f, general_category::Cn},
-            {0xb62, general_category::Lo},    {0xb64, general_category::Mn},
-            {0xb66, general_category::Cn},    {0xb70, general_category::Nd},
-            {0xb71, general_category::So},    {0xb72, general_category::Lo},
-            {0xb78, general_category::No},    {0xb82, general_category::Cn},
-            {0xb83, general_category::Mn},    {0xb84, general_category::Lo},
-            {0xb85, general_category::Cn},    {0xb8b, general_category::Lo},
-            {0xb8e, general_category::Cn},    {0xb91, general_category::Lo},
-            {0xb92, general_category::Cn},    {0xb96, general_category::Lo},
-            {0xb99, general_category::Cn},    {0xb9b, general_category::Lo},
-            {0xb9c, general_category::Cn},    {0xb9d, general_category::Lo},
-            {0xb9e, general_category::Cn},    {0xba0, general_category::Lo},
-            {0xba3, general_category::Cn},    {0xba5, general_category::Lo},
-            {0xba8, general_category::Cn},    {0xbab, general_category::Lo},
-            {0xbae, general_category::Cn},    {0xbba, general_category::Lo},
-            {0xbbe, general_category::Cn},    {0xbc0, general_category::Mc},
-            {0xbc1, general_category::Mn},    {0xbc3, general_category::Mc},
-            {0xbc6, general_category::Cn},    {0xbc9, general_category::Mc},
-            {0xbca, general_category::Cn},    {0xbcd, general_category::Mc},
-            {0xbce, general_category::Mn},    {0xbd0, general_category::Cn},
-            {0xbd1, general_category::Lo},    {0xbd7, general_category::Cn},
-            {0xbd8, general_category::Mc},    {0xbe6, general_category::Cn},
-            {0xbf0, general_category::Nd},    {0xbf3, general_category::No},
-            {0xbf9, general_category::So},    {0xbfa, general_category::Sc},
-            {0xbfb, general_category::So},    {0xc00, general_category::Cn},
-            {0xc01, general_category::Mn},    {0xc04, general_category::Mc},
-            {0xc05, general_category::Mn},    {0xc0d, general_category::Lo},
-            {0xc0e, general_category::Cn},    {0xc11, general_category::Lo},
-            {0xc12, general_category::Cn},    {0xc29, general_category::Lo},
-            {0xc2a, general_category::Cn},    {0xc3a, general_category::Lo},
-            {0xc3d, general_category::Cn},    {0xc3e, general_category::Lo},
-            {0xc41, general_category::Mn},    {0xc45, general_category::Mc},
-            {0xc46, general_category::Cn},    {0xc49, general_category::Mn},
-            {0xc4a, general_category::Cn},    {0xc4e, general_category::Mn},
-            {0xc55, general_category::Cn},    {0xc57, general_category::Mn},
-            {0xc58, general_category::Cn},    {0xc5b, general_category::Lo},
-            {0xc60, general_category::Cn},    {0xc62, general_category::Lo},
-            {0xc64, general_category::Mn},    {0xc66, general_category::Cn},
-            {0xc70, general_category::Nd},    {0xc77, general_category::Cn},
-            {0xc78, general_category::Po},    {0xc7f, general_category::No},
-            {0xc80, general_category::So},    {0xc81, general_category::Lo},
-            {0xc82, general_category::Mn},    {0xc84, general_category::Mc},
-            {0xc85, general_category::Po},    {0xc8d, general_category::Lo},
-            {0xc8e, general_category::Cn},    {0xc91, general_category::Lo},
-            {0xc92, general_category::Cn},    {0xca9, general_category::Lo},
-            {0xcaa, general_category::Cn},    {0xcb4, general_category::Lo},
-            {0xcb5, general_category::Cn},    {0xcba, general_category::Lo},
-            {0xcbc, general_category::Cn},    {0xcbd, general_category::Mn},
-            {0xcbe, general_category::Lo},    {0xcbf, general_category::Mc},
-            {0xcc0, general_category::Mn},    {0xcc5, general_category::Mc},
-            {0xcc6, general_category::Cn},    {0xcc7, general_category::Mn},
-            {0xcc9, general_category::Mc},    {0xcca, general_category::Cn},
-            {0xccc, general_category::Mc},    {0xcce, general_category::Mn},
-            {0xcd5, general_category::Cn},    {0xcd7, general_category::Mc},
-            {0xcde, general_category::Cn},    {0xcdf, general_category::Lo},
-            {0xce0, general_category::Cn},    {0xce2, general_category::Lo},
-            {0xce4, general_category::Mn},    {0xce6, general_category::Cn},
-            {0xcf0, general_category::Nd},    {0xcf1, general_category::Cn},
-            {0xcf3, general_category::Lo},    {0xd00, general_category::Cn},
-            {0xd02, general_category::Mn},    {0xd04, general_category::Mc},
-            {0xd0d, general_category::Lo},    {0xd0e, general_category::Cn},
-            {0xd11, general_category::Lo},    {0xd12, general_category::Cn},
-            {0xd3b, general_category::Lo},    {0xd3d, general_category::Mn},
-            {0xd3e, general_category::Lo},    {0xd41, general_category::Mc},
-            {0xd45, general_category::Mn},    {0xd46, general_category::Cn},
-            {0xd49, general_category::Mc},    {0xd4a, general_category::Cn},
-            {0xd4d, general_category::Mc},    {0xd4e, general_category::Mn},
-            {0xd4f, general_category::Lo},    {0xd50, general_category::So},
-            {0xd54, general_category::Cn},    {0xd57, general_category::Lo},
-            {0xd58, general_category::Mc},    {0xd5f, general_category::No},
-            {0xd62, general_category::Lo},    {0xd64, general_category::Mn},
-            {0xd66, general_category::Cn},    {0xd70, general_category::Nd},
-            {0xd79, general_category::No},    {0xd7a, general_category::So},
-            {0xd80, general_category::Lo},    {0xd81, general_category::Cn},
-            {0xd82, general_category::Mn},    {0xd84, general_category::Mc},
-            {0xd85, general_category::Cn},    {0xd97, general_category::Lo},
-            {0xd9a, general_category::Cn},    {0xdb2, general_category::Lo},
-            {0xdb3, general_category::Cn},    {0xdbc, general_category::Lo},
-            {0xdbd, general_category::Cn},    {0xdbe, general_category::Lo},
-            {0xdc0, general_category::Cn},    {0xdc7, general_category::Lo},
-            {0xdca, general_category::Cn},    {0xdcb, general_category::Mn},
-            {0xdcf, general_category::Cn},    {0xdd2, general_category::Mc},
-            {0xdd5, general_category::Mn},    {0xdd6, general_category::Cn},
-            {0xdd7, general_category::Mn},    {0xdd8, general_category::Cn},
-            {0xde0, general_category::Mc},    {0xde6, general_category::Cn},
-            {0xdf0, general_category::Nd},    {0xdf2, general_category::Cn},
-            {0xdf4, general_category::Mc},    {0xdf5, general_category::Po},
-            {0xe01, general_category::Cn},    {0xe31, general_category::Lo},
-            {0xe32, general_category::Mn},    {0xe34, general_category::Lo},
-            {0xe3b, general_category::Mn},    {0xe3f, general_category::Cn},
-            {0xe40, general_category::Sc},    {0xe46, general_category::Lo},
-            {0xe47, general_category::Lm},    {0xe4f, general_category::Mn},
-            {0xe50, general_category::Po},    {0xe5a, general_category::Nd},
-            {0xe5c, general_category::Po},    {0xe81, general_category::Cn},
-            {0xe83, general_category::Lo},    {0xe84, general_category::Cn},
-            {0xe85, general_category::Lo},    {0xe86, general_category::Cn},
-            {0xe8b, general_category::Lo},    {0xe8c, general_category::Cn},
-            {0xea4, general_category::Lo},    {0xea5, general_category::Cn},
-            {0xea6, general_category::Lo},    {0xea7, general_category::Cn},
-            {0xeb1, general_category::Lo},    {0xeb2, general_category::Mn},
-            {0xeb4, general_category::Lo},    {0xebd, general_category::Mn},
-            {0xebe, general_category::Lo},    {0xec0, general_category::Cn},
-            {0xec5, general_category::Lo},    {0xec6, general_category::Cn},
-            {0xec7, general_category::Lm},    {0xec8, general_category::Cn},
-            {0xece, general_category::Mn},    {0xed0, general_category::Cn},
-            {0xeda, general_category::Nd},    {0xedc, general_category::Cn},
-            {0xee0, general_category::Lo},    {0xf00, general_category::Cn},
-            {0xf01, general_category::Lo},    {0xf04, general_category::So},
-            {0xf13, general_category::Po},    {0xf14, general_category::So},
-            {0xf15, general_category::Po},    {0xf18, general_category::So},
-            {0xf1a, general_category::Mn},    {0xf20, general_category::So},
-            {0xf2a, general_category::Nd},    {0xf34, general_category::No},
-            {0xf35, general_category::So},    {0xf36, general_category::Mn},
-            {0xf37, general_category::So},    {0xf38, general_category::Mn},
-            {0xf39, general_category::So},    {0xf3a, general_category::Mn},
-            {0xf3b, general_category::Ps},    {0xf3c, general_category::Pe},
-            {0xf3d, general_category::Ps},    {0xf3e, general_category::Pe},
-            {0xf40, general_category::Mc},    {0xf48, general_category::Lo},
-            {0xf49, general_category::Cn},    {0xf6d, general_category::Lo},
-            {0xf71, general_category::Cn},    {0xf7f, general_category::Mn},
-            {0xf80, general_category::Mc},    {0xf85, general_category::Mn},
-            {0xf86, general_category::Po},    {0xf88, general_category::Mn},
-            {0xf8d, general_category::Lo},    {0xf98, general_category::Mn},
-            {0xf99, general_category::Cn},    {0xfbd, general_category::Mn},
-            {0xfbe, general_category::Cn},    {0xfc6, general_category::So},
-            {0xfc7, general_category::Mn},    {0xfcd, general_category::So},
-            {0xfce, general_category::Cn},    {0xfd0, general_category::So},
-            {0xfd5, general_category::Po},    {0xfd9, general_category::So},
-            {0xfdb, general_category::Po},    {0x1000, general_category::Cn},
-            {0x102b, general_category::Lo},   {0x102d, general_category::Mc},
-            {0x1031, general_category::Mn},   {0x1032, general_category::Mc},
-            {0x1038, general_category::Mn},   {0x1039, general_category::Mc},
-            {0x103b, general_category::Mn},   {0x103d, general_category::Mc},
-            {0x103f, general_category::Mn},   {0x1040, general_category::Lo},
-            {0x104a, general_category::Nd},   {0x1050, general_category::Po},
-            {0x1056, general_category::Lo},   {0x1058, general_category::Mc},
-            {0x105a, general_category::Mn},   {0x105e, general_category::Lo},
-            {0x1061, general_category::Mn},   {0x1062, general_category::Lo},
-            {0x1065, general_category::Mc},   {0x1067, general_category::Lo},
-            {0x106e, general_category::Mc},   {0x1071, general_category::Lo},
-            {0x1075, general_category::Mn},   {0x1082, general_category::Lo},
-            {0x1083, general_category::Mn},   {0x1085, general_category::Mc},
-            {0x1087, general_category::Mn},   {0x108d, general_category::Mc},
-            {0x108e, general_category::Mn},   {0x108f, general_category::Lo},
-            {0x1090, general_category::Mc},   {0x109a, general_category::Nd},
-            {0x109d, general_category::Mc},   {0x109e, general_category::Mn},
-            {0x10a0, general_category::So},   {0x10c6, general_category::Lu},
-            {0x10c7, general_category::Cn},   {0x10c8, general_category::Lu},
-            {0x10cd, general_category::Cn},   {0x10ce, general_category::Lu},
-            {0x10d0, general_category::Cn},   {0x10fb, general_category::Ll},
-            {0x10fc, general_category::Po},   {0x10fd, general_category::Lm},
-            {0x1100, general_category::Ll},   {0x1249, general_category::Lo},
-            {0x124a, general_category::Cn},   {0x124e, general_category::Lo},
-            {0x1250, general_category::Cn},   {0x1257, general_category::Lo},
-            {0x1258, general_category::Cn},   {0x1259, general_category::Lo},
-            {0x125a, general_category::Cn},   {0x125e, general_category::Lo},
-            {0x1260, general_category::Cn},   {0x1289, general_category::Lo},
-            {0x128a, general_category::Cn},   {0x128e, general_category::Lo},
-            {0x1290, general_category::Cn},   {0x12b1, general_category::Lo},
-            {0x12b2, general_category::Cn},   {0x12b6, general_category::Lo},
-            {0x12b8, general_category::Cn},   {0x12bf, general_category::Lo},
-            {0x12c0, general_category::Cn},   {0x12c1, general_category::Lo},
-            {0x12c2, general_category::Cn},   {0x12c6, general_category::Lo},
-            {0x12c8, general_category::Cn},   {0x12d7, general_category::Lo},
-            {0x12d8, general_category::Cn},   {0x1311, general_category::Lo},
-            {0x1312, general_category::Cn},   {0x1316, general_category::Lo},
-            {0x1318, general_category::Cn},   {0x135b, general_category::Lo},
-            {0x135d, general_category::Cn},   {0x1360, general_category::Mn},
-            {0x1369, general_category::Po},   {0x137d, general_category::No},
-            {0x1380, general_category::Cn},   {0x1390, general_category::Lo},
-            {0x139a, general_category::So},   {0x13a0, general_category::Cn},
-            {0x13f6, general_category::Lu},   {0x13f8, general_category::Cn},
-            {0x13fe, general_category::Ll},   {0x1400, general_category::Cn},
-            {0x1401, general_category::Pd},   {0x166d, general_category::Lo},
-            {0x166e, general_category::So},   {0x166f, general_category::Po},
-            {0x1680, general_category::Lo},   {0x1681, general_category::Zs},
-            {0x169b, general_category::Lo},   {0x169c, general_category::Ps},
-            {0x169d, general_category::Pe},   {0x16a0, general_category::Cn},
-            {0x16eb, general_category::Lo},   {0x16ee, general_category::Po},
-            {0x16f1, general_category::Nl},   {0x16f9, general_category::Lo},
-            {0x1700, general_category::Cn},   {0x170d, general_category::Lo},
-            {0x170e, general_category::Cn},   {0x1712, general_category::Lo},
-            {0x1715, general_category::Mn},   {0x1720, general_category::Cn},
-            {0x1732, general_category::Lo},   {0x1735, general_category::Mn},
-            {0x1737, general_category::Po},   {0x1740, general_category::Cn},
-            {0x1752, general_category::Lo},   {0x1754, general_category::Mn},
-            {0x1760, general_category::Cn},   {0x176d, general_category::Lo},
-            {0x176e, general_category::Cn},   {0x1771, general_category::Lo},
-            {0x1772, general_category::Cn},   {0x1774, general_category::Mn},
-            {0x1780, general_category::Cn},   {0x17b4, general_category::Lo},
-            {0x17b6, general_category::Mn},   {0x17b7, general_category::Mc},
-            {0x17be, general_category::Mn},   {0x17c6, general_category::Mc},
-            {0x17c7, general_category::Mn},   {0x17c9, general_category::Mc},
-            {0x17d4, general_category::Mn},   {0x17d7, general_category::Po},
-            {0x17d8, general_category::Lm},   {0x17db, general_category::Po},
-            {0x17dc, general_category::Sc},   {0x17dd, general_category::Lo},
-            {0x17de, general_category::Mn},   {0x17e0, general_category::Cn},
-            {0x17ea, general_category::Nd},   {0x17f0, general_category::Cn},
-            {0x17fa, general_category::No},   {0x1800, general_category::Cn},
-            {0x1806, general_category::Po},   {0x1807, general_category::Pd},
-            {0x180b, general_category::Po},   {0x180e, general_category::Mn},
-            {0x180f, general_category::Cf},   {0x1810, general_category::Cn},
-            {0x181a, general_category::Nd},   {0x1820, general_category::Cn},
-            {0x1843, general_category::Lo},   {0x1844, general_category::Lm},
-            {0x1879, general_category::Lo},   {0x1880, general_category::Cn},
-            {0x1885, general_category::Lo},   {0x1887, general_category::Mn},
-            {0x18a9, general_category::Lo},   {0x18aa, general_category::Mn},
-            {0x18ab, general_category::Lo},   {0x18b0, general_category::Cn},
-            {0x18f6, general_category::Lo},   {0x1900, general_category::Cn},
-            {0x191f, general_category::Lo},   {0x1920, general_category::Cn},
-            {0x1923, general_category::Mn},   {0x1927, general_category::Mc},
-            {0x1929, general_category::Mn},   {0x192c, general_category::Mc},
-            {0x1930, general_category::Cn},   {0x1932, general_category::Mc},
-            {0x1933, general_category::Mn},   {0x1939, general_category::Mc},
-            {0x193c, general_category::Mn},   {0x1940, general_category::Cn},
-            {0x1941, general_category::So},   {0x1944, general_category::Cn},
-            {0x1946, general_category::Po},   {0x1950, general_category::Nd},
-            {0x196e, general_category::Lo},   {0x1970, general_category::Cn},
-            {0x1975, general_category::Lo},   {0x1980, general_category::Cn},
-            {0x19ac, general_category::Lo},   {0x19b0, general_category::Cn},
-            {0x19ca, general_category::Lo},   {0x19d0, general_category::Cn},
-            {0x19da, general_category::Nd},   {0x19db, general_category::No},
-            {0x19de, general_category::Cn},   {0x1a00, general_category::So},
-            {0x1a17, general_category::Lo},   {0x1a19, general_category::Mn},
-            {0x1a1b, general_category::Mc},   {0x1a1c, general_category::Mn},
-            {0x1a1e, general_category::Cn},   {0x1a20, general_category::Po},
-            {0x1a55, general_category::Lo},   {0x1a56, general_category::Mc},
-            {0x1a57, general_category::Mn},   {0x1a58, general_category::Mc},
-            {0x1a5f, general_category::Mn},   {0x1a60, general_category::Cn},
-            {0x1a61, general_category::Mn},   {0x1a62, general_category::Mc},
-            {0x1a63, general_category::Mn},   {0x1a65, general_category::Mc},
-            {0x1a6d, general_category::Mn},   {0x1a73, general_category::Mc},
-            {0x1a7d, general_category::Mn},   {0x1a7f, general_category::Cn},
-            {0x1a80, general_category::Mn},   {0x1a8a, general_category::Nd},
-            {0x1a90, general_category::Cn},   {0x1a9a, general_category::Nd},
-            {0x1aa0, general_category::Cn},   {0x1aa7, general_category::Po},
-            {0x1aa8, general_category::Lm},   {0x1aae, general_category::Po},
-            {0x1ab0, general_category::Cn},   {0x1abe, general_category::Mn},
-            {0x1abf, general_category::Me},   {0x1ac1, general_category::Mn},
-            {0x1b00, general_category::Cn},   {0x1b04, general_category::Mn},
-            {0x1b05, general_category::Mc},   {0x1b34, general_category::Lo},
-            {0x1b35, general_category::Mn},   {0x1b36, general_category::Mc},
-            {0x1b3b, general_category::Mn},   {0x1b3c, general_category::Mc},
-            {0x1b3d, general_category::Mn},   {0x1b42, general_category::Mc},
-            {0x1b43, general_category::Mn},   {0x1b45, general_category::Mc},
-            {0x1b4c, general_category::Lo},   {0x1b50, general_category::Cn},
-            {0x1b5a, general_category::Nd},   {0x1b61, general_category::Po},
-            {0x1b6b, general_category::So},   {0x1b74, general_category::Mn},
-            {0x1b7d, general_category::So},   {0x1b80, general_category::Cn},
-            {0x1b82, general_category::Mn},   {0x1b83, general_category::Mc},
-            {0x1ba1, general_category::Lo},   {0x1ba2, general_category::Mc},
-            {0x1ba6, general_category::Mn},   {0x1ba8, general_category::Mc},
-            {0x1baa, general_category::Mn},   {0x1bab, general_category::Mc},
-            {0x1bae, general_category::Mn},   {0x1bb0, general_category::Lo},
-            {0x1bba, general_category::Nd},   {0x1be6, general_category::Lo},
-            {0x1be7, general_category::Mn},   {0x1be8, general_category::Mc},
-            {0x1bea, general_category::Mn},   {0x1bed, general_category::Mc},
-            {0x1bee, general_category::Mn},   {0x1bef, general_category::Mc},
-            {0x1bf2, general_category::Mn},   {0x1bf4, general_category::Mc},
-            {0x1bfc, general_category::Cn},   {0x1c00, general_category::Po},
-            {0x1c24, general_category::Lo},   {0x1c2c, general_category::Mc},
-            {0x1c34, general_category::Mn},   {0x1c36, general_category::Mc},
-            {0x1c38, general_category::Mn},   {0x1c3b, general_category::Cn},
-            {0x1c40, general_category::Po},   {0x1c4a, general_category::Nd},
-            {0x1c4d, general_category::Cn},   {0x1c50, general_category::Lo},
-            {0x1c5a, general_category::Nd},   {0x1c78, general_category::Lo},
-            {0x1c7e, general_category::Lm},   {0x1c80, general_category::Po},
-            {0x1c89, general_category::Ll},   {0x1c90, general_category::Cn},
-            {0x1cbb, general_category::Lu},   {0x1cbd, general_category::Cn},
-            {0x1cc0, general_category::Lu},   {0x1cc8, general_category::Po},
-            {0x1cd0, general_category::Cn},   {0x1cd3, general_category::Mn},
-            {0x1cd4, general_category::Po},   {0x1ce1, general_category::Mn},
-            {0x1ce2, general_category::Mc},   {0x1ce9, general_category::Mn},
-            {0x1ced, general_category::Lo},   {0x1cee, general_category::Mn},
-            {0x1cf4, general_category::Lo},   {0x1cf5, general_category::Mn},
-            {0x1cf7, general_category::Lo},   {0x1cf8, general_category::Mc},
-            {0x1cfa, general_category::Mn},   {0x1cfb, general_category::Lo},
-            {0x1d00, general_category::Cn},   {0x1d2c, general_category::Ll},
-            {0x1d6b, general_category::Lm},   {0x1d78, general_category::Ll},
-            {0x1d79, general_category::Lm},   {0x1d9b, general_category::Ll},
-            {0x1dc0, general_category::Lm},   {0x1dfa, general_category::Mn},
-            {0x1dfb, general_category::Cn},   {0x1e00, general_category::Mn},
-            {0x1e01, general_category::Lu},   {0x1e02, general_category::Ll},
-            {0x1e03, general_category::Lu},   {0x1e04, general_category::Ll},
-            {0x1e05, general_category::Lu},   {0x1e06, general_category::Ll},
-            {0x1e07, general_category::Lu},   {0x1e08, general_category::Ll},
-            {0x1e09, general_category::Lu},   {0x1e0a, general_category::Ll},
-            {0x1e0b, general_category::Lu},   {0x1e0c, general_category::Ll},
-            {0x1e0d, general_category::Lu},   {0x1e0e, general_category::Ll},
-            {0x1e0f, general_category::Lu},   {0x1e10, general_category::Ll},
-            {0x1e11, general_category::Lu},   {0x1e12, general_category::Ll},
-            {0x1e13, general_category::Lu},   {0x1e14, general_category::Ll},
-            {0x1e15, general_category::Lu},   {0x1e16, general_category::Ll},
-            {0x1e17, general_category::Lu},   {0x1e18, general_category::Ll},
-            {0x1e19, general_category::Lu},   {0x1e1a, general_category::Ll},
-            {0x1e1b, general_category::Lu},   {0x1e1c, general_category::Ll},
-            {0x1e1d, general_category::Lu},   {0x1e1e, general_category::Ll},
-            {0x1e1f, general_category::Lu},   {0x1e20, general_category::Ll},
-            {0x1e21, general_category::Lu},   {0x1e22, general_category::Ll},
-            {0x1e23, general_category::Lu},   {0x1e24, general_category::Ll},
-            {0x1e25, general_category::Lu},   {0x1e26, general_category::Ll},
-            {0x1e27, general_category::Lu},   {0x1e28, general_category::Ll},
-            {0x1e29, general_category::Lu},   {0x1e2a, general_category::Ll},
-            {0x1e2b, general_category::Lu},   {0x1e2c, general_category::Ll},
-            {0x1e2d, general_category::Lu},   {0x1e2e, general_category::Ll},
-            {0x1e2f, general_category::Lu},   {0x1e30, general_category::Ll},
-            {0x1e31, general_category::Lu},   {0x1e32, general_category::Ll},
-            {0x1e33, general_category::Lu},   {0x1e34, general_category::Ll},
-            {0x1e35, general_category::Lu},   {0x1e36, general_category::Ll},
-            {0x1e37, general_category::Lu},   {0x1e38, general_category::Ll},
-            {0x1e39, general_category::Lu},   {0x1e3a, general_category::Ll},
-            {0x1e3b, general_category::Lu},   {0x1e3c, general_category::Ll},
-            {0x1e3d, general_category::Lu},   {0x1e3e, general_category::Ll},
-            {0x1e3f, general_category::Lu},   {0x1e40, general_category::Ll},
-            {0x1e41, general_category::Lu},   {0x1e42, general_category::Ll},
-            {0x1e43, general_category::Lu},   {0x1e44, general_category::Ll},
-            {0x1e45, general_category::Lu},   {0x1e46, general_category::Ll},
-            {0x1e47, general_category::Lu},   {0x1e48, general_category::Ll},
-            {0x1e49, general_category::Lu},   {0x1e4a, general_category::Ll},
-            {0x1e4b, general_category::Lu},   {0x1e4c, general_category::Ll},
-            {0x1e4d, general_category::Lu},   {0x1e4e, general_category::Ll},
-            {0x1e4f, general_category::Lu},   {0x1e50, general_category::Ll},
-            {0x1e51, general_category::Lu},   {0x1e52, general_category::Ll},
-            {0x1e53, general_category::Lu},   {0x1e54, general_category::Ll},
-            {0x1e55, general_category::Lu},   {0x1e56, general_category::Ll},
-            {0x1e57, general_category::Lu},   {0x1e58, general_category::Ll},
-            {0x1e59, general_category::Lu},   {0x1e5a, general_category::Ll},
-            {0x1e5b, general_category::Lu},   {0x1e5c, general_category::Ll},
-            {0x1e5d, general_category::Lu},   {0x1e5e, general_category::Ll},
-            {0x1e5f, general_category::Lu},   {0x1e60, general_category::Ll},
-            {0x1e61, general_category::Lu},   {0x1e62, general_category::Ll},
-            {0x1e63, general_category::Lu},   {0x1e64, general_category::Ll},
-            {0x1e65, general_category::Lu},   {0x1e66, general_category::Ll},
-            {0x1e67, general_category::Lu},   {0x1e68, general_category::Ll},
-            {0x1e69, general_category::Lu},   {0x1e6a, general_category::Ll},
-            {0x1e6b, general_category::Lu},   {0x1e6c, general_category::Ll},
-            {0x1e6d, general_category::Lu},   {0x1e6e, general_category::Ll},
-            {0x1e6f, general_category::Lu},   {0x1e70, general_category::Ll},
-            {0x1e71, general_category::Lu},   {0x1e72, general_category::Ll},
-            {0x1e73, general_category::Lu},   {0x1e74, general_category::Ll},
-            {0x1e75, general_category::Lu},   {0x1e76, general_category::Ll},
-            {0x1e77, general_category::Lu},   {0x1e78, general_category::Ll},
-            {0x1e79, general_category::Lu},   {0x1e7a, general_category::Ll},
-            {0x1e7b, general_category::Lu},   {0x1e7c, general_category::Ll},
-            {0x1e7d, general_category::Lu},   {0x1e7e, general_category::Ll},
-            {0x1e7f, general_category::Lu},   {0x1e80, general_category::Ll},
-            {0x1e81, general_category::Lu},   {0x1e82, general_category::Ll},
-            {0x1e83, general_category::Lu},   {0x1e84, general_category::Ll},
-            {0x1e85, general_category::Lu},   {0x1e86, general_category::Ll},
-            {0x1e87, general_category::Lu},   {0x1e88, general_category::Ll},
-            {0x1e89, general_category::Lu},   {0x1e8a, general_category::Ll},
-            {0x1e8b, general_category::Lu},   {0x1e8c, general_category::Ll},
-            {0x1e8d, general_category::Lu},   {0x1e8e, general_category::Ll},
-            {0x1e8f, general_category::Lu},   {0x1e90, general_category::Ll},
-            {0x1e91, general_category::Lu},   {0x1e92, general_category::Ll},
-            {0x1e93, general_category::Lu},   {0x1e94, general_category::Ll},
-            {0x1e95, general_category::Lu},   {0x1e9e, general_category::Ll},
-            {0x1e9f, general_category::Lu},   {0x1ea0, general_category::Ll},
-            {0x1ea1, general_category::Lu},   {0x1ea2, general_category::Ll},
-            {0x1ea3, general_category::Lu},   {0x1ea4, general_category::Ll},
-            {0x1ea5, general_category::Lu},   {0x1ea6, general_category::Ll},
-            {0x1ea7, general_category::Lu},   {0x1ea8, general_category::Ll},
-            {0x1ea9, general_category::Lu},   {0x1eaa, general_category::Ll},
-            {0x1eab, general_category::Lu},   {0x1eac, general_category::Ll},
-            {0x1ead, general_category::Lu},   {0x1eae, general_category::Ll},
-            {0x1eaf, general_category::Lu},   {0x1eb0, general_category::Ll},
-            {0x1eb1, general_category::Lu},   {0x1eb2, general_category::Ll},
-            {0x1eb3, general_category::Lu},   {0x1eb4, general_category::Ll},
-            {0x1eb5, general_category::Lu},   {0x1eb6, general_category::Ll},
-            {0x1eb7, general_category::Lu},   {0x1eb8, general_category::Ll},
-            {0x1eb9, general_category::Lu},   {0x1eba, general_category::Ll},
-            {0x1ebb, general_category::Lu},   {0x1ebc, general_category::Ll},
-            {0x1ebd, general_category::Lu},   {0x1ebe, general_category::Ll},
-            {0x1ebf, general_category::Lu},   {0x1ec0, general_category::Ll},
-            {0x1ec1, general_category::Lu},   {0x1ec2, general_category::Ll},
-            {0x1ec3, general_category::Lu},   {0x1ec4, general_category::Ll},
-            {0x1ec5, general_category::Lu},   {0x1ec6, general_category::Ll},
-            {0x1ec7, general_category::Lu},   {0x1ec8, general_category::Ll},
-            {0x1ec9, general_category::Lu},   {0x1eca, general_category::Ll},
-            {0x1ecb, general_category::Lu},   {0x1ecc, general_category::Ll},
-            {0x1ecd, general_category::Lu},   {0x1ece, general_category::Ll},
-            {0x1ecf, general_category::Lu},   {0x1ed0, general_category::Ll},
-            {0x1ed1, general_category::Lu},   {0x1ed2, general_category::Ll},
-            {0x1ed3, general_category::Lu},   {0x1ed4, general_category::Ll},
-            {0x1ed5, general_category::Lu},   {0x1ed6, general_category::Ll},
-            {0x1ed7, general_category::Lu},   {0x1ed8, general_category::Ll},
-            {0x1ed9, general_category::Lu},   {0x1eda, general_category::Ll},
-            {0x1edb, general_category::Lu},   {0x1edc, general_category::Ll},
-            {0x1edd, general_category::Lu},   {0x1ede, general_category::Ll},
-            {0x1edf, general_category::Lu},   {0x1ee0, general_category::Ll},
-            {0x1ee1, general_category::Lu},   {0x1ee2, general_category::Ll},
-            {0x1ee3, general_category::Lu},   {0x1ee4, general_category::Ll},
-            {0x1ee5, general_category::Lu},   {0x1ee6, general_category::Ll},
-            {0x1ee7, general_category::Lu},   {0x1ee8, general_category::Ll},
-            {0x1ee9, general_category::Lu},   {0x1eea, general_category::Ll},
-            {0x1eeb, general_category::Lu},   {0x1eec, general_category::Ll},
-            {0x1eed, general_category::Lu},   {0x1eee, general_category::Ll},
-            {0x1eef, general_category::Lu},   {0x1ef0, general_category::Ll},
-            {0x1ef1, general_category::Lu},   {0x1ef2, general_category::Ll},
-            {0x1ef3, general_category::Lu},   {0x1ef4, general_category::Ll},
-            {0x1ef5, general_category::Lu},   {0x1ef6, general_category::Ll},
-            {0x1ef7, general_category::Lu},   {0x1ef8, general_category::Ll},
-            {0x1ef9, general_category::Lu},   {0x1efa, general_category::Ll},
-            {0x1efb, general_category::Lu},   {0x1efc, general_category::Ll},
-            {0x1efd, general_category::Lu},   {0x1efe, general_category::Ll},
-            {0x1eff, general_category::Lu},   {0x1f08, general_category::Ll},
-            {0x1f10, general_category::Lu},   {0x1f16, general_category::Ll},
-            {0x1f18, general_category::Cn},   {0x1f1e, general_category::Lu},
-            {0x1f20, general_category::Cn},   {0x1f28, general_category::Ll},
-            {0x1f30, general_category::Lu},   {0x1f38, general_category::Ll},
-            {0x1f40, general_category::Lu},   {0x1f46, general_category::Ll},
-            {0x1f48, general_category::Cn},   {0x1f4e, general_category::Lu},
-            {0x1f50, general_category::Cn},   {0x1f58, general_category::Ll},
-            {0x1f59, general_category::Cn},   {0x1f5a, general_category::Lu},
-            {0x1f5b, general_category::Cn},   {0x1f5c, general_category::Lu},
-            {0x1f5d, general_category::Cn},   {0x1f5e, general_category::Lu},
-            {0x1f5f, general_category::Cn},   {0x1f60, general_category::Lu},
-            {0x1f68, general_category::Ll},   {0x1f70, general_category::Lu},
-            {0x1f7e, general_category::Ll},   {0x1f80, general_category::Cn},
-            {0x1f88, general_category::Ll},   {0x1f90, general_category::Lt},
-            {0x1f98, general_category::Ll},   {0x1fa0, general_category::Lt},
-            {0x1fa8, general_category::Ll},   {0x1fb0, general_category::Lt},
-            {0x1fb5, general_category::Ll},   {0x1fb6, general_category::Cn},
-            {0x1fb8, general_category::Ll},   {0x1fbc, general_category::Lu},
-            {0x1fbd, general_category::Lt},   {0x1fbe, general_category::Sk},
-            {0x1fbf, general_category::Ll},   {0x1fc2, general_category::Sk},
-            {0x1fc5, general_category::Ll},   {0x1fc6, general_category::Cn},
-            {0x1fc8, general_category::Ll},   {0x1fcc, general_category::Lu},
-            {0x1fcd, general_category::Lt},   {0x1fd0, general_category::Sk},
-            {0x1fd4, general_category::Ll},   {0x1fd6, general_category::Cn},
-            {0x1fd8, general_category::Ll},   {0x1fdc, general_category::Lu},
-            {0x1fdd, general_category::Cn},   {0x1fe0, general_category::Sk},
-            {0x1fe8, general_category::Ll},   {0x1fed, general_category::Lu},
-            {0x1ff0, general_category::Sk},   {0x1ff2, general_category::Cn},
-            {0x1ff5, general_category::Ll},   {0x1ff6, general_category::Cn},
-            {0x1ff8, general_category::Ll},   {0x1ffc, general_category::Lu},
-            {0x1ffd, general_category::Lt},   {0x1fff, general_category::Sk},
-            {0x2000, general_category::Cn},   {0x200b, general_category::Zs},
-            {0x2010, general_category::Cf},   {0x2016, general_category::Pd},
-            {0x2018, general_category::Po},   {0x2019, general_category::Pi},
-            {0x201a, general_category::Pf},   {0x201b, general_category::Ps},
-            {0x201d, general_category::Pi},   {0x201e, general_category::Pf},
-            {0x201f, general_category::Ps},   {0x2020, general_category::Pi},
-            {0x2028, general_category::Po},   {0x2029, general_category::Zl},
-            {0x202a, general_category::Zp},   {0x202f, general_category::Cf},
-            {0x2030, general_category::Zs},   {0x2039, general_category::Po},
-            {0x203a, general_category::Pi},   {0x203b, general_category::Pf},
-            {0x203f, general_category::Po},   {0x2041, general_category::Pc},
-            {0x2044, general_category::Po},   {0x2045, general_category::Sm},
-            {0x2046, general_category::Ps},   {0x2047, general_category::Pe},
-            {0x2052, general_category::Po},   {0x2053, general_category::Sm},
-            {0x2054, general_category::Po},   {0x2055, general_category::Pc},
-            {0x205f, general_category::Po},   {0x2060, general_category::Zs},
-            {0x2065, general_category::Cf},   {0x2066, general_category::Cn},
-            {0x2070, general_category::Cf},   {0x2071, general_category::No},
-            {0x2072, general_category::Lm},   {0x2074, general_category::Cn},
-            {0x207a, general_category::No},   {0x207d, general_category::Sm},
-            {0x207e, general_category::Ps},   {0x207f, general_category::Pe},
-            {0x2080, general_category::Lm},   {0x208a, general_category::No},
-            {0x208d, general_category::Sm},   {0x208e, general_category::Ps},
-            {0x208f, general_category::Pe},   {0x2090, general_category::Cn},
-            {0x209d, general_category::Lm},   {0x20a0, general_category::Cn},
-            {0x20c0, general_category::Sc},   {0x20d0, general_category::Cn},
-            {0x20dd, general_category::Mn},   {0x20e1, general_category::Me},
-            {0x20e2, general_category::Mn},   {0x20e5, general_category::Me},
-            {0x20f1, general_category::Mn},   {0x2100, general_category::Cn},
-            {0x2102, general_category::So},   {0x2103, general_category::Lu},
-            {0x2107, general_category::So},   {0x2108, general_category::Lu},
-            {0x210a, general_category::So},   {0x210b, general_category::Ll},
-            {0x210e, general_category::Lu},   {0x2110, general_category::Ll},
-            {0x2113, general_category::Lu},   {0x2114, general_category::Ll},
-            {0x2115, general_category::So},   {0x2116, general_category::Lu},
-            {0x2118, general_category::So},   {0x2119, general_category::Sm},
-            {0x211e, general_category::Lu},   {0x2124, general_category::So},
-            {0x2125, general_category::Lu},   {0x2126, general_category::So},
-            {0x2127, general_category::Lu},   {0x2128, general_category::So},
-            {0x2129, general_category::Lu},   {0x212a, general_category::So},
-            {0x212e, general_category::Lu},   {0x212f, general_category::So},
-            {0x2130, general_category::Ll},   {0x2134, general_category::Lu},
-            {0x2135, general_category::Ll},   {0x2139, general_category::Lo},
-            {0x213a, general_category::Ll},   {0x213c, general_category::So},
-            {0x213e, general_category::Ll},   {0x2140, general_category::Lu},
-            {0x2145, general_category::Sm},   {0x2146, general_category::Lu},
-            {0x214a, general_category::Ll},   {0x214b, general_category::So},
-            {0x214c, general_category::Sm},   {0x214e, general_category::So},
-            {0x214f, general_category::Ll},   {0x2150, general_category::So},
-            {0x2160, general_category::No},   {0x2183, general_category::Nl},
-            {0x2184, general_category::Lu},   {0x2185, general_category::Ll},
-            {0x2189, general_category::Nl},   {0x218a, general_category::No},
-            {0x218c, general_category::So},   {0x2190, general_category::Cn},
-            {0x2195, general_category::Sm},   {0x219a, general_category::So},
-            {0x219c, general_category::Sm},   {0x21a0, general_category::So},
-            {0x21a1, general_category::Sm},   {0x21a3, general_category::So},
-            {0x21a4, general_category::Sm},   {0x21a6, general_category::So},
-            {0x21a7, general_category::Sm},   {0x21ae, general_category::So},
-            {0x21af, general_category::Sm},   {0x21ce, general_category::So},
-            {0x21d0, general_category::Sm},   {0x21d2, general_category::So},
-            {0x21d3, general_category::Sm},   {0x21d4, general_category::So},
-            {0x21d5, general_category::Sm},   {0x21f4, general_category::So},
-            {0x2300, general_category::Sm},   {0x2308, general_category::So},
-            {0x2309, general_category::Ps},   {0x230a, general_category::Pe},
-            {0x230b, general_category::Ps},   {0x230c, general_category::Pe},
-            {0x2320, general_category::So},   {0x2322, general_category::Sm},
-            {0x2329, general_category::So},   {0x232a, general_category::Ps},
-            {0x232b, general_category::Pe},   {0x237c, general_category::So},
-            {0x237d, general_category::Sm},   {0x239b, general_category::So},
-            {0x23b4, general_category::Sm},   {0x23dc, general_category::So},
-            {0x23e2, general_category::Sm},   {0x2427, general_category::So},
-            {0x2440, general_category::Cn},   {0x244b, general_category::So},
-            {0x2460, general_category::Cn},   {0x249c, general_category::No},
-            {0x24ea, general_category::So},   {0x2500, general_category::No},
-            {0x25b7, general_category::So},   {0x25b8, general_category::Sm},
-            {0x25c1, general_category::So},   {0x25c2, general_category::Sm},
-            {0x25f8, general_category::So},   {0x2600, general_category::Sm},
-            {0x266f, general_category::So},   {0x2670, general_category::Sm},
-            {0x2768, general_category::So},   {0x2769, general_category::Ps},
-            {0x276a, general_category::Pe},   {0x276b, general_category::Ps},
-            {0x276c, general_category::Pe},   {0x276d, general_category::Ps},
-            {0x276e, general_category::Pe},   {0x276f, general_category::Ps},
-            {0x2770, general_category::Pe},   {0x2771, general_category::Ps},
-            {0x2772, general_category::Pe},   {0x2773, general_category::Ps},
-            {0x2774, general_category::Pe},   {0x2775, general_category::Ps},
-            {0x2776, general_category::Pe},   {0x2794, general_category::No},
-            {0x27c0, general_category::So},   {0x27c5, general_category::Sm},
-            {0x27c6, general_category::Ps},   {0x27c7, general_category::Pe},
-            {0x27e6, general_category::Sm},   {0x27e7, general_category::Ps},
-            {0x27e8, general_category::Pe},   {0x27e9, general_category::Ps},
-            {0x27ea, general_category::Pe},   {0x27eb, general_category::Ps},
-            {0x27ec, general_category::Pe},   {0x27ed, general_category::Ps},
-            {0x27ee, general_category::Pe},   {0x27ef, general_category::Ps},
-            {0x27f0, general_category::Pe},   {0x2800, general_category::Sm},
-            {0x2900, general_category::So},   {0x2983, general_category::Sm},
-            {0x2984, general_category::Ps},   {0x2985, general_category::Pe},
-            {0x2986, general_category::Ps},   {0x2987, general_category::Pe},
-            {0x2988, general_category::Ps},   {0x2989, general_category::Pe},
-            {0x298a, general_category::Ps},   {0x298b, general_category::Pe},
-            {0x298c, general_category::Ps},   {0x298d, general_category::Pe},
-            {0x298e, general_category::Ps},   {0x298f, general_category::Pe},
-            {0x2990, general_category::Ps},   {0x2991, general_category::Pe},
-            {0x2992, general_category::Ps},   {0x2993, general_category::Pe},
-            {0x2994, general_category::Ps},   {0x2995, general_category::Pe},
-            {0x2996, general_category::Ps},   {0x2997, general_category::Pe},
-            {0x2998, general_category::Ps},   {0x2999, general_category::Pe},
-            {0x29d8, general_category::Sm},   {0x29d9, general_category::Ps},
-            {0x29da, general_category::Pe},   {0x29db, general_category::Ps},
-            {0x29dc, general_category::Pe},   {0x29fc, general_category::Sm},
-            {0x29fd, general_category::Ps},   {0x29fe, general_category::Pe},
-            {0x2b00, general_category::Sm},   {0x2b30, general_category::So},
-            {0x2b45, general_category::Sm},   {0x2b47, general_category::So},
-            {0x2b4d, general_category::Sm},   {0x2b74, general_category::So},
-            {0x2b76, general_category::Cn},   {0x2b96, general_category::So},
-            {0x2b97, general_category::Cn},   {0x2c00, general_category::So},
-            {0x2c2f, general_category::Lu},   {0x2c30, general_category::Cn},
-            {0x2c5f, general_category::Ll},   {0x2c60, general_category::Cn},
-            {0x2c61, general_category::Lu},   {0x2c62, general_category::Ll},
-            {0x2c65, general_category::Lu},   {0x2c67, general_category::Ll},
-            {0x2c68, general_category::Lu},   {0x2c69, general_category::Ll},
-            {0x2c6a, general_category::Lu},   {0x2c6b, general_category::Ll},
-            {0x2c6c, general_category::Lu},   {0x2c6d, general_category::Ll},
-            {0x2c71, general_category::Lu},   {0x2c72, general_category::Ll},
-            {0x2c73, general_category::Lu},   {0x2c75, general_category::Ll},
-            {0x2c76, general_category::Lu},   {0x2c7c, general_category::Ll},
-            {0x2c7e, general_category::Lm},   {0x2c81, general_category::Lu},
-            {0x2c82, general_category::Ll},   {0x2c83, general_category::Lu},
-            {0x2c84, general_category::Ll},   {0x2c85, general_category::Lu},
-            {0x2c86, general_category::Ll},   {0x2c87, general_category::Lu},
-            {0x2c88, general_category::Ll},   {0x2c89, general_category::Lu},
-            {0x2c8a, general_category::Ll},   {0x2c8b, general_category::Lu},
-            {0x2c8c, general_category::Ll},   {0x2c8d, general_category::Lu},
-            {0x2c8e, general_category::Ll},   {0x2c8f, general_category::Lu},
-            {0x2c90, general_category::Ll},   {0x2c91, general_category::Lu},
-            {0x2c92, general_category::Ll},   {0x2c93, general_category::Lu},
-            {0x2c94, general_category::Ll},   {0x2c95, general_category::Lu},
-            {0x2c96, general_category::Ll},   {0x2c97, general_category::Lu},
-            {0x2c98, general_category::Ll},   {0x2c99, general_category::Lu},
-            {0x2c9a, general_category::Ll},   {0x2c9b, general_category::Lu},
-            {0x2c9c, general_category::Ll},   {0x2c9d, general_category::Lu},
-            {0x2c9e, general_category::Ll},   {0x2c9f, general_category::Lu},
-            {0x2ca0, general_category::Ll},   {0x2ca1, general_category::Lu},
-            {0x2ca2, general_category::Ll},   {0x2ca3, general_category::Lu},
-            {0x2ca4, general_category::Ll},   {0x2ca5, general_category::Lu},
-            {0x2ca6, general_category::Ll},   {0x2ca7, general_category::Lu},
-            {0x2ca8, general_category::Ll},   {0x2ca9, general_category::Lu},
-            {0x2caa, general_category::Ll},   {0x2cab, general_category::Lu},
-            {0x2cac, general_category::Ll},   {0x2cad, general_category::Lu},
-            {0x2cae, general_category::Ll},   {0x2caf, general_category::Lu},
-            {0x2cb0, general_category::Ll},   {0x2cb1, general_category::Lu},
-            {0x2cb2, general_category::Ll},   {0x2cb3, general_category::Lu},
-            {0x2cb4, general_category::Ll},   {0x2cb5, general_category::Lu},
-            {0x2cb6, general_category::Ll},   {0x2cb7, general_category::Lu},
-            {0x2cb8, general_category::Ll},   {0x2cb9, general_category::Lu},
-            {0x2cba, general_category::Ll},   {0x2cbb, general_category::Lu},
-            {0x2cbc, general_category::Ll},   {0x2cbd, general_category::Lu},
-            {0x2cbe, general_category::Ll},   {0x2cbf, general_category::Lu},
-            {0x2cc0, general_category::Ll},   {0x2cc1, general_category::Lu},
-            {0x2cc2, general_category::Ll},   {0x2cc3, general_category::Lu},
-            {0x2cc4, general_category::Ll},   {0x2cc5, general_category::Lu},
-            {0x2cc6, general_category::Ll},   {0x2cc7, general_category::Lu},
-            {0x2cc8, general_category::Ll},   {0x2cc9, general_category::Lu},
-            {0x2cca, general_category::Ll},   {0x2ccb, general_category::Lu},
-            {0x2ccc, general_category::Ll},   {0x2ccd, general_category::Lu},
-            {0x2cce, general_category::Ll},   {0x2ccf, general_category::Lu},
-            {0x2cd0, general_category::Ll},   {0x2cd1, general_category::Lu},
-            {0x2cd2, general_category::Ll},   {0x2cd3, general_category::Lu},
-            {0x2cd4, general_category::Ll},   {0x2cd5, general_category::Lu},
-            {0x2cd6, general_category::Ll},   {0x2cd7, general_category::Lu},
-            {0x2cd8, general_category::Ll},   {0x2cd9, general_category::Lu},
-            {0x2cda, general_category::Ll},   {0x2cdb, general_category::Lu},
-            {0x2cdc, general_category::Ll},   {0x2cdd, general_category::Lu},
-            {0x2cde, general_category::Ll},   {0x2cdf, general_category::Lu},
-            {0x2ce0, general_category::Ll},   {0x2ce1, general_category::Lu},
-            {0x2ce2, general_category::Ll},   {0x2ce3, general_category::Lu},
-            {0x2ce5, general_category::Ll},   {0x2ceb, general_category::So},
-            {0x2cec, general_category::Lu},   {0x2ced, general_category::Ll},
-            {0x2cee, general_category::Lu},   {0x2cef, general_category::Ll},
-            {0x2cf2, general_category::Mn},   {0x2cf3, general_category::Lu},
-            {0x2cf4, general_category::Ll},   {0x2cf9, general_category::Cn},
-            {0x2cfd, general_category::Po},   {0x2cfe, general_category::No},
-            {0x2d00, general_category::Po},   {0x2d26, general_category::Ll},
-            {0x2d27, general_category::Cn},   {0x2d28, general_category::Ll},
-            {0x2d2d, general_category::Cn},   {0x2d2e, general_category::Ll},
-            {0x2d30, general_category::Cn},   {0x2d68, general_category::Lo},
-            {0x2d6f, general_category::Cn},   {0x2d70, general_category::Lm},
-            {0x2d71, general_category::Po},   {0x2d7f, general_category::Cn},
-            {0x2d80, general_category::Mn},   {0x2d97, general_category::Lo},
-            {0x2da0, general_category::Cn},   {0x2da7, general_category::Lo},
-            {0x2da8, general_category::Cn},   {0x2daf, general_category::Lo},
-            {0x2db0, general_category::Cn},   {0x2db7, general_category::Lo},
-            {0x2db8, general_category::Cn},   {0x2dbf, general_category::Lo},
-            {0x2dc0, general_category::Cn},   {0x2dc7, general_category::Lo},
-            {0x2dc8, general_category::Cn},   {0x2dcf, general_category::Lo},
-            {0x2dd0, general_category::Cn},   {0x2dd7, general_category::Lo},
-            {0x2dd8, general_category::Cn},   {0x2ddf, general_category::Lo},
-            {0x2de0, general_category::Cn},   {0x2e00, general_category::Mn},
-            {0x2e02, general_category::Po},   {0x2e03, general_category::Pi},
-            {0x2e04, general_category::Pf},   {0x2e05, general_category::Pi},
-            {0x2e06, general_category::Pf},   {0x2e09, general_category::Po},
-            {0x2e0a, general_category::Pi},   {0x2e0b, general_category::Pf},
-            {0x2e0c, general_category::Po},   {0x2e0d, general_category::Pi},
-            {0x2e0e, general_category::Pf},   {0x2e17, general_category::Po},
-            {0x2e18, general_category::Pd},   {0x2e1a, general_category::Po},
-            {0x2e1b, general_category::Pd},   {0x2e1c, general_category::Po},
-            {0x2e1d, general_category::Pi},   {0x2e1e, general_category::Pf},
-            {0x2e20, general_category::Po},   {0x2e21, general_category::Pi},
-            {0x2e22, general_category::Pf},   {0x2e23, general_category::Ps},
-            {0x2e24, general_category::Pe},   {0x2e25, general_category::Ps},
-            {0x2e26, general_category::Pe},   {0x2e27, general_category::Ps},
-            {0x2e28, general_category::Pe},   {0x2e29, general_category::Ps},
-            {0x2e2a, general_category::Pe},   {0x2e2f, general_category::Po},
-            {0x2e30, general_category::Lm},   {0x2e3a, general_category::Po},
-            {0x2e3c, general_category::Pd},   {0x2e40, general_category::Po},
-            {0x2e41, general_category::Pd},   {0x2e42, general_category::Po},
-            {0x2e43, general_category::Ps},   {0x2e50, general_category::Po},
-            {0x2e52, general_category::So},   {0x2e53, general_category::Po},
-            {0x2e80, general_category::Cn},   {0x2e9a, general_category::So},
-            {0x2e9b, general_category::Cn},   {0x2ef4, general_category::So},
-            {0x2f00, general_category::Cn},   {0x2fd6, general_category::So},
-            {0x2ff0, general_category::Cn},   {0x2ffc, general_category::So},
-            {0x3000, general_category::Cn},   {0x3001, general_category::Zs},
-            {0x3004, general_category::Po},   {0x3005, general_category::So},
-            {0x3006, general_category::Lm},   {0x3007, general_category::Lo},
-            {0x3008, general_category::Nl},   {0x3009, general_category::Ps},
-            {0x300a, general_category::Pe},   {0x300b, general_category::Ps},
-            {0x300c, general_category::Pe},   {0x300d, general_category::Ps},
-            {0x300e, general_category::Pe},   {0x300f, general_category::Ps},
-            {0x3010, general_category::Pe},   {0x3011, general_category::Ps},
-            {0x3012, general_category::Pe},   {0x3014, general_category::So},
-            {0x3015, general_category::Ps},   {0x3016, general_category::Pe},
-            {0x3017, general_category::Ps},   {0x3018, general_category::Pe},
-            {0x3019, general_category::Ps},   {0x301a, general_category::Pe},
-            {0x301b, general_category::Ps},   {0x301c, general_category::Pe},
-            {0x301d, general_category::Pd},   {0x301e, general_category::Ps},
-            {0x3020, general_category::Pe},   {0x3021, general_category::So},
-            {0x302a, general_category::Nl},   {0x302e, general_category::Mn},
-            {0x3030, general_category::Mc},   {0x3031, general_category::Pd},
-            {0x3036, general_category::Lm},   {0x3038, general_category::So},
-            {0x303b, general_category::Nl},   {0x303c, general_category::Lm},
-            {0x303d, general_category::Lo},   {0x303e, general_category::Po},
-            {0x3040, general_category::So},   {0x3041, general_category::Cn},
-            {0x3097, general_category::Lo},   {0x3099, general_category::Cn},
-            {0x309b, general_category::Mn},   {0x309d, general_category::Sk},
-            {0x309f, general_category::Lm},   {0x30a0, general_category::Lo},
-            {0x30a1, general_category::Pd},   {0x30fb, general_category::Lo},
-            {0x30fc, general_category::Po},   {0x30ff, general_category::Lm},
-            {0x3100, general_category::Lo},   {0x3105, general_category::Cn},
-            {0x3130, general_category::Lo},   {0x3131, general_category::Cn},
-            {0x318f, general_category::Lo},   {0x3190, general_category::Cn},
-            {0x3192, general_category::So},   {0x3196, general_category::No},
-            {0x31a0, general_category::So},   {0x31c0, general_category::Lo},
-            {0x31e4, general_category::So},   {0x31f0, general_category::Cn},
-            {0x3200, general_category::Lo},   {0x321f, general_category::So},
-            {0x3220, general_category::Cn},   {0x322a, general_category::No},
-            {0x3248, general_category::So},   {0x3250, general_category::No},
-            {0x3251, general_category::So},   {0x3260, general_category::No},
-            {0x3280, general_category::So},   {0x328a, general_category::No},
-            {0x32b1, general_category::So},   {0x32c0, general_category::No},
-            {0x3400, general_category::So},   {0x4dc0, general_category::Lo},
-            {0x4e00, general_category::So},   {0x9ffd, general_category::Lo},
-            {0xa000, general_category::Cn},   {0xa015, general_category::Lo},
-            {0xa016, general_category::Lm},   {0xa48d, general_category::Lo},
-            {0xa490, general_category::Cn},   {0xa4c7, general_category::So},
-            {0xa4d0, general_category::Cn},   {0xa4f8, general_category::Lo},
-            {0xa4fe, general_category::Lm},   {0xa500, general_category::Po},
-            {0xa60c, general_category::Lo},   {0xa60d, general_category::Lm},
-            {0xa610, general_category::Po},   {0xa620, general_category::Lo},
-            {0xa62a, general_category::Nd},   {0xa62c, general_category::Lo},
-            {0xa640, general_category::Cn},   {0xa641, general_category::Lu},
-            {0xa642, general_category::Ll},   {0xa643, general_category::Lu},
-            {0xa644, general_category::Ll},   {0xa645, general_category::Lu},
-            {0xa646, general_category::Ll},   {0xa647, general_category::Lu},
-            {0xa648, general_category::Ll},   {0xa649, general_category::Lu},
-            {0xa64a, general_category::Ll},   {0xa64b, general_category::Lu},
-            {0xa64c, general_category::Ll},   {0xa64d, general_category::Lu},
-            {0xa64e, general_category::Ll},   {0xa64f, general_category::Lu},
-            {0xa650, general_category::Ll},   {0xa651, general_category::Lu},
-            {0xa652, general_category::Ll},   {0xa653, general_category::Lu},
-            {0xa654, general_category::Ll},   {0xa655, general_category::Lu},
-            {0xa656, general_category::Ll},   {0xa657, general_category::Lu},
-            {0xa658, general_category::Ll},   {0xa659, general_category::Lu},
-            {0xa65a, general_category::Ll},   {0xa65b, general_category::Lu},
-            {0xa65c, general_category::Ll},   {0xa65d, general_category::Lu},
-            {0xa65e, general_category::Ll},   {0xa65f, general_category::Lu},
-            {0xa660, general_category::Ll},   {0xa661, general_category::Lu},
-            {0xa662, general_category::Ll},   {0xa663, general_category::Lu},
-            {0xa664, general_category::Ll},   {0xa665, general_category::Lu},
-            {0xa666, general_category::Ll},   {0xa667, general_category::Lu},
-            {0xa668, general_category::Ll},   {0xa669, general_category::Lu},
-            {0xa66a, general_category::Ll},   {0xa66b, general_category::Lu},
-            {0xa66c, general_category::Ll},   {0xa66d, general_category::Lu},
-            {0xa66e, general_category::Ll},   {0xa66f, general_category::Lo},
-            {0xa670, general_category::Mn},   {0xa673, general_category::Me},
-            {0xa674, general_category::Po},   {0xa67e, general_category::Mn},
-            {0xa67f, general_category::Po},   {0xa680, general_category::Lm},
-            {0xa681, general_category::Lu},   {0xa682, general_category::Ll},
-            {0xa683, general_category::Lu},   {0xa684, general_category::Ll},
-            {0xa685, general_category::Lu},   {0xa686, general_category::Ll},
-            {0xa687, general_category::Lu},   {0xa688, general_category::Ll},
-            {0xa689, general_category::Lu},   {0xa68a, general_category::Ll},
-            {0xa68b, general_category::Lu},   {0xa68c, general_category::Ll},
-            {0xa68d, general_category::Lu},   {0xa68e, general_category::Ll},
-            {0xa68f, general_category::Lu},   {0xa690, general_category::Ll},
-            {0xa691, general_category::Lu},   {0xa692, general_category::Ll},
-            {0xa693, general_category::Lu},   {0xa694, general_category::Ll},
-            {0xa695, general_category::Lu},   {0xa696, general_category::Ll},
-            {0xa697, general_category::Lu},   {0xa698, general_category::Ll},
-            {0xa699, general_category::Lu},   {0xa69a, general_category::Ll},
-            {0xa69b, general_category::Lu},   {0xa69c, general_category::Ll},
-            {0xa69e, general_category::Lm},   {0xa6a0, general_category::Mn},
-            {0xa6e6, general_category::Lo},   {0xa6f0, general_category::Nl},
-            {0xa6f2, general_category::Mn},   {0xa6f8, general_category::Po},
-            {0xa700, general_category::Cn},   {0xa717, general_category::Sk},
-            {0xa720, general_category::Lm},   {0xa722, general_category::Sk},
-            {0xa723, general_category::Lu},   {0xa724, general_category::Ll},
-            {0xa725, general_category::Lu},   {0xa726, general_category::Ll},
-            {0xa727, general_category::Lu},   {0xa728, general_category::Ll},
-            {0xa729, general_category::Lu},   {0xa72a, general_category::Ll},
-            {0xa72b, general_category::Lu},   {0xa72c, general_category::Ll},
-            {0xa72d, general_category::Lu},   {0xa72e, general_category::Ll},
-            {0xa72f, general_category::Lu},   {0xa732, general_category::Ll},
-            {0xa733, general_category::Lu},   {0xa734, general_category::Ll},
-            {0xa735, general_category::Lu},   {0xa736, general_category::Ll},
-            {0xa737, general_category::Lu},   {0xa738, general_category::Ll},
-            {0xa739, general_category::Lu},   {0xa73a, general_category::Ll},
-            {0xa73b, general_category::Lu},   {0xa73c, general_category::Ll},
-            {0xa73d, general_category::Lu},   {0xa73e, general_category::Ll},
-            {0xa73f, general_category::Lu},   {0xa740, general_category::Ll},
-            {0xa741, general_category::Lu},   {0xa742, general_category::Ll},
-            {0xa743, general_category::Lu},   {0xa744, general_category::Ll},
-            {0xa745, general_category::Lu},   {0xa746, general_category::Ll},
-            {0xa747, general_category::Lu},   {0xa748, general_category::Ll},
-            {0xa749, general_category::Lu},   {0xa74a, general_category::Ll},
-            {0xa74b, general_category::Lu},   {0xa74c, general_category::Ll},
-            {0xa74d, general_category::Lu},   {0xa74e, general_category::Ll},
-            {0xa74f, general_category::Lu},   {0xa750, general_category::Ll},
-            {0xa751, general_category::Lu},   {0xa752, general_category::Ll},
-            {0xa753, general_category::Lu},   {0xa754, general_category::Ll},
-            {0xa755, general_category::Lu},   {0xa756, general_category::Ll},
-            {0xa757, general_category::Lu},   {0xa758, general_category::Ll},
-            {0xa759, general_category::Lu},   {0xa75a, general_category::Ll},
-            {0xa75b, general_category::Lu},   {0xa75c, general_category::Ll},
-            {0xa75d, general_category::Lu},   {0xa75e, general_category::Ll},
-            {0xa75f, general_category::Lu},   {0xa760, general_category::Ll},
-            {0xa761, general_category::Lu},   {0xa762, general_category::Ll},
-            {0xa763, general_category::Lu},   {0xa764, general_category::Ll},
-            {0xa765, general_category::Lu},   {0xa766, general_category::Ll},
-            {0xa767, general_category::Lu},   {0xa768, general_category::Ll},
-            {0xa769, general_category::Lu},   {0xa76a, general_category::Ll},
-            {0xa76b, general_category::Lu},   {0xa76c, general_category::Ll},
-            {0xa76d, general_category::Lu},   {0xa76e, general_category::Ll},
-            {0xa76f, general_category::Lu},   {0xa770, general_category::Ll},
-            {0xa771, general_category::Lm},   {0xa779, general_category::Ll},
-            {0xa77a, general_category::Lu},   {0xa77b, general_category::Ll},
-            {0xa77c, general_category::Lu},   {0xa77d, general_category::Ll},
-            {0xa77f, general_category::Lu},   {0xa780, general_category::Ll},
-            {0xa781, general_category::Lu},   {0xa782, general_category::Ll},
-            {0xa783, general_category::Lu},   {0xa784, general_category::Ll},
-            {0xa785, general_category::Lu},   {0xa786, general_category::Ll},
-            {0xa787, general_category::Lu},   {0xa788, general_category::Ll},
-            {0xa789, general_category::Lm},   {0xa78b, general_category::Sk},
-            {0xa78c, general_category::Lu},   {0xa78d, general_category::Ll},
-            {0xa78e, general_category::Lu},   {0xa78f, general_category::Ll},
-            {0xa790, general_category::Lo},   {0xa791, general_category::Lu},
-            {0xa792, general_category::Ll},   {0xa793, general_category::Lu},
-            {0xa796, general_category::Ll},   {0xa797, general_category::Lu},
-            {0xa798, general_category::Ll},   {0xa799, general_category::Lu},
-            {0xa79a, general_category::Ll},   {0xa79b, general_category::Lu},
-            {0xa79c, general_category::Ll},   {0xa79d, general_category::Lu},
-            {0xa79e, general_category::Ll},   {0xa79f, general_category::Lu},
-            {0xa7a0, general_category::Ll},   {0xa7a1, general_category::Lu},
-            {0xa7a2, general_category::Ll},   {0xa7a3, general_category::Lu},
-            {0xa7a4, general_category::Ll},   {0xa7a5, general_category::Lu},
-            {0xa7a6, general_category::Ll},   {0xa7a7, general_category::Lu},
-            {0xa7a8, general_category::Ll},   {0xa7a9, general_category::Lu},
-            {0xa7aa, general_category::Ll},   {0xa7af, general_category::Lu},
-            {0xa7b0, general_category::Ll},   {0xa7b5, general_category::Lu},
-            {0xa7b6, general_category::Ll},   {0xa7b7, general_category::Lu},
-            {0xa7b8, general_category::Ll},   {0xa7b9, general_category::Lu},
-            {0xa7ba, general_category::Ll},   {0xa7bb, general_category::Lu},
-            {0xa7bc, general_category::Ll},   {0xa7bd, general_category::Lu},
-            {0xa7be, general_category::Ll},   {0xa7bf, general_category::Lu},
-            {0xa7c0, general_category::Ll},   {0xa7c2, general_category::Cn},
-            {0xa7c3, general_category::Lu},   {0xa7c4, general_category::Ll},
-            {0xa7c8, general_category::Lu},   {0xa7c9, general_category::Ll},
-            {0xa7ca, general_category::Lu},   {0xa7cb, general_category::Ll},
-            {0xa7f5, general_category::Cn},   {0xa7f6, general_category::Lu},
-            {0xa7f7, general_category::Ll},   {0xa7f8, general_category::Lo},
-            {0xa7fa, general_category::Lm},   {0xa7fb, general_category::Ll},
-            {0xa802, general_category::Lo},   {0xa803, general_category::Mn},
-            {0xa806, general_category::Lo},   {0xa807, general_category::Mn},
-            {0xa80b, general_category::Lo},   {0xa80c, general_category::Mn},
-            {0xa823, general_category::Lo},   {0xa825, general_category::Mc},
-            {0xa827, general_category::Mn},   {0xa828, general_category::Mc},
-            {0xa82c, general_category::So},   {0xa82d, general_category::Mn},
-            {0xa830, general_category::Cn},   {0xa836, general_category::No},
-            {0xa838, general_category::So},   {0xa839, general_category::Sc},
-            {0xa83a, general_category::So},   {0xa840, general_category::Cn},
-            {0xa874, general_category::Lo},   {0xa878, general_category::Po},
-            {0xa880, general_category::Cn},   {0xa882, general_category::Mc},
-            {0xa8b4, general_category::Lo},   {0xa8c4, general_category::Mc},
-            {0xa8c6, general_category::Mn},   {0xa8ce, general_category::Cn},
-            {0xa8d0, general_category::Po},   {0xa8da, general_category::Nd},
-            {0xa8e0, general_category::Cn},   {0xa8f2, general_category::Mn},
-            {0xa8f8, general_category::Lo},   {0xa8fb, general_category::Po},
-            {0xa8fc, general_category::Lo},   {0xa8fd, general_category::Po},
-            {0xa8ff, general_category::Lo},   {0xa900, general_category::Mn},
-            {0xa90a, general_category::Nd},   {0xa926, general_category::Lo},
-            {0xa92e, general_category::Mn},   {0xa930, general_category::Po},
-            {0xa947, general_category::Lo},   {0xa952, general_category::Mn},
-            {0xa954, general_category::Mc},   {0xa95f, general_category::Cn},
-            {0xa960, general_category::Po},   {0xa97d, general_category::Lo},
-            {0xa980, general_category::Cn},   {0xa983, general_category::Mn},
-            {0xa984, general_category::Mc},   {0xa9b3, general_category::Lo},
-            {0xa9b4, general_category::Mn},   {0xa9b6, general_category::Mc},
-            {0xa9ba, general_category::Mn},   {0xa9bc, general_category::Mc},
-            {0xa9be, general_category::Mn},   {0xa9c1, general_category::Mc},
-            {0xa9ce, general_category::Po},   {0xa9cf, general_category::Cn},
-            {0xa9d0, general_category::Lm},   {0xa9da, general_category::Nd},
-            {0xa9de, general_category::Cn},   {0xa9e0, general_category::Po},
-            {0xa9e5, general_category::Lo},   {0xa9e6, general_category::Mn},
-            {0xa9e7, general_category::Lm},   {0xa9f0, general_category::Lo},
-            {0xa9fa, general_category::Nd},   {0xa9ff, general_category::Lo},
-            {0xaa00, general_category::Cn},   {0xaa29, general_category::Lo},
-            {0xaa2f, general_category::Mn},   {0xaa31, general_category::Mc},
-            {0xaa33, general_category::Mn},   {0xaa35, general_category::Mc},
-            {0xaa37, general_category::Mn},   {0xaa40, general_category::Cn},
-            {0xaa43, general_category::Lo},   {0xaa44, general_category::Mn},
-            {0xaa4c, general_category::Lo},   {0xaa4d, general_category::Mn},
-            {0xaa4e, general_category::Mc},   {0xaa50, general_category::Cn},
-            {0xaa5a, general_category::Nd},   {0xaa5c, general_category::Cn},
-            {0xaa60, general_category::Po},   {0xaa70, general_category::Lo},
-            {0xaa71, general_category::Lm},   {0xaa77, general_category::Lo},
-            {0xaa7a, general_category::So},   {0xaa7b, general_category::Lo},
-            {0xaa7c, general_category::Mc},   {0xaa7d, general_category::Mn},
-            {0xaa7e, general_category::Mc},   {0xaab0, general_category::Lo},
-            {0xaab1, general_category::Mn},   {0xaab2, general_category::Lo},
-            {0xaab5, general_category::Mn},   {0xaab7, general_category::Lo},
-            {0xaab9, general_category::Mn},   {0xaabe, general_category::Lo},
-            {0xaac0, general_category::Mn},   {0xaac1, general_category::Lo},
-            {0xaac2, general_category::Mn},   {0xaac3, general_category::Lo},
-            {0xaadb, general_category::Cn},   {0xaadd, general_category::Lo},
-            {0xaade, general_category::Lm},   {0xaae0, general_category::Po},
-            {0xaaeb, general_category::Lo},   {0xaaec, general_category::Mc},
-            {0xaaee, general_category::Mn},   {0xaaf0, general_category::Mc},
-            {0xaaf2, general_category::Po},   {0xaaf3, general_category::Lo},
-            {0xaaf5, general_category::Lm},   {0xaaf6, general_category::Mc},
-            {0xaaf7, general_category::Mn},   {0xab01, general_category::Cn},
-            {0xab07, general_category::Lo},   {0xab09, general_category::Cn},
-            {0xab0f, general_category::Lo},   {0xab11, general_category::Cn},
-            {0xab17, general_category::Lo},   {0xab20, general_category::Cn},
-            {0xab27, general_category::Lo},   {0xab28, general_category::Cn},
-            {0xab2f, general_category::Lo},   {0xab30, general_category::Cn},
-            {0xab5b, general_category::Ll},   {0xab5c, general_category::Sk},
-            {0xab60, general_category::Lm},   {0xab69, general_category::Ll},
-            {0xab6a, general_category::Lm},   {0xab6c, general_category::Sk},
-            {0xab70, general_category::Cn},   {0xabc0, general_category::Ll},
-            {0xabe3, general_category::Lo},   {0xabe5, general_category::Mc},
-            {0xabe6, general_category::Mn},   {0xabe8, general_category::Mc},
-            {0xabe9, general_category::Mn},   {0xabeb, general_category::Mc},
-            {0xabec, general_category::Po},   {0xabed, general_category::Mc},
-            {0xabee, general_category::Mn},   {0xabf0, general_category::Cn},
-            {0xabfa, general_category::Nd},   {0xac00, general_category::Cn},
-            {0xd7a4, general_category::Lo},   {0xd7b0, general_category::Cn},
-            {0xd7c7, general_category::Lo},   {0xd7cb, general_category::Cn},
-            {0xd7fc, general_category::Lo},   {0xd800, general_category::Cn},
-            {0xe000, general_category::Cs},   {0xf900, general_category::Co},
-            {0xfa6e, general_category::Lo},   {0xfa70, general_category::Cn},
-            {0xfada, general_category::Lo},   {0xfb00, general_category::Cn},
-            {0xfb07, general_category::Ll},   {0xfb13, general_category::Cn},
-            {0xfb18, general_category::Ll},   {0xfb1d, general_category::Cn},
-            {0xfb1e, general_category::Lo},   {0xfb1f, general_category::Mn},
-            {0xfb29, general_category::Lo},   {0xfb2a, general_category::Sm},
-            {0xfb37, general_category::Lo},   {0xfb38, general_category::Cn},
-            {0xfb3d, general_category::Lo},   {0xfb3e, general_category::Cn},
-            {0xfb3f, general_category::Lo},   {0xfb40, general_category::Cn},
-            {0xfb42, general_category::Lo},   {0xfb43, general_category::Cn},
-            {0xfb45, general_category::Lo},   {0xfb46, general_category::Cn},
-            {0xfbb2, general_category::Lo},   {0xfbc2, general_category::Sk},
-            {0xfbd3, general_category::Cn},   {0xfd3e, general_category::Lo},
-            {0xfd3f, general_category::Pe},   {0xfd40, general_category::Ps},
-            {0xfd50, general_category::Cn},   {0xfd90, general_category::Lo},
-            {0xfd92, general_category::Cn},   {0xfdc8, general_category::Lo},
-            {0xfdf0, general_category::Cn},   {0xfdfc, general_category::Lo},
-            {0xfdfd, general_category::Sc},   {0xfdfe, general_category::So},
-            {0xfe00, general_category::Cn},   {0xfe10, general_category::Mn},
-            {0xfe17, general_category::Po},   {0xfe18, general_category::Ps},
-            {0xfe19, general_category::Pe},   {0xfe1a, general_category::Po},
-            {0xfe20, general_category::Cn},   {0xfe30, general_category::Mn},
-            {0xfe31, general_category::Po},   {0xfe33, general_category::Pd},
-            {0xfe35, general_category::Pc},   {0xfe36, general_category::Ps},
-            {0xfe37, general_category::Pe},   {0xfe38, general_category::Ps},
-            {0xfe39, general_category::Pe},   {0xfe3a, general_category::Ps},
-            {0xfe3b, general_category::Pe},   {0xfe3c, general_category::Ps},
-            {0xfe3d, general_category::Pe},   {0xfe3e, general_category::Ps},
-            {0xfe3f, general_category::Pe},   {0xfe40, general_category::Ps},
-            {0xfe41, general_category::Pe},   {0xfe42, general_category::Ps},
-            {0xfe43, general_category::Pe},   {0xfe44, general_category::Ps},
-            {0xfe45, general_category::Pe},   {0xfe47, general_category::Po},
-            {0xfe48, general_category::Ps},   {0xfe49, general_category::Pe},
-            {0xfe4d, general_category::Po},   {0xfe50, general_category::Pc},
-            {0xfe53, general_category::Po},   {0xfe54, general_category::Cn},
-            {0xfe58, general_category::Po},   {0xfe59, general_category::Pd},
-            {0xfe5a, general_category::Ps},   {0xfe5b, general_category::Pe},
-            {0xfe5c, general_category::Ps},   {0xfe5d, general_category::Pe},
-            {0xfe5e, general_category::Ps},   {0xfe5f, general_category::Pe},
-            {0xfe62, general_category::Po},   {0xfe63, general_category::Sm},
-            {0xfe64, general_category::Pd},   {0xfe67, general_category::Sm},
-            {0xfe68, general_category::Cn},   {0xfe69, general_category::Po},
-            {0xfe6a, general_category::Sc},   {0xfe6c, general_category::Po},
-            {0xfe70, general_category::Cn},   {0xfe75, general_category::Lo},
-            {0xfe76, general_category::Cn},   {0xfefd, general_category::Lo},
-            {0xfeff, general_category::Cn},   {0xff00, general_category::Cf},
-            {0xff01, general_category::Cn},   {0xff04, general_category::Po},
-            {0xff05, general_category::Sc},   {0xff08, general_category::Po},
-            {0xff09, general_category::Ps},   {0xff0a, general_category::Pe},
-            {0xff0b, general_category::Po},   {0xff0c, general_category::Sm},
-            {0xff0d, general_category::Po},   {0xff0e, general_category::Pd},
-            {0xff10, general_category::Po},   {0xff1a, general_category::Nd},
-            {0xff1c, general_category::Po},   {0xff1f, general_category::Sm},
-            {0xff21, general_category::Po},   {0xff3b, general_category::Lu},
-            {0xff3c, general_category::Ps},   {0xff3d, general_category::Po},
-            {0xff3e, general_category::Pe},   {0xff3f, general_category::Sk},
-            {0xff40, general_category::Pc},   {0xff41, general_category::Sk},
-            {0xff5b, general_category::Ll},   {0xff5c, general_category::Ps},
-            {0xff5d, general_category::Sm},   {0xff5e, general_category::Pe},
-            {0xff5f, general_category::Sm},   {0xff60, general_category::Ps},
-            {0xff61, general_category::Pe},   {0xff62, general_category::Po},
-            {0xff63, general_category::Ps},   {0xff64, general_category::Pe},
-            {0xff66, general_category::Po},   {0xff70, general_category::Lo},
-            {0xff71, general_category::Lm},   {0xff9e, general_category::Lo},
-            {0xffa0, general_category::Lm},   {0xffbf, general_category::Lo},
-            {0xffc2, general_category::Cn},   {0xffc8, general_category::Lo},
-            {0xffca, general_category::Cn},   {0xffd0, general_category::Lo},
-            {0xffd2, general_category::Cn},   {0xffd8, general_category::Lo},
-            {0xffda, general_category::Cn},   {0xffdd, general_category::Lo},
-            {0xffe0, general_category::Cn},   {0xffe2, general_category::Sc},
-            {0xffe3, general_category::Sm},   {0xffe4, general_category::Sk},
-            {0xffe5, general_category::So},   {0xffe7, general_category::Sc},
-            {0xffe8, general_category::Cn},   {0xffe9, general_category::So},
-            {0xffed, general_category::Sm},   {0xffef, general_category::So},
-            {0xfff9, general_category::Cn},   {0xfffc, general_category::Cf},
-            {0xfffe, general_category::So},   {0x10000, general_category::Cn},
-            {0x1000c, general_category::Lo},  {0x1000d, general_category::Cn},
-            {0x10027, general_category::Lo},  {0x10028, general_category::Cn},
-            {0x1003b, general_category::Lo},  {0x1003c, general_category::Cn},
-            {0x1003e, general_category::Lo},  {0x1003f, general_category::Cn},
-            {0x1004e, general_category::Lo},  {0x10050, general_category::Cn},
-            {0x1005e, general_category::Lo},  {0x10080, general_category::Cn},
-            {0x100fb, general_category::Lo},  {0x10100, general_category::Cn},
-            {0x10103, general_category::Po},  {0x10107, general_category::Cn},
-            {0x10134, general_category::No},  {0x10137, general_category::Cn},
-            {0x10140, general_category::So},  {0x10175, general_category::Nl},
-            {0x10179, general_category::No},  {0x1018a, general_category::So},
-            {0x1018c, general_category::No},  {0x1018f, general_category::So},
-            {0x10190, general_category::Cn},  {0x1019d, general_category::So},
-            {0x101a0, general_category::Cn},  {0x101a1, general_category::So},
-            {0x101d0, general_category::Cn},  {0x101fd, general_category::So},
-            {0x101fe, general_category::Mn},  {0x10280, general_category::Cn},
-            {0x1029d, general_category::Lo},  {0x102a0, general_category::Cn},
-            {0x102d1, general_category::Lo},  {0x102e0, general_category::Cn},
-            {0x102e1, general_category::Mn},  {0x102fc, general_category::No},
-            {0x10300, general_category::Cn},  {0x10320, general_category::Lo},
-            {0x10324, general_category::No},  {0x1032d, general_category::Cn},
-            {0x10341, general_category::Lo},  {0x10342, general_category::Nl},
-            {0x1034a, general_category::Lo},  {0x1034b, general_category::Nl},
-            {0x10350, general_category::Cn},  {0x10376, general_category::Lo},
-            {0x1037b, general_category::Mn},  {0x10380, general_category::Cn},
-            {0x1039e, general_category::Lo},  {0x1039f, general_category::Cn},
-            {0x103a0, general_category::Po},  {0x103c4, general_category::Lo},
-            {0x103c8, general_category::Cn},  {0x103d0, general_category::Lo},
-            {0x103d1, general_category::Po},  {0x103d6, general_category::Nl},
-            {0x10400, general_category::Cn},  {0x10428, general_category::Lu},
-            {0x10450, general_category::Ll},  {0x1049e, general_category::Lo},
-            {0x104a0, general_category::Cn},  {0x104aa, general_category::Nd},
-            {0x104b0, general_category::Cn},  {0x104d4, general_category::Lu},
-            {0x104d8, general_category::Cn},  {0x104fc, general_category::Ll},
-            {0x10500, general_category::Cn},  {0x10528, general_category::Lo},
-            {0x10530, general_category::Cn},  {0x10564, general_category::Lo},
-            {0x1056f, general_category::Cn},  {0x10570, general_category::Po},
-            {0x10600, general_category::Cn},  {0x10737, general_category::Lo},
-            {0x10740, general_category::Cn},  {0x10756, general_category::Lo},
-            {0x10760, general_category::Cn},  {0x10768, general_category::Lo},
-            {0x10800, general_category::Cn},  {0x10806, general_category::Lo},
-            {0x10808, general_category::Cn},  {0x10809, general_category::Lo},
-            {0x1080a, general_category::Cn},  {0x10836, general_category::Lo},
-            {0x10837, general_category::Cn},  {0x10839, general_category::Lo},
-            {0x1083c, general_category::Cn},  {0x1083d, general_category::Lo},
-            {0x1083f, general_category::Cn},  {0x10856, general_category::Lo},
-            {0x10857, general_category::Cn},  {0x10858, general_category::Po},
-            {0x10860, general_category::No},  {0x10877, general_category::Lo},
-            {0x10879, general_category::So},  {0x10880, general_category::No},
-            {0x1089f, general_category::Lo},  {0x108a7, general_category::Cn},
-            {0x108b0, general_category::No},  {0x108e0, general_category::Cn},
-            {0x108f3, general_category::Lo},  {0x108f4, general_category::Cn},
-            {0x108f6, general_category::Lo},  {0x108fb, general_category::Cn},
-            {0x10900, general_category::No},  {0x10916, general_category::Lo},
-            {0x1091c, general_category::No},  {0x1091f, general_category::Cn},
-            {0x10920, general_category::Po},  {0x1093a, general_category::Lo},
-            {0x1093f, general_category::Cn},  {0x10940, general_category::Po},
-            {0x10980, general_category::Cn},  {0x109b8, general_category::Lo},
-            {0x109bc, general_category::Cn},  {0x109be, general_category::No},
-            {0x109c0, general_category::Lo},  {0x109d0, general_category::No},
-            {0x109d2, general_category::Cn},  {0x10a00, general_category::No},
-            {0x10a01, general_category::Lo},  {0x10a04, general_category::Mn},
-            {0x10a05, general_category::Cn},  {0x10a07, general_category::Mn},
-            {0x10a0c, general_category::Cn},  {0x10a10, general_category::Mn},
-            {0x10a14, general_category::Lo},  {0x10a15, general_category::Cn},
-            {0x10a18, general_category::Lo},  {0x10a19, general_category::Cn},
-            {0x10a36, general_category::Lo},  {0x10a38, general_category::Cn},
-            {0x10a3b, general_category::Mn},  {0x10a3f, general_category::Cn},
-            {0x10a40, general_category::Mn},  {0x10a49, general_category::No},
-            {0x10a50, general_category::Cn},  {0x10a59, general_category::Po},
-            {0x10a60, general_category::Cn},  {0x10a7d, general_category::Lo},
-            {0x10a7f, general_category::No},  {0x10a80, general_category::Po},
-            {0x10a9d, general_category::Lo},  {0x10aa0, general_category::No},
-            {0x10ac0, general_category::Cn},  {0x10ac8, general_category::Lo},
-            {0x10ac9, general_category::So},  {0x10ae5, general_category::Lo},
-            {0x10ae7, general_category::Mn},  {0x10aeb, general_category::Cn},
-            {0x10af0, general_category::No},  {0x10af7, general_category::Po},
-            {0x10b00, general_category::Cn},  {0x10b36, general_category::Lo},
-            {0x10b39, general_category::Cn},  {0x10b40, general_category::Po},
-            {0x10b56, general_category::Lo},  {0x10b58, general_category::Cn},
-            {0x10b60, general_category::No},  {0x10b73, general_category::Lo},
-            {0x10b78, general_category::Cn},  {0x10b80, general_category::No},
-            {0x10b92, general_category::Lo},  {0x10b99, general_category::Cn},
-            {0x10b9d, general_category::Po},  {0x10ba9, general_category::Cn},
-            {0x10bb0, general_category::No},  {0x10c00, general_category::Cn},
-            {0x10c49, general_category::Lo},  {0x10c80, general_category::Cn},
-            {0x10cb3, general_category::Lu},  {0x10cc0, general_category::Cn},
-            {0x10cf3, general_category::Ll},  {0x10cfa, general_category::Cn},
-            {0x10d00, general_category::No},  {0x10d24, general_category::Lo},
-            {0x10d28, general_category::Mn},  {0x10d30, general_category::Cn},
-            {0x10d3a, general_category::Nd},  {0x10e60, general_category::Cn},
-            {0x10e7f, general_category::No},  {0x10e80, general_category::Cn},
-            {0x10eaa, general_category::Lo},  {0x10eab, general_category::Cn},
-            {0x10ead, general_category::Mn},  {0x10eae, general_category::Pd},
-            {0x10eb0, general_category::Cn},  {0x10eb2, general_category::Lo},
-            {0x10f00, general_category::Cn},  {0x10f1d, general_category::Lo},
-            {0x10f27, general_category::No},  {0x10f28, general_category::Lo},
-            {0x10f30, general_category::Cn},  {0x10f46, general_category::Lo},
-            {0x10f51, general_category::Mn},  {0x10f55, general_category::No},
-            {0x10f5a, general_category::Po},  {0x10fb0, general_category::Cn},
-            {0x10fc5, general_category::Lo},  {0x10fcc, general_category::No},
-            {0x10fe0, general_category::Cn},  {0x10ff7, general_category::Lo},
-            {0x11000, general_category::Cn},  {0x11001, general_category::Mc},
-            {0x11002, general_category::Mn},  {0x11003, general_category::Mc},
-            {0x11038, general_category::Lo},  {0x11047, general_category::Mn},
-            {0x1104e, general_category::Po},  {0x11052, general_category::Cn},
-            {0x11066, general_category::No},  {0x11070, general_category::Nd},
-            {0x1107f, general_category::Cn},  {0x11082, general_category::Mn},
-            {0x11083, general_category::Mc},  {0x110b0, general_category::Lo},
-            {0x110b3, general_category::Mc},  {0x110b7, general_category::Mn},
-            {0x110b9, general_category::Mc},  {0x110bb, general_category::Mn},
-            {0x110bd, general_category::Po},  {0x110be, general_category::Cf},
-            {0x110c2, general_category::Po},  {0x110cd, general_category::Cn},
-            {0x110ce, general_category::Cf},  {0x110d0, general_category::Cn},
-            {0x110e9, general_category::Lo},  {0x110f0, general_category::Cn},
-            {0x110fa, general_category::Nd},  {0x11100, general_category::Cn},
-            {0x11103, general_category::Mn},  {0x11127, general_category::Lo},
-            {0x1112c, general_category::Mn},  {0x1112d, general_category::Mc},
-            {0x11135, general_category::Mn},  {0x11136, general_category::Cn},
-            {0x11140, general_category::Nd},  {0x11144, general_category::Po},
-            {0x11145, general_category::Lo},  {0x11147, general_category::Mc},
-            {0x11148, general_category::Lo},  {0x11150, general_category::Cn},
-            {0x11173, general_category::Lo},  {0x11174, general_category::Mn},
-            {0x11176, general_category::Po},  {0x11177, general_category::Lo},
-            {0x11180, general_category::Cn},  {0x11182, general_category::Mn},
-            {0x11183, general_category::Mc},  {0x111b3, general_category::Lo},
-            {0x111b6, general_category::Mc},  {0x111bf, general_category::Mn},
-            {0x111c1, general_category::Mc},  {0x111c5, general_category::Lo},
-            {0x111c9, general_category::Po},  {0x111cd, general_category::Mn},
-            {0x111ce, general_category::Po},  {0x111cf, general_category::Mc},
-            {0x111d0, general_category::Mn},  {0x111da, general_category::Nd},
-            {0x111db, general_category::Lo},  {0x111dc, general_category::Po},
-            {0x111dd, general_category::Lo},  {0x111e0, general_category::Po},
-            {0x111e1, general_category::Cn},  {0x111f5, general_category::No},
-            {0x11200, general_category::Cn},  {0x11212, general_category::Lo},
-            {0x11213, general_category::Cn},  {0x1122c, general_category::Lo},
-            {0x1122f, general_category::Mc},  {0x11232, general_category::Mn},
-            {0x11234, general_category::Mc},  {0x11235, general_category::Mn},
-            {0x11236, general_category::Mc},  {0x11238, general_category::Mn},
-            {0x1123e, general_category::Po},  {0x1123f, general_category::Mn},
-            {0x11280, general_category::Cn},  {0x11287, general_category::Lo},
-            {0x11288, general_category::Cn},  {0x11289, general_category::Lo},
-            {0x1128a, general_category::Cn},  {0x1128e, general_category::Lo},
-            {0x1128f, general_category::Cn},  {0x1129e, general_category::Lo},
-            {0x1129f, general_category::Cn},  {0x112a9, general_category::Lo},
-            {0x112aa, general_category::Po},  {0x112b0, general_category::Cn},
-            {0x112df, general_category::Lo},  {0x112e0, general_category::Mn},
-            {0x112e3, general_category::Mc},  {0x112eb, general_category::Mn},
-            {0x112f0, general_category::Cn},  {0x112fa, general_category::Nd},
-            {0x11300, general_category::Cn},  {0x11302, general_category::Mn},
-            {0x11304, general_category::Mc},  {0x11305, general_category::Cn},
-            {0x1130d, general_category::Lo},  {0x1130f, general_category::Cn},
-            {0x11311, general_category::Lo},  {0x11313, general_category::Cn},
-            {0x11329, general_category::Lo},  {0x1132a, general_category::Cn},
-            {0x11331, general_category::Lo},  {0x11332, general_category::Cn},
-            {0x11334, general_category::Lo},  {0x11335, general_category::Cn},
-            {0x1133a, general_category::Lo},  {0x1133b, general_category::Cn},
-            {0x1133d, general_category::Mn},  {0x1133e, general_category::Lo},
-            {0x11340, general_category::Mc},  {0x11341, general_category::Mn},
-            {0x11345, general_category::Mc},  {0x11347, general_category::Cn},
-            {0x11349, general_category::Mc},  {0x1134b, general_category::Cn},
-            {0x1134e, general_category::Mc},  {0x11350, general_category::Cn},
-            {0x11351, general_category::Lo},  {0x11357, general_category::Cn},
-            {0x11358, general_category::Mc},  {0x1135d, general_category::Cn},
-            {0x11362, general_category::Lo},  {0x11364, general_category::Mc},
-            {0x11366, general_category::Cn},  {0x1136d, general_category::Mn},
-            {0x11370, general_category::Cn},  {0x11375, general_category::Mn},
-            {0x11400, general_category::Cn},  {0x11435, general_category::Lo},
-            {0x11438, general_category::Mc},  {0x11440, general_category::Mn},
-            {0x11442, general_category::Mc},  {0x11445, general_category::Mn},
-            {0x11446, general_category::Mc},  {0x11447, general_category::Mn},
-            {0x1144b, general_category::Lo},  {0x11450, general_category::Po},
-            {0x1145a, general_category::Nd},  {0x1145c, general_category::Po},
-            {0x1145d, general_category::Cn},  {0x1145e, general_category::Po},
-            {0x1145f, general_category::Mn},  {0x11462, general_category::Lo},
-            {0x11480, general_category::Cn},  {0x114b0, general_category::Lo},
-            {0x114b3, general_category::Mc},  {0x114b9, general_category::Mn},
-            {0x114ba, general_category::Mc},  {0x114bb, general_category::Mn},
-            {0x114bf, general_category::Mc},  {0x114c1, general_category::Mn},
-            {0x114c2, general_category::Mc},  {0x114c4, general_category::Mn},
-            {0x114c6, general_category::Lo},  {0x114c7, general_category::Po},
-            {0x114c8, general_category::Lo},  {0x114d0, general_category::Cn},
-            {0x114da, general_category::Nd},  {0x11580, general_category::Cn},
-            {0x115af, general_category::Lo},  {0x115b2, general_category::Mc},
-            {0x115b6, general_category::Mn},  {0x115b8, general_category::Cn},
-            {0x115bc, general_category::Mc},  {0x115be, general_category::Mn},
-            {0x115bf, general_category::Mc},  {0x115c1, general_category::Mn},
-            {0x115d8, general_category::Po},  {0x115dc, general_category::Lo},
-            {0x115de, general_category::Mn},  {0x11600, general_category::Cn},
-            {0x11630, general_category::Lo},  {0x11633, general_category::Mc},
-            {0x1163b, general_category::Mn},  {0x1163d, general_category::Mc},
-            {0x1163e, general_category::Mn},  {0x1163f, general_category::Mc},
-            {0x11641, general_category::Mn},  {0x11644, general_category::Po},
-            {0x11645, general_category::Lo},  {0x11650, general_category::Cn},
-            {0x1165a, general_category::Nd},  {0x11660, general_category::Cn},
-            {0x1166d, general_category::Po},  {0x11680, general_category::Cn},
-            {0x116ab, general_category::Lo},  {0x116ac, general_category::Mn},
-            {0x116ad, general_category::Mc},  {0x116ae, general_category::Mn},
-            {0x116b0, general_category::Mc},  {0x116b6, general_category::Mn},
-            {0x116b7, general_category::Mc},  {0x116b8, general_category::Mn},
-            {0x116b9, general_category::Lo},  {0x116c0, general_category::Cn},
-            {0x116ca, general_category::Nd},  {0x11700, general_category::Cn},
-            {0x1171b, general_category::Lo},  {0x1171d, general_category::Cn},
-            {0x11720, general_category::Mn},  {0x11722, general_category::Mc},
-            {0x11726, general_category::Mn},  {0x11727, general_category::Mc},
-            {0x1172c, general_category::Mn},  {0x11730, general_category::Cn},
-            {0x1173a, general_category::Nd},  {0x1173c, general_category::No},
-            {0x1173f, general_category::Po},  {0x11740, general_category::So},
-            {0x11800, general_category::Cn},  {0x1182c, general_category::Lo},
-            {0x1182f, general_category::Mc},  {0x11838, general_category::Mn},
-            {0x11839, general_category::Mc},  {0x1183b, general_category::Mn},
-            {0x1183c, general_category::Po},  {0x118a0, general_category::Cn},
-            {0x118c0, general_category::Lu},  {0x118e0, general_category::Ll},
-            {0x118ea, general_category::Nd},  {0x118f3, general_category::No},
-            {0x118ff, general_category::Cn},  {0x11907, general_category::Lo},
-            {0x11909, general_category::Cn},  {0x1190a, general_category::Lo},
-            {0x1190c, general_category::Cn},  {0x11914, general_category::Lo},
-            {0x11915, general_category::Cn},  {0x11917, general_category::Lo},
-            {0x11918, general_category::Cn},  {0x11930, general_category::Lo},
-            {0x11936, general_category::Mc},  {0x11937, general_category::Cn},
-            {0x11939, general_category::Mc},  {0x1193b, general_category::Cn},
-            {0x1193d, general_category::Mn},  {0x1193e, general_category::Mc},
-            {0x1193f, general_category::Mn},  {0x11940, general_category::Lo},
-            {0x11941, general_category::Mc},  {0x11942, general_category::Lo},
-            {0x11943, general_category::Mc},  {0x11944, general_category::Mn},
-            {0x11947, general_category::Po},  {0x11950, general_category::Cn},
-            {0x1195a, general_category::Nd},  {0x119a0, general_category::Cn},
-            {0x119a8, general_category::Lo},  {0x119aa, general_category::Cn},
-            {0x119d1, general_category::Lo},  {0x119d4, general_category::Mc},
-            {0x119d8, general_category::Mn},  {0x119da, general_category::Cn},
-            {0x119dc, general_category::Mn},  {0x119e0, general_category::Mc},
-            {0x119e1, general_category::Mn},  {0x119e2, general_category::Lo},
-            {0x119e3, general_category::Po},  {0x119e4, general_category::Lo},
-            {0x119e5, general_category::Mc},  {0x11a00, general_category::Cn},
-            {0x11a01, general_category::Lo},  {0x11a0b, general_category::Mn},
-            {0x11a33, general_category::Lo},  {0x11a39, general_category::Mn},
-            {0x11a3a, general_category::Mc},  {0x11a3b, general_category::Lo},
-            {0x11a3f, general_category::Mn},  {0x11a47, general_category::Po},
-            {0x11a48, general_category::Mn},  {0x11a50, general_category::Cn},
-            {0x11a51, general_category::Lo},  {0x11a57, general_category::Mn},
-            {0x11a59, general_category::Mc},  {0x11a5c, general_category::Mn},
-            {0x11a8a, general_category::Lo},  {0x11a97, general_category::Mn},
-            {0x11a98, general_category::Mc},  {0x11a9a, general_category::Mn},
-            {0x11a9d, general_category::Po},  {0x11a9e, general_category::Lo},
-            {0x11aa3, general_category::Po},  {0x11ac0, general_category::Cn},
-            {0x11af9, general_category::Lo},  {0x11c00, general_category::Cn},
-            {0x11c09, general_category::Lo},  {0x11c0a, general_category::Cn},
-            {0x11c2f, general_category::Lo},  {0x11c30, general_category::Mc},
-            {0x11c37, general_category::Mn},  {0x11c38, general_category::Cn},
-            {0x11c3e, general_category::Mn},  {0x11c3f, general_category::Mc},
-            {0x11c40, general_category::Mn},  {0x11c41, general_category::Lo},
-            {0x11c46, general_category::Po},  {0x11c50, general_category::Cn},
-            {0x11c5a, general_category::Nd},  {0x11c6d, general_category::No},
-            {0x11c70, general_category::Cn},  {0x11c72, general_category::Po},
-            {0x11c90, general_category::Lo},  {0x11c92, general_category::Cn},
-            {0x11ca8, general_category::Mn},  {0x11ca9, general_category::Cn},
-            {0x11caa, general_category::Mc},  {0x11cb1, general_category::Mn},
-            {0x11cb2, general_category::Mc},  {0x11cb4, general_category::Mn},
-            {0x11cb5, general_category::Mc},  {0x11cb7, general_category::Mn},
-            {0x11d00, general_category::Cn},  {0x11d07, general_category::Lo},
-            {0x11d08, general_category::Cn},  {0x11d0a, general_category::Lo},
-            {0x11d0b, general_category::Cn},  {0x11d31, general_category::Lo},
-            {0x11d37, general_category::Mn},  {0x11d3a, general_category::Cn},
-            {0x11d3b, general_category::Mn},  {0x11d3c, general_category::Cn},
-            {0x11d3e, general_category::Mn},  {0x11d3f, general_category::Cn},
-            {0x11d46, general_category::Mn},  {0x11d47, general_category::Lo},
-            {0x11d48, general_category::Mn},  {0x11d50, general_category::Cn},
-            {0x11d5a, general_category::Nd},  {0x11d60, general_category::Cn},
-            {0x11d66, general_category::Lo},  {0x11d67, general_category::Cn},
-            {0x11d69, general_category::Lo},  {0x11d6a, general_category::Cn},
-            {0x11d8a, general_category::Lo},  {0x11d8f, general_category::Mc},
-            {0x11d90, general_category::Cn},  {0x11d92, general_category::Mn},
-            {0x11d93, general_category::Cn},  {0x11d95, general_category::Mc},
-            {0x11d96, general_category::Mn},  {0x11d97, general_category::Mc},
-            {0x11d98, general_category::Mn},  {0x11d99, general_category::Lo},
-            {0x11da0, general_category::Cn},  {0x11daa, general_category::Nd},
-            {0x11ee0, general_category::Cn},  {0x11ef3, general_category::Lo},
-            {0x11ef5, general_category::Mn},  {0x11ef7, general_category::Mc},
-            {0x11ef9, general_category::Po},  {0x11fb0, general_category::Cn},
-            {0x11fb1, general_category::Lo},  {0x11fc0, general_category::Cn},
-            {0x11fd5, general_category::No},  {0x11fdd, general_category::So},
-            {0x11fe1, general_category::Sc},  {0x11ff2, general_category::So},
-            {0x11fff, general_category::Cn},  {0x12000, general_category::Po},
-            {0x1239a, general_category::Lo},  {0x12400, general_category::Cn},
-            {0x1246f, general_category::Nl},  {0x12470, general_category::Cn},
-            {0x12475, general_category::Po},  {0x12480, general_category::Cn},
-            {0x12544, general_category::Lo},  {0x13000, general_category::Cn},
-            {0x1342f, general_category::Lo},  {0x13430, general_category::Cn},
-            {0x13439, general_category::Cf},  {0x14400, general_category::Cn},
-            {0x14647, general_category::Lo},  {0x16800, general_category::Cn},
-            {0x16a39, general_category::Lo},  {0x16a40, general_category::Cn},
-            {0x16a5f, general_category::Lo},  {0x16a60, general_category::Cn},
-            {0x16a6a, general_category::Nd},  {0x16a6e, general_category::Cn},
-            {0x16a70, general_category::Po},  {0x16ad0, general_category::Cn},
-            {0x16aee, general_category::Lo},  {0x16af0, general_category::Cn},
-            {0x16af5, general_category::Mn},  {0x16af6, general_category::Po},
-            {0x16b00, general_category::Cn},  {0x16b30, general_category::Lo},
-            {0x16b37, general_category::Mn},  {0x16b3c, general_category::Po},
-            {0x16b40, general_category::So},  {0x16b44, general_category::Lm},
-            {0x16b45, general_category::Po},  {0x16b46, general_category::So},
-            {0x16b50, general_category::Cn},  {0x16b5a, general_category::Nd},
-            {0x16b5b, general_category::Cn},  {0x16b62, general_category::No},
-            {0x16b63, general_category::Cn},  {0x16b78, general_category::Lo},
-            {0x16b7d, general_category::Cn},  {0x16b90, general_category::Lo},
-            {0x16e40, general_category::Cn},  {0x16e60, general_category::Lu},
-            {0x16e80, general_category::Ll},  {0x16e97, general_category::No},
-            {0x16e9b, general_category::Po},  {0x16f00, general_category::Cn},
-            {0x16f4b, general_category::Lo},  {0x16f4f, general_category::Cn},
-            {0x16f50, general_category::Mn},  {0x16f51, general_category::Lo},
-            {0x16f88, general_category::Mc},  {0x16f8f, general_category::Cn},
-            {0x16f93, general_category::Mn},  {0x16fa0, general_category::Lm},
-            {0x16fe0, general_category::Cn},  {0x16fe2, general_category::Lm},
-            {0x16fe3, general_category::Po},  {0x16fe4, general_category::Lm},
-            {0x16fe5, general_category::Mn},  {0x16ff0, general_category::Cn},
-            {0x16ff2, general_category::Mc},  {0x17000, general_category::Cn},
-            {0x187f8, general_category::Lo},  {0x18800, general_category::Cn},
-            {0x18cd6, general_category::Lo},  {0x18d00, general_category::Cn},
-            {0x18d09, general_category::Lo},  {0x1b000, general_category::Cn},
-            {0x1b11f, general_category::Lo},  {0x1b150, general_category::Cn},
-            {0x1b153, general_category::Lo},  {0x1b164, general_category::Cn},
-            {0x1b168, general_category::Lo},  {0x1b170, general_category::Cn},
-            {0x1b2fc, general_category::Lo},  {0x1bc00, general_category::Cn},
-            {0x1bc6b, general_category::Lo},  {0x1bc70, general_category::Cn},
-            {0x1bc7d, general_category::Lo},  {0x1bc80, general_category::Cn},
-            {0x1bc89, general_category::Lo},  {0x1bc90, general_category::Cn},
-            {0x1bc9a, general_category::Lo},  {0x1bc9c, general_category::Cn},
-            {0x1bc9d, general_category::So},  {0x1bc9f, general_category::Mn},
-            {0x1bca0, general_category::Po},  {0x1bca4, general_category::Cf},
-            {0x1d000, general_category::Cn},  {0x1d0f6, general_category::So},
-            {0x1d100, general_category::Cn},  {0x1d127, general_category::So},
-            {0x1d129, general_category::Cn},  {0x1d165, general_category::So},
-            {0x1d167, general_category::Mc},  {0x1d16a, general_category::Mn},
-            {0x1d16d, general_category::So},  {0x1d173, general_category::Mc},
-            {0x1d17b, general_category::Cf},  {0x1d183, general_category::Mn},
-            {0x1d185, general_category::So},  {0x1d18c, general_category::Mn},
-            {0x1d1aa, general_category::So},  {0x1d1ae, general_category::Mn},
-            {0x1d1e9, general_category::So},  {0x1d200, general_category::Cn},
-            {0x1d242, general_category::So},  {0x1d245, general_category::Mn},
-            {0x1d246, general_category::So},  {0x1d2e0, general_category::Cn},
-            {0x1d2f4, general_category::No},  {0x1d300, general_category::Cn},
-            {0x1d357, general_category::So},  {0x1d360, general_category::Cn},
-            {0x1d379, general_category::No},  {0x1d400, general_category::Cn},
-            {0x1d41a, general_category::Lu},  {0x1d434, general_category::Ll},
-            {0x1d44e, general_category::Lu},  {0x1d455, general_category::Ll},
-            {0x1d456, general_category::Cn},  {0x1d468, general_category::Ll},
-            {0x1d482, general_category::Lu},  {0x1d49c, general_category::Ll},
-            {0x1d49d, general_category::Lu},  {0x1d49e, general_category::Cn},
-            {0x1d4a0, general_category::Lu},  {0x1d4a2, general_category::Cn},
-            {0x1d4a3, general_category::Lu},  {0x1d4a5, general_category::Cn},
-            {0x1d4a7, general_category::Lu},  {0x1d4a9, general_category::Cn},
-            {0x1d4ad, general_category::Lu},  {0x1d4ae, general_category::Cn},
-            {0x1d4b6, general_category::Lu},  {0x1d4ba, general_category::Ll},
-            {0x1d4bb, general_category::Cn},  {0x1d4bc, general_category::Ll},
-            {0x1d4bd, general_category::Cn},  {0x1d4c4, general_category::Ll},
-            {0x1d4c5, general_category::Cn},  {0x1d4d0, general_category::Ll},
-            {0x1d4ea, general_category::Lu},  {0x1d504, general_category::Ll},
-            {0x1d506, general_category::Lu},  {0x1d507, general_category::Cn},
-            {0x1d50b, general_category::Lu},  {0x1d50d, general_category::Cn},
-            {0x1d515, general_category::Lu},  {0x1d516, general_category::Cn},
-            {0x1d51d, general_category::Lu},  {0x1d51e, general_category::Cn},
-            {0x1d538, general_category::Ll},  {0x1d53a, general_category::Lu},
-            {0x1d53b, general_category::Cn},  {0x1d53f, general_category::Lu},
-            {0x1d540, general_category::Cn},  {0x1d545, general_category::Lu},
-            {0x1d546, general_category::Cn},  {0x1d547, general_category::Lu},
-            {0x1d54a, general_category::Cn},  {0x1d551, general_category::Lu},
-            {0x1d552, general_category::Cn},  {0x1d56c, general_category::Ll},
-            {0x1d586, general_category::Lu},  {0x1d5a0, general_category::Ll},
-            {0x1d5ba, general_category::Lu},  {0x1d5d4, general_category::Ll},
-            {0x1d5ee, general_category::Lu},  {0x1d608, general_category::Ll},
-            {0x1d622, general_category::Lu},  {0x1d63c, general_category::Ll},
-            {0x1d656, general_category::Lu},  {0x1d670, general_category::Ll},
-            {0x1d68a, general_category::Lu},  {0x1d6a6, general_category::Ll},
-            {0x1d6a8, general_category::Cn},  {0x1d6c1, general_category::Lu},
-            {0x1d6c2, general_category::Sm},  {0x1d6db, general_category::Ll},
-            {0x1d6dc, general_category::Sm},  {0x1d6e2, general_category::Ll},
-            {0x1d6fb, general_category::Lu},  {0x1d6fc, general_category::Sm},
-            {0x1d715, general_category::Ll},  {0x1d716, general_category::Sm},
-            {0x1d71c, general_category::Ll},  {0x1d735, general_category::Lu},
-            {0x1d736, general_category::Sm},  {0x1d74f, general_category::Ll},
-            {0x1d750, general_category::Sm},  {0x1d756, general_category::Ll},
-            {0x1d76f, general_category::Lu},  {0x1d770, general_category::Sm},
-            {0x1d789, general_category::Ll},  {0x1d78a, general_category::Sm},
-            {0x1d790, general_category::Ll},  {0x1d7a9, general_category::Lu},
-            {0x1d7aa, general_category::Sm},  {0x1d7c3, general_category::Ll},
-            {0x1d7c4, general_category::Sm},  {0x1d7ca, general_category::Ll},
-            {0x1d7cb, general_category::Lu},  {0x1d7cc, general_category::Ll},
-            {0x1d7ce, general_category::Cn},  {0x1d800, general_category::Nd},
-            {0x1da00, general_category::So},  {0x1da37, general_category::Mn},
-            {0x1da3b, general_category::So},  {0x1da6d, general_category::Mn},
-            {0x1da75, general_category::So},  {0x1da76, general_category::Mn},
-            {0x1da84, general_category::So},  {0x1da85, general_category::Mn},
-            {0x1da87, general_category::So},  {0x1da8c, general_category::Po},
-            {0x1da9b, general_category::Cn},  {0x1daa0, general_category::Mn},
-            {0x1daa1, general_category::Cn},  {0x1dab0, general_category::Mn},
-            {0x1e000, general_category::Cn},  {0x1e007, general_category::Mn},
-            {0x1e008, general_category::Cn},  {0x1e019, general_category::Mn},
-            {0x1e01b, general_category::Cn},  {0x1e022, general_category::Mn},
-            {0x1e023, general_category::Cn},  {0x1e025, general_category::Mn},
-            {0x1e026, general_category::Cn},  {0x1e02b, general_category::Mn},
-            {0x1e100, general_category::Cn},  {0x1e12d, general_category::Lo},
-            {0x1e130, general_category::Cn},  {0x1e137, general_category::Mn},
-            {0x1e13e, general_category::Lm},  {0x1e140, general_category::Cn},
-            {0x1e14a, general_category::Nd},  {0x1e14e, general_category::Cn},
-            {0x1e14f, general_category::Lo},  {0x1e150, general_category::So},
-            {0x1e2c0, general_category::Cn},  {0x1e2ec, general_category::Lo},
-            {0x1e2f0, general_category::Mn},  {0x1e2fa, general_category::Nd},
-            {0x1e2ff, general_category::Cn},  {0x1e300, general_category::Sc},
-            {0x1e800, general_category::Cn},  {0x1e8c5, general_category::Lo},
-            {0x1e8c7, general_category::Cn},  {0x1e8d0, general_category::No},
-            {0x1e8d7, general_category::Mn},  {0x1e900, general_category::Cn},
-            {0x1e922, general_category::Lu},  {0x1e944, general_category::Ll},
-            {0x1e94b, general_category::Mn},  {0x1e94c, general_category::Lm},
-            {0x1e950, general_category::Cn},  {0x1e95a, general_category::Nd},
-            {0x1e95e, general_category::Cn},  {0x1e960, general_category::Po},
-            {0x1ec71, general_category::Cn},  {0x1ecac, general_category::No},
-            {0x1ecad, general_category::So},  {0x1ecb0, general_category::No},
-            {0x1ecb1, general_category::Sc},  {0x1ecb5, general_category::No},
-            {0x1ed01, general_category::Cn},  {0x1ed2e, general_category::No},
-            {0x1ed2f, general_category::So},  {0x1ed3e, general_category::No},
-            {0x1ee00, general_category::Cn},  {0x1ee04, general_category::Lo},
-            {0x1ee05, general_category::Cn},  {0x1ee20, general_category::Lo},
-            {0x1ee21, general_category::Cn},  {0x1ee23, general_category::Lo},
-            {0x1ee24, general_category::Cn},  {0x1ee25, general_category::Lo},
-            {0x1ee27, general_category::Cn},  {0x1ee28, general_category::Lo},
-            {0x1ee29, general_category::Cn},  {0x1ee33, general_category::Lo},
-            {0x1ee34, general_category::Cn},  {0x1ee38, general_category::Lo},
-            {0x1ee39, general_category::Cn},  {0x1ee3a, general_category::Lo},
-            {0x1ee3b, general_category::Cn},  {0x1ee3c, general_category::Lo},
-            {0x1ee42, general_category::Cn},  {0x1ee43, general_category::Lo},
-            {0x1ee47, general_category::Cn},  {0x1ee48, general_category::Lo},
-            {0x1ee49, general_category::Cn},  {0x1ee4a, general_category::Lo},
-            {0x1ee4b, general_category::Cn},  {0x1ee4c, general_category::Lo},
-            {0x1ee4d, general_category::Cn},  {0x1ee50, general_category::Lo},
-            {0x1ee51, general_category::Cn},  {0x1ee53, general_category::Lo},
-            {0x1ee54, general_category::Cn},  {0x1ee55, general_category::Lo},
-            {0x1ee57, general_category::Cn},  {0x1ee58, general_category::Lo},
-            {0x1ee59, general_category::Cn},  {0x1ee5a, general_category::Lo},
-            {0x1ee5b, general_category::Cn},  {0x1ee5c, general_category::Lo},
-            {0x1ee5d, general_category::Cn},  {0x1ee5e, general_category::Lo},
-            {0x1ee5f, general_category::Cn},  {0x1ee60, general_category::Lo},
-            {0x1ee61, general_category::Cn},  {0x1ee63, general_category::Lo},
-            {0x1ee64, general_category::Cn},  {0x1ee65, general_category::Lo},
-            {0x1ee67, general_category::Cn},  {0x1ee6b, general_category::Lo},
-            {0x1ee6c, general_category::Cn},  {0x1ee73, general_category::Lo},
-            {0x1ee74, general_category::Cn},  {0x1ee78, general_category::Lo},
-            {0x1ee79, general_category::Cn},  {0x1ee7d, general_category::Lo},
-            {0x1ee7e, general_category::Cn},  {0x1ee7f, general_category::Lo},
-            {0x1ee80, general_category::Cn},  {0x1ee8a, general_category::Lo},
-            {0x1ee8b, general_category::Cn},  {0x1ee9c, general_category::Lo},
-            {0x1eea1, general_category::Cn},  {0x1eea4, general_category::Lo},
-            {0x1eea5, general_category::Cn},  {0x1eeaa, general_category::Lo},
-            {0x1eeab, general_category::Cn},  {0x1eebc, general_category::Lo},
-            {0x1eef0, general_category::Cn},  {0x1eef2, general_category::Sm},
-            {0x1f000, general_category::Cn},  {0x1f02c, general_category::So},
-            {0x1f030, general_category::Cn},  {0x1f094, general_category::So},
-            {0x1f0a0, general_category::Cn},  {0x1f0af, general_category::So},
-            {0x1f0b1, general_category::Cn},  {0x1f0c0, general_category::So},
-            {0x1f0c1, general_category::Cn},  {0x1f0d0, general_category::So},
-            {0x1f0d1, general_category::Cn},  {0x1f0f6, general_category::So},
-            {0x1f100, general_category::Cn},  {0x1f10d, general_category::No},
-            {0x1f1ae, general_category::So},  {0x1f1e6, general_category::Cn},
-            {0x1f203, general_category::So},  {0x1f210, general_category::Cn},
-            {0x1f23c, general_category::So},  {0x1f240, general_category::Cn},
-            {0x1f249, general_category::So},  {0x1f250, general_category::Cn},
-            {0x1f252, general_category::So},  {0x1f260, general_category::Cn},
-            {0x1f266, general_category::So},  {0x1f300, general_category::Cn},
-            {0x1f3fb, general_category::So},  {0x1f400, general_category::Sk},
-            {0x1f6d8, general_category::So},  {0x1f6e0, general_category::Cn},
-            {0x1f6ed, general_category::So},  {0x1f6f0, general_category::Cn},
-            {0x1f6fd, general_category::So},  {0x1f700, general_category::Cn},
-            {0x1f774, general_category::So},  {0x1f780, general_category::Cn},
-            {0x1f7d9, general_category::So},  {0x1f7e0, general_category::Cn},
-            {0x1f7ec, general_category::So},  {0x1f800, general_category::Cn},
-            {0x1f80c, general_category::So},  {0x1f810, general_category::Cn},
-            {0x1f848, general_category::So},  {0x1f850, general_category::Cn},
-            {0x1f85a, general_category::So},  {0x1f860, general_category::Cn},
-            {0x1f888, general_category::So},  {0x1f890, general_category::Cn},
-            {0x1f8ae, general_category::So},  {0x1f8b0, general_category::Cn},
-            {0x1f8b2, general_category::So},  {0x1f900, general_category::Cn},
-            {0x1f979, general_category::So},  {0x1f97a, general_category::Cn},
-            {0x1f9cc, general_category::So},  {0x1f9cd, general_category::Cn},
-            {0x1fa54, general_category::So},  {0x1fa60, general_category::Cn},
-            {0x1fa6e, general_category::So},  {0x1fa70, general_category::Cn},
-            {0x1fa75, general_category::So},  {0x1fa78, general_category::Cn},
-            {0x1fa7b, general_category::So},  {0x1fa80, general_category::Cn},
-            {0x1fa87, general_category::So},  {0x1fa90, general_category::Cn},
-            {0x1faa9, general_category::So},  {0x1fab0, general_category::Cn},
-            {0x1fab7, general_category::So},  {0x1fac0, general_category::Cn},
-            {0x1fac3, general_category::So},  {0x1fad0, general_category::Cn},
-            {0x1fad7, general_category::So},  {0x1fb00, general_category::Cn},
-            {0x1fb93, general_category::So},  {0x1fb94, general_category::Cn},
-            {0x1fbcb, general_category::So},  {0x1fbf0, general_category::Cn},
-            {0x1fbfa, general_category::Nd},  {0x20000, general_category::Cn},
-            {0x2a6de, general_category::Lo},  {0x2a700, general_category::Cn},
-            {0x2b735, general_category::Lo},  {0x2b740, general_category::Cn},
-            {0x2b81e, general_category::Lo},  {0x2b820, general_category::Cn},
-            {0x2cea2, general_category::Lo},  {0x2ceb0, general_category::Cn},
-            {0x2ebe1, general_category::Lo},  {0x2f800, general_category::Cn},
-            {0x2fa1e, general_category::Lo},  {0x30000, general_category::Cn},
-            {0x3134b, general_category::Lo},  {0xe0001, general_category::Cn},
-            {0xe0002, general_category::Cf},  {0xe0020, general_category::Cn},
-            {0xe0080, general_category::Cf},  {0xe0100, general_category::Cn},
-            {0xe01f0, general_category::Mn},  {0xf0000, general_category::Cn},
-            {0xffffe, general_category::Co},  {0x100000, general_category::Cn},
-            {0x10fffe, general_category::Co}, {0x110000, general_category::Cn},
+            {
+                26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+                23, 18, 18, 18, 20, 18, 18, 18, 14, 15, 18, 19, 18, 13, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 19, 19, 19, 18,
+                18, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 18, 15, 21, 12,
+                21, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 19, 15, 19, 26,
+            },
+            {
+                26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+                23, 18, 20, 20, 20, 20, 22, 18, 21, 22, 5, 16, 19, 27, 22, 21, 22, 19, 11, 11, 21, 2, 18, 18, 21, 11, 5, 17, 11, 11, 11, 18,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19, 1, 1, 1, 1, 1, 1, 1, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1,
+                2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 2, 1, 2, 1, 2, 2,
+            },
+            {
+                2, 1, 1, 2, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 1, 1, 1, 1, 2, 1, 1, 2, 1, 1, 1, 2, 2, 2, 1, 1, 2, 1,
+                1, 2, 1, 2, 1, 2, 1, 1, 2, 1, 2, 2, 1, 2, 1, 1, 2, 1, 1, 1, 2, 1, 2, 1, 1, 2, 2, 5, 1, 2, 2, 2,
+                5, 5, 5, 5, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 3, 2, 1, 2, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2,
+            },
+            {
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 1, 1, 2, 1, 1, 2,
+                2, 1, 2, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 21, 21, 21, 21, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+                4, 4, 4, 4, 4, 21, 21, 21, 21, 21, 21, 21, 4, 21, 4, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+            },
+            {
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 1, 2, 1, 2, 4, 21, 1, 2, 30, 30, 4, 2, 2, 2, 18, 1,
+            },
+            {
+                30, 30, 30, 30, 21, 21, 1, 18, 1, 1, 1, 30, 1, 30, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 30, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 2, 1, 1, 1, 2, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 2, 2, 2, 1, 2, 19, 1, 2, 1, 1, 2, 2, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            },
+            {
+                1, 2, 22, 6, 6, 6, 6, 6, 8, 8, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            },
+            {
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 30, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 30, 30, 4, 18, 18, 18, 18, 18, 18,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 18, 13, 30, 30, 22, 22, 20, 30, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 13, 6,
+                18, 6, 6, 18, 6, 6, 18, 6, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 5, 5, 5, 5, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                27, 27, 27, 27, 27, 27, 19, 19, 19, 18, 18, 20, 18, 18, 22, 22, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 18, 27, 18, 18, 18,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 18, 18, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 5, 6, 6, 6, 6, 6, 6, 6, 27, 22, 6,
+                6, 6, 6, 6, 6, 4, 4, 6, 6, 22, 6, 6, 6, 6, 5, 5, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 22, 22, 5,
+            },
+            {
+                18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 30, 27, 5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 4, 22, 18, 18, 18, 4, 30, 30, 6, 20, 20,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 4, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 4, 6, 6, 6, 4, 6, 6, 6, 6, 6, 30, 30, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 30, 30, 18, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 21, 5, 5, 5, 5, 5, 5, 30, 27, 27, 30, 30, 30, 30, 30, 30, 6, 6, 6, 6, 6, 6, 6, 6,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 27, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+            },
+            {
+                6, 6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 6, 5, 7, 7,
+                7, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 6, 7, 7, 5, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 6, 6, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 6, 7, 7, 30, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 30, 30, 30, 5, 5, 5, 5, 30, 30, 6, 5, 7, 7,
+                7, 6, 6, 6, 6, 30, 30, 7, 7, 30, 30, 7, 7, 6, 5, 30, 30, 30, 30, 30, 30, 30, 30, 7, 30, 30, 30, 30, 5, 5, 30, 5,
+                5, 5, 6, 6, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 20, 20, 11, 11, 11, 11, 11, 11, 22, 20, 5, 18, 6, 30,
+            },
+            {
+                30, 6, 6, 7, 30, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 5, 5, 30, 5, 5, 30, 30, 6, 30, 7, 7,
+                7, 6, 6, 30, 30, 30, 30, 6, 6, 30, 30, 6, 6, 6, 30, 30, 30, 6, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 30, 5, 30,
+                30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 6, 6, 5, 5, 5, 6, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 6, 6, 7, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 5, 5, 5, 5, 5, 30, 30, 6, 5, 7, 7,
+                7, 6, 6, 6, 6, 6, 30, 6, 6, 7, 30, 7, 7, 6, 30, 30, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 6, 6, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 20, 30, 30, 30, 30, 30, 30, 30, 5, 6, 6, 6, 6, 6, 6,
+            },
+            {
+                30, 6, 7, 7, 30, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 5, 5, 5, 5, 5, 30, 30, 6, 5, 7, 6,
+                7, 6, 6, 6, 6, 30, 30, 7, 7, 30, 30, 7, 7, 6, 30, 30, 30, 30, 30, 30, 30, 6, 6, 7, 30, 30, 30, 30, 5, 5, 30, 5,
+                5, 5, 6, 6, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 22, 5, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 6, 5, 30, 5, 5, 5, 5, 5, 5, 30, 30, 30, 5, 5, 5, 30, 5, 5, 5, 5, 30, 30, 30, 5, 5, 30, 5, 30, 5, 5,
+                30, 30, 30, 5, 5, 30, 30, 30, 5, 5, 5, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 7, 7,
+                6, 7, 7, 30, 30, 30, 7, 7, 7, 30, 7, 7, 7, 6, 30, 30, 5, 30, 30, 30, 30, 30, 30, 7, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 11, 22, 22, 22, 22, 22, 22, 20, 22, 30, 30, 30, 30, 30,
+            },
+            {
+                6, 7, 7, 7, 6, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 6, 5, 6, 6,
+                6, 7, 7, 7, 7, 30, 6, 6, 6, 30, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 6, 6, 30, 5, 5, 5, 30, 30, 5, 30, 30,
+                5, 5, 6, 6, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30, 30, 18, 11, 11, 11, 11, 11, 11, 11, 22,
+            },
+            {
+                5, 6, 7, 7, 18, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 30, 30, 6, 5, 7, 6,
+                7, 7, 7, 7, 7, 30, 6, 7, 7, 30, 7, 7, 6, 6, 30, 30, 30, 30, 30, 30, 30, 7, 7, 30, 30, 30, 30, 30, 30, 5, 5, 30,
+                5, 5, 6, 6, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                6, 6, 7, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 5, 7, 7,
+                7, 6, 6, 6, 6, 30, 7, 7, 7, 30, 7, 7, 7, 6, 5, 22, 30, 30, 30, 30, 5, 5, 5, 7, 11, 11, 11, 11, 11, 11, 11, 5,
+                5, 5, 6, 6, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                30, 6, 7, 7, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 6, 30, 30, 30, 30, 7, 7, 7, 6, 6, 6, 30, 6, 30, 7, 7, 7, 7, 7, 7, 7, 7,
+                30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 7, 7, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 6, 6, 6, 6, 6, 6, 6, 30, 30, 30, 30, 20,
+                5, 5, 5, 5, 5, 5, 4, 6, 6, 6, 6, 6, 6, 6, 6, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 5, 5, 30, 5, 30, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 30, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 30, 30,
+                5, 5, 5, 5, 5, 30, 4, 30, 6, 6, 6, 6, 6, 6, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 5, 5, 5, 5,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 22, 22, 22, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 22, 18, 22, 22, 22, 6, 6, 22, 22, 22, 22, 22, 22,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 6, 22, 6, 22, 6, 14, 15, 14, 15, 7, 7,
+                5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+            },
+            {
+                6, 6, 6, 6, 6, 18, 6, 6, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 22, 22,
+                22, 22, 22, 22, 22, 22, 6, 22, 22, 22, 22, 22, 22, 30, 22, 22, 18, 18, 18, 18, 18, 22, 22, 22, 22, 18, 18, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 7, 6, 6, 7, 7, 6, 6, 5,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 18, 18, 18, 18, 5, 5, 5, 5, 5, 5, 7, 7, 6, 6, 5, 5, 5, 5, 6, 6,
+                6, 5, 7, 7, 7, 5, 5, 7, 7, 7, 7, 7, 7, 7, 5, 5, 5, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 6, 7, 7, 6, 6, 7, 7, 7, 7, 7, 7, 6, 5, 7, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 7, 7, 7, 6, 22, 22,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 30, 1, 30, 30, 30, 30, 30, 1, 30, 30, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 18, 4, 2, 2, 2,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 30, 5, 5, 5, 5, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 30,
+                5, 30, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 6, 6, 6,
+                18, 18, 18, 18, 18, 18, 18, 18, 18, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 30, 30, 2, 2, 2, 2, 2, 2, 30, 30,
+            },
+            {
+                13, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 22, 18, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                23, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 14, 15, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 18, 18, 10, 10, 10, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 7, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 7, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 30, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 7,
+                7, 7, 7, 7, 7, 7, 6, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 18, 18, 18, 4, 18, 18, 18, 20, 5, 6, 30, 30,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                18, 18, 18, 18, 18, 18, 13, 18, 18, 18, 18, 6, 6, 6, 27, 6, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30,
+                6, 6, 6, 7, 7, 7, 7, 6, 6, 7, 7, 7, 30, 30, 30, 30, 7, 7, 6, 7, 7, 7, 7, 7, 7, 6, 6, 6, 30, 30, 30, 30,
+                22, 30, 30, 30, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 30, 30, 30, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 7, 7, 6, 30, 30, 18, 18,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 6, 7, 6, 6, 6, 6, 6, 6, 6, 30,
+                6, 7, 6, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 30, 6,
+            },
+            {
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+                18, 18, 18, 18, 18, 18, 18, 4, 18, 18, 18, 18, 18, 18, 30, 30, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                6, 6, 6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 6, 6, 6, 6, 6, 7, 6, 7, 7, 7,
+                7, 7, 6, 7, 7, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 18, 18, 18, 18,
+                18, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 6, 6, 6, 6, 6, 6, 6, 6, 22, 22, 22, 22, 22, 22, 22, 22, 22, 18, 18, 30,
+            },
+            {
+                6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 7, 6, 6, 6, 6, 7, 7, 6, 6, 7, 6, 6, 6, 5, 5, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 6, 7, 6, 6, 7, 7, 7, 6, 7, 6, 6, 6, 7, 7, 30, 30, 30, 30, 30, 30, 30, 30, 18, 18, 18, 18,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 30, 30, 30, 18, 18, 18, 18, 18,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 5, 5, 5, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 18, 18,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 30, 30, 30, 30, 30, 30, 30, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 30, 30, 1, 1, 1,
+                18, 18, 18, 18, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 6, 6, 6, 18, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 7, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 6, 5, 5, 5, 5, 5, 5, 6, 5, 5, 7, 6, 6, 5, 30, 30, 30, 30, 30,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+            },
+            {
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            },
+            {
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 30, 30, 1, 1, 1, 1, 1, 1, 30, 30,
+                2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+                2, 2, 2, 2, 2, 2, 30, 30, 1, 1, 1, 1, 1, 1, 30, 30, 2, 2, 2, 2, 2, 2, 2, 2, 30, 1, 30, 1, 30, 1, 30, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 30, 30,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+                2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 30, 2, 2, 1, 1, 1, 1, 3, 21, 2, 21,
+                21, 21, 2, 2, 2, 30, 2, 2, 1, 1, 1, 1, 3, 21, 21, 21, 2, 2, 2, 2, 30, 30, 2, 2, 1, 1, 1, 1, 30, 21, 21, 21,
+                2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 21, 21, 21, 30, 30, 2, 2, 2, 30, 2, 2, 1, 1, 1, 1, 3, 21, 21, 30,
+            },
+            {
+                23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 27, 27, 27, 27, 27, 13, 13, 13, 13, 13, 13, 18, 18, 16, 17, 14, 16, 16, 17, 14, 16,
+                18, 18, 18, 18, 18, 18, 18, 18, 24, 25, 27, 27, 27, 27, 27, 23, 18, 18, 18, 18, 18, 18, 18, 18, 18, 16, 17, 18, 18, 18, 18, 12,
+                12, 18, 18, 18, 19, 14, 15, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 19, 18, 12, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 23,
+                27, 27, 27, 27, 27, 30, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 11, 4, 30, 30, 11, 11, 11, 11, 11, 11, 19, 19, 19, 14, 15, 4,
+            },
+            {
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 19, 19, 19, 14, 15, 30, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 30, 30, 30,
+                20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+                20, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8,
+                8, 6, 8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 1, 22, 22, 22, 22, 1, 22, 22, 2, 1, 1, 1, 2, 2, 1, 1, 1, 2, 22, 1, 22, 22, 19, 1, 1, 1, 1, 1, 22, 22,
+                22, 22, 22, 22, 1, 22, 1, 22, 1, 22, 1, 1, 1, 1, 22, 2, 1, 1, 1, 1, 2, 5, 5, 5, 5, 2, 22, 22, 2, 2, 1, 1,
+                19, 19, 19, 19, 19, 1, 2, 2, 2, 2, 22, 19, 22, 22, 2, 22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            },
+            {
+                10, 10, 10, 1, 2, 10, 10, 10, 10, 11, 22, 22, 30, 30, 30, 30, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 19, 19, 22, 22, 22, 22,
+                19, 22, 22, 19, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 22, 22, 19, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+            },
+            {
+                19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+                19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+                19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+                19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 14, 15, 14, 15, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                19, 19, 22, 22, 22, 22, 22, 22, 22, 14, 15, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19,
+                19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19,
+                19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            },
+            {
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            },
+            {
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                19, 19, 19, 19, 19, 14, 15, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+                19, 19, 19, 19, 19, 19, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+            },
+            {
+                19, 19, 19, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 19, 19, 19, 19, 19, 19, 19,
+                19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+                19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 14, 15, 14, 15, 19, 19, 19, 19,
+                19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 14, 15, 19, 19,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+                19, 19, 19, 19, 19, 22, 22, 19, 19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                1, 2, 1, 1, 1, 2, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 2, 1, 2, 2, 1, 2, 2, 2, 2, 2, 2, 4, 4, 1, 1,
+            },
+            {
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 2, 22, 22, 22, 22, 22, 22, 1, 2, 1, 2, 6, 6, 6, 1, 2, 30, 30, 30, 30, 30, 18, 18, 18, 18, 11, 18, 18,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 30, 2, 30, 30, 30, 30, 30, 2, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 4, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 6,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30,
+                5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+            },
+            {
+                18, 18, 16, 17, 16, 17, 18, 18, 18, 16, 17, 18, 16, 17, 18, 18, 18, 18, 18, 18, 18, 18, 18, 13, 18, 18, 13, 18, 16, 17, 18, 18,
+                16, 17, 14, 15, 14, 15, 14, 15, 14, 15, 18, 18, 18, 18, 18, 4, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 13, 13, 18, 18, 18, 18,
+                13, 18, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 22, 22, 18, 18, 18, 14, 15, 14, 15, 14, 15, 14, 15, 13, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30,
+            },
+            {
+                23, 18, 18, 18, 22, 4, 5, 10, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 22, 22, 14, 15, 14, 15, 14, 15, 14, 15, 13, 14, 15, 15,
+                22, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 6, 6, 6, 7, 7, 13, 4, 4, 4, 4, 4, 22, 22, 10, 10, 10, 4, 5, 18, 22, 22,
+                30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 6, 6, 21, 21, 4, 4, 5,
+                13, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 4, 4, 4, 5,
+            },
+            {
+                30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 22, 22, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 11, 11, 11, 11, 11, 11, 22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 18, 18,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 18, 18, 18, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 5, 6, 8, 8, 8, 18, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 18, 4,
+            },
+            {
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 4, 4, 6, 6,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 6, 18, 18, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                21, 21, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 4, 2, 2, 2, 2, 2, 2, 2, 2, 1, 2, 1, 2, 1, 1, 2,
+            },
+            {
+                1, 2, 1, 2, 1, 2, 1, 2, 4, 21, 21, 1, 2, 1, 2, 5, 1, 2, 1, 2, 2, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2,
+                1, 2, 1, 2, 1, 1, 1, 1, 2, 1, 2, 30, 30, 30, 30, 30, 1, 2, 30, 2, 30, 2, 1, 2, 1, 2, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 4, 4, 4, 1, 2, 5, 4, 4, 2, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 6, 5, 5, 5, 6, 5, 5, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 7, 7, 6, 6, 7, 22, 22, 22, 22, 6, 30, 30, 30, 11, 11, 11, 11, 11, 11, 22, 22, 20, 22, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                7, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 18, 18, 18, 5, 18, 5, 5, 6,
+            },
+            {
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 18, 18, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 18,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30,
+            },
+            {
+                6, 6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 7, 6, 6, 6, 6, 7, 7, 6, 6, 7, 7,
+                7, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 30, 4, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 18, 18,
+                5, 5, 5, 5, 5, 6, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 5, 5, 5, 5, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 7, 7, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 6, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 18, 18, 18, 18,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 22, 22, 22, 5, 7, 6, 7, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 5, 6, 6, 6, 5, 5, 6, 6, 5, 5, 5, 5, 5, 6, 6,
+                5, 6, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 4, 18, 18,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 6, 6, 7, 7, 18, 18, 5, 4, 4, 7, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 21, 4, 4, 4, 4,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 21, 21, 30, 30, 30, 30, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 7, 7, 6, 7, 7, 6, 7, 7, 18, 7, 6, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30,
+            },
+            {
+                28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+                28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+                28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+                28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+            },
+            {
+                29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+                29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+                29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+                29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 2, 2, 2, 2, 2, 30, 30, 30, 30, 30, 5, 6, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 19, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 30, 5, 30,
+                5, 5, 30, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+                21, 21, 21, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 15, 14,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 20, 22, 22, 22,
+            },
+            {
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 18, 18, 18, 18, 18, 18, 18, 14, 15, 18, 30, 30, 30, 30, 30, 30,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 18, 13, 13, 12, 12, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+                15, 14, 15, 14, 15, 18, 18, 14, 15, 18, 18, 18, 18, 12, 12, 12, 18, 18, 18, 30, 18, 18, 18, 18, 13, 14, 15, 14, 15, 14, 15, 18,
+                18, 18, 19, 13, 19, 19, 19, 30, 18, 20, 18, 18, 30, 30, 30, 30, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 27,
+            },
+            {
+                30, 18, 18, 18, 20, 18, 18, 18, 14, 15, 18, 19, 18, 13, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 19, 19, 19, 18,
+                18, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 18, 15, 21, 12,
+                21, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 19, 15, 19, 14,
+                15, 18, 14, 15, 18, 18, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 4, 4,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30,
+                30, 30, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 30, 30, 30,
+                20, 20, 19, 21, 22, 20, 20, 30, 22, 19, 19, 19, 19, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 27, 27, 27, 22, 22, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30,
+            },
+            {
+                18, 18, 18, 30, 30, 30, 30, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 22, 22, 22, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30,
+                22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 10, 5, 5, 5, 5, 5, 5, 5, 5, 10, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 18,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 18, 10, 10, 10, 10, 10, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 30, 30, 30, 30, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 18, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 30, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 30, 1, 1, 1, 1, 1, 1, 1, 30, 1, 1, 30, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 30, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 30, 2, 2, 2, 2, 2, 2, 2, 30, 2, 2, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                4, 4, 4, 4, 4, 4, 30, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 30, 4, 4, 4, 4, 4, 4, 4, 4, 4, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 30, 30, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 30, 30, 5, 30, 30, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 18, 11, 11, 11, 11, 11, 11, 11, 11,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 22, 22, 11, 11, 11, 11, 11, 11, 11,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30,
+                30, 30, 30, 30, 30, 30, 30, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 30, 30, 30, 30, 11, 11, 11, 11, 11,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 11, 11, 11, 11, 11, 30, 30, 30, 18,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 18,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 11, 11, 5, 5,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            },
+            {
+                5, 6, 6, 6, 30, 6, 6, 30, 30, 30, 30, 30, 6, 6, 6, 6, 5, 5, 5, 5, 30, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 6, 6, 6, 30, 30, 30, 30, 6,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 18, 18, 18, 18, 18, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 11, 18,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 11, 11,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 22, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 6, 6, 30, 30, 30, 30, 11, 11, 11, 11, 11, 18, 18, 18, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 18, 18, 18, 18, 18, 18, 18,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 11, 11, 11, 11, 11, 11, 11, 11,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 11, 11, 11, 11, 11, 11, 11, 11,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 18, 18, 18, 18, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 30, 30, 30, 30, 30, 30, 30, 11, 11, 11, 11, 11, 11,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 6, 6, 13, 30, 30, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 11, 11,
+                11, 11, 11, 11, 11, 11, 11, 5, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 11, 11, 11, 11, 18, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 6, 6, 6, 6, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                7, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 18, 18, 18, 18, 18, 18, 18, 30, 30, 30, 30, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+                11, 11, 11, 11, 11, 11, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 6, 5, 5, 6, 6, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 6,
+            },
+            {
+                6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 7, 7, 6, 6, 18, 18, 27, 18, 18,
+                18, 18, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 27, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 6, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                18, 18, 18, 18, 5, 7, 7, 5, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 18, 18, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                6, 6, 7, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7,
+                7, 5, 5, 5, 5, 18, 18, 18, 18, 6, 6, 6, 6, 18, 7, 6, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 5, 18, 5, 18, 18, 18,
+                30, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 7, 7, 6, 7, 6, 6, 18, 18, 18, 18, 18, 18, 6, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 30, 5, 30, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+                7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                6, 6, 7, 7, 30, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 5, 5, 5, 5, 5, 30, 6, 6, 5, 7, 7,
+                6, 7, 7, 7, 7, 30, 30, 7, 7, 30, 30, 7, 7, 7, 30, 30, 5, 30, 30, 30, 30, 30, 30, 7, 30, 30, 30, 30, 30, 5, 5, 5,
+                5, 5, 7, 7, 30, 30, 6, 6, 6, 6, 6, 6, 6, 30, 30, 30, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6,
+                7, 7, 6, 6, 6, 7, 6, 5, 5, 5, 5, 18, 18, 18, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 30, 18, 6, 5,
+                5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 6, 6, 7, 6, 7, 7, 7, 7, 6,
+                6, 7, 6, 6, 5, 5, 18, 5, 30, 30, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 30, 30, 7, 7, 7, 7, 6, 6, 7, 6,
+                6, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 5, 5, 5, 5, 6, 6, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 6, 7, 6,
+                6, 18, 18, 18, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+                18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 7, 6, 7, 7, 6, 6, 6, 6, 6, 6, 7, 6, 5, 18, 30, 30, 30, 30, 30, 30,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 6, 6, 6,
+                7, 7, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 18, 18, 18, 22,
+                5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 18, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 30, 30, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 7, 7, 7, 30, 7, 7, 30, 30, 6, 6, 7, 6, 5,
+                7, 5, 7, 6, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 6, 6, 6, 6, 30, 30, 6, 6, 7, 7, 7, 7,
+                6, 5, 18, 5, 7, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 7, 5, 6, 6, 6, 6, 18,
+                18, 18, 18, 18, 18, 18, 18, 6, 30, 30, 30, 30, 30, 30, 30, 30, 5, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 6, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 18, 18, 18, 5, 18, 18,
+                18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 6, 6, 6, 6, 6, 6, 6, 30, 6, 6, 6, 6, 6, 6, 7, 6,
+                5, 18, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 11, 11, 11, 11,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 18, 18, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 30, 7, 6, 6, 6, 6, 6, 6, 6, 7, 6, 6, 7, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 30, 30, 30, 6, 30, 6, 6, 30, 6,
+                6, 6, 6, 6, 6, 6, 5, 6, 30, 30, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 30, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 7, 7, 7, 7, 7, 30, 6, 6, 30, 7, 7, 6, 7, 6, 5, 30, 30, 30, 30, 30, 30, 30,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 7, 7, 18, 18, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 20, 20, 20,
+                20, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 18,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 30, 18, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 27, 27, 27, 27, 27, 27, 27, 27, 27, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 18, 18, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 6, 6, 6, 6, 6, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6, 18, 18, 18, 18, 18, 22, 22, 22, 22,
+                4, 4, 4, 4, 18, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 11, 11, 11, 11, 11,
+                11, 11, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 18, 18, 18, 18, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 6, 5, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+            },
+            {
+                7, 7, 7, 7, 7, 7, 7, 7, 30, 30, 30, 30, 30, 30, 30, 6, 6, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                4, 4, 18, 4, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 7, 7, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 4, 4, 4, 4, 30, 4, 4, 4, 4, 4, 4, 4, 30, 4, 4, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 22, 6, 6, 18,
+                27, 27, 27, 27, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 30, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 7, 7, 6, 6, 6, 22, 22, 22, 7, 7, 7, 7, 7, 7, 27, 27, 27, 27, 27, 27, 27, 27, 6, 6, 6, 6, 6,
+            },
+            {
+                6, 6, 6, 22, 22, 6, 6, 6, 6, 6, 6, 6, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 6, 6, 6, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 6, 6, 6, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 30, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 30, 1, 1,
+                30, 30, 1, 30, 30, 1, 1, 30, 30, 1, 1, 1, 1, 30, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 30, 2, 30, 2, 2, 2,
+                2, 2, 2, 2, 30, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 1, 1, 30, 1, 1, 1, 1, 30, 30, 1, 1, 1, 1, 1, 1, 1, 1, 30, 1, 1, 1, 1, 1, 1, 1, 30, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 30, 1, 1, 1, 1, 30,
+                1, 1, 1, 1, 1, 30, 1, 30, 30, 30, 1, 1, 1, 1, 1, 1, 1, 30, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 30, 30, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 19, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19, 2, 2, 2, 2,
+                2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 19, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 19, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 19, 2, 2, 2, 2, 2, 2, 1, 2, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            },
+            {
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 22, 22, 22, 22, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 22, 22, 22, 22, 22, 22, 22, 22, 6, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 6, 22, 22, 18, 18, 18, 18, 18, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 6, 6, 6, 6, 6,
+                30, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                6, 6, 6, 6, 6, 6, 6, 30, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 30, 6, 6, 6, 6, 6,
+                6, 6, 30, 6, 6, 30, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 6, 6, 6, 6, 6, 6, 6, 4, 4, 4, 4, 4, 4, 4, 30, 30,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 5, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 20,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 30, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 30, 30, 11, 11, 11, 11, 11, 11, 11, 11, 11, 6, 6, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 6, 6, 6, 6, 6, 6, 6, 4, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 18, 18,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+            },
+            {
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 11, 11, 11, 20, 11, 11, 11, 11, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                30, 5, 5, 30, 5, 30, 30, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 30, 5, 30, 5, 30, 30, 30, 30,
+                30, 30, 5, 30, 30, 30, 30, 5, 30, 5, 30, 5, 30, 5, 5, 5, 30, 5, 5, 30, 5, 30, 30, 5, 30, 5, 30, 5, 30, 5, 30, 5,
+                30, 5, 5, 30, 5, 30, 30, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 30, 5, 5, 5, 5, 30, 5, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30,
+                30, 5, 5, 5, 30, 5, 5, 5, 5, 5, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 19, 19, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 21, 21, 21, 21,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 22, 22, 22, 22, 22, 30, 30, 30, 22, 22, 22, 22, 22, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30,
+                22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30,
+                22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+                22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+                5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                30, 27, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+                27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+                27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+                27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+            },
+            {
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+            },
+            {
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+            },
+            {
+                29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+                29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+                29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+                29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 30, 30,
+            },
         };
+        // end generated general_category
 
         enum class numeric_type
         {
@@ -2945,939 +3804,1229 @@ namespace u32
             Numeric,
         };
 
-        const std::unordered_map<char32_t, numeric_type> numeric_types
+        // Numeric type of each code point as its numeric_type enumerator.
+        constexpr uint8_t numeric_type_blocks[]
         {
-            {0x30, numeric_type::Decimal},    {0x31, numeric_type::Decimal},
-            {0x32, numeric_type::Decimal},    {0x33, numeric_type::Decimal},
-            {0x34, numeric_type::Decimal},    {0x35, numeric_type::Decimal},
-            {0x36, numeric_type::Decimal},    {0x37, numeric_type::Decimal},
-            {0x38, numeric_type::Decimal},    {0x39, numeric_type::Decimal},
-            {0xb2, numeric_type::Digit},      {0xb3, numeric_type::Digit},
-            {0xb9, numeric_type::Digit},      {0xbc, numeric_type::Numeric},
-            {0xbd, numeric_type::Numeric},    {0xbe, numeric_type::Numeric},
-            {0x660, numeric_type::Decimal},   {0x661, numeric_type::Decimal},
-            {0x662, numeric_type::Decimal},   {0x663, numeric_type::Decimal},
-            {0x664, numeric_type::Decimal},   {0x665, numeric_type::Decimal},
-            {0x666, numeric_type::Decimal},   {0x667, numeric_type::Decimal},
-            {0x668, numeric_type::Decimal},   {0x669, numeric_type::Decimal},
-            {0x6f0, numeric_type::Decimal},   {0x6f1, numeric_type::Decimal},
-            {0x6f2, numeric_type::Decimal},   {0x6f3, numeric_type::Decimal},
-            {0x6f4, numeric_type::Decimal},   {0x6f5, numeric_type::Decimal},
-            {0x6f6, numeric_type::Decimal},   {0x6f7, numeric_type::Decimal},
-            {0x6f8, numeric_type::Decimal},   {0x6f9, numeric_type::Decimal},
-            {0x7c0, numeric_type::Decimal},   {0x7c1, numeric_type::Decimal},
-            {0x7c2, numeric_type::Decimal},   {0x7c3, numeric_type::Decimal},
-            {0x7c4, numeric_type::Decimal},   {0x7c5, numeric_type::Decimal},
-            {0x7c6, numeric_type::Decimal},   {0x7c7, numeric_type::Decimal},
-            {0x7c8, numeric_type::Decimal},   {0x7c9, numeric_type::Decimal},
-            {0x966, numeric_type::Decimal},   {0x967, numeric_type::Decimal},
-            {0x968, numeric_type::Decimal},   {0x969, numeric_type::Decimal},
-            {0x96a, numeric_type::Decimal},   {0x96b, numeric_type::Decimal},
-            {0x96c, numeric_type::Decimal},   {0x96d, numeric_type::Decimal},
-            {0x96e, numeric_type::Decimal},   {0x96f, numeric_type::Decimal},
-            {0x9e6, numeric_type::Decimal},   {0x9e7, numeric_type::Decimal},
-            {0x9e8, numeric_type::Decimal},   {0x9e9, numeric_type::Decimal},
-            {0x9ea, numeric_type::Decimal},   {0x9eb, numeric_type::Decimal},
-            {0x9ec, numeric_type::Decimal},   {0x9ed, numeric_type::Decimal},
-            {0x9ee, numeric_type::Decimal},   {0x9ef, numeric_type::Decimal},
-            {0x9f4, numeric_type::Numeric},   {0x9f5, numeric_type::Numeric},
-            {0x9f6, numeric_type::Numeric},   {0x9f7, numeric_type::Numeric},
-            {0x9f8, numeric_type::Numeric},   {0x9f9, numeric_type::Numeric},
-            {0xa66, numeric_type::Decimal},   {0xa67, numeric_type::Decimal},
-            {0xa68, numeric_type::Decimal},   {0xa69, numeric_type::Decimal},
-            {0xa6a, numeric_type::Decimal},   {0xa6b, numeric_type::Decimal},
-            {0xa6c, numeric_type::Decimal},   {0xa6d, numeric_type::Decimal},
-            {0xa6e, numeric_type::Decimal},   {0xa6f, numeric_type::Decimal},
-            {0xae6, numeric_type::Decimal},   {0xae7, numeric_type::Decimal},
-            {0xae8, numeric_type::Decimal},   {0xae9, numeric_type::Decimal},
-            {0xaea, numeric_type::Decimal},   {0xaeb, numeric_type::Decimal},
-            {0xaec, numeric_type::Decimal},   {0xaed, numeric_type::Decimal},
-            {0xaee, numeric_type::Decimal},   {0xaef, numeric_type::Decimal},
-            {0xb66, numeric_type::Decimal},   {0xb67, numeric_type::Decimal},
-            {0xb68, numeric_type::Decimal},   {0xb69, numeric_type::Decimal},
-            {0xb6a, numeric_type::Decimal},   {0xb6b, numeric_type::Decimal},
-            {0xb6c, numeric_type::Decimal},   {0xb6d, numeric_type::Decimal},
-            {0xb6e, numeric_type::Decimal},   {0xb6f, numeric_type::Decimal},
-            {0xb72, numeric_type::Numeric},   {0xb73, numeric_type::Numeric},
-            {0xb74, numeric_type::Numeric},   {0xb75, numeric_type::Numeric},
-            {0xb76, numeric_type::Numeric},   {0xb77, numeric_type::Numeric},
-            {0xbe6, numeric_type::Decimal},   {0xbe7, numeric_type::Decimal},
-            {0xbe8, numeric_type::Decimal},   {0xbe9, numeric_type::Decimal},
-            {0xbea, numeric_type::Decimal},   {0xbeb, numeric_type::Decimal},
-            {0xbec, numeric_type::Decimal},   {0xbed, numeric_type::Decimal},
-            {0xbee, numeric_type::Decimal},   {0xbef, numeric_type::Decimal},
-            {0xbf0, numeric_type::Numeric},   {0xbf1, numeric_type::Numeric},
-            {0xbf2, numeric_type::Numeric},   {0xc66, numeric_type::Decimal},
-            {0xc67, numeric_type::Decimal},   {0xc68, numeric_type::Decimal},
-            {0xc69, numeric_type::Decimal},   {0xc6a, numeric_type::Decimal},
-            {0xc6b, numeric_type::Decimal},   {0xc6c, numeric_type::Decimal},
-            {0xc6d, numeric_type::Decimal},   {0xc6e, numeric_type::Decimal},
-            {0xc6f, numeric_type::Decimal},   {0xc78, numeric_type::Numeric},
-            {0xc79, numeric_type::Numeric},   {0xc7a, numeric_type::Numeric},
-            {0xc7b, numeric_type::Numeric},   {0xc7c, numeric_type::Numeric},
-            {0xc7d, numeric_type::Numeric},   {0xc7e, numeric_type::Numeric},
-            {0xce6, numeric_type::Decimal},   {0xce7, numeric_type::Decimal},
-            {0xce8, numeric_type::Decimal},   {0xce9, numeric_type::Decimal},
-            {0xcea, numeric_type::Decimal},   {0xceb, numeric_type::Decimal},
-            {0xcec, numeric_type::Decimal},   {0xced, numeric_type::Decimal},
-            {0xcee, numeric_type::Decimal},   {0xcef, numeric_type::Decimal},
-            {0xd58, numeric_type::Numeric},   {0xd59, numeric_type::Numeric},
-            {0xd5a, numeric_type::Numeric},   {0xd5b, numeric_type::Numeric},
-            {0xd5c, numeric_type::Numeric},   {0xd5d, numeric_type::Numeric},
-            {0xd5e, numeric_type::Numeric},   {0xd66, numeric_type::Decimal},
-            {0xd67, numeric_type::Decimal},   {0xd68, numeric_type::Decimal},
-            {0xd69, numeric_type::Decimal},   {0xd6a, numeric_type::Decimal},
-            {0xd6b, numeric_type::Decimal},   {0xd6c, numeric_type::Decimal},
-            {0xd6d, numeric_type::Decimal},   {0xd6e, numeric_type::Decimal},
-            {0xd6f, numeric_type::Decimal},   {0xd70, numeric_type::Numeric},
-            {0xd71, numeric_type::Numeric},   {0xd72, numeric_type::Numeric},
-            {0xd73, numeric_type::Numeric},   {0xd74, numeric_type::Numeric},
-            {0xd75, numeric_type::Numeric},   {0xd76, numeric_type::Numeric},
-            {0xd77, numeric_type::Numeric},   {0xd78, numeric_type::Numeric},
-            {0xde6, numeric_type::Decimal},   {0xde7, numeric_type::Decimal},
-            {0xde8, numeric_type::Decimal},   {0xde9, numeric_type::Decimal},
-            {0xdea, numeric_type::Decimal},   {0xdeb, numeric_type::Decimal},
-            {0xdec, numeric_type::Decimal},   {0xded, numeric_type::Decimal},
-            {0xdee, numeric_type::Decimal},   {0xdef, numeric_type::Decimal},
-            {0xe50, numeric_type::Decimal},   {0xe51, numeric_type::Decimal},
-            {0xe52, numeric_type::Decimal},   {0xe53, numeric_type::Decimal},
-            {0xe54, numeric_type::Decimal},   {0xe55, numeric_type::Decimal},
-            {0xe56, numeric_type::Decimal},   {0xe57, numeric_type::Decimal},
-            {0xe58, numeric_type::Decimal},   {0xe59, numeric_type::Decimal},
-            {0xed0, numeric_type::Decimal},   {0xed1, numeric_type::Decimal},
-            {0xed2, numeric_type::Decimal},   {0xed3, numeric_type::Decimal},
-            {0xed4, numeric_type::Decimal},   {0xed5, numeric_type::Decimal},
-            {0xed6, numeric_type::Decimal},   {0xed7, numeric_type::Decimal},
-            {0xed8, numeric_type::Decimal},   {0xed9, numeric_type::Decimal},
-            {0xf20, numeric_type::Decimal},   {0xf21, numeric_type::Decimal},
-            {0xf22, numeric_type::Decimal},   {0xf23, numeric_type::Decimal},
-            {0xf24, numeric_type::Decimal},   {0xf25, numeric_type::Decimal},
-            {0xf26, numeric_type::Decimal},   {0xf27, numeric_type::Decimal},
-            {0xf28, numeric_type::Decimal},   {0xf29, numeric_type::Decimal},
-            {0xf2a, numeric_type::Numeric},   {0xf2b, numeric_type::Numeric},
-            {0xf2c, numeric_type::Numeric},   {0xf2d, numeric_type::Numeric},
-            {0xf2e, numeric_type::Numeric},   {0xf2f, numeric_type::Numeric},
-            {0xf30, numeric_type::Numeric},   {0xf31, numeric_type::Numeric},
-            {0xf32, numeric_type::Numeric},   {0xf33, numeric_type::Numeric},
-            {0x1040, numeric_type::Decimal},  {0x1041, numeric_type::Decimal},
-            {0x1042, numeric_type::Decimal},  {0x1043, numeric_type::Decimal},
-            {0x1044, numeric_type::Decimal},  {0x1045, numeric_type::Decimal},
-            {0x1046, numeric_type::Decimal},  {0x1047, numeric_type::Decimal},
-            {0x1048, numeric_type::Decimal},  {0x1049, numeric_type::Decimal},
-            {0x1090, numeric_type::Decimal},  {0x1091, numeric_type::Decimal},
-            {0x1092, numeric_type::Decimal},  {0x1093, numeric_type::Decimal},
-            {0x1094, numeric_type::Decimal},  {0x1095, numeric_type::Decimal},
-            {0x1096, numeric_type::Decimal},  {0x1097, numeric_type::Decimal},
-            {0x1098, numeric_type::Decimal},  {0x1099, numeric_type::Decimal},
-            {0x1369, numeric_type::Digit},    {0x136a, numeric_type::Digit},
-            {0x136b, numeric_type::Digit},    {0x136c, numeric_type::Digit},
-            {0x136d, numeric_type::Digit},    {0x136e, numeric_type::Digit},
-            {0x136f, numeric_type::Digit},    {0x1370, numeric_type::Digit},
-            {0x1371, numeric_type::Digit},    {0x1372, numeric_type::Numeric},
-            {0x1373, numeric_type::Numeric},  {0x1374, numeric_type::Numeric},
-            {0x1375, numeric_type::Numeric},  {0x1376, numeric_type::Numeric},
-            {0x1377, numeric_type::Numeric},  {0x1378, numeric_type::Numeric},
-            {0x1379, numeric_type::Numeric},  {0x137a, numeric_type::Numeric},
-            {0x137b, numeric_type::Numeric},  {0x137c, numeric_type::Numeric},
-            {0x16ee, numeric_type::Numeric},  {0x16ef, numeric_type::Numeric},
-            {0x16f0, numeric_type::Numeric},  {0x17e0, numeric_type::Decimal},
-            {0x17e1, numeric_type::Decimal},  {0x17e2, numeric_type::Decimal},
-            {0x17e3, numeric_type::Decimal},  {0x17e4, numeric_type::Decimal},
-            {0x17e5, numeric_type::Decimal},  {0x17e6, numeric_type::Decimal},
-            {0x17e7, numeric_type::Decimal},  {0x17e8, numeric_type::Decimal},
-            {0x17e9, numeric_type::Decimal},  {0x17f0, numeric_type::Numeric},
-            {0x17f1, numeric_type::Numeric},  {0x17f2, numeric_type::Numeric},
-            {0x17f3, numeric_type::Numeric},  {0x17f4, numeric_type::Numeric},
-            {0x17f5, numeric_type::Numeric},  {0x17f6, numeric_type::Numeric},
-            {0x17f7, numeric_type::Numeric},  {0x17f8, numeric_type::Numeric},
-            {0x17f9, numeric_type::Numeric},  {0x1810, numeric_type::Decimal},
-            {0x1811, numeric_type::Decimal},  {0x1812, numeric_type::Decimal},
-            {0x1813, numeric_type::Decimal},  {0x1814, numeric_type::Decimal},
-            {0x1815, numeric_type::Decimal},  {0x1816, numeric_type::Decimal},
-            {0x1817, numeric_type::Decimal},  {0x1818, numeric_type::Decimal},
-            {0x1819, numeric_type::Decimal},  {0x1946, numeric_type::Decimal},
-            {0x1947, numeric_type::Decimal},  {0x1948, numeric_type::Decimal},
-            {0x1949, numeric_type::Decimal},  {0x194a, numeric_type::Decimal},
-            {0x194b, numeric_type::Decimal},  {0x194c, numeric_type::Decimal},
-            {0x194d, numeric_type::Decimal},  {0x194e, numeric_type::Decimal},
-            {0x194f, numeric_type::Decimal},  {0x19d0, numeric_type::Decimal},
-            {0x19d1, numeric_type::Decimal},  {0x19d2, numeric_type::Decimal},
-            {0x19d3, numeric_type::Decimal},  {0x19d4, numeric_type::Decimal},
-            {0x19d5, numeric_type::Decimal},  {0x19d6, numeric_type::Decimal},
-            {0x19d7, numeric_type::Decimal},  {0x19d8, numeric_type::Decimal},
-            {0x19d9, numeric_type::Decimal},  {0x19da, numeric_type::Digit},
-            {0x1a80, numeric_type::Decimal},  {0x1a81, numeric_type::Decimal},
-            {0x1a82, numeric_type::Decimal},  {0x1a83, numeric_type::Decimal},
-            {0x1a84, numeric_type::Decimal},  {0x1a85, numeric_type::Decimal},
-            {0x1a86, numeric_type::Decimal},  {0x1a87, numeric_type::Decimal},
-            {0x1a88, numeric_type::Decimal},  {0x1a89, numeric_type::Decimal},
-            {0x1a90, numeric_type::Decimal},  {0x1a91, numeric_type::Decimal},
-            {0x1a92, numeric_type::Decimal},  {0x1a93, numeric_type::Decimal},
-            {0x1a94, numeric_type::Decimal},  {0x1a95, numeric_type::Decimal},
-            {0x1a96, numeric_type::Decimal},  {0x1a97, numeric_type::Decimal},
-            {0x1a98, numeric_type::Decimal},  {0x1a99, numeric_type::Decimal},
-            {0x1b50, numeric_type::Decimal},  {0x1b51, numeric_type::Decimal},
-            {0x1b52, numeric_type::Decimal},  {0x1b53, numeric_type::Decimal},
-            {0x1b54, numeric_type::Decimal},  {0x1b55, numeric_type::Decimal},
-            {0x1b56, numeric_type::Decimal},  {0x1b57, numeric_type::Decimal},
-            {0x1b58, numeric_type::Decimal},  {0x1b59, numeric_type::Decimal},
-            {0x1bb0, numeric_type::Decimal},  {0x1bb1, numeric_type::Decimal},
-            {0x1bb2, numeric_type::Decimal},  {0x1bb3, numeric_type::Decimal},
-            {0x1bb4, numeric_type::Decimal},  {0x1bb5, numeric_type::Decimal},
-            {0x1bb6, numeric_type::Decimal},  {0x1bb7, numeric_type::Decimal},
-            {0x1bb8, numeric_type::Decimal},  {0x1bb9, numeric_type::Decimal},
-            {0x1c40, numeric_type::Decimal},  {0x1c41, numeric_type::Decimal},
-            {0x1c42, numeric_type::Decimal},  {0x1c43, numeric_type::Decimal},
-            {0x1c44, numeric_type::Decimal},  {0x1c45, numeric_type::Decimal},
-            {0x1c46, numeric_type::Decimal},  {0x1c47, numeric_type::Decimal},
-            {0x1c48, numeric_type::Decimal},  {0x1c49, numeric_type::Decimal},
-            {0x1c50, numeric_type::Decimal},  {0x1c51, numeric_type::Decimal},
-            {0x1c52, numeric_type::Decimal},  {0x1c53, numeric_type::Decimal},
-            {0x1c54, numeric_type::Decimal},  {0x1c55, numeric_type::Decimal},
-            {0x1c56, numeric_type::Decimal},  {0x1c57, numeric_type::Decimal},
-            {0x1c58, numeric_type::Decimal},  {0x1c59, numeric_type::Decimal},
-            {0x2070, numeric_type::Digit},    {0x2074, numeric_type::Digit},
-            {0x2075, numeric_type::Digit},    {0x2076, numeric_type::Digit},
-            {0x2077, numeric_type::Digit},    {0x2078, numeric_type::Digit},
-            {0x2079, numeric_type::Digit},    {0x2080, numeric_type::Digit},
-            {0x2081, numeric_type::Digit},    {0x2082, numeric_type::Digit},
-            {0x2083, numeric_type::Digit},    {0x2084, numeric_type::Digit},
-            {0x2085, numeric_type::Digit},    {0x2086, numeric_type::Digit},
-            {0x2087, numeric_type::Digit},    {0x2088, numeric_type::Digit},
-            {0x2089, numeric_type::Digit},    {0x2150, numeric_type::Numeric},
-            {0x2151, numeric_type::Numeric},  {0x2152, numeric_type::Numeric},
-            {0x2153, numeric_type::Numeric},  {0x2154, numeric_type::Numeric},
-            {0x2155, numeric_type::Numeric},  {0x2156, numeric_type::Numeric},
-            {0x2157, numeric_type::Numeric},  {0x2158, numeric_type::Numeric},
-            {0x2159, numeric_type::Numeric},  {0x215a, numeric_type::Numeric},
-            {0x215b, numeric_type::Numeric},  {0x215c, numeric_type::Numeric},
-            {0x215d, numeric_type::Numeric},  {0x215e, numeric_type::Numeric},
-            {0x215f, numeric_type::Numeric},  {0x2160, numeric_type::Numeric},
-            {0x2161, numeric_type::Numeric},  {0x2162, numeric_type::Numeric},
-            {0x2163, numeric_type::Numeric},  {0x2164, numeric_type::Numeric},
-            {0x2165, numeric_type::Numeric},  {0x2166, numeric_type::Numeric},
-            {0x2167, numeric_type::Numeric},  {0x2168, numeric_type::Numeric},
-            {0x2169, numeric_type::Numeric},  {0x216a, numeric_type::Numeric},
-            {0x216b, numeric_type::Numeric},  {0x216c, numeric_type::Numeric},
-            {0x216d, numeric_type::Numeric},  {0x216e, numeric_type::Numeric},
-            {0x216f, numeric_type::Numeric},  {0x2170, numeric_type::Numeric},
-            {0x2171, numeric_type::Numeric},  {0x2172, numeric_type::Numeric},
-            {0x2173, numeric_type::Numeric},  {0x2174, numeric_type::Numeric},
-            {0x2175, numeric_type::Numeric},  {0x2176, numeric_type::Numeric},
-            {0x2177, numeric_type::Numeric},  {0x2178, numeric_type::Numeric},
-            {0x2179, numeric_type::Numeric},  {0x217a, numeric_type::Numeric},
-            {0x217b, numeric_type::Numeric},  {0x217c, numeric_type::Numeric},
-            {0x217d, numeric_type::Numeric},  {0x217e, numeric_type::Numeric},
-            {0x217f, numeric_type::Numeric},  {0x2180, numeric_type::Numeric},
-            {0x2181, numeric_type::Numeric},  {0x2182, numeric_type::Numeric},
-            {0x2185, numeric_type::Numeric},  {0x2186, numeric_type::Numeric},
-            {0x2187, numeric_type::Numeric},  {0x2188, numeric_type::Numeric},
-            {0x2189, numeric_type::Numeric},  {0x2460, numeric_type::Digit},
-            {0x2461, numeric_type::Digit},    {0x2462, numeric_type::Digit},
-            {0x2463, numeric_type::Digit},    {0x2464, numeric_type::Digit},
-            {0x2465, numeric_type::Digit},    {0x2466, numeric_type::Digit},
-            {0x2467, numeric_type::Digit},    {0x2468, numeric_type::Digit},
-            {0x2469, numeric_type::Numeric},  {0x246a, numeric_type::Numeric},
-            {0x246b, numeric_type::Numeric},  {0x246c, numeric_type::Numeric},
-            {0x246d, numeric_type::Numeric},  {0x246e, numeric_type::Numeric},
-            {0x246f, numeric_type::Numeric},  {0x2470, numeric_type::Numeric},
-            {0x2471, numeric_type::Numeric},  {0x2472, numeric_type::Numeric},
-            {0x2473, numeric_type::Numeric},  {0x2474, numeric_type::Digit},
-            {0x2475, numeric_type::Digit},    {0x2476, numeric_type::Digit},
-            {0x2477, numeric_type::Digit},    {0x2478, numeric_type::Digit},
-            {0x2479, numeric_type::Digit},    {0x247a, numeric_type::Digit},
-            {0x247b, numeric_type::Digit},    {0x247c, numeric_type::Digit},
-            {0x247d, numeric_type::Numeric},  {0x247e, numeric_type::Numeric},
-            {0x247f, numeric_type::Numeric},  {0x2480, numeric_type::Numeric},
-            {0x2481, numeric_type::Numeric},  {0x2482, numeric_type::Numeric},
-            {0x2483, numeric_type::Numeric},  {0x2484, numeric_type::Numeric},
-            {0x2485, numeric_type::Numeric},  {0x2486, numeric_type::Numeric},
-            {0x2487, numeric_type::Numeric},  {0x2488, numeric_type::Digit},
-            {0x2489, numeric_type::Digit},    {0x248a, numeric_type::Digit},
-            {0x248b, numeric_type::Digit},    {0x248c, numeric_type::Digit},
-            {0x248d, numeric_type::Digit},    {0x248e, numeric_type::Digit},
-            {0x248f, numeric_type::Digit},    {0x2490, numeric_type::Digit},
-            {0x2491, numeric_type::Numeric},  {0x2492, numeric_type::Numeric},
-            {0x2493, numeric_type::Numeric},  {0x2494, numeric_type::Numeric},
-            {0x2495, numeric_type::Numeric},  {0x2496, numeric_type::Numeric},
-            {0x2497, numeric_type::Numeric},  {0x2498, numeric_type::Numeric},
-            {0x2499, numeric_type::Numeric},  {0x249a, numeric_type::Numeric},
-            {0x249b, numeric_type::Numeric},  {0x24ea, numeric_type::Digit},
-            {0x24eb, numeric_type::Numeric},  {0x24ec, numeric_type::Numeric},
-            {0x24ed, numeric_type::Numeric},  {0x24ee, numeric_type::Numeric},
-            {0x24ef, numeric_type::Numeric},  {0x24f0, numeric_type::Numeric},
-            {0x24f1, numeric_type::Numeric},  {0x24f2, numeric_type::Numeric},
-            {0x24f3, numeric_type::Numeric},  {0x24f4, numeric_type::Numeric},
-            {0x24f5, numeric_type::Digit},    {0x24f6, numeric_type::Digit},
-            {0x24f7, numeric_type::Digit},    {0x24f8, numeric_type::Digit},
-            {0x24f9, numeric_type::Digit},    {0x24fa, numeric_type::Digit},
-            {0x24fb, numeric_type::Digit},    {0x24fc, numeric_type::Digit},
-            {0x24fd, numeric_type::Digit},    {0x24fe, numeric_type::Numeric},
-            {0x24ff, numeric_type::Digit},    {0x2776, numeric_type::Digit},
-            {0x2777, numeric_type::Digit},    {0x2778, numeric_type::Digit},
-            {0x2779, numeric_type::Digit},    {0x277a, numeric_type::Digit},
-            {0x277b, numeric_type::Digit},    {0x277c, numeric_type::Digit},
-            {0x277d, numeric_type::Digit},    {0x277e, numeric_type::Digit},
-            {0x277f, numeric_type::Numeric},  {0x2780, numeric_type::Digit},
-            {0x2781, numeric_type::Digit},    {0x2782, numeric_type::Digit},
-            {0x2783, numeric_type::Digit},    {0x2784, numeric_type::Digit},
-            {0x2785, numeric_type::Digit},    {0x2786, numeric_type::Digit},
-            {0x2787, numeric_type::Digit},    {0x2788, numeric_type::Digit},
-            {0x2789, numeric_type::Numeric},  {0x278a, numeric_type::Digit},
-            {0x278b, numeric_type::Digit},    {0x278c, numeric_type::Digit},
-            {0x278d, numeric_type::Digit},    {0x278e, numeric_type::Digit},
-            {0x278f, numeric_type::Digit},    {0x2790, numeric_type::Digit},
-            {0x2791, numeric_type::Digit},    {0x2792, numeric_type::Digit},
-            {0x2793, numeric_type::Numeric},  {0x2cfd, numeric_type::Numeric},
-            {0x3007, numeric_type::Numeric},  {0x3021, numeric_type::Numeric},
-            {0x3022, numeric_type::Numeric},  {0x3023, numeric_type::Numeric},
-            {0x3024, numeric_type::Numeric},  {0x3025, numeric_type::Numeric},
-            {0x3026, numeric_type::Numeric},  {0x3027, numeric_type::Numeric},
-            {0x3028, numeric_type::Numeric},  {0x3029, numeric_type::Numeric},
-            {0x3038, numeric_type::Numeric},  {0x3039, numeric_type::Numeric},
-            {0x303a, numeric_type::Numeric},  {0x3192, numeric_type::Numeric},
-            {0x3193, numeric_type::Numeric},  {0x3194, numeric_type::Numeric},
-            {0x3195, numeric_type::Numeric},  {0x3220, numeric_type::Numeric},
-            {0x3221, numeric_type::Numeric},  {0x3222, numeric_type::Numeric},
-            {0x3223, numeric_type::Numeric},  {0x3224, numeric_type::Numeric},
-            {0x3225, numeric_type::Numeric},  {0x3226, numeric_type::Numeric},
-            {0x3227, numeric_type::Numeric},  {0x3228, numeric_type::Numeric},
-            {0x3229, numeric_type::Numeric},  {0x3248, numeric_type::Numeric},
-            {0x3249, numeric_type::Numeric},  {0x324a, numeric_type::Numeric},
-            {0x324b, numeric_type::Numeric},  {0x324c, numeric_type::Numeric},
-            {0x324d, numeric_type::Numeric},  {0x324e, numeric_type::Numeric},
-            {0x324f, numeric_type::Numeric},  {0x3251, numeric_type::Numeric},
-            {0x3252, numeric_type::Numeric},  {0x3253, numeric_type::Numeric},
-            {0x3254, numeric_type::Numeric},  {0x3255, numeric_type::Numeric},
-            {0x3256, numeric_type::Numeric},  {0x3257, numeric_type::Numeric},
-            {0x3258, numeric_type::Numeric},  {0x3259, numeric_type::Numeric},
-            {0x325a, numeric_type::Numeric},  {0x325b, numeric_type::Numeric},
-            {0x325c, numeric_type::Numeric},  {0x325d, numeric_type::Numeric},
-            {0x325e, numeric_type::Numeric},  {0x325f, numeric_type::Numeric},
-            {0x3280, numeric_type::Numeric},  {0x3281, numeric_type::Numeric},
-            {0x3282, numeric_type::Numeric},  {0x3283, numeric_type::Numeric},
-            {0x3284, numeric_type::Numeric},  {0x3285, numeric_type::Numeric},
-            {0x3286, numeric_type::Numeric},  {0x3287, numeric_type::Numeric},
-            {0x3288, numeric_type::Numeric},  {0x3289, numeric_type::Numeric},
-            {0x32b1, numeric_type::Numeric},  {0x32b2, numeric_type::Numeric},
-            {0x32b3, numeric_type::Numeric},  {0x32b4, numeric_type::Numeric},
-            {0x32b5, numeric_type::Numeric},  {0x32b6, numeric_type::Numeric},
-            {0x32b7, numeric_type::Numeric},  {0x32b8, numeric_type::Numeric},
-            {0x32b9, numeric_type::Numeric},  {0x32ba, numeric_type::Numeric},
-            {0x32bb, numeric_type::Numeric},  {0x32bc, numeric_type::Numeric},
-            {0x32bd, numeric_type::Numeric},  {0x32be, numeric_type::Numeric},
-            {0x32bf, numeric_type::Numeric},  {0x3405, numeric_type::Numeric},
-            {0x3483, numeric_type::Numeric},  {0x382a, numeric_type::Numeric},
-            {0x3b4d, numeric_type::Numeric},  {0x4e00, numeric_type::Numeric},
-            {0x4e03, numeric_type::Numeric},  {0x4e07, numeric_type::Numeric},
-            {0x4e09, numeric_type::Numeric},  {0x4e5d, numeric_type::Numeric},
-            {0x4e8c, numeric_type::Numeric},  {0x4e94, numeric_type::Numeric},
-            {0x4e96, numeric_type::Numeric},  {0x4ebf, numeric_type::Numeric},
-            {0x4ec0, numeric_type::Numeric},  {0x4edf, numeric_type::Numeric},
-            {0x4ee8, numeric_type::Numeric},  {0x4f0d, numeric_type::Numeric},
-            {0x4f70, numeric_type::Numeric},  {0x5104, numeric_type::Numeric},
-            {0x5146, numeric_type::Numeric},  {0x5169, numeric_type::Numeric},
-            {0x516b, numeric_type::Numeric},  {0x516d, numeric_type::Numeric},
-            {0x5341, numeric_type::Numeric},  {0x5343, numeric_type::Numeric},
-            {0x5344, numeric_type::Numeric},  {0x5345, numeric_type::Numeric},
-            {0x534c, numeric_type::Numeric},  {0x53c1, numeric_type::Numeric},
-            {0x53c2, numeric_type::Numeric},  {0x53c3, numeric_type::Numeric},
-            {0x53c4, numeric_type::Numeric},  {0x56db, numeric_type::Numeric},
-            {0x58f1, numeric_type::Numeric},  {0x58f9, numeric_type::Numeric},
-            {0x5e7a, numeric_type::Numeric},  {0x5efe, numeric_type::Numeric},
-            {0x5eff, numeric_type::Numeric},  {0x5f0c, numeric_type::Numeric},
-            {0x5f0d, numeric_type::Numeric},  {0x5f0e, numeric_type::Numeric},
-            {0x5f10, numeric_type::Numeric},  {0x62fe, numeric_type::Numeric},
-            {0x634c, numeric_type::Numeric},  {0x67d2, numeric_type::Numeric},
-            {0x6f06, numeric_type::Numeric},  {0x7396, numeric_type::Numeric},
-            {0x767e, numeric_type::Numeric},  {0x8086, numeric_type::Numeric},
-            {0x842c, numeric_type::Numeric},  {0x8cae, numeric_type::Numeric},
-            {0x8cb3, numeric_type::Numeric},  {0x8d30, numeric_type::Numeric},
-            {0x9621, numeric_type::Numeric},  {0x9646, numeric_type::Numeric},
-            {0x964c, numeric_type::Numeric},  {0x9678, numeric_type::Numeric},
-            {0x96f6, numeric_type::Numeric},  {0xa620, numeric_type::Decimal},
-            {0xa621, numeric_type::Decimal},  {0xa622, numeric_type::Decimal},
-            {0xa623, numeric_type::Decimal},  {0xa624, numeric_type::Decimal},
-            {0xa625, numeric_type::Decimal},  {0xa626, numeric_type::Decimal},
-            {0xa627, numeric_type::Decimal},  {0xa628, numeric_type::Decimal},
-            {0xa629, numeric_type::Decimal},  {0xa6e6, numeric_type::Numeric},
-            {0xa6e7, numeric_type::Numeric},  {0xa6e8, numeric_type::Numeric},
-            {0xa6e9, numeric_type::Numeric},  {0xa6ea, numeric_type::Numeric},
-            {0xa6eb, numeric_type::Numeric},  {0xa6ec, numeric_type::Numeric},
-            {0xa6ed, numeric_type::Numeric},  {0xa6ee, numeric_type::Numeric},
-            {0xa6ef, numeric_type::Numeric},  {0xa830, numeric_type::Numeric},
-            {0xa831, numeric_type::Numeric},  {0xa832, numeric_type::Numeric},
-            {0xa833, numeric_type::Numeric},  {0xa834, numeric_type::Numeric},
-            {0xa835, numeric_type::Numeric},  {0xa8d0, numeric_type::Decimal},
-            {0xa8d1, numeric_type::Decimal},  {0xa8d2, numeric_type::Decimal},
-            {0xa8d3, numeric_type::Decimal},  {0xa8d4, numeric_type::Decimal},
-            {0xa8d5, numeric_type::Decimal},  {0xa8d6, numeric_type::Decimal},
-            {0xa8d7, numeric_type::Decimal},  {0xa8d8, numeric_type::Decimal},
-            {0xa8d9, numeric_type::Decimal},  {0xa900, numeric_type::Decimal},
-            {0xa901, numeric_type::Decimal},  {0xa902, numeric_type::Decimal},
-            {0xa903, numeric_type::Decimal},  {0xa904, numeric_type::Decimal},
-            {0xa905, numeric_type::Decimal},  {0xa906, numeric_type::Decimal},
-            {0xa907, numeric_type::Decimal},  {0xa908, numeric_type::Decimal},
-            {0xa909, numeric_type::Decimal},  {0xa9d0, numeric_type::Decimal},
-            {0xa9d1, numeric_type::Decimal},  {0xa9d2, numeric_type::Decimal},
-            {0xa9d3, numeric_type::Decimal},  {0xa9d4, numeric_type::Decimal},
-            {0xa9d5, numeric_type::Decimal},  {0xa9d6, numeric_type::Decimal},
-            {0xa9d7, numeric_type::Decimal},  {0xa9d8, numeric_type::Decimal},
-            {0xa9d9, numeric_type::Decimal},  {0xa9f0, numeric_type::Decimal},
-            {0xa9f1, numeric_type::Decimal},  {0xa9f2, numeric_type::Decimal},
-            {0xa9f3, numeric_type::Decimal},  {0xa9f4, numeric_type::Decimal},
-            {0xa9f5, numeric_type::Decimal},  {0xa9f6, numeric_type::Decimal},
-            {0xa9f7, numeric_type::Decimal},  {0xa9f8, numeric_type::Decimal},
-            {0xa9f9, numeric_type::Decimal},  {0xaa50, numeric_type::Decimal},
-            {0xaa51, numeric_type::Decimal},  {0xaa52, numeric_type::Decimal},
-            {0xaa53, numeric_type::Decimal},  {0xaa54, numeric_type::Decimal},
-            {0xaa55, numeric_type::Decimal},  {0xaa56, numeric_type::Decimal},
-            {0xaa57, numeric_type::Decimal},  {0xaa58, numeric_type::Decimal},
-            {0xaa59, numeric_type::Decimal},  {0xabf0, numeric_type::Decimal},
-            {0xabf1, numeric_type::Decimal},  {0xabf2, numeric_type::Decimal},
-            {0xabf3, numeric_type::Decimal},  {0xabf4, numeric_type::Decimal},
-            {0xabf5, numeric_type::Decimal},  {0xabf6, numeric_type::Decimal},
-            {0xabf7, numeric_type::Decimal},  {0xabf8, numeric_type::Decimal},
-            {0xabf9, numeric_type::Decimal},  {0xf96b, numeric_type::Numeric},
-            {0xf973, numeric_type::Numeric},  {0xf978, numeric_type::Numeric},
-            {0xf9b2, numeric_type::Numeric},  {0xf9d1, numeric_type::Numeric},
-            {0xf9d3, numeric_type::Numeric},  {0xf9fd, numeric_type::Numeric},
-            {0xff10, numeric_type::Decimal},  {0xff11, numeric_type::Decimal},
-            {0xff12, numeric_type::Decimal},  {0xff13, numeric_type::Decimal},
-            {0xff14, numeric_type::Decimal},  {0xff15, numeric_type::Decimal},
-            {0xff16, numeric_type::Decimal},  {0xff17, numeric_type::Decimal},
-            {0xff18, numeric_type::Decimal},  {0xff19, numeric_type::Decimal},
-            {0x10107, numeric_type::Numeric}, {0x10108, numeric_type::Numeric},
-            {0x10109, numeric_type::Numeric}, {0x1010a, numeric_type::Numeric},
-            {0x1010b, numeric_type::Numeric}, {0x1010c, numeric_type::Numeric},
-            {0x1010d, numeric_type::Numeric}, {0x1010e, numeric_type::Numeric},
-            {0x1010f, numeric_type::Numeric}, {0x10110, numeric_type::Numeric},
-            {0x10111, numeric_type::Numeric}, {0x10112, numeric_type::Numeric},
-            {0x10113, numeric_type::Numeric}, {0x10114, numeric_type::Numeric},
-            {0x10115, numeric_type::Numeric}, {0x10116, numeric_type::Numeric},
-            {0x10117, numeric_type::Numeric}, {0x10118, numeric_type::Numeric},
-            {0x10119, numeric_type::Numeric}, {0x1011a, numeric_type::Numeric},
-            {0x1011b, numeric_type::Numeric}, {0x1011c, numeric_type::Numeric},
-            {0x1011d, numeric_type::Numeric}, {0x1011e, numeric_type::Numeric},
-            {0x1011f, numeric_type::Numeric}, {0x10120, numeric_type::Numeric},
-            {0x10121, numeric_type::Numeric}, {0x10122, numeric_type::Numeric},
-            {0x10123, numeric_type::Numeric}, {0x10124, numeric_type::Numeric},
-            {0x10125, numeric_type::Numeric}, {0x10126, numeric_type::Numeric},
-            {0x10127, numeric_type::Numeric}, {0x10128, numeric_type::Numeric},
-            {0x10129, numeric_type::Numeric}, {0x1012a, numeric_type::Numeric},
-            {0x1012b, numeric_type::Numeric}, {0x1012c, numeric_type::Numeric},
-            {0x1012d, numeric_type::Numeric}, {0x1012e, numeric_type::Numeric},
-            {0x1012f, numeric_type::Numeric}, {0x10130, numeric_type::Numeric},
-            {0x10131, numeric_type::Numeric}, {0x10132, numeric_type::Numeric},
-            {0x10133, numeric_type::Numeric}, {0x10140, numeric_type::Numeric},
-            {0x10141, numeric_type::Numeric}, {0x10142, numeric_type::Numeric},
-            {0x10143, numeric_type::Numeric}, {0x10144, numeric_type::Numeric},
-            {0x10145, numeric_type::Numeric}, {0x10146, numeric_type::Numeric},
-            {0x10147, numeric_type::Numeric}, {0x10148, numeric_type::Numeric},
-            {0x10149, numeric_type::Numeric}, {0x1014a, numeric_type::Numeric},
-            {0x1014b, numeric_type::Numeric}, {0x1014c, numeric_type::Numeric},
-            {0x1014d, numeric_type::Numeric}, {0x1014e, numeric_type::Numeric},
-            {0x1014f, numeric_type::Numeric}, {0x10150, numeric_type::Numeric},
-            {0x10151, numeric_type::Numeric}, {0x10152, numeric_type::Numeric},
-            {0x10153, numeric_type::Numeric}, {0x10154, numeric_type::Numeric},
-            {0x10155, numeric_type::Numeric}, {0x10156, numeric_type::Numeric},
-            {0x10157, numeric_type::Numeric}, {0x10158, numeric_type::Numeric},
-            {0x10159, numeric_type::Numeric}, {0x1015a, numeric_type::Numeric},
-            {0x1015b, numeric_type::Numeric}, {0x1015c, numeric_type::Numeric},
-            {0x1015d, numeric_type::Numeric}, {0x1015e, numeric_type::Numeric},
-            {0x1015f, numeric_type::Numeric}, {0x10160, numeric_type::Numeric},
-            {0x10161, numeric_type::Numeric}, {0x10162, numeric_type::Numeric},
-            {0x10163, numeric_type::Numeric}, {0x10164, numeric_type::Numeric},
-            {0x10165, numeric_type::Numeric}, {0x10166, numeric_type::Numeric},
-            {0x10167, numeric_type::Numeric}, {0x10168, numeric_type::Numeric},
-            {0x10169, numeric_type::Numeric}, {0x1016a, numeric_type::Numeric},
-            {0x1016b, numeric_type::Numeric}, {0x1016c, numeric_type::Numeric},
-            {0x1016d, numeric_type::Numeric}, {0x1016e, numeric_type::Numeric},
-            {0x1016f, numeric_type::Numeric}, {0x10170, numeric_type::Numeric},
-            {0x10171, numeric_type::Numeric}, {0x10172, numeric_type::Numeric},
-            {0x10173, numeric_type::Numeric}, {0x10174, numeric_type::Numeric},
-            {0x10175, numeric_type::Numeric}, {0x10176, numeric_type::Numeric},
-            {0x10177, numeric_type::Numeric}, {0x10178, numeric_type::Numeric},
-            {0x1018a, numeric_type::Numeric}, {0x1018b, numeric_type::Numeric},
-            {0x102e1, numeric_type::Numeric}, {0x102e2, numeric_type::Numeric},
-            {0x102e3, numeric_type::Numeric}, {0x102e4, numeric_type::Numeric},
-            {0x102e5, numeric_type::Numeric}, {0x102e6, numeric_type::Numeric},
-            {0x102e7, numeric_type::Numeric}, {0x102e8, numeric_type::Numeric},
-            {0x102e9, numeric_type::Numeric}, {0x102ea, numeric_type::Numeric},
-            {0x102eb, numeric_type::Numeric}, {0x102ec, numeric_type::Numeric},
-            {0x102ed, numeric_type::Numeric}, {0x102ee, numeric_type::Numeric},
-            {0x102ef, numeric_type::Numeric}, {0x102f0, numeric_type::Numeric},
-            {0x102f1, numeric_type::Numeric}, {0x102f2, numeric_type::Numeric},
-            {0x102f3, numeric_type::Numeric}, {0x102f4, numeric_type::Numeric},
-            {0x102f5, numeric_type::Numeric}, {0x102f6, numeric_type::Numeric},
-            {0x102f7, numeric_type::Numeric}, {0x102f8, numeric_type::Numeric},
-            {0x102f9, numeric_type::Numeric}, {0x102fa, numeric_type::Numeric},
-            {0x102fb, numeric_type::Numeric}, {0x10320, numeric_type::Numeric},
-            {0x10321, numeric_type::Numeric}, {0x10322, numeric_type::Numeric},
-            {0x10323, numeric_type::Numeric}, {0x10341, numeric_type::Numeric},
-            {0x1034a, numeric_type::Numeric}, {0x103d1, numeric_type::Numeric},
-            {0x103d2, numeric_type::Numeric}, {0x103d3, numeric_type::Numeric},
-            {0x103d4, numeric_type::Numeric}, {0x103d5, numeric_type::Numeric},
-            {0x104a0, numeric_type::Decimal}, {0x104a1, numeric_type::Decimal},
-            {0x104a2, numeric_type::Decimal}, {0x104a3, numeric_type::Decimal},
-            {0x104a4, numeric_type::Decimal}, {0x104a5, numeric_type::Decimal},
-            {0x104a6, numeric_type::Decimal}, {0x104a7, numeric_type::Decimal},
-            {0x104a8, numeric_type::Decimal}, {0x104a9, numeric_type::Decimal},
-            {0x10858, numeric_type::Numeric}, {0x10859, numeric_type::Numeric},
-            {0x1085a, numeric_type::Numeric}, {0x1085b, numeric_type::Numeric},
-            {0x1085c, numeric_type::Numeric}, {0x1085d, numeric_type::Numeric},
-            {0x1085e, numeric_type::Numeric}, {0x1085f, numeric_type::Numeric},
-            {0x10879, numeric_type::Numeric}, {0x1087a, numeric_type::Numeric},
-            {0x1087b, numeric_type::Numeric}, {0x1087c, numeric_type::Numeric},
-            {0x1087d, numeric_type::Numeric}, {0x1087e, numeric_type::Numeric},
-            {0x1087f, numeric_type::Numeric}, {0x108a7, numeric_type::Numeric},
-            {0x108a8, numeric_type::Numeric}, {0x108a9, numeric_type::Numeric},
-            {0x108aa, numeric_type::Numeric}, {0x108ab, numeric_type::Numeric},
-            {0x108ac, numeric_type::Numeric}, {0x108ad, numeric_type::Numeric},
-            {0x108ae, numeric_type::Numeric}, {0x108af, numeric_type::Numeric},
-            {0x108fb, numeric_type::Numeric}, {0x108fc, numeric_type::Numeric},
-            {0x108fd, numeric_type::Numeric}, {0x108fe, numeric_type::Numeric},
-            {0x108ff, numeric_type::Numeric}, {0x10916, numeric_type::Numeric},
-            {0x10917, numeric_type::Numeric}, {0x10918, numeric_type::Numeric},
-            {0x10919, numeric_type::Numeric}, {0x1091a, numeric_type::Numeric},
-            {0x1091b, numeric_type::Numeric}, {0x109bc, numeric_type::Numeric},
-            {0x109bd, numeric_type::Numeric}, {0x109c0, numeric_type::Numeric},
-            {0x109c1, numeric_type::Numeric}, {0x109c2, numeric_type::Numeric},
-            {0x109c3, numeric_type::Numeric}, {0x109c4, numeric_type::Numeric},
-            {0x109c5, numeric_type::Numeric}, {0x109c6, numeric_type::Numeric},
-            {0x109c7, numeric_type::Numeric}, {0x109c8, numeric_type::Numeric},
-            {0x109c9, numeric_type::Numeric}, {0x109ca, numeric_type::Numeric},
-            {0x109cb, numeric_type::Numeric}, {0x109cc, numeric_type::Numeric},
-            {0x109cd, numeric_type::Numeric}, {0x109ce, numeric_type::Numeric},
-            {0x109cf, numeric_type::Numeric}, {0x109d2, numeric_type::Numeric},
-            {0x109d3, numeric_type::Numeric}, {0x109d4, numeric_type::Numeric},
-            {0x109d5, numeric_type::Numeric}, {0x109d6, numeric_type::Numeric},
-            {0x109d7, numeric_type::Numeric}, {0x109d8, numeric_type::Numeric},
-            {0x109d9, numeric_type::Numeric}, {0x109da, numeric_type::Numeric},
-            {0x109db, numeric_type::Numeric}, {0x109dc, numeric_type::Numeric},
-            {0x109dd, numeric_type::Numeric}, {0x109de, numeric_type::Numeric},
-            {0x109df, numeric_type::Numeric}, {0x109e0, numeric_type::Numeric},
-            {0x109e1, numeric_type::Numeric}, {0x109e2, numeric_type::Numeric},
-            {0x109e3, numeric_type::Numeric}, {0x109e4, numeric_type::Numeric},
-            {0x109e5, numeric_type::Numeric}, {0x109e6, numeric_type::Numeric},
-            {0x109e7, numeric_type::Numeric}, {0x109e8, numeric_type::Numeric},
-            {0x109e9, numeric_type::Numeric}, {0x109ea, numeric_type::Numeric},
-            {0x109eb, numeric_type::Numeric}, {0x109ec, numeric_type::Numeric},
-            {0x109ed, numeric_type::Numeric}, {0x109ee, numeric_type::Numeric},
-            {0x109ef, numeric_type::Numeric}, {0x109f0, numeric_type::Numeric},
-            {0x109f1, numeric_type::Numeric}, {0x109f2, numeric_type::Numeric},
-            {0x109f3, numeric_type::Numeric}, {0x109f4, numeric_type::Numeric},
-            {0x109f5, numeric_type::Numeric}, {0x109f6, numeric_type::Numeric},
-            {0x109f7, numeric_type::Numeric}, {0x109f8, numeric_type::Numeric},
-            {0x109f9, numeric_type::Numeric}, {0x109fa, numeric_type::Numeric},
-            {0x109fb, numeric_type::Numeric}, {0x109fc, numeric_type::Numeric},
-            {0x109fd, numeric_type::Numeric}, {0x109fe, numeric_type::Numeric},
-            {0x109ff, numeric_type::Numeric}, {0x10a40, numeric_type::Digit},
-            {0x10a41, numeric_type::Digit},   {0x10a42, numeric_type::Digit},
-            {0x10a43, numeric_type::Digit},   {0x10a44, numeric_type::Numeric},
-            {0x10a45, numeric_type::Numeric}, {0x10a46, numeric_type::Numeric},
-            {0x10a47, numeric_type::Numeric}, {0x10a48, numeric_type::Numeric},
-            {0x10a7d, numeric_type::Numeric}, {0x10a7e, numeric_type::Numeric},
-            {0x10a9d, numeric_type::Numeric}, {0x10a9e, numeric_type::Numeric},
-            {0x10a9f, numeric_type::Numeric}, {0x10aeb, numeric_type::Numeric},
-            {0x10aec, numeric_type::Numeric}, {0x10aed, numeric_type::Numeric},
-            {0x10aee, numeric_type::Numeric}, {0x10aef, numeric_type::Numeric},
-            {0x10b58, numeric_type::Numeric}, {0x10b59, numeric_type::Numeric},
-            {0x10b5a, numeric_type::Numeric}, {0x10b5b, numeric_type::Numeric},
-            {0x10b5c, numeric_type::Numeric}, {0x10b5d, numeric_type::Numeric},
-            {0x10b5e, numeric_type::Numeric}, {0x10b5f, numeric_type::Numeric},
-            {0x10b78, numeric_type::Numeric}, {0x10b79, numeric_type::Numeric},
-            {0x10b7a, numeric_type::Numeric}, {0x10b7b, numeric_type::Numeric},
-            {0x10b7c, numeric_type::Numeric}, {0x10b7d, numeric_type::Numeric},
-            {0x10b7e, numeric_type::Numeric}, {0x10b7f, numeric_type::Numeric},
-            {0x10ba9, numeric_type::Numeric}, {0x10baa, numeric_type::Numeric},
-            {0x10bab, numeric_type::Numeric}, {0x10bac, numeric_type::Numeric},
-            {0x10bad, numeric_type::Numeric}, {0x10bae, numeric_type::Numeric},
-            {0x10baf, numeric_type::Numeric}, {0x10cfa, numeric_type::Numeric},
-            {0x10cfb, numeric_type::Numeric}, {0x10cfc, numeric_type::Numeric},
-            {0x10cfd, numeric_type::Numeric}, {0x10cfe, numeric_type::Numeric},
-            {0x10cff, numeric_type::Numeric}, {0x10d30, numeric_type::Decimal},
-            {0x10d31, numeric_type::Decimal}, {0x10d32, numeric_type::Decimal},
-            {0x10d33, numeric_type::Decimal}, {0x10d34, numeric_type::Decimal},
-            {0x10d35, numeric_type::Decimal}, {0x10d36, numeric_type::Decimal},
-            {0x10d37, numeric_type::Decimal}, {0x10d38, numeric_type::Decimal},
-            {0x10d39, numeric_type::Decimal}, {0x10e60, numeric_type::Digit},
-            {0x10e61, numeric_type::Digit},   {0x10e62, numeric_type::Digit},
-            {0x10e63, numeric_type::Digit},   {0x10e64, numeric_type::Digit},
-            {0x10e65, numeric_type::Digit},   {0x10e66, numeric_type::Digit},
-            {0x10e67, numeric_type::Digit},   {0x10e68, numeric_type::Digit},
-            {0x10e69, numeric_type::Numeric}, {0x10e6a, numeric_type::Numeric},
-            {0x10e6b, numeric_type::Numeric}, {0x10e6c, numeric_type::Numeric},
-            {0x10e6d, numeric_type::Numeric}, {0x10e6e, numeric_type::Numeric},
-            {0x10e6f, numeric_type::Numeric}, {0x10e70, numeric_type::Numeric},
-            {0x10e71, numeric_type::Numeric}, {0x10e72, numeric_type::Numeric},
-            {0x10e73, numeric_type::Numeric}, {0x10e74, numeric_type::Numeric},
-            {0x10e75, numeric_type::Numeric}, {0x10e76, numeric_type::Numeric},
-            {0x10e77, numeric_type::Numeric}, {0x10e78, numeric_type::Numeric},
-            {0x10e79, numeric_type::Numeric}, {0x10e7a, numeric_type::Numeric},
-            {0x10e7b, numeric_type::Numeric}, {0x10e7c, numeric_type::Numeric},
-            {0x10e7d, numeric_type::Numeric}, {0x10e7e, numeric_type::Numeric},
-            {0x10f1d, numeric_type::Numeric}, {0x10f1e, numeric_type::Numeric},
-            {0x10f1f, numeric_type::Numeric}, {0x10f20, numeric_type::Numeric},
-            {0x10f21, numeric_type::Numeric}, {0x10f22, numeric_type::Numeric},
-            {0x10f23, numeric_type::Numeric}, {0x10f24, numeric_type::Numeric},
-            {0x10f25, numeric_type::Numeric}, {0x10f26, numeric_type::Numeric},
-            {0x10f51, numeric_type::Numeric}, {0x10f52, numeric_type::Numeric},
-            {0x10f53, numeric_type::Numeric}, {0x10f54, numeric_type::Numeric},
-            {0x10fc5, numeric_type::Numeric}, {0x10fc6, numeric_type::Numeric},
-            {0x10fc7, numeric_type::Numeric}, {0x10fc8, numeric_type::Numeric},
-            {0x10fc9, numeric_type::Numeric}, {0x10fca, numeric_type::Numeric},
-            {0x10fcb, numeric_type::Numeric}, {0x11052, numeric_type::Digit},
-            {0x11053, numeric_type::Digit},   {0x11054, numeric_type::Digit},
-            {0x11055, numeric_type::Digit},   {0x11056, numeric_type::Digit},
-            {0x11057, numeric_type::Digit},   {0x11058, numeric_type::Digit},
-            {0x11059, numeric_type::Digit},   {0x1105a, numeric_type::Digit},
-            {0x1105b, numeric_type::Numeric}, {0x1105c, numeric_type::Numeric},
-            {0x1105d, numeric_type::Numeric}, {0x1105e, numeric_type::Numeric},
-            {0x1105f, numeric_type::Numeric}, {0x11060, numeric_type::Numeric},
-            {0x11061, numeric_type::Numeric}, {0x11062, numeric_type::Numeric},
-            {0x11063, numeric_type::Numeric}, {0x11064, numeric_type::Numeric},
-            {0x11065, numeric_type::Numeric}, {0x11066, numeric_type::Decimal},
-            {0x11067, numeric_type::Decimal}, {0x11068, numeric_type::Decimal},
-            {0x11069, numeric_type::Decimal}, {0x1106a, numeric_type::Decimal},
-            {0x1106b, numeric_type::Decimal}, {0x1106c, numeric_type::Decimal},
-            {0x1106d, numeric_type::Decimal}, {0x1106e, numeric_type::Decimal},
-            {0x1106f, numeric_type::Decimal}, {0x110f0, numeric_type::Decimal},
-            {0x110f1, numeric_type::Decimal}, {0x110f2, numeric_type::Decimal},
-            {0x110f3, numeric_type::Decimal}, {0x110f4, numeric_type::Decimal},
-            {0x110f5, numeric_type::Decimal}, {0x110f6, numeric_type::Decimal},
-            {0x110f7, numeric_type::Decimal}, {0x110f8, numeric_type::Decimal},
-            {0x110f9, numeric_type::Decimal}, {0x11136, numeric_type::Decimal},
-            {0x11137, numeric_type::Decimal}, {0x11138, numeric_type::Decimal},
-            {0x11139, numeric_type::Decimal}, {0x1113a, numeric_type::Decimal},
-            {0x1113b, numeric_type::Decimal}, {0x1113c, numeric_type::Decimal},
-            {0x1113d, numeric_type::Decimal}, {0x1113e, numeric_type::Decimal},
-            {0x1113f, numeric_type::Decimal}, {0x111d0, numeric_type::Decimal},
-            {0x111d1, numeric_type::Decimal}, {0x111d2, numeric_type::Decimal},
-            {0x111d3, numeric_type::Decimal}, {0x111d4, numeric_type::Decimal},
-            {0x111d5, numeric_type::Decimal}, {0x111d6, numeric_type::Decimal},
-            {0x111d7, numeric_type::Decimal}, {0x111d8, numeric_type::Decimal},
-            {0x111d9, numeric_type::Decimal}, {0x111e1, numeric_type::Numeric},
-            {0x111e2, numeric_type::Numeric}, {0x111e3, numeric_type::Numeric},
-            {0x111e4, numeric_type::Numeric}, {0x111e5, numeric_type::Numeric},
-            {0x111e6, numeric_type::Numeric}, {0x111e7, numeric_type::Numeric},
-            {0x111e8, numeric_type::Numeric}, {0x111e9, numeric_type::Numeric},
-            {0x111ea, numeric_type::Numeric}, {0x111eb, numeric_type::Numeric},
-            {0x111ec, numeric_type::Numeric}, {0x111ed, numeric_type::Numeric},
-            {0x111ee, numeric_type::Numeric}, {0x111ef, numeric_type::Numeric},
-            {0x111f0, numeric_type::Numeric}, {0x111f1, numeric_type::Numeric},
-            {0x111f2, numeric_type::Numeric}, {0x111f3, numeric_type::Numeric},
-            {0x111f4, numeric_type::Numeric}, {0x112f0, numeric_type::Decimal},
-            {0x112f1, numeric_type::Decimal}, {0x112f2, numeric_type::Decimal},
-            {0x112f3, numeric_type::Decimal}, {0x112f4, numeric_type::Decimal},
-            {0x112f5, numeric_type::Decimal}, {0x112f6, numeric_type::Decimal},
-            {0x112f7, numeric_type::Decimal}, {0x112f8, numeric_type::Decimal},
-            {0x112f9, numeric_type::Decimal}, {0x11450, numeric_type::Decimal},
-            {0x11451, numeric_type::Decimal}, {0x11452, numeric_type::Decimal},
-            {0x11453, numeric_type::Decimal}, {0x11454, numeric_type::Decimal},
-            {0x11455, numeric_type::Decimal}, {0x11456, numeric_type::Decimal},
-            {0x11457, numeric_type::Decimal}, {0x11458, numeric_type::Decimal},
-            {0x11459, numeric_type::Decimal}, {0x114d0, numeric_type::Decimal},
-            {0x114d1, numeric_type::Decimal}, {0x114d2, numeric_type::Decimal},
-            {0x114d3, numeric_type::Decimal}, {0x114d4, numeric_type::Decimal},
-            {0x114d5, numeric_type::Decimal}, {0x114d6, numeric_type::Decimal},
-            {0x114d7, numeric_type::Decimal}, {0x114d8, numeric_type::Decimal},
-            {0x114d9, numeric_type::Decimal}, {0x11650, numeric_type::Decimal},
-            {0x11651, numeric_type::Decimal}, {0x11652, numeric_type::Decimal},
-            {0x11653, numeric_type::Decimal}, {0x11654, numeric_type::Decimal},
-            {0x11655, numeric_type::Decimal}, {0x11656, numeric_type::Decimal},
-            {0x11657, numeric_type::Decimal}, {0x11658, numeric_type::Decimal},
-            {0x11659, numeric_type::Decimal}, {0x116c0, numeric_type::Decimal},
-            {0x116c1, numeric_type::Decimal}, {0x116c2, numeric_type::Decimal},
-            {0x116c3, numeric_type::Decimal}, {0x116c4, numeric_type::Decimal},
-            {0x116c5, numeric_type::Decimal}, {0x116c6, numeric_type::Decimal},
-            {0x116c7, numeric_type::Decimal}, {0x116c8, numeric_type::Decimal},
-            {0x116c9, numeric_type::Decimal}, {0x11730, numeric_type::Decimal},
-            {0x11731, numeric_type::Decimal}, {0x11732, numeric_type::Decimal},
-            {0x11733, numeric_type::Decimal}, {0x11734, numeric_type::Decimal},
-            {0x11735, numeric_type::Decimal}, {0x11736, numeric_type::Decimal},
-            {0x11737, numeric_type::Decimal}, {0x11738, numeric_type::Decimal},
-            {0x11739, numeric_type::Decimal}, {0x1173a, numeric_type::Numeric},
-            {0x1173b, numeric_type::Numeric}, {0x118e0, numeric_type::Decimal},
-            {0x118e1, numeric_type::Decimal}, {0x118e2, numeric_type::Decimal},
-            {0x118e3, numeric_type::Decimal}, {0x118e4, numeric_type::Decimal},
-            {0x118e5, numeric_type::Decimal}, {0x118e6, numeric_type::Decimal},
-            {0x118e7, numeric_type::Decimal}, {0x118e8, numeric_type::Decimal},
-            {0x118e9, numeric_type::Decimal}, {0x118ea, numeric_type::Numeric},
-            {0x118eb, numeric_type::Numeric}, {0x118ec, numeric_type::Numeric},
-            {0x118ed, numeric_type::Numeric}, {0x118ee, numeric_type::Numeric},
-            {0x118ef, numeric_type::Numeric}, {0x118f0, numeric_type::Numeric},
-            {0x118f1, numeric_type::Numeric}, {0x118f2, numeric_type::Numeric},
-            {0x11950, numeric_type::Decimal}, {0x11951, numeric_type::Decimal},
-            {0x11952, numeric_type::Decimal}, {0x11953, numeric_type::Decimal},
-            {0x11954, numeric_type::Decimal}, {0x11955, numeric_type::Decimal},
-            {0x11956, numeric_type::Decimal}, {0x11957, numeric_type::Decimal},
-            {0x11958, numeric_type::Decimal}, {0x11959, numeric_type::Decimal},
-            {0x11c50, numeric_type::Decimal}, {0x11c51, numeric_type::Decimal},
-            {0x11c52, numeric_type::Decimal}, {0x11c53, numeric_type::Decimal},
-            {0x11c54, numeric_type::Decimal}, {0x11c55, numeric_type::Decimal},
-            {0x11c56, numeric_type::Decimal}, {0x11c57, numeric_type::Decimal},
-            {0x11c58, numeric_type::Decimal}, {0x11c59, numeric_type::Decimal},
-            {0x11c5a, numeric_type::Numeric}, {0x11c5b, numeric_type::Numeric},
-            {0x11c5c, numeric_type::Numeric}, {0x11c5d, numeric_type::Numeric},
-            {0x11c5e, numeric_type::Numeric}, {0x11c5f, numeric_type::Numeric},
-            {0x11c60, numeric_type::Numeric}, {0x11c61, numeric_type::Numeric},
-            {0x11c62, numeric_type::Numeric}, {0x11c63, numeric_type::Numeric},
-            {0x11c64, numeric_type::Numeric}, {0x11c65, numeric_type::Numeric},
-            {0x11c66, numeric_type::Numeric}, {0x11c67, numeric_type::Numeric},
-            {0x11c68, numeric_type::Numeric}, {0x11c69, numeric_type::Numeric},
-            {0x11c6a, numeric_type::Numeric}, {0x11c6b, numeric_type::Numeric},
-            {0x11c6c, numeric_type::Numeric}, {0x11d50, numeric_type::Decimal},
-            {0x11d51, numeric_type::Decimal}, {0x11d52, numeric_type::Decimal},
-            {0x11d53, numeric_type::Decimal}, {0x11d54, numeric_type::Decimal},
-            {0x11d55, numeric_type::Decimal}, {0x11d56, numeric_type::Decimal},
-            {0x11d57, numeric_type::Decimal}, {0x11d58, numeric_type::Decimal},
-            {0x11d59, numeric_type::Decimal}, {0x11da0, numeric_type::Decimal},
-            {0x11da1, numeric_type::Decimal}, {0x11da2, numeric_type::Decimal},
-            {0x11da3, numeric_type::Decimal}, {0x11da4, numeric_type::Decimal},
-            {0x11da5, numeric_type::Decimal}, {0x11da6, numeric_type::Decimal},
-            {0x11da7, numeric_type::Decimal}, {0x11da8, numeric_type::Decimal},
-            {0x11da9, numeric_type::Decimal}, {0x11fc0, numeric_type::Numeric},
-            {0x11fc1, numeric_type::Numeric}, {0x11fc2, numeric_type::Numeric},
-            {0x11fc3, numeric_type::Numeric}, {0x11fc4, numeric_type::Numeric},
-            {0x11fc5, numeric_type::Numeric}, {0x11fc6, numeric_type::Numeric},
-            {0x11fc7, numeric_type::Numeric}, {0x11fc8, numeric_type::Numeric},
-            {0x11fc9, numeric_type::Numeric}, {0x11fca, numeric_type::Numeric},
-            {0x11fcb, numeric_type::Numeric}, {0x11fcc, numeric_type::Numeric},
-            {0x11fcd, numeric_type::Numeric}, {0x11fce, numeric_type::Numeric},
-            {0x11fcf, numeric_type::Numeric}, {0x11fd0, numeric_type::Numeric},
-            {0x11fd1, numeric_type::Numeric}, {0x11fd2, numeric_type::Numeric},
-            {0x11fd3, numeric_type::Numeric}, {0x11fd4, numeric_type::Numeric},
-            {0x12400, numeric_type::Numeric}, {0x12401, numeric_type::Numeric},
-            {0x12402, numeric_type::Numeric}, {0x12403, numeric_type::Numeric},
-            {0x12404, numeric_type::Numeric}, {0x12405, numeric_type::Numeric},
-            {0x12406, numeric_type::Numeric}, {0x12407, numeric_type::Numeric},
-            {0x12408, numeric_type::Numeric}, {0x12409, numeric_type::Numeric},
-            {0x1240a, numeric_type::Numeric}, {0x1240b, numeric_type::Numeric},
-            {0x1240c, numeric_type::Numeric}, {0x1240d, numeric_type::Numeric},
-            {0x1240e, numeric_type::Numeric}, {0x1240f, numeric_type::Numeric},
-            {0x12410, numeric_type::Numeric}, {0x12411, numeric_type::Numeric},
-            {0x12412, numeric_type::Numeric}, {0x12413, numeric_type::Numeric},
-            {0x12414, numeric_type::Numeric}, {0x12415, numeric_type::Numeric},
-            {0x12416, numeric_type::Numeric}, {0x12417, numeric_type::Numeric},
-            {0x12418, numeric_type::Numeric}, {0x12419, numeric_type::Numeric},
-            {0x1241a, numeric_type::Numeric}, {0x1241b, numeric_type::Numeric},
-            {0x1241c, numeric_type::Numeric}, {0x1241d, numeric_type::Numeric},
-            {0x1241e, numeric_type::Numeric}, {0x1241f, numeric_type::Numeric},
-            {0x12420, numeric_type::Numeric}, {0x12421, numeric_type::Numeric},
-            {0x12422, numeric_type::Numeric}, {0x12423, numeric_type::Numeric},
-            {0x12424, numeric_type::Numeric}, {0x12425, numeric_type::Numeric},
-            {0x12426, numeric_type::Numeric}, {0x12427, numeric_type::Numeric},
-            {0x12428, numeric_type::Numeric}, {0x12429, numeric_type::Numeric},
-            {0x1242a, numeric_type::Numeric}, {0x1242b, numeric_type::Numeric},
-            {0x1242c, numeric_type::Numeric}, {0x1242d, numeric_type::Numeric},
-            {0x1242e, numeric_type::Numeric}, {0x1242f, numeric_type::Numeric},
-            {0x12430, numeric_type::Numeric}, {0x12431, numeric_type::Numeric},
-            {0x12432, numeric_type::Numeric}, {0x12433, numeric_type::Numeric},
-            {0x12434, numeric_type::Numeric}, {0x12435, numeric_type::Numeric},
-            {0x12436, numeric_type::Numeric}, {0x12437, numeric_type::Numeric},
-            {0x12438, numeric_type::Numeric}, {0x12439, numeric_type::Numeric},
-            {0x1243a, numeric_type::Numeric}, {0x1243b, numeric_type::Numeric},
-            {0x1243c, numeric_type::Numeric}, {0x1243d, numeric_type::Numeric},
-            {0x1243e, numeric_type::Numeric}, {0x1243f, numeric_type::Numeric},
-            {0x12440, numeric_type::Numeric}, {0x12441, numeric_type::Numeric},
-            {0x12442, numeric_type::Numeric}, {0x12443, numeric_type::Numeric},
-            {0x12444, numeric_type::Numeric}, {0x12445, numeric_type::Numeric},
-            {0x12446, numeric_type::Numeric}, {0x12447, numeric_type::Numeric},
-            {0x12448, numeric_type::Numeric}, {0x12449, numeric_type::Numeric},
-            {0x1244a, numeric_type::Numeric}, {0x1244b, numeric_type::Numeric},
-            {0x1244c, numeric_type::Numeric}, {0x1244d, numeric_type::Numeric},
-            {0x1244e, numeric_type::Numeric}, {0x1244f, numeric_type::Numeric},
-            {0x12450, numeric_type::Numeric}, {0x12451, numeric_type::Numeric},
-            {0x12452, numeric_type::Numeric}, {0x12453, numeric_type::Numeric},
-            {0x12454, numeric_type::Numeric}, {0x12455, numeric_type::Numeric},
-            {0x12456, numeric_type::Numeric}, {0x12457, numeric_type::Numeric},
-            {0x12458, numeric_type::Numeric}, {0x12459, numeric_type::Numeric},
-            {0x1245a, numeric_type::Numeric}, {0x1245b, numeric_type::Numeric},
-            {0x1245c, numeric_type::Numeric}, {0x1245d, numeric_type::Numeric},
-            {0x1245e, numeric_type::Numeric}, {0x1245f, numeric_type::Numeric},
-            {0x12460, numeric_type::Numeric}, {0x12461, numeric_type::Numeric},
-            {0x12462, numeric_type::Numeric}, {0x12463, numeric_type::Numeric},
-            {0x12464, numeric_type::Numeric}, {0x12465, numeric_type::Numeric},
-            {0x12466, numeric_type::Numeric}, {0x12467, numeric_type::Numeric},
-            {0x12468, numeric_type::Numeric}, {0x12469, numeric_type::Numeric},
-            {0x1246a, numeric_type::Numeric}, {0x1246b, numeric_type::Numeric},
-            {0x1246c, numeric_type::Numeric}, {0x1246d, numeric_type::Numeric},
-            {0x1246e, numeric_type::Numeric}, {0x16a60, numeric_type::Decimal},
-            {0x16a61, numeric_type::Decimal}, {0x16a62, numeric_type::Decimal},
-            {0x16a63, numeric_type::Decimal}, {0x16a64, numeric_type::Decimal},
-            {0x16a65, numeric_type::Decimal}, {0x16a66, numeric_type::Decimal},
-            {0x16a67, numeric_type::Decimal}, {0x16a68, numeric_type::Decimal},
-            {0x16a69, numeric_type::Decimal}, {0x16b50, numeric_type::Decimal},
-            {0x16b51, numeric_type::Decimal}, {0x16b52, numeric_type::Decimal},
-            {0x16b53, numeric_type::Decimal}, {0x16b54, numeric_type::Decimal},
-            {0x16b55, numeric_type::Decimal}, {0x16b56, numeric_type::Decimal},
-            {0x16b57, numeric_type::Decimal}, {0x16b58, numeric_type::Decimal},
-            {0x16b59, numeric_type::Decimal}, {0x16b5b, numeric_type::Numeric},
-            {0x16b5c, numeric_type::Numeric}, {0x16b5d, numeric_type::Numeric},
-            {0x16b5e, numeric_type::Numeric}, {0x16b5f, numeric_type::Numeric},
-            {0x16b60, numeric_type::Numeric}, {0x16b61, numeric_type::Numeric},
-            {0x16e80, numeric_type::Numeric}, {0x16e81, numeric_type::Numeric},
-            {0x16e82, numeric_type::Numeric}, {0x16e83, numeric_type::Numeric},
-            {0x16e84, numeric_type::Numeric}, {0x16e85, numeric_type::Numeric},
-            {0x16e86, numeric_type::Numeric}, {0x16e87, numeric_type::Numeric},
-            {0x16e88, numeric_type::Numeric}, {0x16e89, numeric_type::Numeric},
-            {0x16e8a, numeric_type::Numeric}, {0x16e8b, numeric_type::Numeric},
-            {0x16e8c, numeric_type::Numeric}, {0x16e8d, numeric_type::Numeric},
-            {0x16e8e, numeric_type::Numeric}, {0x16e8f, numeric_type::Numeric},
-            {0x16e90, numeric_type::Numeric}, {0x16e91, numeric_type::Numeric},
-            {0x16e92, numeric_type::Numeric}, {0x16e93, numeric_type::Numeric},
-            {0x16e94, numeric_type::Numeric}, {0x16e95, numeric_type::Numeric},
-            {0x16e96, numeric_type::Numeric}, {0x1d2e0, numeric_type::Numeric},
-            {0x1d2e1, numeric_type::Numeric}, {0x1d2e2, numeric_type::Numeric},
-            {0x1d2e3, numeric_type::Numeric}, {0x1d2e4, numeric_type::Numeric},
-            {0x1d2e5, numeric_type::Numeric}, {0x1d2e6, numeric_type::Numeric},
-            {0x1d2e7, numeric_type::Numeric}, {0x1d2e8, numeric_type::Numeric},
-            {0x1d2e9, numeric_type::Numeric}, {0x1d2ea, numeric_type::Numeric},
-            {0x1d2eb, numeric_type::Numeric}, {0x1d2ec, numeric_type::Numeric},
-            {0x1d2ed, numeric_type::Numeric}, {0x1d2ee, numeric_type::Numeric},
-            {0x1d2ef, numeric_type::Numeric}, {0x1d2f0, numeric_type::Numeric},
-            {0x1d2f1, numeric_type::Numeric}, {0x1d2f2, numeric_type::Numeric},
-            {0x1d2f3, numeric_type::Numeric}, {0x1d360, numeric_type::Numeric},
-            {0x1d361, numeric_type::Numeric}, {0x1d362, numeric_type::Numeric},
-            {0x1d363, numeric_type::Numeric}, {0x1d364, numeric_type::Numeric},
-            {0x1d365, numeric_type::Numeric}, {0x1d366, numeric_type::Numeric},
-            {0x1d367, numeric_type::Numeric}, {0x1d368, numeric_type::Numeric},
-            {0x1d369, numeric_type::Numeric}, {0x1d36a, numeric_type::Numeric},
-            {0x1d36b, numeric_type::Numeric}, {0x1d36c, numeric_type::Numeric},
-            {0x1d36d, numeric_type::Numeric}, {0x1d36e, numeric_type::Numeric},
-            {0x1d36f, numeric_type::Numeric}, {0x1d370, numeric_type::Numeric},
-            {0x1d371, numeric_type::Numeric}, {0x1d372, numeric_type::Numeric},
-            {0x1d373, numeric_type::Numeric}, {0x1d374, numeric_type::Numeric},
-            {0x1d375, numeric_type::Numeric}, {0x1d376, numeric_type::Numeric},
-            {0x1d377, numeric_type::Numeric}, {0x1d378, numeric_type::Numeric},
-            {0x1d7ce, numeric_type::Decimal}, {0x1d7cf, numeric_type::Decimal},
-            {0x1d7d0, numeric_type::Decimal}, {0x1d7d1, numeric_type::Decimal},
-            {0x1d7d2, numeric_type::Decimal}, {0x1d7d3, numeric_type::Decimal},
-            {0x1d7d4, numeric_type::Decimal}, {0x1d7d5, numeric_type::Decimal},
-            {0x1d7d6, numeric_type::Decimal}, {0x1d7d7, numeric_type::Decimal},
-            {0x1d7d8, numeric_type::Decimal}, {0x1d7d9, numeric_type::Decimal},
-            {0x1d7da, numeric_type::Decimal}, {0x1d7db, numeric_type::Decimal},
-            {0x1d7dc, numeric_type::Decimal}, {0x1d7dd, numeric_type::Decimal},
-            {0x1d7de, numeric_type::Decimal}, {0x1d7df, numeric_type::Decimal},
-            {0x1d7e0, numeric_type::Decimal}, {0x1d7e1, numeric_type::Decimal},
-            {0x1d7e2, numeric_type::Decimal}, {0x1d7e3, numeric_type::Decimal},
-            {0x1d7e4, numeric_type::Decimal}, {0x1d7e5, numeric_type::Decimal},
-            {0x1d7e6, numeric_type::Decimal}, {0x1d7e7, numeric_type::Decimal},
-            {0x1d7e8, numeric_type::Decimal}, {0x1d7e9, numeric_type::Decimal},
-            {0x1d7ea, numeric_type::Decimal}, {0x1d7eb, numeric_type::Decimal},
-            {0x1d7ec, numeric_type::Decimal}, {0x1d7ed, numeric_type::Decimal},
-            {0x1d7ee, numeric_type::Decimal}, {0x1d7ef, numeric_type::Decimal},
-            {0x1d7f0, numeric_type::Decimal}, {0x1d7f1, numeric_type::Decimal},
-            {0x1d7f2, numeric_type::Decimal}, {0x1d7f3, numeric_type::Decimal},
-            {0x1d7f4, numeric_type::Decimal}, {0x1d7f5, numeric_type::Decimal},
-            {0x1d7f6, numeric_type::Decimal}, {0x1d7f7, numeric_type::Decimal},
-            {0x1d7f8, numeric_type::Decimal}, {0x1d7f9, numeric_type::Decimal},
-            {0x1d7fa, numeric_type::Decimal}, {0x1d7fb, numeric_type::Decimal},
-            {0x1d7fc, numeric_type::Decimal}, {0x1d7fd, numeric_type::Decimal},
-            {0x1d7fe, numeric_type::Decimal}, {0x1d7ff, numeric_type::Decimal},
-            {0x1e140, numeric_type::Decimal}, {0x1e141, numeric_type::Decimal},
-            {0x1e142, numeric_type::Decimal}, {0x1e143, numeric_type::Decimal},
-            {0x1e144, numeric_type::Decimal}, {0x1e145, numeric_type::Decimal},
-            {0x1e146, numeric_type::Decimal}, {0x1e147, numeric_type::Decimal},
-            {0x1e148, numeric_type::Decimal}, {0x1e149, numeric_type::Decimal},
-            {0x1e2f0, numeric_type::Decimal}, {0x1e2f1, numeric_type::Decimal},
-            {0x1e2f2, numeric_type::Decimal}, {0x1e2f3, numeric_type::Decimal},
-            {0x1e2f4, numeric_type::Decimal}, {0x1e2f5, numeric_type::Decimal},
-            {0x1e2f6, numeric_type::Decimal}, {0x1e2f7, numeric_type::Decimal},
-            {0x1e2f8, numeric_type::Decimal}, {0x1e2f9, numeric_type::Decimal},
-            {0x1e8c7, numeric_type::Numeric}, {0x1e8c8, numeric_type::Numeric},
-            {0x1e8c9, numeric_type::Numeric}, {0x1e8ca, numeric_type::Numeric},
-            {0x1e8cb, numeric_type::Numeric}, {0x1e8cc, numeric_type::Numeric},
-            {0x1e8cd, numeric_type::Numeric}, {0x1e8ce, numeric_type::Numeric},
-            {0x1e8cf, numeric_type::Numeric}, {0x1e950, numeric_type::Decimal},
-            {0x1e951, numeric_type::Decimal}, {0x1e952, numeric_type::Decimal},
-            {0x1e953, numeric_type::Decimal}, {0x1e954, numeric_type::Decimal},
-            {0x1e955, numeric_type::Decimal}, {0x1e956, numeric_type::Decimal},
-            {0x1e957, numeric_type::Decimal}, {0x1e958, numeric_type::Decimal},
-            {0x1e959, numeric_type::Decimal}, {0x1ec71, numeric_type::Numeric},
-            {0x1ec72, numeric_type::Numeric}, {0x1ec73, numeric_type::Numeric},
-            {0x1ec74, numeric_type::Numeric}, {0x1ec75, numeric_type::Numeric},
-            {0x1ec76, numeric_type::Numeric}, {0x1ec77, numeric_type::Numeric},
-            {0x1ec78, numeric_type::Numeric}, {0x1ec79, numeric_type::Numeric},
-            {0x1ec7a, numeric_type::Numeric}, {0x1ec7b, numeric_type::Numeric},
-            {0x1ec7c, numeric_type::Numeric}, {0x1ec7d, numeric_type::Numeric},
-            {0x1ec7e, numeric_type::Numeric}, {0x1ec7f, numeric_type::Numeric},
-            {0x1ec80, numeric_type::Numeric}, {0x1ec81, numeric_type::Numeric},
-            {0x1ec82, numeric_type::Numeric}, {0x1ec83, numeric_type::Numeric},
-            {0x1ec84, numeric_type::Numeric}, {0x1ec85, numeric_type::Numeric},
-            {0x1ec86, numeric_type::Numeric}, {0x1ec87, numeric_type::Numeric},
-            {0x1ec88, numeric_type::Numeric}, {0x1ec89, numeric_type::Numeric},
-            {0x1ec8a, numeric_type::Numeric}, {0x1ec8b, numeric_type::Numeric},
-            {0x1ec8c, numeric_type::Numeric}, {0x1ec8d, numeric_type::Numeric},
-            {0x1ec8e, numeric_type::Numeric}, {0x1ec8f, numeric_type::Numeric},
-            {0x1ec90, numeric_type::Numeric}, {0x1ec91, numeric_type::Numeric},
-            {0x1ec92, numeric_type::Numeric}, {0x1ec93, numeric_type::Numeric},
-            {0x1ec94, numeric_type::Numeric}, {0x1ec95, numeric_type::Numeric},
-            {0x1ec96, numeric_type::Numeric}, {0x1ec97, numeric_type::Numeric},
-            {0x1ec98, numeric_type::Numeric}, {0x1ec99, numeric_type::Numeric},
-            {0x1ec9a, numeric_type::Numeric}, {0x1ec9b, numeric_type::Numeric},
-            {0x1ec9c, numeric_type::Numeric}, {0x1ec9d, numeric_type::Numeric},
-            {0x1ec9e, numeric_type::Numeric}, {0x1ec9f, numeric_type::Numeric},
-            {0x1eca0, numeric_type::Numeric}, {0x1eca1, numeric_type::Numeric},
-            {0x1eca2, numeric_type::Numeric}, {0x1eca3, numeric_type::Numeric},
-            {0x1eca4, numeric_type::Numeric}, {0x1eca5, numeric_type::Numeric},
-            {0x1eca6, numeric_type::Numeric}, {0x1eca7, numeric_type::Numeric},
-            {0x1eca8, numeric_type::Numeric}, {0x1eca9, numeric_type::Numeric},
-            {0x1ecaa, numeric_type::Numeric}, {0x1ecab, numeric_type::Numeric},
-            {0x1ecad, numeric_type::Numeric}, {0x1ecae, numeric_type::Numeric},
-            {0x1ecaf, numeric_type::Numeric}, {0x1ecb1, numeric_type::Numeric},
-            {0x1ecb2, numeric_type::Numeric}, {0x1ecb3, numeric_type::Numeric},
-            {0x1ecb4, numeric_type::Numeric}, {0x1ed01, numeric_type::Numeric},
-            {0x1ed02, numeric_type::Numeric}, {0x1ed03, numeric_type::Numeric},
-            {0x1ed04, numeric_type::Numeric}, {0x1ed05, numeric_type::Numeric},
-            {0x1ed06, numeric_type::Numeric}, {0x1ed07, numeric_type::Numeric},
-            {0x1ed08, numeric_type::Numeric}, {0x1ed09, numeric_type::Numeric},
-            {0x1ed0a, numeric_type::Numeric}, {0x1ed0b, numeric_type::Numeric},
-            {0x1ed0c, numeric_type::Numeric}, {0x1ed0d, numeric_type::Numeric},
-            {0x1ed0e, numeric_type::Numeric}, {0x1ed0f, numeric_type::Numeric},
-            {0x1ed10, numeric_type::Numeric}, {0x1ed11, numeric_type::Numeric},
-            {0x1ed12, numeric_type::Numeric}, {0x1ed13, numeric_type::Numeric},
-            {0x1ed14, numeric_type::Numeric}, {0x1ed15, numeric_type::Numeric},
-            {0x1ed16, numeric_type::Numeric}, {0x1ed17, numeric_type::Numeric},
-            {0x1ed18, numeric_type::Numeric}, {0x1ed19, numeric_type::Numeric},
-            {0x1ed1a, numeric_type::Numeric}, {0x1ed1b, numeric_type::Numeric},
-            {0x1ed1c, numeric_type::Numeric}, {0x1ed1d, numeric_type::Numeric},
-            {0x1ed1e, numeric_type::Numeric}, {0x1ed1f, numeric_type::Numeric},
-            {0x1ed20, numeric_type::Numeric}, {0x1ed21, numeric_type::Numeric},
-            {0x1ed22, numeric_type::Numeric}, {0x1ed23, numeric_type::Numeric},
-            {0x1ed24, numeric_type::Numeric}, {0x1ed25, numeric_type::Numeric},
-            {0x1ed26, numeric_type::Numeric}, {0x1ed27, numeric_type::Numeric},
-            {0x1ed28, numeric_type::Numeric}, {0x1ed29, numeric_type::Numeric},
-            {0x1ed2a, numeric_type::Numeric}, {0x1ed2b, numeric_type::Numeric},
-            {0x1ed2c, numeric_type::Numeric}, {0x1ed2d, numeric_type::Numeric},
-            {0x1ed2f, numeric_type::Numeric}, {0x1ed30, numeric_type::Numeric},
-            {0x1ed31, numeric_type::Numeric}, {0x1ed32, numeric_type::Numeric},
-            {0x1ed33, numeric_type::Numeric}, {0x1ed34, numeric_type::Numeric},
-            {0x1ed35, numeric_type::Numeric}, {0x1ed36, numeric_type::Numeric},
-            {0x1ed37, numeric_type::Numeric}, {0x1ed38, numeric_type::Numeric},
-            {0x1ed39, numeric_type::Numeric}, {0x1ed3a, numeric_type::Numeric},
-            {0x1ed3b, numeric_type::Numeric}, {0x1ed3c, numeric_type::Numeric},
-            {0x1ed3d, numeric_type::Numeric}, {0x1f100, numeric_type::Digit},
-            {0x1f101, numeric_type::Digit},   {0x1f102, numeric_type::Digit},
-            {0x1f103, numeric_type::Digit},   {0x1f104, numeric_type::Digit},
-            {0x1f105, numeric_type::Digit},   {0x1f106, numeric_type::Digit},
-            {0x1f107, numeric_type::Digit},   {0x1f108, numeric_type::Digit},
-            {0x1f109, numeric_type::Digit},   {0x1f10a, numeric_type::Digit},
-            {0x1f10b, numeric_type::Numeric}, {0x1f10c, numeric_type::Numeric},
-            {0x1fbf0, numeric_type::Decimal}, {0x1fbf1, numeric_type::Decimal},
-            {0x1fbf2, numeric_type::Decimal}, {0x1fbf3, numeric_type::Decimal},
-            {0x1fbf4, numeric_type::Decimal}, {0x1fbf5, numeric_type::Decimal},
-            {0x1fbf6, numeric_type::Decimal}, {0x1fbf7, numeric_type::Decimal},
-            {0x1fbf8, numeric_type::Decimal}, {0x1fbf9, numeric_type::Decimal},
-            {0x20001, numeric_type::Numeric}, {0x20064, numeric_type::Numeric},
-            {0x200e2, numeric_type::Numeric}, {0x20121, numeric_type::Numeric},
-            {0x2092a, numeric_type::Numeric}, {0x20983, numeric_type::Numeric},
-            {0x2098c, numeric_type::Numeric}, {0x2099c, numeric_type::Numeric},
-            {0x20aea, numeric_type::Numeric}, {0x20afd, numeric_type::Numeric},
-            {0x20b19, numeric_type::Numeric}, {0x22390, numeric_type::Numeric},
-            {0x22998, numeric_type::Numeric}, {0x23b1b, numeric_type::Numeric},
-            {0x2626d, numeric_type::Numeric}, {0x2f890, numeric_type::Numeric},
+            0x00, 0x01, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x03, 0x04, 0x02, 0x05,
+            0x02, 0x02, 0x06, 0x07, 0x06, 0x06, 0x08, 0x09, 0x0a, 0x06, 0x0b, 0x06, 0x0c, 0x0c, 0x0d, 0x02,
+            0x05, 0x0e, 0x02, 0x02, 0x02, 0x02, 0x0f, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x10, 0x02, 0x11,
+            0x0e, 0x02, 0x12, 0x13, 0x02, 0x14, 0x0c, 0x00, 0x15, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x16, 0x17, 0x18, 0x19, 0x02, 0x02, 0x02, 0x02, 0x1a, 0x1b, 0x02, 0x02, 0x02, 0x02, 0x1c, 0x1d,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x1f, 0x02, 0x02, 0x20, 0x21, 0x22, 0x02, 0x02, 0x23, 0x24, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x25, 0x02, 0x02, 0x02, 0x02, 0x02, 0x26, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x27, 0x28, 0x29, 0x02,
+            0x02, 0x02, 0x2a, 0x02, 0x02, 0x02, 0x2b, 0x2c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x2d, 0x02, 0x02,
+            0x02, 0x2e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x2f, 0x30, 0x31, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x32, 0x33, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x34,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x35, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x36, 0x02, 0x02, 0x02, 0x02, 0x32, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x35, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x37, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x38, 0x39, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x3a, 0x3b, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x3c, 0x3d, 0x02, 0x02,
+            0x3e, 0x0c, 0x3f, 0x40, 0x0c, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x41, 0x42, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, 0x02,
+            0x02, 0x02, 0x43, 0x44, 0x02, 0x45, 0x46, 0x47, 0x02, 0x3c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x02, 0x50, 0x00, 0x02, 0x51, 0x02, 0x52, 0x53,
+            0x54, 0x04, 0x55, 0x56, 0x02, 0x04, 0x02, 0x02, 0x0c, 0x0c, 0x02, 0x02, 0x0c, 0x05, 0x57, 0x02,
+            0x02, 0x58, 0x0c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x59, 0x02, 0x0c, 0x3c, 0x02, 0x02, 0x02, 0x5a,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x5b, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x03, 0x02, 0x5c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x5d, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x5e, 0x5f, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x60,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x05, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x61, 0x0c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x62, 0x63, 0x64, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x65, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x66, 0x67, 0x68, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x25, 0x69, 0x02, 0x6a, 0x6b, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x6c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x6d, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x6e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x6f, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x6c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+        };
+
+        constexpr uint8_t numeric_type_values[][property_block_size]
+        {
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 2, 0, 0, 3, 3, 3, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                3, 0, 0, 3, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+                3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+                0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 3, 0, 3, 3, 3, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                2, 2, 2, 2, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 3, 3, 3, 3, 3,
+                3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
         };
 
         enum class bidi_class
@@ -3908,1015 +5057,2146 @@ namespace u32
             PDI,
         };
 
-        const std::map<char32_t, bidi_class> bidi_class_range
+        // Bidi class of each code point as its bidi_class enumerator.
+        // begin generated bidi_class, see tools/gen_unicode_tables.py
+        constexpr uint8_t bidi_class_blocks[]
+        {
+            0x00, 0x01, 0x02, 0x02, 0x02, 0x03, 0x04, 0x05, 0x02, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+            0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c,
+            0x1d, 0x1e, 0x02, 0x02, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x02, 0x02, 0x02, 0x02, 0x24, 0x25, 0x26,
+            0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x02, 0x31, 0x02, 0x02, 0x32, 0x33,
+            0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x39, 0x39, 0x39, 0x3e, 0x39, 0x39,
+            0x02, 0x02, 0x39, 0x39, 0x39, 0x39, 0x3f, 0x40, 0x02, 0x41, 0x42, 0x43, 0x44, 0x45, 0x39, 0x46,
+            0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x4f, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x50, 0x02, 0x02, 0x51, 0x52, 0x53, 0x54,
+            0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x5d,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x5e, 0x5f, 0x60, 0x61, 0x61, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+            0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x02, 0x70, 0x71, 0x72, 0x02, 0x02, 0x73, 0x74,
+            0x75, 0x75, 0x76, 0x75, 0x77, 0x78, 0x79, 0x75, 0x75, 0x75, 0x7a, 0x75, 0x7b, 0x7c, 0x7d, 0x7e,
+            0x7f, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x6c, 0x86, 0x87, 0x6c, 0x88, 0x89, 0x8a, 0x8b, 0x6c,
+            0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x6c, 0x6c, 0x92, 0x93, 0x94, 0x95, 0x6c, 0x96, 0x6c, 0x97,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x98, 0x99, 0x02, 0x9a, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x9b,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x9c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x02, 0x02, 0x02, 0x02, 0x9d, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x02, 0x02, 0x02, 0x02, 0x9e, 0x9f, 0xa0, 0xa1, 0x6c, 0x6c, 0x6c, 0x6c, 0xa2, 0xa3, 0xa4, 0xa5,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xa6,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xa7, 0xa8, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xa9,
+            0x02, 0x02, 0xaa, 0x02, 0x02, 0xab, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xac, 0xad, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xae, 0x9a,
+            0x02, 0xaf, 0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0x6c, 0xb5, 0xb6, 0xb7, 0x02, 0x02, 0xb8, 0xb9, 0xba,
+            0x02, 0x02, 0x02, 0x02, 0xbb, 0xbc, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xbd, 0x6c,
+            0xbe, 0x6c, 0xbf, 0x6c, 0x6c, 0xc0, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xc1,
+            0x75, 0xc2, 0xc3, 0x75, 0x75, 0x75, 0x75, 0x75, 0xc4, 0xc5, 0xc6, 0x75, 0x61, 0xc7, 0x75, 0x75,
+            0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0x6c, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0xcd, 0xce, 0xcf,
+            0xd0, 0xd1, 0x39, 0x39, 0xd2, 0xd3, 0x39, 0xd4, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xd6, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xd7, 0x02,
+            0xd8, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xd9, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xda, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x02, 0x02, 0x02, 0x02, 0xdb, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xdc, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0xdd, 0xdd, 0xde, 0xdf, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+            0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c,
+            0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xd5,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe0,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+            0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xe0,
+        };
+
+        constexpr uint8_t bidi_class_values[][property_block_size]
         {
-            {0x9, bidi_class::BN},       {0xa, bidi_class::S},
-            {0xb, bidi_class::B},        {0xc, bidi_class::S},
-            {0xd, bidi_class::WS},       {0xe, bidi_class::B},
-            {0x1c, bidi_class::BN},      {0x1f, bidi_class::B},
-            {0x20, bidi_class::S},       {0x21, bidi_class::WS},
-            {0x23, bidi_class::ON},      {0x26, bidi_class::ET},
-            {0x2b, bidi_class::ON},      {0x2c, bidi_class::ES},
-            {0x2d, bidi_class::CS},      {0x2e, bidi_class::ES},
-            {0x30, bidi_class::CS},      {0x3a, bidi_class::EN},
-            {0x3b, bidi_class::CS},      {0x41, bidi_class::ON},
-            {0x5b, bidi_class::L},       {0x61, bidi_class::ON},
-            {0x7b, bidi_class::L},       {0x7f, bidi_class::ON},
-            {0x85, bidi_class::BN},      {0x86, bidi_class::B},
-            {0xa0, bidi_class::BN},      {0xa1, bidi_class::CS},
-            {0xa2, bidi_class::ON},      {0xa6, bidi_class::ET},
-            {0xaa, bidi_class::ON},      {0xab, bidi_class::L},
-            {0xad, bidi_class::ON},      {0xae, bidi_class::BN},
-            {0xb0, bidi_class::ON},      {0xb2, bidi_class::ET},
-            {0xb4, bidi_class::EN},      {0xb5, bidi_class::ON},
-            {0xb6, bidi_class::L},       {0xb9, bidi_class::ON},
-            {0xba, bidi_class::EN},      {0xbb, bidi_class::L},
-            {0xc0, bidi_class::ON},      {0xd7, bidi_class::L},
-            {0xd8, bidi_class::ON},      {0xf7, bidi_class::L},
-            {0xf8, bidi_class::ON},      {0x2b9, bidi_class::L},
-            {0x2bb, bidi_class::ON},     {0x2c2, bidi_class::L},
-            {0x2d0, bidi_class::ON},     {0x2d2, bidi_class::L},
-            {0x2e0, bidi_class::ON},     {0x2e5, bidi_class::L},
-            {0x2ee, bidi_class::ON},     {0x2ef, bidi_class::L},
-            {0x300, bidi_class::ON},     {0x370, bidi_class::NSM},
-            {0x374, bidi_class::L},      {0x376, bidi_class::ON},
-            {0x378, bidi_class::L},      {0x37a, bidi_class::None},
-            {0x37e, bidi_class::L},      {0x37f, bidi_class::ON},
-            {0x380, bidi_class::L},      {0x384, bidi_class::None},
-            {0x386, bidi_class::ON},     {0x387, bidi_class::L},
-            {0x388, bidi_class::ON},     {0x38b, bidi_class::L},
-            {0x38c, bidi_class::None},   {0x38d, bidi_class::L},
-            {0x38e, bidi_class::None},   {0x3a2, bidi_class::L},
-            {0x3a3, bidi_class::None},   {0x3f6, bidi_class::L},
-            {0x3f7, bidi_class::ON},     {0x483, bidi_class::L},
-            {0x48a, bidi_class::NSM},    {0x530, bidi_class::L},
-            {0x531, bidi_class::None},   {0x557, bidi_class::L},
-            {0x559, bidi_class::None},   {0x58a, bidi_class::L},
-            {0x58b, bidi_class::ON},     {0x58d, bidi_class::None},
-            {0x58f, bidi_class::ON},     {0x590, bidi_class::ET},
-            {0x591, bidi_class::R},      {0x5be, bidi_class::NSM},
-            {0x5bf, bidi_class::R},      {0x5c0, bidi_class::NSM},
-            {0x5c1, bidi_class::R},      {0x5c3, bidi_class::NSM},
-            {0x5c4, bidi_class::R},      {0x5c6, bidi_class::NSM},
-            {0x5c7, bidi_class::R},      {0x5c8, bidi_class::NSM},
-            {0x600, bidi_class::R},      {0x606, bidi_class::AN},
-            {0x608, bidi_class::ON},     {0x609, bidi_class::AL},
-            {0x60b, bidi_class::ET},     {0x60c, bidi_class::AL},
-            {0x60d, bidi_class::CS},     {0x60e, bidi_class::AL},
-            {0x610, bidi_class::ON},     {0x61b, bidi_class::NSM},
-            {0x64b, bidi_class::AL},     {0x660, bidi_class::NSM},
-            {0x66a, bidi_class::AN},     {0x66b, bidi_class::ET},
-            {0x66d, bidi_class::AN},     {0x670, bidi_class::AL},
-            {0x671, bidi_class::NSM},    {0x6d6, bidi_class::AL},
-            {0x6dd, bidi_class::NSM},    {0x6de, bidi_class::AN},
-            {0x6df, bidi_class::ON},     {0x6e5, bidi_class::NSM},
-            {0x6e7, bidi_class::AL},     {0x6e9, bidi_class::NSM},
-            {0x6ea, bidi_class::ON},     {0x6ee, bidi_class::NSM},
-            {0x6f0, bidi_class::AL},     {0x6fa, bidi_class::EN},
-            {0x711, bidi_class::AL},     {0x712, bidi_class::NSM},
-            {0x730, bidi_class::AL},     {0x74b, bidi_class::NSM},
-            {0x7a6, bidi_class::AL},     {0x7b1, bidi_class::NSM},
-            {0x7c0, bidi_class::AL},     {0x7eb, bidi_class::R},
-            {0x7f4, bidi_class::NSM},    {0x7f6, bidi_class::R},
-            {0x7fa, bidi_class::ON},     {0x7fd, bidi_class::R},
-            {0x7fe, bidi_class::NSM},    {0x816, bidi_class::R},
-            {0x81a, bidi_class::NSM},    {0x81b, bidi_class::R},
-            {0x824, bidi_class::NSM},    {0x825, bidi_class::R},
-            {0x828, bidi_class::NSM},    {0x829, bidi_class::R},
-            {0x82e, bidi_class::NSM},    {0x859, bidi_class::R},
-            {0x85c, bidi_class::NSM},    {0x860, bidi_class::R},
-            {0x870, bidi_class::AL},     {0x8a0, bidi_class::R},
-            {0x8d3, bidi_class::AL},     {0x8e2, bidi_class::NSM},
-            {0x8e3, bidi_class::AN},     {0x903, bidi_class::NSM},
-            {0x93a, bidi_class::L},      {0x93b, bidi_class::NSM},
-            {0x93c, bidi_class::L},      {0x93d, bidi_class::NSM},
-            {0x941, bidi_class::L},      {0x949, bidi_class::NSM},
-            {0x94d, bidi_class::L},      {0x94e, bidi_class::NSM},
-            {0x951, bidi_class::L},      {0x958, bidi_class::NSM},
-            {0x962, bidi_class::L},      {0x964, bidi_class::NSM},
-            {0x981, bidi_class::L},      {0x982, bidi_class::NSM},
-            {0x984, bidi_class::L},      {0x985, bidi_class::None},
-            {0x98d, bidi_class::L},      {0x98f, bidi_class::None},
-            {0x991, bidi_class::L},      {0x993, bidi_class::None},
-            {0x9a9, bidi_class::L},      {0x9aa, bidi_class::None},
-            {0x9b1, bidi_class::L},      {0x9b2, bidi_class::None},
-            {0x9b3, bidi_class::L},      {0x9b6, bidi_class::None},
-            {0x9ba, bidi_class::L},      {0x9bc, bidi_class::None},
-            {0x9bd, bidi_class::NSM},    {0x9c1, bidi_class::L},
-            {0x9c5, bidi_class::NSM},    {0x9c7, bidi_class::None},
-            {0x9c9, bidi_class::L},      {0x9cb, bidi_class::None},
-            {0x9cd, bidi_class::L},      {0x9ce, bidi_class::NSM},
-            {0x9cf, bidi_class::L},      {0x9d7, bidi_class::None},
-            {0x9d8, bidi_class::L},      {0x9dc, bidi_class::None},
-            {0x9de, bidi_class::L},      {0x9df, bidi_class::None},
-            {0x9e2, bidi_class::L},      {0x9e4, bidi_class::NSM},
-            {0x9e6, bidi_class::None},   {0x9f2, bidi_class::L},
-            {0x9f4, bidi_class::ET},     {0x9fb, bidi_class::L},
-            {0x9fc, bidi_class::ET},     {0x9fe, bidi_class::L},
-            {0x9ff, bidi_class::NSM},    {0xa01, bidi_class::None},
-            {0xa03, bidi_class::NSM},    {0xa04, bidi_class::L},
-            {0xa05, bidi_class::None},   {0xa0b, bidi_class::L},
-            {0xa0f, bidi_class::None},   {0xa11, bidi_class::L},
-            {0xa13, bidi_class::None},   {0xa29, bidi_class::L},
-            {0xa2a, bidi_class::None},   {0xa31, bidi_class::L},
-            {0xa32, bidi_class::None},   {0xa34, bidi_class::L},
-            {0xa35, bidi_class::None},   {0xa37, bidi_class::L},
-            {0xa38, bidi_class::None},   {0xa3a, bidi_class::L},
-            {0xa3c, bidi_class::None},   {0xa3d, bidi_class::NSM},
-            {0xa3e, bidi_class::None},   {0xa41, bidi_class::L},
-            {0xa43, bidi_class::NSM},    {0xa47, bidi_class::None},
-            {0xa49, bidi_class::NSM},    {0xa4b, bidi_class::None},
-            {0xa4e, bidi_class::NSM},    {0xa51, bidi_class::None},
-            {0xa52, bidi_class::NSM},    {0xa59, bidi_class::None},
-            {0xa5d, bidi_class::L},      {0xa5e, bidi_class::None},
-            {0xa5f, bidi_class::L},      {0xa66, bidi_class::None},
-            {0xa70, bidi_class::L},      {0xa72, bidi_class::NSM},
-            {0xa75, bidi_class::L},      {0xa76, bidi_class::NSM},
-            {0xa77, bidi_class::L},      {0xa81, bidi_class::None},
-            {0xa83, bidi_class::NSM},    {0xa84, bidi_class::L},
-            {0xa85, bidi_class::None},   {0xa8e, bidi_class::L},
-            {0xa8f, bidi_class::None},   {0xa92, bidi_class::L},
-            {0xa93, bidi_class::None},   {0xaa9, bidi_class::L},
-            {0xaaa, bidi_class::None},   {0xab1, bidi_class::L},
-            {0xab2, bidi_class::None},   {0xab4, bidi_class::L},
-            {0xab5, bidi_class::None},   {0xaba, bidi_class::L},
-            {0xabc, bidi_class::None},   {0xabd, bidi_class::NSM},
-            {0xac1, bidi_class::L},      {0xac6, bidi_class::NSM},
-            {0xac7, bidi_class::None},   {0xac9, bidi_class::NSM},
-            {0xaca, bidi_class::L},      {0xacb, bidi_class::None},
-            {0xacd, bidi_class::L},      {0xace, bidi_class::NSM},
-            {0xad0, bidi_class::None},   {0xad1, bidi_class::L},
-            {0xae0, bidi_class::None},   {0xae2, bidi_class::L},
-            {0xae4, bidi_class::NSM},    {0xae6, bidi_class::None},
-            {0xaf1, bidi_class::L},      {0xaf2, bidi_class::ET},
-            {0xaf9, bidi_class::None},   {0xafa, bidi_class::L},
-            {0xb00, bidi_class::NSM},    {0xb01, bidi_class::None},
-            {0xb02, bidi_class::NSM},    {0xb04, bidi_class::L},
-            {0xb05, bidi_class::None},   {0xb0d, bidi_class::L},
-            {0xb0f, bidi_class::None},   {0xb11, bidi_class::L},
-            {0xb13, bidi_class::None},   {0xb29, bidi_class::L},
-            {0xb2a, bidi_class::None},   {0xb31, bidi_class::L},
-            {0xb32, bidi_class::None},   {0xb34, bidi_class::L},
-            {0xb35, bidi_class::None},   {0xb3a, bidi_class::L},
-            {0xb3c, bidi_class::None},   {0xb3d, bidi_class::NSM},
-            {0xb3f, bidi_class::L},      {0xb40, bidi_class::NSM},
-            {0xb41, bidi_class::L},      {0xb45, bidi_class::NSM},
-            {0xb47, bidi_class::None},   {0xb49, bidi_class::L},
-            {0xb4b, bidi_class::None},   {0xb4d, bidi_class::L},
-            {0xb4e, bidi_class::NSM},    {0xb55, bidi_class::None},
-            {0xb57, bidi_class::NSM},    {0xb58, bidi_class::L},
-            {0xb5c, bidi_class::None},   {0xb5e, bidi_class::L},
-            {0xb5f, bidi_class::None},   {0xb62, bidi_class::L},
-            {0xb64, bidi_class::NSM},    {0xb66, bidi_class::None},
-            {0xb78, bidi_class::L},      {0xb82, bidi_class::None},
-            {0xb83, bidi_class::NSM},    {0xb84, bidi_class::L},
-            {0xb85, bidi_class::None},   {0xb8b, bidi_class::L},
-            {0xb8e, bidi_class::None},   {0xb91, bidi_class::L},
-            {0xb92, bidi_class::None},   {0xb96, bidi_class::L},
-            {0xb99, bidi_class::None},   {0xb9b, bidi_class::L},
-            {0xb9c, bidi_class::None},   {0xb9d, bidi_class::L},
-            {0xb9e, bidi_class::None},   {0xba0, bidi_class::L},
-            {0xba3, bidi_class::None},   {0xba5, bidi_class::L},
-            {0xba8, bidi_class::None},   {0xbab, bidi_class::L},
-            {0xbae, bidi_class::None},   {0xbba, bidi_class::L},
-            {0xbbe, bidi_class::None},   {0xbc0, bidi_class::L},
-            {0xbc1, bidi_class::NSM},    {0xbc3, bidi_class::L},
-            {0xbc6, bidi_class::None},   {0xbc9, bidi_class::L},
-            {0xbca, bidi_class::None},   {0xbcd, bidi_class::L},
-            {0xbce, bidi_class::NSM},    {0xbd0, bidi_class::None},
-            {0xbd1, bidi_class::L},      {0xbd7, bidi_class::None},
-            {0xbd8, bidi_class::L},      {0xbe6, bidi_class::None},
-            {0xbf3, bidi_class::L},      {0xbf9, bidi_class::ON},
-            {0xbfa, bidi_class::ET},     {0xbfb, bidi_class::ON},
-            {0xc00, bidi_class::None},   {0xc01, bidi_class::NSM},
-            {0xc04, bidi_class::L},      {0xc05, bidi_class::NSM},
-            {0xc0d, bidi_class::L},      {0xc0e, bidi_class::None},
-            {0xc11, bidi_class::L},      {0xc12, bidi_class::None},
-            {0xc29, bidi_class::L},      {0xc2a, bidi_class::None},
-            {0xc3a, bidi_class::L},      {0xc3d, bidi_class::None},
-            {0xc3e, bidi_class::L},      {0xc41, bidi_class::NSM},
-            {0xc45, bidi_class::L},      {0xc46, bidi_class::None},
-            {0xc49, bidi_class::NSM},    {0xc4a, bidi_class::None},
-            {0xc4e, bidi_class::NSM},    {0xc55, bidi_class::None},
-            {0xc57, bidi_class::NSM},    {0xc58, bidi_class::None},
-            {0xc5b, bidi_class::L},      {0xc60, bidi_class::None},
-            {0xc62, bidi_class::L},      {0xc64, bidi_class::NSM},
-            {0xc66, bidi_class::None},   {0xc70, bidi_class::L},
-            {0xc77, bidi_class::None},   {0xc78, bidi_class::L},
-            {0xc7f, bidi_class::ON},     {0xc81, bidi_class::L},
-            {0xc82, bidi_class::NSM},    {0xc8d, bidi_class::L},
-            {0xc8e, bidi_class::None},   {0xc91, bidi_class::L},
-            {0xc92, bidi_class::None},   {0xca9, bidi_class::L},
-            {0xcaa, bidi_class::None},   {0xcb4, bidi_class::L},
-            {0xcb5, bidi_class::None},   {0xcba, bidi_class::L},
-            {0xcbc, bidi_class::None},   {0xcbd, bidi_class::NSM},
-            {0xcc5, bidi_class::L},      {0xcc6, bidi_class::None},
-            {0xcc9, bidi_class::L},      {0xcca, bidi_class::None},
-            {0xccc, bidi_class::L},      {0xcce, bidi_class::NSM},
-            {0xcd5, bidi_class::None},   {0xcd7, bidi_class::L},
-            {0xcde, bidi_class::None},   {0xcdf, bidi_class::L},
-            {0xce0, bidi_class::None},   {0xce2, bidi_class::L},
-            {0xce4, bidi_class::NSM},    {0xce6, bidi_class::None},
-            {0xcf0, bidi_class::L},      {0xcf1, bidi_class::None},
-            {0xcf3, bidi_class::L},      {0xd00, bidi_class::None},
-            {0xd02, bidi_class::NSM},    {0xd0d, bidi_class::L},
-            {0xd0e, bidi_class::None},   {0xd11, bidi_class::L},
-            {0xd12, bidi_class::None},   {0xd3b, bidi_class::L},
-            {0xd3d, bidi_class::NSM},    {0xd41, bidi_class::L},
-            {0xd45, bidi_class::NSM},    {0xd46, bidi_class::None},
-            {0xd49, bidi_class::L},      {0xd4a, bidi_class::None},
-            {0xd4d, bidi_class::L},      {0xd4e, bidi_class::NSM},
-            {0xd50, bidi_class::L},      {0xd54, bidi_class::None},
-            {0xd62, bidi_class::L},      {0xd64, bidi_class::NSM},
-            {0xd66, bidi_class::None},   {0xd80, bidi_class::L},
-            {0xd81, bidi_class::None},   {0xd82, bidi_class::NSM},
-            {0xd84, bidi_class::L},      {0xd85, bidi_class::None},
-            {0xd97, bidi_class::L},      {0xd9a, bidi_class::None},
-            {0xdb2, bidi_class::L},      {0xdb3, bidi_class::None},
-            {0xdbc, bidi_class::L},      {0xdbd, bidi_class::None},
-            {0xdbe, bidi_class::L},      {0xdc0, bidi_class::None},
-            {0xdc7, bidi_class::L},      {0xdca, bidi_class::None},
-            {0xdcb, bidi_class::NSM},    {0xdcf, bidi_class::None},
-            {0xdd2, bidi_class::L},      {0xdd5, bidi_class::NSM},
-            {0xdd6, bidi_class::None},   {0xdd7, bidi_class::NSM},
-            {0xdd8, bidi_class::None},   {0xde0, bidi_class::L},
-            {0xde6, bidi_class::None},   {0xdf0, bidi_class::L},
-            {0xdf2, bidi_class::None},   {0xdf5, bidi_class::L},
-            {0xe01, bidi_class::None},   {0xe31, bidi_class::L},
-            {0xe32, bidi_class::NSM},    {0xe34, bidi_class::L},
-            {0xe3b, bidi_class::NSM},    {0xe3f, bidi_class::None},
-            {0xe40, bidi_class::ET},     {0xe47, bidi_class::L},
-            {0xe4f, bidi_class::NSM},    {0xe5c, bidi_class::L},
-            {0xe81, bidi_class::None},   {0xe83, bidi_class::L},
-            {0xe84, bidi_class::None},   {0xe85, bidi_class::L},
-            {0xe86, bidi_class::None},   {0xe8b, bidi_class::L},
-            {0xe8c, bidi_class::None},   {0xea4, bidi_class::L},
-            {0xea5, bidi_class::None},   {0xea6, bidi_class::L},
-            {0xea7, bidi_class::None},   {0xeb1, bidi_class::L},
-            {0xeb2, bidi_class::NSM},    {0xeb4, bidi_class::L},
-            {0xebd, bidi_class::NSM},    {0xebe, bidi_class::L},
-            {0xec0, bidi_class::None},   {0xec5, bidi_class::L},
-            {0xec6, bidi_class::None},   {0xec7, bidi_class::L},
-            {0xec8, bidi_class::None},   {0xece, bidi_class::NSM},
-            {0xed0, bidi_class::None},   {0xeda, bidi_class::L},
-            {0xedc, bidi_class::None},   {0xee0, bidi_class::L},
-            {0xf00, bidi_class::None},   {0xf18, bidi_class::L},
-            {0xf1a, bidi_class::NSM},    {0xf35, bidi_class::L},
-            {0xf36, bidi_class::NSM},    {0xf37, bidi_class::L},
-            {0xf38, bidi_class::NSM},    {0xf39, bidi_class::L},
-            {0xf3a, bidi_class::NSM},    {0xf3e, bidi_class::ON},
-            {0xf48, bidi_class::L},      {0xf49, bidi_class::None},
-            {0xf6d, bidi_class::L},      {0xf71, bidi_class::None},
-            {0xf7f, bidi_class::NSM},    {0xf80, bidi_class::L},
-            {0xf85, bidi_class::NSM},    {0xf86, bidi_class::L},
-            {0xf88, bidi_class::NSM},    {0xf8d, bidi_class::L},
-            {0xf98, bidi_class::NSM},    {0xf99, bidi_class::None},
-            {0xfbd, bidi_class::NSM},    {0xfbe, bidi_class::None},
-            {0xfc6, bidi_class::L},      {0xfc7, bidi_class::NSM},
-            {0xfcd, bidi_class::L},      {0xfce, bidi_class::None},
-            {0xfdb, bidi_class::L},      {0x1000, bidi_class::None},
-            {0x102d, bidi_class::L},     {0x1031, bidi_class::NSM},
-            {0x1032, bidi_class::L},     {0x1038, bidi_class::NSM},
-            {0x1039, bidi_class::L},     {0x103b, bidi_class::NSM},
-            {0x103d, bidi_class::L},     {0x103f, bidi_class::NSM},
-            {0x1058, bidi_class::L},     {0x105a, bidi_class::NSM},
-            {0x105e, bidi_class::L},     {0x1061, bidi_class::NSM},
-            {0x1071, bidi_class::L},     {0x1075, bidi_class::NSM},
-            {0x1082, bidi_class::L},     {0x1083, bidi_class::NSM},
-            {0x1085, bidi_class::L},     {0x1087, bidi_class::NSM},
-            {0x108d, bidi_class::L},     {0x108e, bidi_class::NSM},
-            {0x109d, bidi_class::L},     {0x109e, bidi_class::NSM},
-            {0x10c6, bidi_class::L},     {0x10c7, bidi_class::None},
-            {0x10c8, bidi_class::L},     {0x10cd, bidi_class::None},
-            {0x10ce, bidi_class::L},     {0x10d0, bidi_class::None},
-            {0x1249, bidi_class::L},     {0x124a, bidi_class::None},
-            {0x124e, bidi_class::L},     {0x1250, bidi_class::None},
-            {0x1257, bidi_class::L},     {0x1258, bidi_class::None},
-            {0x1259, bidi_class::L},     {0x125a, bidi_class::None},
-            {0x125e, bidi_class::L},     {0x1260, bidi_class::None},
-            {0x1289, bidi_class::L},     {0x128a, bidi_class::None},
-            {0x128e, bidi_class::L},     {0x1290, bidi_class::None},
-            {0x12b1, bidi_class::L},     {0x12b2, bidi_class::None},
-            {0x12b6, bidi_class::L},     {0x12b8, bidi_class::None},
-            {0x12bf, bidi_class::L},     {0x12c0, bidi_class::None},
-            {0x12c1, bidi_class::L},     {0x12c2, bidi_class::None},
-            {0x12c6, bidi_class::L},     {0x12c8, bidi_class::None},
-            {0x12d7, bidi_class::L},     {0x12d8, bidi_class::None},
-            {0x1311, bidi_class::L},     {0x1312, bidi_class::None},
-            {0x1316, bidi_class::L},     {0x1318, bidi_class::None},
-            {0x135b, bidi_class::L},     {0x135d, bidi_class::None},
-            {0x1360, bidi_class::NSM},   {0x137d, bidi_class::L},
-            {0x1380, bidi_class::None},  {0x1390, bidi_class::L},
-            {0x139a, bidi_class::ON},    {0x13a0, bidi_class::None},
-            {0x13f6, bidi_class::L},     {0x13f8, bidi_class::None},
-            {0x13fe, bidi_class::L},     {0x1400, bidi_class::None},
-            {0x1401, bidi_class::ON},    {0x1680, bidi_class::L},
-            {0x1681, bidi_class::WS},    {0x169b, bidi_class::L},
-            {0x169d, bidi_class::ON},    {0x16a0, bidi_class::None},
-            {0x16f9, bidi_class::L},     {0x1700, bidi_class::None},
-            {0x170d, bidi_class::L},     {0x170e, bidi_class::None},
-            {0x1712, bidi_class::L},     {0x1715, bidi_class::NSM},
-            {0x1720, bidi_class::None},  {0x1732, bidi_class::L},
-            {0x1735, bidi_class::NSM},   {0x1737, bidi_class::L},
-            {0x1740, bidi_class::None},  {0x1752, bidi_class::L},
-            {0x1754, bidi_class::NSM},   {0x1760, bidi_class::None},
-            {0x176d, bidi_class::L},     {0x176e, bidi_class::None},
-            {0x1771, bidi_class::L},     {0x1772, bidi_class::None},
-            {0x1774, bidi_class::NSM},   {0x1780, bidi_class::None},
-            {0x17b4, bidi_class::L},     {0x17b6, bidi_class::NSM},
-            {0x17b7, bidi_class::L},     {0x17be, bidi_class::NSM},
-            {0x17c6, bidi_class::L},     {0x17c7, bidi_class::NSM},
-            {0x17c9, bidi_class::L},     {0x17d4, bidi_class::NSM},
-            {0x17db, bidi_class::L},     {0x17dc, bidi_class::ET},
-            {0x17dd, bidi_class::L},     {0x17de, bidi_class::NSM},
-            {0x17e0, bidi_class::None},  {0x17ea, bidi_class::L},
-            {0x17f0, bidi_class::None},  {0x17fa, bidi_class::ON},
-            {0x1800, bidi_class::None},  {0x180b, bidi_class::ON},
-            {0x180e, bidi_class::NSM},   {0x180f, bidi_class::BN},
-            {0x1810, bidi_class::None},  {0x181a, bidi_class::L},
-            {0x1820, bidi_class::None},  {0x1879, bidi_class::L},
-            {0x1880, bidi_class::None},  {0x1885, bidi_class::L},
-            {0x1887, bidi_class::NSM},   {0x18a9, bidi_class::L},
-            {0x18aa, bidi_class::NSM},   {0x18ab, bidi_class::L},
-            {0x18b0, bidi_class::None},  {0x18f6, bidi_class::L},
-            {0x1900, bidi_class::None},  {0x191f, bidi_class::L},
-            {0x1920, bidi_class::None},  {0x1923, bidi_class::NSM},
-            {0x1927, bidi_class::L},     {0x1929, bidi_class::NSM},
-            {0x192c, bidi_class::L},     {0x1930, bidi_class::None},
-            {0x1932, bidi_class::L},     {0x1933, bidi_class::NSM},
-            {0x1939, bidi_class::L},     {0x193c, bidi_class::NSM},
-            {0x1940, bidi_class::None},  {0x1941, bidi_class::ON},
-            {0x1944, bidi_class::None},  {0x1946, bidi_class::ON},
-            {0x196e, bidi_class::L},     {0x1970, bidi_class::None},
-            {0x1975, bidi_class::L},     {0x1980, bidi_class::None},
-            {0x19ac, bidi_class::L},     {0x19b0, bidi_class::None},
-            {0x19ca, bidi_class::L},     {0x19d0, bidi_class::None},
-            {0x19db, bidi_class::L},     {0x19de, bidi_class::None},
-            {0x1a00, bidi_class::ON},    {0x1a17, bidi_class::L},
-            {0x1a19, bidi_class::NSM},   {0x1a1b, bidi_class::L},
-            {0x1a1c, bidi_class::NSM},   {0x1a1e, bidi_class::None},
-            {0x1a56, bidi_class::L},     {0x1a57, bidi_class::NSM},
-            {0x1a58, bidi_class::L},     {0x1a5f, bidi_class::NSM},
-            {0x1a60, bidi_class::None},  {0x1a61, bidi_class::NSM},
-            {0x1a62, bidi_class::L},     {0x1a63, bidi_class::NSM},
-            {0x1a65, bidi_class::L},     {0x1a6d, bidi_class::NSM},
-            {0x1a73, bidi_class::L},     {0x1a7d, bidi_class::NSM},
-            {0x1a7f, bidi_class::None},  {0x1a80, bidi_class::NSM},
-            {0x1a8a, bidi_class::L},     {0x1a90, bidi_class::None},
-            {0x1a9a, bidi_class::L},     {0x1aa0, bidi_class::None},
-            {0x1aae, bidi_class::L},     {0x1ab0, bidi_class::None},
-            {0x1ac1, bidi_class::NSM},   {0x1b00, bidi_class::None},
-            {0x1b04, bidi_class::NSM},   {0x1b34, bidi_class::L},
-            {0x1b35, bidi_class::NSM},   {0x1b36, bidi_class::L},
-            {0x1b3b, bidi_class::NSM},   {0x1b3c, bidi_class::L},
-            {0x1b3d, bidi_class::NSM},   {0x1b42, bidi_class::L},
-            {0x1b43, bidi_class::NSM},   {0x1b4c, bidi_class::L},
-            {0x1b50, bidi_class::None},  {0x1b6b, bidi_class::L},
-            {0x1b74, bidi_class::NSM},   {0x1b7d, bidi_class::L},
-            {0x1b80, bidi_class::None},  {0x1b82, bidi_class::NSM},
-            {0x1ba2, bidi_class::L},     {0x1ba6, bidi_class::NSM},
-            {0x1ba8, bidi_class::L},     {0x1baa, bidi_class::NSM},
-            {0x1bab, bidi_class::L},     {0x1bae, bidi_class::NSM},
-            {0x1be6, bidi_class::L},     {0x1be7, bidi_class::NSM},
-            {0x1be8, bidi_class::L},     {0x1bea, bidi_class::NSM},
-            {0x1bed, bidi_class::L},     {0x1bee, bidi_class::NSM},
-            {0x1bef, bidi_class::L},     {0x1bf2, bidi_class::NSM},
-            {0x1bf4, bidi_class::L},     {0x1bfc, bidi_class::None},
-            {0x1c2c, bidi_class::L},     {0x1c34, bidi_class::NSM},
-            {0x1c36, bidi_class::L},     {0x1c38, bidi_class::NSM},
-            {0x1c3b, bidi_class::None},  {0x1c4a, bidi_class::L},
-            {0x1c4d, bidi_class::None},  {0x1c89, bidi_class::L},
-            {0x1c90, bidi_class::None},  {0x1cbb, bidi_class::L},
-            {0x1cbd, bidi_class::None},  {0x1cc8, bidi_class::L},
-            {0x1cd0, bidi_class::None},  {0x1cd3, bidi_class::NSM},
-            {0x1cd4, bidi_class::L},     {0x1ce1, bidi_class::NSM},
-            {0x1ce2, bidi_class::L},     {0x1ce9, bidi_class::NSM},
-            {0x1ced, bidi_class::L},     {0x1cee, bidi_class::NSM},
-            {0x1cf4, bidi_class::L},     {0x1cf5, bidi_class::NSM},
-            {0x1cf8, bidi_class::L},     {0x1cfa, bidi_class::NSM},
-            {0x1cfb, bidi_class::L},     {0x1d00, bidi_class::None},
-            {0x1dc0, bidi_class::L},     {0x1dfa, bidi_class::NSM},
-            {0x1dfb, bidi_class::None},  {0x1e00, bidi_class::NSM},
-            {0x1f16, bidi_class::L},     {0x1f18, bidi_class::None},
-            {0x1f1e, bidi_class::L},     {0x1f20, bidi_class::None},
-            {0x1f46, bidi_class::L},     {0x1f48, bidi_class::None},
-            {0x1f4e, bidi_class::L},     {0x1f50, bidi_class::None},
-            {0x1f58, bidi_class::L},     {0x1f59, bidi_class::None},
-            {0x1f5a, bidi_class::L},     {0x1f5b, bidi_class::None},
-            {0x1f5c, bidi_class::L},     {0x1f5d, bidi_class::None},
-            {0x1f5e, bidi_class::L},     {0x1f5f, bidi_class::None},
-            {0x1f7e, bidi_class::L},     {0x1f80, bidi_class::None},
-            {0x1fb5, bidi_class::L},     {0x1fb6, bidi_class::None},
-            {0x1fbd, bidi_class::L},     {0x1fbe, bidi_class::ON},
-            {0x1fbf, bidi_class::L},     {0x1fc2, bidi_class::ON},
-            {0x1fc5, bidi_class::L},     {0x1fc6, bidi_class::None},
-            {0x1fcd, bidi_class::L},     {0x1fd0, bidi_class::ON},
-            {0x1fd4, bidi_class::L},     {0x1fd6, bidi_class::None},
-            {0x1fdc, bidi_class::L},     {0x1fdd, bidi_class::None},
-            {0x1fe0, bidi_class::ON},    {0x1fed, bidi_class::L},
-            {0x1ff0, bidi_class::ON},    {0x1ff2, bidi_class::None},
-            {0x1ff5, bidi_class::L},     {0x1ff6, bidi_class::None},
-            {0x1ffd, bidi_class::L},     {0x1fff, bidi_class::ON},
-            {0x2000, bidi_class::None},  {0x200b, bidi_class::WS},
-            {0x200e, bidi_class::BN},    {0x200f, bidi_class::L},
-            {0x2010, bidi_class::R},     {0x2028, bidi_class::ON},
-            {0x2029, bidi_class::WS},    {0x202a, bidi_class::B},
-            {0x202b, bidi_class::LRE},   {0x202c, bidi_class::RLE},
-            {0x202d, bidi_class::PDF},   {0x202e, bidi_class::LRO},
-            {0x202f, bidi_class::RLO},   {0x2030, bidi_class::CS},
-            {0x2035, bidi_class::ET},    {0x2044, bidi_class::ON},
-            {0x2045, bidi_class::CS},    {0x205f, bidi_class::ON},
-            {0x2060, bidi_class::WS},    {0x2066, bidi_class::BN},
-            {0x2067, bidi_class::LRI},   {0x2068, bidi_class::RLI},
-            {0x2069, bidi_class::FSI},   {0x206a, bidi_class::PDI},
-            {0x2070, bidi_class::BN},    {0x2071, bidi_class::EN},
-            {0x2072, bidi_class::L},     {0x2074, bidi_class::None},
-            {0x207a, bidi_class::EN},    {0x207c, bidi_class::ES},
-            {0x207f, bidi_class::ON},    {0x2080, bidi_class::L},
-            {0x208a, bidi_class::EN},    {0x208c, bidi_class::ES},
-            {0x208f, bidi_class::ON},    {0x2090, bidi_class::None},
-            {0x209d, bidi_class::L},     {0x20a0, bidi_class::None},
-            {0x20d0, bidi_class::ET},    {0x20f1, bidi_class::NSM},
-            {0x2100, bidi_class::None},  {0x2102, bidi_class::ON},
-            {0x2103, bidi_class::L},     {0x2107, bidi_class::ON},
-            {0x2108, bidi_class::L},     {0x210a, bidi_class::ON},
-            {0x2114, bidi_class::L},     {0x2115, bidi_class::ON},
-            {0x2116, bidi_class::L},     {0x2119, bidi_class::ON},
-            {0x211e, bidi_class::L},     {0x2124, bidi_class::ON},
-            {0x2125, bidi_class::L},     {0x2126, bidi_class::ON},
-            {0x2127, bidi_class::L},     {0x2128, bidi_class::ON},
-            {0x2129, bidi_class::L},     {0x212a, bidi_class::ON},
-            {0x212e, bidi_class::L},     {0x212f, bidi_class::ET},
-            {0x213a, bidi_class::L},     {0x213c, bidi_class::ON},
-            {0x2140, bidi_class::L},     {0x2145, bidi_class::ON},
-            {0x214a, bidi_class::L},     {0x214e, bidi_class::ON},
-            {0x2150, bidi_class::L},     {0x2160, bidi_class::ON},
-            {0x2189, bidi_class::L},     {0x218c, bidi_class::ON},
-            {0x2190, bidi_class::None},  {0x2212, bidi_class::ON},
-            {0x2213, bidi_class::ES},    {0x2214, bidi_class::ET},
-            {0x2336, bidi_class::ON},    {0x237b, bidi_class::L},
-            {0x2395, bidi_class::ON},    {0x2396, bidi_class::L},
-            {0x2427, bidi_class::ON},    {0x2440, bidi_class::None},
-            {0x244b, bidi_class::ON},    {0x2460, bidi_class::None},
-            {0x2488, bidi_class::ON},    {0x249c, bidi_class::EN},
-            {0x24ea, bidi_class::L},     {0x26ac, bidi_class::ON},
-            {0x26ad, bidi_class::L},     {0x2800, bidi_class::ON},
-            {0x2900, bidi_class::L},     {0x2b74, bidi_class::ON},
-            {0x2b76, bidi_class::None},  {0x2b96, bidi_class::ON},
-            {0x2b97, bidi_class::None},  {0x2c00, bidi_class::ON},
-            {0x2c2f, bidi_class::L},     {0x2c30, bidi_class::None},
-            {0x2c5f, bidi_class::L},     {0x2c60, bidi_class::None},
-            {0x2ce5, bidi_class::L},     {0x2ceb, bidi_class::ON},
-            {0x2cef, bidi_class::L},     {0x2cf2, bidi_class::NSM},
-            {0x2cf4, bidi_class::L},     {0x2cf9, bidi_class::None},
-            {0x2d00, bidi_class::ON},    {0x2d26, bidi_class::L},
-            {0x2d27, bidi_class::None},  {0x2d28, bidi_class::L},
-            {0x2d2d, bidi_class::None},  {0x2d2e, bidi_class::L},
-            {0x2d30, bidi_class::None},  {0x2d68, bidi_class::L},
-            {0x2d6f, bidi_class::None},  {0x2d71, bidi_class::L},
-            {0x2d7f, bidi_class::None},  {0x2d80, bidi_class::NSM},
-            {0x2d97, bidi_class::L},     {0x2da0, bidi_class::None},
-            {0x2da7, bidi_class::L},     {0x2da8, bidi_class::None},
-            {0x2daf, bidi_class::L},     {0x2db0, bidi_class::None},
-            {0x2db7, bidi_class::L},     {0x2db8, bidi_class::None},
-            {0x2dbf, bidi_class::L},     {0x2dc0, bidi_class::None},
-            {0x2dc7, bidi_class::L},     {0x2dc8, bidi_class::None},
-            {0x2dcf, bidi_class::L},     {0x2dd0, bidi_class::None},
-            {0x2dd7, bidi_class::L},     {0x2dd8, bidi_class::None},
-            {0x2ddf, bidi_class::L},     {0x2de0, bidi_class::None},
-            {0x2e00, bidi_class::NSM},   {0x2e53, bidi_class::ON},
-            {0x2e80, bidi_class::None},  {0x2e9a, bidi_class::ON},
-            {0x2e9b, bidi_class::None},  {0x2ef4, bidi_class::ON},
-            {0x2f00, bidi_class::None},  {0x2fd6, bidi_class::ON},
-            {0x2ff0, bidi_class::None},  {0x2ffc, bidi_class::ON},
-            {0x3000, bidi_class::None},  {0x3001, bidi_class::WS},
-            {0x3005, bidi_class::ON},    {0x3008, bidi_class::L},
-            {0x3021, bidi_class::ON},    {0x302a, bidi_class::L},
-            {0x302e, bidi_class::NSM},   {0x3030, bidi_class::L},
-            {0x3031, bidi_class::ON},    {0x3036, bidi_class::L},
-            {0x3038, bidi_class::ON},    {0x303d, bidi_class::L},
-            {0x3040, bidi_class::ON},    {0x3041, bidi_class::None},
-            {0x3097, bidi_class::L},     {0x3099, bidi_class::None},
-            {0x309b, bidi_class::NSM},   {0x309d, bidi_class::ON},
-            {0x30a0, bidi_class::L},     {0x30a1, bidi_class::ON},
-            {0x30fb, bidi_class::L},     {0x30fc, bidi_class::ON},
-            {0x3100, bidi_class::L},     {0x3105, bidi_class::None},
-            {0x3130, bidi_class::L},     {0x3131, bidi_class::None},
-            {0x318f, bidi_class::L},     {0x3190, bidi_class::None},
-            {0x31c0, bidi_class::L},     {0x31e4, bidi_class::ON},
-            {0x31f0, bidi_class::None},  {0x321d, bidi_class::L},
-            {0x321f, bidi_class::ON},    {0x3220, bidi_class::None},
-            {0x3250, bidi_class::L},     {0x3260, bidi_class::ON},
-            {0x327c, bidi_class::L},     {0x327f, bidi_class::ON},
-            {0x32b1, bidi_class::L},     {0x32c0, bidi_class::ON},
-            {0x32cc, bidi_class::L},     {0x32d0, bidi_class::ON},
-            {0x3377, bidi_class::L},     {0x337b, bidi_class::ON},
-            {0x33de, bidi_class::L},     {0x33e0, bidi_class::ON},
-            {0x33ff, bidi_class::L},     {0x3400, bidi_class::ON},
-            {0x4dc0, bidi_class::L},     {0x4e00, bidi_class::ON},
-            {0x9ffd, bidi_class::L},     {0xa000, bidi_class::None},
-            {0xa48d, bidi_class::L},     {0xa490, bidi_class::None},
-            {0xa4c7, bidi_class::ON},    {0xa4d0, bidi_class::None},
-            {0xa60d, bidi_class::L},     {0xa610, bidi_class::ON},
-            {0xa62c, bidi_class::L},     {0xa640, bidi_class::None},
-            {0xa66f, bidi_class::L},     {0xa673, bidi_class::NSM},
-            {0xa674, bidi_class::ON},    {0xa67e, bidi_class::NSM},
-            {0xa680, bidi_class::ON},    {0xa69e, bidi_class::L},
-            {0xa6a0, bidi_class::NSM},   {0xa6f0, bidi_class::L},
-            {0xa6f2, bidi_class::NSM},   {0xa6f8, bidi_class::L},
-            {0xa700, bidi_class::None},  {0xa722, bidi_class::ON},
-            {0xa788, bidi_class::L},     {0xa789, bidi_class::ON},
-            {0xa7c0, bidi_class::L},     {0xa7c2, bidi_class::None},
-            {0xa7cb, bidi_class::L},     {0xa7f5, bidi_class::None},
-            {0xa802, bidi_class::L},     {0xa803, bidi_class::NSM},
-            {0xa806, bidi_class::L},     {0xa807, bidi_class::NSM},
-            {0xa80b, bidi_class::L},     {0xa80c, bidi_class::NSM},
-            {0xa825, bidi_class::L},     {0xa827, bidi_class::NSM},
-            {0xa828, bidi_class::L},     {0xa82c, bidi_class::ON},
-            {0xa82d, bidi_class::NSM},   {0xa830, bidi_class::None},
-            {0xa838, bidi_class::L},     {0xa83a, bidi_class::ET},
-            {0xa840, bidi_class::None},  {0xa874, bidi_class::L},
-            {0xa878, bidi_class::ON},    {0xa880, bidi_class::None},
-            {0xa8c4, bidi_class::L},     {0xa8c6, bidi_class::NSM},
-            {0xa8ce, bidi_class::None},  {0xa8da, bidi_class::L},
-            {0xa8e0, bidi_class::None},  {0xa8f2, bidi_class::NSM},
-            {0xa8ff, bidi_class::L},     {0xa900, bidi_class::NSM},
-            {0xa926, bidi_class::L},     {0xa92e, bidi_class::NSM},
-            {0xa947, bidi_class::L},     {0xa952, bidi_class::NSM},
-            {0xa954, bidi_class::L},     {0xa95f, bidi_class::None},
-            {0xa97d, bidi_class::L},     {0xa980, bidi_class::None},
-            {0xa983, bidi_class::NSM},   {0xa9b3, bidi_class::L},
-            {0xa9b4, bidi_class::NSM},   {0xa9b6, bidi_class::L},
-            {0xa9ba, bidi_class::NSM},   {0xa9bc, bidi_class::L},
-            {0xa9be, bidi_class::NSM},   {0xa9ce, bidi_class::L},
-            {0xa9cf, bidi_class::None},  {0xa9da, bidi_class::L},
-            {0xa9de, bidi_class::None},  {0xa9e5, bidi_class::L},
-            {0xa9e6, bidi_class::NSM},   {0xa9ff, bidi_class::L},
-            {0xaa00, bidi_class::None},  {0xaa29, bidi_class::L},
-            {0xaa2f, bidi_class::NSM},   {0xaa31, bidi_class::L},
-            {0xaa33, bidi_class::NSM},   {0xaa35, bidi_class::L},
-            {0xaa37, bidi_class::NSM},   {0xaa40, bidi_class::None},
-            {0xaa43, bidi_class::L},     {0xaa44, bidi_class::NSM},
-            {0xaa4c, bidi_class::L},     {0xaa4d, bidi_class::NSM},
-            {0xaa4e, bidi_class::L},     {0xaa50, bidi_class::None},
-            {0xaa5a, bidi_class::L},     {0xaa5c, bidi_class::None},
-            {0xaa7c, bidi_class::L},     {0xaa7d, bidi_class::NSM},
-            {0xaab0, bidi_class::L},     {0xaab1, bidi_class::NSM},
-            {0xaab2, bidi_class::L},     {0xaab5, bidi_class::NSM},
-            {0xaab7, bidi_class::L},     {0xaab9, bidi_class::NSM},
-            {0xaabe, bidi_class::L},     {0xaac0, bidi_class::NSM},
-            {0xaac1, bidi_class::L},     {0xaac2, bidi_class::NSM},
-            {0xaac3, bidi_class::L},     {0xaadb, bidi_class::None},
-            {0xaaec, bidi_class::L},     {0xaaee, bidi_class::NSM},
-            {0xaaf6, bidi_class::L},     {0xaaf7, bidi_class::NSM},
-            {0xab01, bidi_class::None},  {0xab07, bidi_class::L},
-            {0xab09, bidi_class::None},  {0xab0f, bidi_class::L},
-            {0xab11, bidi_class::None},  {0xab17, bidi_class::L},
-            {0xab20, bidi_class::None},  {0xab27, bidi_class::L},
-            {0xab28, bidi_class::None},  {0xab2f, bidi_class::L},
-            {0xab30, bidi_class::None},  {0xab6a, bidi_class::L},
-            {0xab6c, bidi_class::ON},    {0xab70, bidi_class::None},
-            {0xabe5, bidi_class::L},     {0xabe6, bidi_class::NSM},
-            {0xabe8, bidi_class::L},     {0xabe9, bidi_class::NSM},
-            {0xabed, bidi_class::L},     {0xabee, bidi_class::NSM},
-            {0xabf0, bidi_class::None},  {0xabfa, bidi_class::L},
-            {0xac00, bidi_class::None},  {0xd7a4, bidi_class::L},
-            {0xd7b0, bidi_class::None},  {0xd7c7, bidi_class::L},
-            {0xd7cb, bidi_class::None},  {0xd7fc, bidi_class::L},
-            {0xe000, bidi_class::None},  {0xfa6e, bidi_class::L},
-            {0xfa70, bidi_class::None},  {0xfada, bidi_class::L},
-            {0xfb00, bidi_class::None},  {0xfb07, bidi_class::L},
-            {0xfb13, bidi_class::None},  {0xfb18, bidi_class::L},
-            {0xfb1d, bidi_class::None},  {0xfb1e, bidi_class::R},
-            {0xfb1f, bidi_class::NSM},   {0xfb29, bidi_class::R},
-            {0xfb2a, bidi_class::ES},    {0xfb50, bidi_class::R},
-            {0xfd3e, bidi_class::AL},    {0xfd40, bidi_class::ON},
-            {0xfdd0, bidi_class::AL},    {0xfdf0, bidi_class::BN},
-            {0xfdfd, bidi_class::AL},    {0xfdfe, bidi_class::ON},
-            {0xfe00, bidi_class::AL},    {0xfe10, bidi_class::NSM},
-            {0xfe1a, bidi_class::ON},    {0xfe20, bidi_class::None},
-            {0xfe30, bidi_class::NSM},   {0xfe50, bidi_class::ON},
-            {0xfe51, bidi_class::CS},    {0xfe52, bidi_class::ON},
-            {0xfe53, bidi_class::CS},    {0xfe54, bidi_class::None},
-            {0xfe55, bidi_class::ON},    {0xfe56, bidi_class::CS},
-            {0xfe5f, bidi_class::ON},    {0xfe60, bidi_class::ET},
-            {0xfe62, bidi_class::ON},    {0xfe64, bidi_class::ES},
-            {0xfe67, bidi_class::ON},    {0xfe68, bidi_class::None},
-            {0xfe69, bidi_class::ON},    {0xfe6b, bidi_class::ET},
-            {0xfe6c, bidi_class::ON},    {0xfe70, bidi_class::None},
-            {0xfeff, bidi_class::AL},    {0xff00, bidi_class::BN},
-            {0xff01, bidi_class::None},  {0xff03, bidi_class::ON},
-            {0xff06, bidi_class::ET},    {0xff0b, bidi_class::ON},
-            {0xff0c, bidi_class::ES},    {0xff0d, bidi_class::CS},
-            {0xff0e, bidi_class::ES},    {0xff10, bidi_class::CS},
-            {0xff1a, bidi_class::EN},    {0xff1b, bidi_class::CS},
-            {0xff21, bidi_class::ON},    {0xff3b, bidi_class::L},
-            {0xff41, bidi_class::ON},    {0xff5b, bidi_class::L},
-            {0xff66, bidi_class::ON},    {0xffbf, bidi_class::L},
-            {0xffc2, bidi_class::None},  {0xffc8, bidi_class::L},
-            {0xffca, bidi_class::None},  {0xffd0, bidi_class::L},
-            {0xffd2, bidi_class::None},  {0xffd8, bidi_class::L},
-            {0xffda, bidi_class::None},  {0xffdd, bidi_class::L},
-            {0xffe0, bidi_class::None},  {0xffe2, bidi_class::ET},
-            {0xffe5, bidi_class::ON},    {0xffe7, bidi_class::ET},
-            {0xffe8, bidi_class::None},  {0xffef, bidi_class::ON},
-            {0xfff0, bidi_class::None},  {0xfff9, bidi_class::BN},
-            {0xfffe, bidi_class::ON},    {0x10000, bidi_class::BN},
-            {0x1000c, bidi_class::L},    {0x1000d, bidi_class::None},
-            {0x10027, bidi_class::L},    {0x10028, bidi_class::None},
-            {0x1003b, bidi_class::L},    {0x1003c, bidi_class::None},
-            {0x1003e, bidi_class::L},    {0x1003f, bidi_class::None},
-            {0x1004e, bidi_class::L},    {0x10050, bidi_class::None},
-            {0x1005e, bidi_class::L},    {0x10080, bidi_class::None},
-            {0x100fb, bidi_class::L},    {0x10100, bidi_class::None},
-            {0x10101, bidi_class::L},    {0x10102, bidi_class::ON},
-            {0x10103, bidi_class::L},    {0x10107, bidi_class::None},
-            {0x10134, bidi_class::L},    {0x10137, bidi_class::None},
-            {0x10140, bidi_class::L},    {0x1018d, bidi_class::ON},
-            {0x1018f, bidi_class::L},    {0x10190, bidi_class::None},
-            {0x1019d, bidi_class::ON},   {0x101a0, bidi_class::None},
-            {0x101a1, bidi_class::ON},   {0x101d0, bidi_class::None},
-            {0x101fd, bidi_class::L},    {0x101fe, bidi_class::NSM},
-            {0x10280, bidi_class::None}, {0x1029d, bidi_class::L},
-            {0x102a0, bidi_class::None}, {0x102d1, bidi_class::L},
-            {0x102e0, bidi_class::None}, {0x102e1, bidi_class::NSM},
-            {0x102fc, bidi_class::EN},   {0x10300, bidi_class::None},
-            {0x10324, bidi_class::L},    {0x1032d, bidi_class::None},
-            {0x1034b, bidi_class::L},    {0x10350, bidi_class::None},
-            {0x10376, bidi_class::L},    {0x1037b, bidi_class::NSM},
-            {0x10380, bidi_class::None}, {0x1039e, bidi_class::L},
-            {0x1039f, bidi_class::None}, {0x103c4, bidi_class::L},
-            {0x103c8, bidi_class::None}, {0x103d6, bidi_class::L},
-            {0x10400, bidi_class::None}, {0x1049e, bidi_class::L},
-            {0x104a0, bidi_class::None}, {0x104aa, bidi_class::L},
-            {0x104b0, bidi_class::None}, {0x104d4, bidi_class::L},
-            {0x104d8, bidi_class::None}, {0x104fc, bidi_class::L},
-            {0x10500, bidi_class::None}, {0x10528, bidi_class::L},
-            {0x10530, bidi_class::None}, {0x10564, bidi_class::L},
-            {0x1056f, bidi_class::None}, {0x10570, bidi_class::L},
-            {0x10600, bidi_class::None}, {0x10737, bidi_class::L},
-            {0x10740, bidi_class::None}, {0x10756, bidi_class::L},
-            {0x10760, bidi_class::None}, {0x10768, bidi_class::L},
-            {0x10800, bidi_class::None}, {0x1091f, bidi_class::R},
-            {0x10920, bidi_class::ON},   {0x10a01, bidi_class::R},
-            {0x10a04, bidi_class::NSM},  {0x10a05, bidi_class::R},
-            {0x10a07, bidi_class::NSM},  {0x10a0c, bidi_class::R},
-            {0x10a10, bidi_class::NSM},  {0x10a38, bidi_class::R},
-            {0x10a3b, bidi_class::NSM},  {0x10a3f, bidi_class::R},
-            {0x10a40, bidi_class::NSM},  {0x10ae5, bidi_class::R},
-            {0x10ae7, bidi_class::NSM},  {0x10b39, bidi_class::R},
-            {0x10b40, bidi_class::ON},   {0x10d00, bidi_class::R},
-            {0x10d24, bidi_class::AL},   {0x10d28, bidi_class::NSM},
-            {0x10d30, bidi_class::AL},   {0x10d3a, bidi_class::AN},
-            {0x10d40, bidi_class::AL},   {0x10e60, bidi_class::R},
-            {0x10e7f, bidi_class::AN},   {0x10eab, bidi_class::R},
-            {0x10ead, bidi_class::NSM},  {0x10f30, bidi_class::R},
-            {0x10f46, bidi_class::AL},   {0x10f51, bidi_class::NSM},
-            {0x10f70, bidi_class::AL},   {0x11000, bidi_class::R},
-            {0x11001, bidi_class::L},    {0x11002, bidi_class::NSM},
-            {0x11038, bidi_class::L},    {0x11047, bidi_class::NSM},
-            {0x1104e, bidi_class::L},    {0x11052, bidi_class::None},
-            {0x11066, bidi_class::ON},   {0x11070, bidi_class::L},
-            {0x1107f, bidi_class::None}, {0x11082, bidi_class::NSM},
-            {0x110b3, bidi_class::L},    {0x110b7, bidi_class::NSM},
-            {0x110b9, bidi_class::L},    {0x110bb, bidi_class::NSM},
-            {0x110c2, bidi_class::L},    {0x110cd, bidi_class::None},
-            {0x110ce, bidi_class::L},    {0x110d0, bidi_class::None},
-            {0x110e9, bidi_class::L},    {0x110f0, bidi_class::None},
-            {0x110fa, bidi_class::L},    {0x11100, bidi_class::None},
-            {0x11103, bidi_class::NSM},  {0x11127, bidi_class::L},
-            {0x1112c, bidi_class::NSM},  {0x1112d, bidi_class::L},
-            {0x11135, bidi_class::NSM},  {0x11136, bidi_class::None},
-            {0x11148, bidi_class::L},    {0x11150, bidi_class::None},
-            {0x11173, bidi_class::L},    {0x11174, bidi_class::NSM},
-            {0x11177, bidi_class::L},    {0x11180, bidi_class::None},
-            {0x11182, bidi_class::NSM},  {0x111b6, bidi_class::L},
-            {0x111bf, bidi_class::NSM},  {0x111c9, bidi_class::L},
-            {0x111cd, bidi_class::NSM},  {0x111cf, bidi_class::L},
-            {0x111d0, bidi_class::NSM},  {0x111e0, bidi_class::L},
-            {0x111e1, bidi_class::None}, {0x111f5, bidi_class::L},
-            {0x11200, bidi_class::None}, {0x11212, bidi_class::L},
-            {0x11213, bidi_class::None}, {0x1122f, bidi_class::L},
-            {0x11232, bidi_class::NSM},  {0x11234, bidi_class::L},
-            {0x11235, bidi_class::NSM},  {0x11236, bidi_class::L},
-            {0x11238, bidi_class::NSM},  {0x1123e, bidi_class::L},
-            {0x1123f, bidi_class::NSM},  {0x11280, bidi_class::None},
-            {0x11287, bidi_class::L},    {0x11288, bidi_class::None},
-            {0x11289, bidi_class::L},    {0x1128a, bidi_class::None},
-            {0x1128e, bidi_class::L},    {0x1128f, bidi_class::None},
-            {0x1129e, bidi_class::L},    {0x1129f, bidi_class::None},
-            {0x112aa, bidi_class::L},    {0x112b0, bidi_class::None},
-            {0x112df, bidi_class::L},    {0x112e0, bidi_class::NSM},
-            {0x112e3, bidi_class::L},    {0x112eb, bidi_class::NSM},
-            {0x112f0, bidi_class::None}, {0x112fa, bidi_class::L},
-            {0x11300, bidi_class::None}, {0x11302, bidi_class::NSM},
-            {0x11304, bidi_class::L},    {0x11305, bidi_class::None},
-            {0x1130d, bidi_class::L},    {0x1130f, bidi_class::None},
-            {0x11311, bidi_class::L},    {0x11313, bidi_class::None},
-            {0x11329, bidi_class::L},    {0x1132a, bidi_class::None},
-            {0x11331, bidi_class::L},    {0x11332, bidi_class::None},
-            {0x11334, bidi_class::L},    {0x11335, bidi_class::None},
-            {0x1133a, bidi_class::L},    {0x1133b, bidi_class::None},
-            {0x1133d, bidi_class::NSM},  {0x11340, bidi_class::L},
-            {0x11341, bidi_class::NSM},  {0x11345, bidi_class::L},
-            {0x11347, bidi_class::None}, {0x11349, bidi_class::L},
-            {0x1134b, bidi_class::None}, {0x1134e, bidi_class::L},
-            {0x11350, bidi_class::None}, {0x11351, bidi_class::L},
-            {0x11357, bidi_class::None}, {0x11358, bidi_class::L},
-            {0x1135d, bidi_class::None}, {0x11364, bidi_class::L},
-            {0x11366, bidi_class::None}, {0x1136d, bidi_class::NSM},
-            {0x11370, bidi_class::None}, {0x11375, bidi_class::NSM},
-            {0x11400, bidi_class::None}, {0x11438, bidi_class::L},
-            {0x11440, bidi_class::NSM},  {0x11442, bidi_class::L},
-            {0x11445, bidi_class::NSM},  {0x11446, bidi_class::L},
-            {0x11447, bidi_class::NSM},  {0x1145c, bidi_class::L},
-            {0x1145d, bidi_class::None}, {0x1145e, bidi_class::L},
-            {0x1145f, bidi_class::NSM},  {0x11462, bidi_class::L},
-            {0x11480, bidi_class::None}, {0x114b3, bidi_class::L},
-            {0x114b9, bidi_class::NSM},  {0x114ba, bidi_class::L},
-            {0x114bb, bidi_class::NSM},  {0x114bf, bidi_class::L},
-            {0x114c1, bidi_class::NSM},  {0x114c2, bidi_class::L},
-            {0x114c4, bidi_class::NSM},  {0x114c8, bidi_class::L},
-            {0x114d0, bidi_class::None}, {0x114da, bidi_class::L},
-            {0x11580, bidi_class::None}, {0x115b2, bidi_class::L},
-            {0x115b6, bidi_class::NSM},  {0x115b8, bidi_class::None},
-            {0x115bc, bidi_class::L},    {0x115be, bidi_class::NSM},
-            {0x115bf, bidi_class::L},    {0x115c1, bidi_class::NSM},
-            {0x115dc, bidi_class::L},    {0x115de, bidi_class::NSM},
-            {0x11600, bidi_class::None}, {0x11633, bidi_class::L},
-            {0x1163b, bidi_class::NSM},  {0x1163d, bidi_class::L},
-            {0x1163e, bidi_class::NSM},  {0x1163f, bidi_class::L},
-            {0x11641, bidi_class::NSM},  {0x11645, bidi_class::L},
-            {0x11650, bidi_class::None}, {0x1165a, bidi_class::L},
-            {0x11660, bidi_class::None}, {0x1166d, bidi_class::ON},
-            {0x11680, bidi_class::None}, {0x116ab, bidi_class::L},
-            {0x116ac, bidi_class::NSM},  {0x116ad, bidi_class::L},
-            {0x116ae, bidi_class::NSM},  {0x116b0, bidi_class::L},
-            {0x116b6, bidi_class::NSM},  {0x116b7, bidi_class::L},
-            {0x116b8, bidi_class::NSM},  {0x116b9, bidi_class::L},
-            {0x116c0, bidi_class::None}, {0x116ca, bidi_class::L},
-            {0x11700, bidi_class::None}, {0x1171b, bidi_class::L},
-            {0x1171d, bidi_class::None}, {0x11720, bidi_class::NSM},
-            {0x11722, bidi_class::L},    {0x11726, bidi_class::NSM},
-            {0x11727, bidi_class::L},    {0x1172c, bidi_class::NSM},
-            {0x11730, bidi_class::None}, {0x11740, bidi_class::L},
-            {0x11800, bidi_class::None}, {0x1182f, bidi_class::L},
-            {0x11838, bidi_class::NSM},  {0x11839, bidi_class::L},
-            {0x1183b, bidi_class::NSM},  {0x1183c, bidi_class::L},
-            {0x118a0, bidi_class::None}, {0x118f3, bidi_class::L},
-            {0x118ff, bidi_class::None}, {0x11907, bidi_class::L},
-            {0x11909, bidi_class::None}, {0x1190a, bidi_class::L},
-            {0x1190c, bidi_class::None}, {0x11914, bidi_class::L},
-            {0x11915, bidi_class::None}, {0x11917, bidi_class::L},
-            {0x11918, bidi_class::None}, {0x11936, bidi_class::L},
-            {0x11937, bidi_class::None}, {0x11939, bidi_class::L},
-            {0x1193b, bidi_class::None}, {0x1193d, bidi_class::NSM},
-            {0x1193e, bidi_class::L},    {0x1193f, bidi_class::NSM},
-            {0x11943, bidi_class::L},    {0x11944, bidi_class::NSM},
-            {0x11947, bidi_class::L},    {0x11950, bidi_class::None},
-            {0x1195a, bidi_class::L},    {0x119a0, bidi_class::None},
-            {0x119a8, bidi_class::L},    {0x119aa, bidi_class::None},
-            {0x119d4, bidi_class::L},    {0x119d8, bidi_class::NSM},
-            {0x119da, bidi_class::None}, {0x119dc, bidi_class::NSM},
-            {0x119e0, bidi_class::L},    {0x119e1, bidi_class::NSM},
-            {0x119e5, bidi_class::L},    {0x11a00, bidi_class::None},
-            {0x11a01, bidi_class::L},    {0x11a07, bidi_class::NSM},
-            {0x11a09, bidi_class::L},    {0x11a0b, bidi_class::NSM},
-            {0x11a33, bidi_class::L},    {0x11a39, bidi_class::NSM},
-            {0x11a3b, bidi_class::L},    {0x11a3f, bidi_class::NSM},
-            {0x11a47, bidi_class::L},    {0x11a48, bidi_class::NSM},
-            {0x11a50, bidi_class::None}, {0x11a51, bidi_class::L},
-            {0x11a57, bidi_class::NSM},  {0x11a59, bidi_class::L},
-            {0x11a5c, bidi_class::NSM},  {0x11a8a, bidi_class::L},
-            {0x11a97, bidi_class::NSM},  {0x11a98, bidi_class::L},
-            {0x11a9a, bidi_class::NSM},  {0x11aa3, bidi_class::L},
-            {0x11ac0, bidi_class::None}, {0x11af9, bidi_class::L},
-            {0x11c00, bidi_class::None}, {0x11c09, bidi_class::L},
-            {0x11c0a, bidi_class::None}, {0x11c30, bidi_class::L},
-            {0x11c37, bidi_class::NSM},  {0x11c38, bidi_class::None},
-            {0x11c3e, bidi_class::NSM},  {0x11c46, bidi_class::L},
-            {0x11c50, bidi_class::None}, {0x11c6d, bidi_class::L},
-            {0x11c70, bidi_class::None}, {0x11c90, bidi_class::L},
-            {0x11c92, bidi_class::None}, {0x11ca8, bidi_class::NSM},
-            {0x11ca9, bidi_class::None}, {0x11caa, bidi_class::L},
-            {0x11cb1, bidi_class::NSM},  {0x11cb2, bidi_class::L},
-            {0x11cb4, bidi_class::NSM},  {0x11cb5, bidi_class::L},
-            {0x11cb7, bidi_class::NSM},  {0x11d00, bidi_class::None},
-            {0x11d07, bidi_class::L},    {0x11d08, bidi_class::None},
-            {0x11d0a, bidi_class::L},    {0x11d0b, bidi_class::None},
-            {0x11d31, bidi_class::L},    {0x11d37, bidi_class::NSM},
-            {0x11d3a, bidi_class::None}, {0x11d3b, bidi_class::NSM},
-            {0x11d3c, bidi_class::None}, {0x11d3e, bidi_class::NSM},
-            {0x11d3f, bidi_class::None}, {0x11d46, bidi_class::NSM},
-            {0x11d47, bidi_class::L},    {0x11d48, bidi_class::NSM},
-            {0x11d50, bidi_class::None}, {0x11d5a, bidi_class::L},
-            {0x11d60, bidi_class::None}, {0x11d66, bidi_class::L},
-            {0x11d67, bidi_class::None}, {0x11d69, bidi_class::L},
-            {0x11d6a, bidi_class::None}, {0x11d8f, bidi_class::L},
-            {0x11d90, bidi_class::None}, {0x11d92, bidi_class::NSM},
-            {0x11d93, bidi_class::None}, {0x11d95, bidi_class::L},
-            {0x11d96, bidi_class::NSM},  {0x11d97, bidi_class::L},
-            {0x11d98, bidi_class::NSM},  {0x11d99, bidi_class::L},
-            {0x11da0, bidi_class::None}, {0x11daa, bidi_class::L},
-            {0x11ee0, bidi_class::None}, {0x11ef3, bidi_class::L},
-            {0x11ef5, bidi_class::NSM},  {0x11ef9, bidi_class::L},
-            {0x11fb0, bidi_class::None}, {0x11fb1, bidi_class::L},
-            {0x11fc0, bidi_class::None}, {0x11fd5, bidi_class::L},
-            {0x11fdd, bidi_class::ON},   {0x11fe1, bidi_class::ET},
-            {0x11ff2, bidi_class::ON},   {0x11fff, bidi_class::None},
-            {0x1239a, bidi_class::L},    {0x12400, bidi_class::None},
-            {0x1246f, bidi_class::L},    {0x12470, bidi_class::None},
-            {0x12475, bidi_class::L},    {0x12480, bidi_class::None},
-            {0x12544, bidi_class::L},    {0x13000, bidi_class::None},
-            {0x1342f, bidi_class::L},    {0x13430, bidi_class::None},
-            {0x13439, bidi_class::L},    {0x14400, bidi_class::None},
-            {0x14647, bidi_class::L},    {0x16800, bidi_class::None},
-            {0x16a39, bidi_class::L},    {0x16a40, bidi_class::None},
-            {0x16a5f, bidi_class::L},    {0x16a60, bidi_class::None},
-            {0x16a6a, bidi_class::L},    {0x16a6e, bidi_class::None},
-            {0x16a70, bidi_class::L},    {0x16ad0, bidi_class::None},
-            {0x16aee, bidi_class::L},    {0x16af0, bidi_class::None},
-            {0x16af5, bidi_class::NSM},  {0x16af6, bidi_class::L},
-            {0x16b00, bidi_class::None}, {0x16b30, bidi_class::L},
-            {0x16b37, bidi_class::NSM},  {0x16b46, bidi_class::L},
-            {0x16b50, bidi_class::None}, {0x16b5a, bidi_class::L},
-            {0x16b5b, bidi_class::None}, {0x16b62, bidi_class::L},
-            {0x16b63, bidi_class::None}, {0x16b78, bidi_class::L},
-            {0x16b7d, bidi_class::None}, {0x16b90, bidi_class::L},
-            {0x16e40, bidi_class::None}, {0x16e9b, bidi_class::L},
-            {0x16f00, bidi_class::None}, {0x16f4b, bidi_class::L},
-            {0x16f4f, bidi_class::None}, {0x16f50, bidi_class::NSM},
-            {0x16f88, bidi_class::L},    {0x16f8f, bidi_class::None},
-            {0x16f93, bidi_class::NSM},  {0x16fa0, bidi_class::L},
-            {0x16fe0, bidi_class::None}, {0x16fe2, bidi_class::L},
-            {0x16fe3, bidi_class::ON},   {0x16fe4, bidi_class::L},
-            {0x16fe5, bidi_class::NSM},  {0x16ff0, bidi_class::None},
-            {0x16ff2, bidi_class::L},    {0x17000, bidi_class::None},
-            {0x187f8, bidi_class::L},    {0x18800, bidi_class::None},
-            {0x18cd6, bidi_class::L},    {0x18d00, bidi_class::None},
-            {0x18d09, bidi_class::L},    {0x1b000, bidi_class::None},
-            {0x1b11f, bidi_class::L},    {0x1b150, bidi_class::None},
-            {0x1b153, bidi_class::L},    {0x1b164, bidi_class::None},
-            {0x1b168, bidi_class::L},    {0x1b170, bidi_class::None},
-            {0x1b2fc, bidi_class::L},    {0x1bc00, bidi_class::None},
-            {0x1bc6b, bidi_class::L},    {0x1bc70, bidi_class::None},
-            {0x1bc7d, bidi_class::L},    {0x1bc80, bidi_class::None},
-            {0x1bc89, bidi_class::L},    {0x1bc90, bidi_class::None},
-            {0x1bc9a, bidi_class::L},    {0x1bc9c, bidi_class::None},
-            {0x1bc9d, bidi_class::L},    {0x1bc9f, bidi_class::NSM},
-            {0x1bca0, bidi_class::L},    {0x1bca4, bidi_class::BN},
-            {0x1d000, bidi_class::None}, {0x1d0f6, bidi_class::L},
-            {0x1d100, bidi_class::None}, {0x1d127, bidi_class::L},
-            {0x1d129, bidi_class::None}, {0x1d167, bidi_class::L},
-            {0x1d16a, bidi_class::NSM},  {0x1d173, bidi_class::L},
-            {0x1d17b, bidi_class::BN},   {0x1d183, bidi_class::NSM},
-            {0x1d185, bidi_class::L},    {0x1d18c, bidi_class::NSM},
-            {0x1d1aa, bidi_class::L},    {0x1d1ae, bidi_class::NSM},
-            {0x1d1e9, bidi_class::L},    {0x1d200, bidi_class::None},
-            {0x1d242, bidi_class::ON},   {0x1d245, bidi_class::NSM},
-            {0x1d246, bidi_class::ON},   {0x1d2e0, bidi_class::None},
-            {0x1d2f4, bidi_class::L},    {0x1d300, bidi_class::None},
-            {0x1d357, bidi_class::ON},   {0x1d360, bidi_class::None},
-            {0x1d379, bidi_class::L},    {0x1d400, bidi_class::None},
-            {0x1d455, bidi_class::L},    {0x1d456, bidi_class::None},
-            {0x1d49d, bidi_class::L},    {0x1d49e, bidi_class::None},
-            {0x1d4a0, bidi_class::L},    {0x1d4a2, bidi_class::None},
-            {0x1d4a3, bidi_class::L},    {0x1d4a5, bidi_class::None},
-            {0x1d4a7, bidi_class::L},    {0x1d4a9, bidi_class::None},
-            {0x1d4ad, bidi_class::L},    {0x1d4ae, bidi_class::None},
-            {0x1d4ba, bidi_class::L},    {0x1d4bb, bidi_class::None},
-            {0x1d4bc, bidi_class::L},    {0x1d4bd, bidi_class::None},
-            {0x1d4c4, bidi_class::L},    {0x1d4c5, bidi_class::None},
-            {0x1d506, bidi_class::L},    {0x1d507, bidi_class::None},
-            {0x1d50b, bidi_class::L},    {0x1d50d, bidi_class::None},
-            {0x1d515, bidi_class::L},    {0x1d516, bidi_class::None},
-            {0x1d51d, bidi_class::L},    {0x1d51e, bidi_class::None},
-            {0x1d53a, bidi_class::L},    {0x1d53b, bidi_class::None},
-            {0x1d53f, bidi_class::L},    {0x1d540, bidi_class::None},
-            {0x1d545, bidi_class::L},    {0x1d546, bidi_class::None},
-            {0x1d547, bidi_class::L},    {0x1d54a, bidi_class::None},
-            {0x1d551, bidi_class::L},    {0x1d552, bidi_class::None},
-            {0x1d6a6, bidi_class::L},    {0x1d6a8, bidi_class::None},
-            {0x1d6db, bidi_class::L},    {0x1d6dc, bidi_class::ON},
-            {0x1d715, bidi_class::L},    {0x1d716, bidi_class::ON},
-            {0x1d74f, bidi_class::L},    {0x1d750, bidi_class::ON},
-            {0x1d789, bidi_class::L},    {0x1d78a, bidi_class::ON},
-            {0x1d7c3, bidi_class::L},    {0x1d7c4, bidi_class::ON},
-            {0x1d7cc, bidi_class::L},    {0x1d7ce, bidi_class::None},
-            {0x1d800, bidi_class::EN},   {0x1da00, bidi_class::L},
-            {0x1da37, bidi_class::NSM},  {0x1da3b, bidi_class::L},
-            {0x1da6d, bidi_class::NSM},  {0x1da75, bidi_class::L},
-            {0x1da76, bidi_class::NSM},  {0x1da84, bidi_class::L},
-            {0x1da85, bidi_class::NSM},  {0x1da8c, bidi_class::L},
-            {0x1da9b, bidi_class::None}, {0x1daa0, bidi_class::NSM},
-            {0x1daa1, bidi_class::None}, {0x1dab0, bidi_class::NSM},
-            {0x1e000, bidi_class::None}, {0x1e007, bidi_class::NSM},
-            {0x1e008, bidi_class::None}, {0x1e019, bidi_class::NSM},
-            {0x1e01b, bidi_class::None}, {0x1e022, bidi_class::NSM},
-            {0x1e023, bidi_class::None}, {0x1e025, bidi_class::NSM},
-            {0x1e026, bidi_class::None}, {0x1e02b, bidi_class::NSM},
-            {0x1e100, bidi_class::None}, {0x1e12d, bidi_class::L},
-            {0x1e130, bidi_class::None}, {0x1e137, bidi_class::NSM},
-            {0x1e13e, bidi_class::L},    {0x1e140, bidi_class::None},
-            {0x1e14a, bidi_class::L},    {0x1e14e, bidi_class::None},
-            {0x1e150, bidi_class::L},    {0x1e2c0, bidi_class::None},
-            {0x1e2ec, bidi_class::L},    {0x1e2f0, bidi_class::NSM},
-            {0x1e2fa, bidi_class::L},    {0x1e2ff, bidi_class::None},
-            {0x1e300, bidi_class::ET},   {0x1e800, bidi_class::None},
-            {0x1e8d0, bidi_class::R},    {0x1e8d7, bidi_class::NSM},
-            {0x1e944, bidi_class::R},    {0x1e94b, bidi_class::NSM},
-            {0x1ec70, bidi_class::R},    {0x1ecc0, bidi_class::AL},
-            {0x1ed00, bidi_class::R},    {0x1ed50, bidi_class::AL},
-            {0x1ee00, bidi_class::R},    {0x1eef0, bidi_class::AL},
-            {0x1eef2, bidi_class::ON},   {0x1ef00, bidi_class::AL},
-            {0x1f000, bidi_class::R},    {0x1f02c, bidi_class::ON},
-            {0x1f030, bidi_class::None}, {0x1f094, bidi_class::ON},
-            {0x1f0a0, bidi_class::None}, {0x1f0af, bidi_class::ON},
-            {0x1f0b1, bidi_class::None}, {0x1f0c0, bidi_class::ON},
-            {0x1f0c1, bidi_class::None}, {0x1f0d0, bidi_class::ON},
-            {0x1f0d1, bidi_class::None}, {0x1f0f6, bidi_class::ON},
-            {0x1f100, bidi_class::None}, {0x1f10b, bidi_class::EN},
-            {0x1f110, bidi_class::ON},   {0x1f12f, bidi_class::L},
-            {0x1f130, bidi_class::ON},   {0x1f16a, bidi_class::L},
-            {0x1f170, bidi_class::ON},   {0x1f1ad, bidi_class::L},
-            {0x1f1ae, bidi_class::ON},   {0x1f1e6, bidi_class::None},
-            {0x1f203, bidi_class::L},    {0x1f210, bidi_class::None},
-            {0x1f23c, bidi_class::L},    {0x1f240, bidi_class::None},
-            {0x1f249, bidi_class::L},    {0x1f250, bidi_class::None},
-            {0x1f252, bidi_class::L},    {0x1f260, bidi_class::None},
-            {0x1f266, bidi_class::ON},   {0x1f300, bidi_class::None},
-            {0x1f6d8, bidi_class::ON},   {0x1f6e0, bidi_class::None},
-            {0x1f6ed, bidi_class::ON},   {0x1f6f0, bidi_class::None},
-            {0x1f6fd, bidi_class::ON},   {0x1f700, bidi_class::None},
-            {0x1f774, bidi_class::ON},   {0x1f780, bidi_class::None},
-            {0x1f7d9, bidi_class::ON},   {0x1f7e0, bidi_class::None},
-            {0x1f7ec, bidi_class::ON},   {0x1f800, bidi_class::None},
-            {0x1f80c, bidi_class::ON},   {0x1f810, bidi_class::None},
-            {0x1f848, bidi_class::ON},   {0x1f850, bidi_class::None},
-            {0x1f85a, bidi_class::ON},   {0x1f860, bidi_class::None},
-            {0x1f888, bidi_class::ON},   {0x1f890, bidi_class::None},
-            {0x1f8ae, bidi_class::ON},   {0x1f8b0, bidi_class::None},
-            {0x1f8b2, bidi_class::ON},   {0x1f900, bidi_class::None},
-            {0x1f979, bidi_class::ON},   {0x1f97a, bidi_class::None},
-            {0x1f9cc, bidi_class::ON},   {0x1f9cd, bidi_class::None},
-            {0x1fa54, bidi_class::ON},   {0x1fa60, bidi_class::None},
-            {0x1fa6e, bidi_class::ON},   {0x1fa70, bidi_class::None},
-            {0x1fa75, bidi_class::ON},   {0x1fa78, bidi_class::None},
-            {0x1fa7b, bidi_class::ON},   {0x1fa80, bidi_class::None},
-            {0x1fa87, bidi_class::ON},   {0x1fa90, bidi_class::None},
-            {0x1faa9, bidi_class::ON},   {0x1fab0, bidi_class::None},
-            {0x1fab7, bidi_class::ON},   {0x1fac0, bidi_class::None},
-            {0x1fac3, bidi_class::ON},   {0x1fad0, bidi_class::None},
-            {0x1fad7, bidi_class::ON},   {0x1fb00, bidi_class::None},
-            {0x1fb93, bidi_class::ON},   {0x1fb94, bidi_class::None},
-            {0x1fbcb, bidi_class::ON},   {0x1fbf0, bidi_class::None},
-            {0x1fbfa, bidi_class::EN},   {0x1fffe, bidi_class::None},
-            {0x20000, bidi_class::BN},   {0x2a6de, bidi_class::L},
-            {0x2a700, bidi_class::None}, {0x2b735, bidi_class::L},
-            {0x2b740, bidi_class::None}, {0x2b81e, bidi_class::L},
-            {0x2b820, bidi_class::None}, {0x2cea2, bidi_class::L},
-            {0x2ceb0, bidi_class::None}, {0x2ebe1, bidi_class::L},
-            {0x2f800, bidi_class::None}, {0x2fa1e, bidi_class::L},
-            {0x2fffe, bidi_class::None}, {0x30000, bidi_class::BN},
-            {0x3134b, bidi_class::L},    {0x3fffe, bidi_class::None},
-            {0x40000, bidi_class::BN},   {0x4fffe, bidi_class::None},
-            {0x50000, bidi_class::BN},   {0x5fffe, bidi_class::None},
-            {0x60000, bidi_class::BN},   {0x6fffe, bidi_class::None},
-            {0x70000, bidi_class::BN},   {0x7fffe, bidi_class::None},
-            {0x80000, bidi_class::BN},   {0x8fffe, bidi_class::None},
-            {0x90000, bidi_class::BN},   {0x9fffe, bidi_class::None},
-            {0xa0000, bidi_class::BN},   {0xafffe, bidi_class::None},
-            {0xb0000, bidi_class::BN},   {0xbfffe, bidi_class::None},
-            {0xc0000, bidi_class::BN},   {0xcfffe, bidi_class::None},
-            {0xd0000, bidi_class::BN},   {0xdfffe, bidi_class::None},
-            {0xe0100, bidi_class::BN},   {0xe01f0, bidi_class::NSM},
-            {0xe1000, bidi_class::BN},   {0xefffe, bidi_class::None},
-            {0xf0000, bidi_class::BN},   {0xffffe, bidi_class::L},
-            {0x100000, bidi_class::BN},  {0x10fffe, bidi_class::L},
-            {0x110000, bidi_class::BN},
+            {
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 11, 12, 13, 11, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 12,
+                13, 14, 14, 6, 6, 6, 14, 14, 14, 14, 14, 5, 8, 5, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 14, 14, 14, 14, 14,
+                14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14,
+                14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 10,
+            },
+            {
+                10, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                8, 14, 6, 6, 6, 6, 14, 14, 14, 14, 1, 14, 14, 10, 14, 14, 6, 6, 4, 4, 14, 1, 14, 14, 14, 4, 1, 14, 14, 14, 14, 14,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 1, 1, 1, 1, 1,
+                1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                1, 1, 1, 1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 14, 14, 1, 1, 0, 0, 1, 1, 1, 1, 14, 1,
+            },
+            {
+                0, 0, 0, 0, 14, 14, 1, 14, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 0, 0, 14, 14, 6, 2, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 2, 9,
+                2, 9, 9, 2, 9, 9, 2, 9, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                7, 7, 7, 7, 7, 7, 14, 14, 3, 6, 6, 3, 8, 3, 14, 14, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 7, 7, 3, 3, 3, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 7, 14, 9,
+                9, 9, 9, 9, 9, 3, 3, 9, 9, 14, 9, 9, 9, 9, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 9, 9, 9, 9, 9, 9, 9, 9, 9, 2, 2, 14, 14, 14, 14, 2, 2, 2, 9, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 9, 9, 9, 9, 2, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 2, 9, 9, 9, 2, 9, 9, 9, 9, 9, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 9, 9, 9, 2, 2, 2, 2,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 7, 7, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 7, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            },
+            {
+                9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 9, 1, 1, 1,
+                1, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 9, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 9, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 9, 1, 1, 1,
+                1, 9, 9, 9, 9, 0, 0, 1, 1, 0, 0, 1, 1, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 1,
+                1, 1, 9, 9, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 6, 6, 1, 1, 1, 1, 1, 1, 1, 6, 1, 1, 9, 0,
+            },
+            {
+                0, 9, 9, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 0, 1, 1, 0, 0, 9, 0, 1, 1,
+                1, 9, 9, 0, 0, 0, 0, 9, 9, 0, 0, 9, 9, 9, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 1, 1, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 9, 9, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 9, 1, 1, 1,
+                1, 9, 9, 9, 9, 9, 0, 9, 9, 1, 0, 1, 1, 9, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 9, 9, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 6, 0, 0, 0, 0, 0, 0, 0, 1, 9, 9, 9, 9, 9, 9,
+            },
+            {
+                0, 9, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 9, 1, 1, 9,
+                1, 9, 9, 9, 9, 0, 0, 1, 1, 0, 0, 1, 1, 9, 0, 0, 0, 0, 0, 0, 0, 9, 9, 1, 0, 0, 0, 0, 1, 1, 0, 1,
+                1, 1, 9, 9, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 9, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1,
+                0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+                9, 1, 1, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 9, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14, 14, 6, 14, 0, 0, 0, 0, 0,
+            },
+            {
+                9, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 9, 1, 9, 9,
+                9, 1, 1, 1, 1, 0, 9, 9, 9, 0, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 1, 1, 1, 0, 0, 1, 0, 0,
+                1, 1, 9, 9, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 14, 14, 14, 14, 14, 14, 14, 1,
+            },
+            {
+                1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 9, 1, 1, 1,
+                1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 9, 9, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+                1, 1, 9, 9, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 1, 1,
+                1, 9, 9, 9, 9, 0, 1, 1, 1, 0, 1, 1, 1, 9, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 9, 9, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                0, 9, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 9, 0, 0, 0, 0, 1, 1, 1, 9, 9, 9, 0, 9, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 6,
+                1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 0, 0,
+                1, 1, 1, 1, 1, 0, 1, 0, 9, 9, 9, 9, 9, 9, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 9, 1, 9, 14, 14, 14, 14, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1,
+            },
+            {
+                9, 9, 9, 9, 9, 1, 9, 9, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 1, 1,
+                1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 1, 9, 9, 9, 9, 9, 9, 1, 9, 9, 1, 1, 9, 9, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 1, 1, 1, 9, 9,
+                9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 9, 1, 1, 9, 9, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+                1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 9, 9, 9,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+            },
+            {
+                14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                13, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 9, 9, 9, 9, 9, 9, 9, 1, 1,
+                1, 1, 1, 1, 1, 1, 9, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 6, 1, 9, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 9, 9, 9, 10, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+                9, 9, 9, 1, 1, 1, 1, 9, 9, 1, 1, 1, 0, 0, 0, 0, 1, 1, 9, 1, 1, 1, 1, 1, 1, 9, 9, 9, 0, 0, 0, 0,
+                14, 0, 0, 0, 14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 1, 9, 0, 0, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 9, 9, 9, 9, 9, 9, 9, 0,
+                9, 1, 9, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 9,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 9, 9, 9, 9, 9, 1, 9, 1, 1, 1,
+                1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+            },
+            {
+                9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 9, 9, 9, 9, 1, 1, 9, 9, 1, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 9, 1, 9, 9, 1, 1, 1, 9, 1, 9, 9, 9, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 9, 9, 0, 0, 0, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 1, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 9, 9, 1, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 14, 1, 14,
+                14, 14, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 14, 14, 14,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 14, 14, 0,
+            },
+            {
+                13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 10, 10, 10, 1, 2, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 13, 11, 15, 17, 19, 16, 18, 8, 6, 6, 6, 6, 6, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 8, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 13,
+                10, 10, 10, 10, 10, 10, 20, 21, 22, 23, 10, 10, 10, 10, 10, 10, 4, 1, 0, 0, 4, 4, 4, 4, 4, 4, 5, 5, 14, 14, 14, 1,
+            },
+            {
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 14, 14, 14, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+                6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 1, 14, 14, 14, 14, 1, 14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 14, 14, 14, 1, 1, 1, 1, 1, 14, 14,
+                14, 14, 14, 14, 1, 14, 1, 14, 1, 14, 1, 1, 1, 1, 6, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 1, 1, 1, 1,
+                14, 14, 14, 14, 14, 1, 1, 1, 1, 1, 14, 14, 14, 14, 1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 5, 6, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 14, 14, 14, 14, 14, 14, 1, 1, 1, 1, 9, 9, 9, 1, 1, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+                1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0,
+            },
+            {
+                13, 14, 14, 14, 14, 1, 1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 1, 1, 14, 1, 1, 1, 1, 1, 14, 14, 1, 1, 1, 1, 1, 14, 14, 14,
+                0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 9, 9, 14, 14, 1, 1, 1,
+                14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1,
+            },
+            {
+                0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 14, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 14, 14,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 9, 1, 1, 1, 9, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 9, 9, 1, 14, 14, 14, 14, 9, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 6, 6, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+            },
+            {
+                9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 9, 9, 9, 9, 1, 1, 9, 9, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1,
+                1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 1, 1, 9, 9, 1, 1, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 9, 9, 9, 1, 1, 9, 9, 1, 1, 1, 1, 1, 9, 9,
+                1, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 9, 1, 1, 9, 1, 1, 1, 1, 9, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 2, 9, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 14, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 14, 14, 14,
+            },
+            {
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 8, 14, 8, 0, 14, 8, 14, 14, 14, 14, 14, 14, 14, 14, 14, 6,
+                14, 14, 5, 5, 14, 14, 14, 0, 14, 6, 6, 14, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 10,
+            },
+            {
+                0, 14, 14, 6, 6, 6, 14, 14, 14, 14, 14, 5, 8, 5, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 14, 14, 14, 14, 14,
+                14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14,
+                14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+                0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0,
+                6, 6, 14, 14, 14, 6, 6, 0, 14, 14, 14, 14, 14, 14, 14, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 14, 14, 14, 14, 14, 10, 10,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 14, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 1, 1, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0,
+                14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                9, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 9, 9, 9, 2, 9, 9, 2, 2, 2, 2, 2, 9, 9, 9, 9, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 9, 9, 9, 2, 2, 2, 2, 9,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 9, 9, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 14, 14, 14, 14, 14, 14, 14,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 3, 3, 3, 3, 3, 3,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 9, 9, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 9, 9, 9, 9, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 9, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+            },
+            {
+                9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 1, 1, 9, 9, 1, 1, 1, 1, 1,
+                1, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 1, 9, 9, 9, 9, 9, 9, 9, 9, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 1, 1, 9, 1, 9, 9, 1, 1, 1, 1, 1, 1, 9, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9,
+                1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                9, 9, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 9, 9, 1, 1, 1,
+                9, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+                1, 1, 1, 1, 0, 0, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9,
+                1, 1, 9, 9, 9, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 9, 1,
+                1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 1, 9, 1, 1, 1, 1, 9,
+                9, 1, 9, 9, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 0, 0, 1, 1, 1, 1, 9, 9, 1, 9,
+                9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 9, 1, 9,
+                9, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 9, 1, 1, 9, 9, 9, 9, 9, 9, 1, 9, 1, 1, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 9, 9, 9,
+                1, 1, 9, 9, 9, 9, 1, 9, 9, 9, 9, 9, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 9, 9, 1, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 9, 9, 1, 9, 1,
+                1, 1, 1, 9, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 0, 0, 9, 9, 1, 1, 1, 1,
+                9, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 9, 9, 9, 9, 9, 9, 1, 1, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 1, 1, 9, 9, 9, 9, 1,
+                1, 1, 1, 1, 1, 1, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 9, 9, 9, 9, 9, 9, 1, 1, 9, 9, 9, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 9, 9, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 1, 1,
+                1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 0, 1, 9, 9, 9, 9, 9, 9, 9, 1, 9, 9, 1, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 0, 0, 0, 9, 0, 9, 9, 0, 9,
+                9, 9, 9, 9, 9, 9, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 9, 9, 0, 1, 1, 9, 1, 9, 1, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14, 14, 14, 14, 6, 6, 6,
+                6, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 9, 9, 9, 9, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1,
+                1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 14, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 9, 9, 1,
+                10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 10, 10, 10, 10, 10, 10, 10, 9, 9, 9, 9, 9,
+            },
+            {
+                9, 9, 9, 1, 1, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 9, 9, 9, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+                0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1,
+                1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0,
+                1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 14, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+            },
+            {
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 9, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9,
+                0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 9, 9, 9, 9, 9,
+                9, 9, 0, 9, 9, 0, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 6,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 9, 9, 9, 9, 9, 9, 9, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 9, 9, 9, 9, 9, 9, 9, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            },
+            {
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+                3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 14, 14, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 14, 14, 14, 14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 14, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 14, 14, 14, 14, 14, 0, 0, 0, 14, 14, 14, 14, 14, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+                14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+                14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            },
+            {
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+                10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            },
+            {
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+            },
+            {
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+                9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+            },
+            {
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+                1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 10,
+            },
         };
+        // end generated bidi_class
+
+        template<size_t Rows>
+        unsigned property_of(char32_t ch, const uint8_t (&blocks)[0x110000 >> property_block_shift],
+                             const uint8_t (&values)[Rows][property_block_size])
+        {
+            return ch < 0x110000 ? values[blocks[ch >> property_block_shift]][ch & (property_block_size - 1)] : 0;
+        }
+
+        bool has_category(char32_t ch, general_category category)
+        {
+            const auto bit = property_of(ch, general_category_blocks, general_category_values);
+            return ((uint64_t(1) << bit) & static_cast<uint64_t>(category)) != 0;
+        }
+
+        numeric_type numeric_type_of(char32_t ch)
+        {
+            return static_cast<numeric_type>(property_of(ch, numeric_type_blocks, numeric_type_values));
+        }
+
+        bidi_class bidi_class_of(char32_t ch)
+        {
+            return static_cast<bidi_class>(property_of(ch, bidi_class_blocks, bidi_class_values));
+        }
+
+        bool has_special_casing(char32_t ch)
+        {
+            const auto block = ch >> case_block_shift;
+            return block < sizeof(special_casing_blocks)
+                   && ((special_casing_bits[special_casing_blocks[block]] >> (ch & (case_block_size - 1))) & 1);
+        }
+
+        const special_casing* find_special_casing(char32_t ch)
+        {
+            if (!has_special_casing(ch))
+            {
+                return nullptr;
+            }
+
+            auto it = std::lower_bound(std::begin(special_casings), std::end(special_casings), ch,
+                                       [](const special_casing& entry, char32_t value) { return entry.ch < value; });
+            return it != std::end(special_casings) && it->ch == ch ? it : nullptr;
+        }
+
+        size_t append_mapping(const char32_t (&mapping)[3], char32_t* out)
+        {
+            size_t len {};
+            for (; len != 3 && mapping[len]; ++len)
+            {
+                out[len] = mapping[len];
+            }
+            return len;
+        }
+
+        // Cased and Case_Ignorable of the Unicode standard. Without Other_Lowercase and
+        // Other_Uppercase, cased is approximated by the letter categories and the case tables.
+        bool is_cased(char32_t ch)
+        {
+            return has_category(ch, general_category::LC) || toupper(ch) != ch || tolower(ch) != ch;
+        }
+
+        bool is_case_ignorable(char32_t ch)
+        {
+            switch (ch)
+            {
+            // Word_Break MidLetter, MidNumLet and Single_Quote
+            case 0x27: case 0x2e: case 0x3a: case 0xb7: case 0x387: case 0x55f: case 0x5f4: case 0x2018:
+            case 0x2019: case 0x2024: case 0x2027: case 0xfe13: case 0xfe52: case 0xfe55: case 0xff07:
+            case 0xff0e: case 0xff1a:
+                return true;
+            default:
+                return has_category(ch, general_category::Mn) || has_category(ch, general_category::Me)
+                       || has_category(ch, general_category::Cf) || has_category(ch, general_category::Lm)
+                       || has_category(ch, general_category::Sk);
+            }
+        }
+
+        // Final_Sigma: preceded by a cased code point and not followed by one, skipping the
+        // case-ignorable ones in between.
+        bool is_final_sigma(const char32_t* in, size_t len, size_t pos)
+        {
+            auto before = pos;
+            while (before != 0 && is_case_ignorable(in[before - 1]))
+            {
+                --before;
+            }
+
+            if (before == 0 || !is_cased(in[before - 1]))
+            {
+                return false;
+            }
+
+            auto after = pos + 1;
+            while (after != len && is_case_ignorable(in[after]))
+            {
+                ++after;
+            }
+            return after == len || !is_cased(in[after]);
+        }
+
+        size_t upper_full(char32_t ch, char32_t* out)
+        {
+            if (auto entry = find_special_casing(ch))
+            {
+                return append_mapping(entry->upper, out);
+            }
+
+            *out = toupper(ch);
+            return 1;
+        }
+
+        size_t lower_full(const char32_t* in, size_t len, size_t pos, char32_t* out)
+        {
+            const auto ch = in[pos];
+            if (ch == 0x3a3)
+            {
+                *out = is_final_sigma(in, len, pos) ? 0x3c2 : 0x3c3;
+                return 1;
+            }
+
+            if (auto entry = find_special_casing(ch))
+            {
+                return append_mapping(entry->lower, out);
+            }
+
+            *out = tolower(ch);
+            return 1;
+        }
+
+        // Runs without special casing are mapped like to_upper/to_lower.
+        template<bool Upper>
+        size_t change_case_full(const char32_t* in, size_t len, char32_t* out)
+        {
+            size_t written {};
+            size_t run {};
+            auto flush = [&](size_t end) {
+                details::change_case<Upper>(in + run, end - run, out + written,
+                                            [](char32_t ch) { return Upper ? toupper(ch) : tolower(ch); });
+                written += end - run;
+            };
+
+            size_t i {};
+            while (i != len)
+            {
+                // nothing before ß has special casing, from there on code points are checked one by
+                // one until the next run below it
+                i += details::below_prefix_length(in + i, len - i, 0xdf);
+                for (; i != len && in[i] >= 0xdf; ++i)
+                {
+                    if (has_special_casing(in[i]))
+                    {
+                        flush(i);
+                        written += Upper ? upper_full(in[i], out + written) : lower_full(in, len, i, out + written);
+                        run = i + 1;
+                    }
+                }
+            }
+
+            flush(len);
+            return written;
+        }
+
+        // The first cased code point of a word is titlecased and the rest lowercased. A word
+        // continues over cased and case-ignorable code points.
+        size_t title_full(const char32_t* in, size_t len, char32_t* out)
+        {
+            size_t written {};
+            bool in_word {};
+            for (size_t i = 0; i != len; ++i)
+            {
+                const auto ch = in[i];
+                const auto cased = is_cased(ch);
+                if (in_word)
+                {
+                    written += lower_full(in, len, i, out + written);
+                }
+                else if (!cased)
+                {
+                    out[written++] = ch;
+                }
+                else if (auto entry = find_special_casing(ch))
+                {
+                    written += append_mapping(entry->title, out + written);
+                }
+                else
+                {
+                    out[written++] = toupper(ch);
+                }
+
+                in_word = cased || (in_word && is_case_ignorable(ch));
+            }
+            return written;
+        }
+
+        // A code point maps to at most three, and only the ones with special casing expand, so
+        // the result needs two more for each of them. Without any it has the exact size.
+        std::u32string full_case_string(const std::u32string& str, size_t (*convert)(const char32_t*, size_t, char32_t*))
+        {
+            size_t special {};
+            size_t i {};
+            while (i != str.size())
+            {
+                i += details::below_prefix_length(str.data() + i, str.size() - i, 0xdf);
+                for (; i != str.size() && str[i] >= 0xdf; ++i)
+                {
+                    special += has_special_casing(str[i]);
+                }
+            }
+
+            std::u32string result(str.size() + 2 * special, U'\0');
+            result.resize(convert(str.data(), str.size(), &result[0]));
+            if (special)
+            {
+                result.shrink_to_fit();
+            }
+            return result;
+        }
     }
 
     char32_t toupper(char32_t ch)
     {
-        auto it = upper_map.find(ch);
-        if (it != std::end(upper_map))
+        if (ch < 0x80)
         {
-            return it->second;
+            return ch >= U'a' && ch <= U'z' ? ch - 0x20 : ch;
         }
 
-        return ch;
+        return ch + char32_t(case_delta(ch, upper_blocks, upper_deltas));
     }
 
     char32_t tolower(char32_t ch)
     {
-        auto it = lower_map.find(ch);
-        if (it != std::end(lower_map))
+        if (ch < 0x80)
         {
-            return it->second;
+            return ch >= U'A' && ch <= U'Z' ? ch + 0x20 : ch;
         }
 
-        return ch;
+        return ch + char32_t(case_delta(ch, lower_blocks, lower_deltas));
     }
 
     bool toupper_case(char32_t &input)
@@ -4943,51 +7223,84 @@ namespace u32
         return true;
     }
 
+    void to_upper(char32_t* str, size_t len)
+    {
+        details::change_case<true>(str, len, str, [](char32_t ch) { return toupper(ch); });
+    }
+
+    void to_upper(std::u32string& str)
+    {
+        to_upper(&str[0], str.size());
+    }
+
+    void to_lower(char32_t* str, size_t len)
+    {
+        details::change_case<false>(str, len, str, [](char32_t ch) { return tolower(ch); });
+    }
+
+    void to_lower(std::u32string& str)
+    {
+        to_lower(&str[0], str.size());
+    }
+
+    size_t to_upper_full(const char32_t* in, size_t len, char32_t* out)
+    {
+        return change_case_full<true>(in, len, out);
+    }
+
+    size_t to_lower_full(const char32_t* in, size_t len, char32_t* out)
+    {
+        return change_case_full<false>(in, len, out);
+    }
+
+    size_t to_title_full(const char32_t* in, size_t len, char32_t* out)
+    {
+        return title_full(in, len, out);
+    }
+
+    std::u32string to_upper_full(const std::u32string& str)
+    {
+        return full_case_string(str, to_upper_full);
+    }
+
+    std::u32string to_lower_full(const std::u32string& str)
+    {
+        return full_case_string(str, to_lower_full);
+    }
+
+    std::u32string to_title_full(const std::u32string& str)
+    {
+        return full_case_string(str, to_title_full);
+    }
+
     bool is_upper(char32_t ch)
     {
-        return lower_map.find(ch) != std::end(lower_map);
+        return case_delta(ch, lower_blocks, lower_deltas) != 0;
     }
 
     bool is_lower(char32_t ch)
     {
-        return upper_map.find(ch) != std::end(upper_map);
+        return case_delta(ch, upper_blocks, upper_deltas) != 0;
     }
 
     bool is_alpha(char32_t ch)
     {
-        auto it = general_category_range.upper_bound(ch);
-        if (it == std::end(general_category_range))
-        {
-            return false;
-        }
-
-        return (static_cast<uint64_t>(it->second) & static_cast<uint64_t>(general_category::L)) != 0;
+        return has_category(ch, general_category::L);
     }
 
     bool is_digit(char32_t ch)
     {
-        auto it = numeric_types.find(ch);
-        if (it == std::end(numeric_types))
-        {
-            return false;
-        }
-
-        return it->second == numeric_type::Decimal || it->second == numeric_type::Digit;
+        const auto type = numeric_type_of(ch);
+        return type == numeric_type::Decimal || type == numeric_type::Digit;
     }
 
     bool is_space(char32_t ch)
     {
-        auto git = general_category_range.upper_bound(ch);
-        if (git != std::end(general_category_range) && git->second == general_category::Zs) {
+        if (has_category(ch, general_category::Zs)) {
             return true;
         }
 
-        auto bidit = bidi_class_range.upper_bound(ch);
-        if (bidit == bidi_class_range.end()) {
-            return false;
-        }
-
-        bidi_class bidi_class = bidit->second;
+        bidi_class bidi_class = bidi_class_of(ch);
 
         return bidi_class == bidi_class::B || bidi_class == bidi_class::S ||
                bidi_class == bidi_class::WS;
@@ -4995,34 +7308,16 @@ namespace u32
 
     bool is_punctuation(char32_t ch)
     {
-        auto it = general_category_range.upper_bound(ch);
-        if (it != std::end(general_category_range))
-        {
-            return (static_cast<uint64_t>(it->second) & static_cast<uint64_t>(general_category::P)) != 0;
-        }
-
-        return false;
+        return has_category(ch, general_category::P);
     }
 
     bool is_other_symbol(char32_t ch)
     {
-        auto it = general_category_range.upper_bound(ch);
-        if (it != std::end(general_category_range))
-        {
-            return (static_cast<uint64_t>(it->second) & static_cast<uint64_t>(general_category::So)) != 0;
-        }
-
-        return false;
+        return has_category(ch, general_category::So);
     }
 
     bool is_currency_symbol(char32_t ch)
     {
-        auto it = general_category_range.upper_bound(ch);
-        if (it != std::end(general_category_range))
-        {
-            return (static_cast<uint64_t>(it->second) & static_cast<uint64_t>(general_category::Sc)) != 0;
-        }
-
-        return false;
+        return has_category(ch, general_category::Sc);
     }
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <string>
+
 namespace u32
 {
     char32_t toupper(char32_t ch);
@@ -10,6 +13,37 @@ namespace u32
 
     bool tolower_case(char32_t& input);
 
+    // Simple case mapping of a whole string in place. ASCII and Latin-1 runs are converted
+    // several code points per step, other code points go through toupper/tolower.
+    void to_upper(char32_t* str, size_t len);
+
+    void to_upper(std::u32string& str);
+
+    void to_lower(char32_t* str, size_t len);
+
+    void to_lower(std::u32string& str);
+
+    // Full case mapping with the expansions of SpecialCasing.txt, e.g. "ß" to "SS", and the
+    // Final_Sigma rule; the language specific rules are not applied. Titlecase maps the first
+    // cased code point of each word. out needs room for full_case_capacity(len) code points,
+    // the number written is returned.
+    constexpr size_t full_case_capacity(size_t len)
+    {
+        return 3 * len;
+    }
+
+    size_t to_upper_full(const char32_t* in, size_t len, char32_t* out);
+
+    size_t to_lower_full(const char32_t* in, size_t len, char32_t* out);
+
+    size_t to_title_full(const char32_t* in, size_t len, char32_t* out);
+
+    std::u32string to_upper_full(const std::u32string& str);
+
+    std::u32string to_lower_full(const std::u32string& str);
+
+    std::u32string to_title_full(const std::u32string& str);
+
     bool is_upper(char32_t ch);
 
     bool is_lower(char32_t ch);
@@ -1,5 +1,8 @@
 #include "u32charset.h"
 
+#include "details/ascii.h"
+
+#include <algorithm>
 #include <array>
 #include <cstdint>
 
@@ -435,166 +438,173 @@ namespace u32
 
         constexpr uint8_t basic_symbols_count {128};
         constexpr auto EOS {'\0'};
-    }
 
-    char32_t charset_to_utf32(char ch, charset_t encoding)
-    {
-        auto idx {std::size_t(encoding)};
-        if (idx >= charset_table.size())
+        char32_t decode_char(const charset_info& charset, uint8_t uch)
         {
-            return EOS;
-        }
-        auto& charset = charset_table[idx];
-        uint8_t uch(ch);
+            if (charset.use_basic_symbols && uch < basic_symbols_count)
+            {
+                return uch;
+            }
 
-        if (charset.use_basic_symbols && uch < basic_symbols_count)
-        {
-            return ch;
-        }
+            if (charset.table_ptr == nullptr)
+            {
+                return EOS;
+            }
 
-        if (charset.table_ptr == nullptr)
-        {
-            return EOS;
-        }
+            if (!charset.use_basic_symbols)
+            {
+                return charset.table_ptr[uch];
+            }
+
+            uch -= basic_symbols_count;
+
+            if (charset.table_size <= uch)
+            {
+                return EOS;
+            }
 
-        if (!charset.use_basic_symbols)
-        {
             return charset.table_ptr[uch];
         }
 
-        uch -= basic_symbols_count;
-
-        if (charset.table_size <= uch)
+        bool encode_char(const charset_info& charset, char32_t ch, char& out)
         {
-            return EOS;
-        }
+            if (charset.use_basic_symbols && ch < basic_symbols_count)
+            {
+                out = char(ch);
+                return true;
+            }
 
-        return charset.table_ptr[uch];
+            // charsets without a table write EOS for everything else
+            if (charset.table_ptr == nullptr)
+            {
+                out = EOS;
+                return true;
+            }
+
+            for (decltype(charset.table_size) i = 0; i < charset.table_size; i++)
+            {
+                if (charset.table_ptr[i] == ch)
+                {
+                    if (charset.use_basic_symbols)
+                    {
+                        i += basic_symbols_count;
+                    }
+                    out = char(i);
+                    return true;
+                }
+            }
+
+            return false;
+        }
     }
 
-    char utf32_to_charset(char32_t ch, charset_t encoding)
+    char32_t charset_to_utf32(char ch, charset_t encoding)
     {
         auto idx {std::size_t(encoding)};
         if (idx >= charset_table.size())
         {
             return EOS;
         }
-        auto& charset = charset_table[idx];
 
-        if (charset.use_basic_symbols && ch < basic_symbols_count)
-        {
-            return char(ch);
-        }
+        return decode_char(charset_table[idx], uint8_t(ch));
+    }
 
-        if (charset.table_ptr == nullptr)
+    char utf32_to_charset(char32_t ch, charset_t encoding)
+    {
+        auto idx {std::size_t(encoding)};
+        if (idx >= charset_table.size())
         {
             return EOS;
         }
 
-        auto ptr = charset.table_ptr;
-        for (decltype(charset.table_size) i = 0; i < charset.table_size; i++)
-        {
-            if (*ptr == ch)
-            {
-                if (charset.use_basic_symbols)
-                {
-                    i += basic_symbols_count;
-                }
-                return i;
-            }
-        }
-
-        return EOS;
+        char out {EOS};
+        encode_char(charset_table[idx], ch, out);
+        return out;
     }
 
-    std::u32string convert(const std::string &str, charset_t encoding)
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, charset_t encoding)
     {
         auto idx {std::size_t(encoding)};
         if (idx >= charset_table.size())
         {
-            return {};
+            return {0, 0, conversion_status::invalid_input};
         }
 
         auto& charset = charset_table[idx];
 
-        std::u32string result {};
-        result.reserve(str.size());
-
-        for (uint8_t uch : str)
+        // single byte charsets map every byte to exactly one code point
+        const auto len = std::min(in_len, out_capacity);
+        for (size_t i = 0; i < len; ++i)
         {
-            if (charset.use_basic_symbols && uch < basic_symbols_count)
+            if (charset.use_basic_symbols)
             {
-                result.append(1, uch);
-                continue;
-            }
-
-            if (charset.table_ptr == nullptr)
-            {
-                result.append(1, EOS);
-                continue;
-            }
-
-            if (!charset.use_basic_symbols)
-            {
-                result.append(1, charset.table_ptr[uch]);
-                continue;
-            }
-
-            uch -= basic_symbols_count;
-
-            if (charset.table_size <= uch)
-            {
-                result.append(1, EOS);
-                continue;
+                i += details::widen_ascii(in + i, len - i, out + i);
+                if (i == len)
+                {
+                    break;
+                }
             }
 
-            result.append(1, charset.table_ptr[uch]);
+            out[i] = decode_char(charset, uint8_t(in[i]));
         }
 
-        return result;
+        return {len, len, len == in_len ? conversion_status::ok : conversion_status::output_too_small};
     }
 
-    std::string convert(const std::u32string &str, charset_t encoding)
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity, charset_t encoding)
     {
         auto idx {std::size_t(encoding)};
         if (idx >= charset_table.size())
         {
-            return {};
+            return {0, 0, conversion_status::invalid_input};
         }
-        auto& charset = charset_table[idx];
 
-        std::string result {};
-        result.reserve(str.size());
+        auto& charset = charset_table[idx];
 
-        for (char32_t ch : str)
+        // characters missing from a table are dropped
+        conversion_result result {};
+        while (result.read != in_len)
         {
-            if (charset.use_basic_symbols && ch < basic_symbols_count)
+            if (result.written == out_capacity)
             {
-                result.append(1, char(ch));
-                continue;
+                result.status = conversion_status::output_too_small;
+                break;
             }
 
-            if (charset.table_ptr == nullptr)
+            if (charset.use_basic_symbols && in[result.read] < basic_symbols_count)
             {
-                result.append(1, EOS);
+                auto ascii = details::narrow_ascii(in + result.read, std::min(in_len - result.read, out_capacity - result.written),
+                                                   out + result.written);
+                result.read += ascii;
+                result.written += ascii;
                 continue;
             }
 
-            auto ptr = charset.table_ptr;
-            for (decltype(charset.table_size) i = 0; i < charset.table_size; i++)
+            if (encode_char(charset, in[result.read], out[result.written]))
             {
-                if (*ptr == ch)
-                {
-                    if (charset.use_basic_symbols)
-                    {
-                        i += basic_symbols_count;
-                    }
-                    result.append(1, char(i));
-                }
+                ++result.written;
             }
+            ++result.read;
         }
 
         return result;
     }
 
+    std::u32string convert(const std::string &str, charset_t encoding)
+    {
+        std::u32string result(str.size(), U'\0');
+        auto converted = convert(str.data(), str.size(), &result[0], result.size(), encoding);
+        result.resize(converted.written);
+        return result;
+    }
+
+    std::string convert(const std::u32string &str, charset_t encoding)
+    {
+        // the input size bounds the output
+        std::string result(str.size(), EOS);
+        auto converted = convert(str.data(), str.size(), &result[0], result.size(), encoding);
+        result.resize(converted.written);
+        return result;
+    }
+
 }
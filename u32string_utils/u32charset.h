@@ -1,5 +1,7 @@
 #pragma once
 
+#include "u32utils.h"
+
 #include <string>
 
 namespace u32
@@ -39,4 +41,7 @@ namespace u32
 
     std::u32string convert(const std::string& str, charset_t encoding);
     std::string convert(const std::u32string& str, charset_t encoding);
+
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, charset_t encoding);
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity, charset_t encoding);
 }
@@ -0,0 +1,119 @@
+#include "u32compact.h"
+
+#include <algorithm>
+
+namespace u32
+{
+    namespace
+    {
+        template<typename Unit>
+        void narrow(const char32_t* in, size_t len, char* out)
+        {
+            // a plain loop the compiler vectorizes, the units are copied out for the aliasing rules
+            for (size_t i = 0; i < len; ++i)
+            {
+                const auto unit = static_cast<Unit>(in[i]);
+                std::memcpy(out + i * sizeof(Unit), &unit, sizeof(Unit));
+            }
+        }
+
+        void narrow(unsigned width, const char32_t* in, size_t len, char* out)
+        {
+            switch (width)
+            {
+            case 1:
+                narrow<unsigned char>(in, len, out);
+                break;
+            case 2:
+                narrow<char16_t>(in, len, out);
+                break;
+            default:
+                narrow<char32_t>(in, len, out);
+                break;
+            }
+        }
+    }
+
+    compact_string::compact_string(const char32_t* str, size_t len)
+    {
+        append(str, len);
+    }
+
+    void compact_string::append(const char32_t* str, size_t len)
+    {
+        // the highest set bit of all code points ORed together is the one of the largest
+        char32_t bits {};
+        for (size_t i = 0; i < len; ++i)
+        {
+            bits |= str[i];
+        }
+
+        const unsigned width = bits < 0x100 ? 1 : bits < 0x10000 ? 2 : 4;
+        const auto count = size();
+        if (width > width_)
+        {
+            // moved back to front, so no code point is overwritten before it is read
+            storage_.resize(count * width);
+            for (auto i = count; i-- != 0;)
+            {
+                const auto ch = load(storage_.data(), width_, i);
+                narrow(width, &ch, 1, &storage_[i * width]);
+            }
+            width_ = width;
+        }
+
+        storage_.resize((count + len) * width_);
+        narrow(width_, str, len, &storage_[count * width_]);
+    }
+
+    compact_string::compact_string(const std::u32string& str)
+        : compact_string(str.data(), str.size())
+    {
+    }
+
+    std::u32string compact_string::str() const
+    {
+        return std::u32string(begin(), end());
+    }
+
+    compact_string convert_to_compact(const std::string& str)
+    {
+        // decoded through a small buffer, the decoder stops at a code point when it is full
+        compact_string result;
+        result.storage_.reserve(str.size());
+        char32_t buffer[256];
+        for (size_t pos = 0; pos < str.size();)
+        {
+            auto converted = convert(str.data() + pos, str.size() - pos, buffer, sizeof(buffer) / sizeof(buffer[0]));
+            result.append(buffer, converted.written);
+            pos += converted.read;
+            if (converted.status != conversion_status::output_too_small)
+            {
+                break;
+            }
+        }
+        return result;
+    }
+
+    std::string convert(const compact_string& str)
+    {
+        // encoded through a small buffer, a high surrogate at its end waits for the next part
+        std::string result;
+        char32_t buffer[256];
+        char bytes[4 * 256];
+        for (size_t pos = 0; pos < str.size();)
+        {
+            auto len = std::min(str.size() - pos, sizeof(buffer) / sizeof(buffer[0]));
+            std::copy_n(str.begin() + std::ptrdiff_t(pos), len, buffer);
+            if (len > 1 && pos + len != str.size() && buffer[len - 1] >= 0xd800 && buffer[len - 1] <= 0xdbff)
+            {
+                --len;
+            }
+
+            auto converted = convert(buffer, len, bytes, sizeof(bytes));
+            result.append(bytes, converted.written);
+            pos += len;
+        }
+        return result;
+    }
+}
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "u32utils.h"
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <string>
+
+namespace u32
+{
+    // Immutable code point string stored with 1, 2 or 4 bytes per code point, whichever fits
+    // its largest code point: Latin-1 text takes a quarter and BMP text half of a std::u32string.
+    class compact_string
+    {
+    public:
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = char32_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const char32_t*;
+            using reference = char32_t;
+
+            const_iterator() = default;
+
+            char32_t operator*() const
+            {
+                return load(data_, width_, index_);
+            }
+
+            char32_t operator[](difference_type n) const
+            {
+                return load(data_, width_, size_t(difference_type(index_) + n));
+            }
+
+            const_iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            const_iterator operator++(int)
+            {
+                auto prev = *this;
+                ++index_;
+                return prev;
+            }
+
+            const_iterator& operator--()
+            {
+                --index_;
+                return *this;
+            }
+
+            const_iterator operator--(int)
+            {
+                auto prev = *this;
+                --index_;
+                return prev;
+            }
+
+            const_iterator& operator+=(difference_type n)
+            {
+                index_ = size_t(difference_type(index_) + n);
+                return *this;
+            }
+
+            const_iterator& operator-=(difference_type n)
+            {
+                return *this += -n;
+            }
+
+            const_iterator operator+(difference_type n) const
+            {
+                auto it = *this;
+                return it += n;
+            }
+
+            const_iterator operator-(difference_type n) const
+            {
+                auto it = *this;
+                return it -= n;
+            }
+
+            difference_type operator-(const const_iterator& other) const
+            {
+                return difference_type(index_) - difference_type(other.index_);
+            }
+
+            bool operator==(const const_iterator& other) const
+            {
+                return index_ == other.index_;
+            }
+
+            bool operator!=(const const_iterator& other) const
+            {
+                return index_ != other.index_;
+            }
+
+            bool operator<(const const_iterator& other) const
+            {
+                return index_ < other.index_;
+            }
+
+            bool operator>(const const_iterator& other) const
+            {
+                return index_ > other.index_;
+            }
+
+            bool operator<=(const const_iterator& other) const
+            {
+                return index_ <= other.index_;
+            }
+
+            bool operator>=(const const_iterator& other) const
+            {
+                return index_ >= other.index_;
+            }
+
+            friend const_iterator operator+(difference_type n, const const_iterator& it)
+            {
+                return it + n;
+            }
+
+        private:
+            friend class compact_string;
+
+            const_iterator(const char* data, unsigned width, size_t index)
+                : data_(data)
+                , width_(width)
+                , index_(index)
+            {
+            }
+
+            const char* data_ {};
+            unsigned width_ {1};
+            size_t index_ {};
+        };
+
+        using iterator = const_iterator;
+
+        compact_string() = default;
+        compact_string(const char32_t* str, size_t len);
+        compact_string(const std::u32string& str);
+
+        char32_t operator[](size_t i) const
+        {
+            return load(storage_.data(), width_, i);
+        }
+
+        const_iterator begin() const
+        {
+            return {storage_.data(), width_, 0};
+        }
+
+        const_iterator end() const
+        {
+            return {storage_.data(), width_, size()};
+        }
+
+        // number of code points
+        size_t size() const
+        {
+            return storage_.size() / width_;
+        }
+
+        bool empty() const
+        {
+            return storage_.empty();
+        }
+
+        // bytes per code point: 1, 2 or 4
+        unsigned width() const
+        {
+            return width_;
+        }
+
+        std::u32string str() const;
+
+        // equal strings have the same width, so their storage is equal as well
+        bool operator==(const compact_string& other) const
+        {
+            return width_ == other.width_ && storage_ == other.storage_;
+        }
+
+        bool operator!=(const compact_string& other) const
+        {
+            return !(*this == other);
+        }
+
+        size_t hash() const
+        {
+            return std::hash<std::string>()(storage_);
+        }
+
+    private:
+        friend compact_string convert_to_compact(const std::string& str);
+
+        // appends code points, widening the stored ones first if they need more bytes
+        void append(const char32_t* str, size_t len);
+
+        static char32_t load(const char* data, unsigned width, size_t i)
+        {
+            if (width == 1)
+            {
+                return static_cast<unsigned char>(data[i]);
+            }
+
+            if (width == 2)
+            {
+                char16_t unit {};
+                std::memcpy(&unit, data + 2 * i, 2);
+                return unit;
+            }
+
+            char32_t ch {};
+            std::memcpy(&ch, data + 4 * i, 4);
+            return ch;
+        }
+
+        std::string storage_;
+        unsigned width_ {1};
+    };
+
+    // UTF-8 <-> compact_string, decoding and encoding like the std::u32string overloads.
+    compact_string convert_to_compact(const std::string& str);
+    std::string convert(const compact_string& str);
+}
+
+namespace std
+{
+    template<>
+    struct hash<u32::compact_string>
+    {
+        size_t operator()(const u32::compact_string& str) const
+        {
+            return str.hash();
+        }
+    };
+}
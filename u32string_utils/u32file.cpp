@@ -0,0 +1,437 @@
+#include "u32file.h"
+
+#include "details/byte_order.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <system_error>
+#include <vector>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace u32
+{
+    namespace
+    {
+        // Mapping windows start at multiples of 64 KiB, the Windows allocation granularity and
+        // a multiple of the page size elsewhere.
+        constexpr size_t map_alignment = size_t(1) << 16;
+        constexpr size_t map_window = size_t(1) << 24;
+        // a window is moved forward when fewer bytes than this are left in it
+        constexpr size_t map_margin = 64;
+        // code points converted per step
+        constexpr size_t buffer_size = size_t(1) << 14;
+
+        std::error_code last_error()
+        {
+#if defined(_WIN32)
+            return {int(GetLastError()), std::system_category()};
+#else
+            return {errno, std::generic_category()};
+#endif
+        }
+
+        [[noreturn]] void throw_last_error(const char* what)
+        {
+            throw std::system_error(last_error(), what);
+        }
+
+        class mapped_file
+        {
+        public:
+            explicit mapped_file(const std::string& path)
+            {
+#if defined(_WIN32)
+                file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+                LARGE_INTEGER size {};
+                if (file_ == INVALID_HANDLE_VALUE || !GetFileSizeEx(file_, &size))
+                {
+                    // closing can overwrite the error
+                    auto error = last_error();
+                    close();
+                    throw std::system_error(error, "cannot open source file");
+                }
+
+                size_ = size_t(size.QuadPart);
+                mapping_ = size_ ? CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+                if (size_ && !mapping_)
+                {
+                    auto error = last_error();
+                    close();
+                    throw std::system_error(error, "cannot map source file");
+                }
+#else
+                fd_ = ::open(path.c_str(), O_RDONLY);
+                struct stat info {};
+                if (fd_ < 0 || ::fstat(fd_, &info) != 0)
+                {
+                    // closing can overwrite the error
+                    auto error = last_error();
+                    close();
+                    throw std::system_error(error, "cannot open source file");
+                }
+                size_ = size_t(info.st_size);
+#endif
+            }
+
+            mapped_file(const mapped_file&) = delete;
+            mapped_file& operator=(const mapped_file&) = delete;
+
+            ~mapped_file()
+            {
+                close();
+            }
+
+            size_t size() const
+            {
+                return size_;
+            }
+
+            // Address of the byte at offset, avail is set to the number of bytes mapped from
+            // there on. The window is moved when fewer than map_margin bytes are left.
+            const char* view(size_t offset, size_t& avail)
+            {
+                if (offset < begin_ || offset > end_ || (end_ - offset < map_margin && end_ != size_) || !data_)
+                {
+                    remap(offset);
+                }
+
+                avail = end_ - offset;
+                return data_ + (offset - begin_);
+            }
+
+        private:
+            void remap(size_t offset)
+            {
+                unmap();
+                begin_ = offset & ~(map_alignment - 1);
+                end_ = std::min(size_, begin_ + map_window);
+                if (begin_ == end_)
+                {
+                    return;
+                }
+#if defined(_WIN32)
+                auto view = MapViewOfFile(mapping_, FILE_MAP_READ, DWORD(uint64_t(begin_) >> 32), DWORD(begin_), end_ - begin_);
+                if (!view)
+                {
+                    throw_last_error("cannot map source file");
+                }
+                data_ = static_cast<const char*>(view);
+#else
+                auto view = ::mmap(nullptr, end_ - begin_, PROT_READ, MAP_PRIVATE, fd_, off_t(begin_));
+                if (view == MAP_FAILED)
+                {
+                    throw_last_error("cannot map source file");
+                }
+                ::madvise(view, end_ - begin_, MADV_SEQUENTIAL);
+                data_ = static_cast<const char*>(view);
+#endif
+            }
+
+            void unmap()
+            {
+                if (data_)
+                {
+#if defined(_WIN32)
+                    UnmapViewOfFile(data_);
+#else
+                    ::munmap(const_cast<char*>(data_), end_ - begin_);
+#endif
+                    data_ = nullptr;
+                }
+            }
+
+            void close()
+            {
+                unmap();
+#if defined(_WIN32)
+                if (mapping_)
+                {
+                    CloseHandle(mapping_);
+                }
+                if (file_ != INVALID_HANDLE_VALUE)
+                {
+                    CloseHandle(file_);
+                }
+                mapping_ = nullptr;
+                file_ = INVALID_HANDLE_VALUE;
+#else
+                if (fd_ >= 0)
+                {
+                    ::close(fd_);
+                }
+                fd_ = -1;
+#endif
+            }
+
+#if defined(_WIN32)
+            HANDLE file_ {INVALID_HANDLE_VALUE};
+            HANDLE mapping_ {};
+#else
+            int fd_ {-1};
+#endif
+            size_t size_ {};
+            size_t begin_ {};
+            size_t end_ {};
+            const char* data_ {};
+        };
+
+        class output_file
+        {
+        public:
+            explicit output_file(const std::string& path)
+                : file_(std::fopen(path.c_str(), "wb"))
+            {
+                if (!file_)
+                {
+                    throw_last_error("cannot open destination file");
+                }
+            }
+
+            output_file(const output_file&) = delete;
+            output_file& operator=(const output_file&) = delete;
+
+            ~output_file()
+            {
+                if (file_)
+                {
+                    std::fclose(file_);
+                }
+            }
+
+            void write(const void* data, size_t size)
+            {
+                if (size != 0 && std::fwrite(data, 1, size, file_) != size)
+                {
+                    throw_last_error("cannot write destination file");
+                }
+            }
+
+            void close()
+            {
+                auto file = file_;
+                file_ = nullptr;
+                if (std::fclose(file) != 0)
+                {
+                    throw_last_error("cannot write destination file");
+                }
+            }
+
+        private:
+            std::FILE* file_ {};
+        };
+
+        bool is_little_endian()
+        {
+            const uint16_t probe {1};
+            uint8_t first {};
+            std::memcpy(&first, &probe, 1);
+            return first == 1;
+        }
+
+        bool is_little_endian(unicode_t encoding)
+        {
+            return encoding == unicode_t::UTF_16LE || encoding == unicode_t::UTF_32LE;
+        }
+
+        template<typename Unit>
+        void swap_bytes(Unit* units, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto bytes = reinterpret_cast<uint8_t*>(units + i);
+                std::reverse(bytes, bytes + sizeof(Unit));
+            }
+        }
+
+        bool is_high_surrogate(char32_t ch)
+        {
+            return ch >= 0xd800 && ch <= 0xdbff;
+        }
+
+        // Decodes the source a buffer at a time into UTF-32.
+        class source_decoder
+        {
+        public:
+            source_decoder(const std::string& path, file_encoding encoding)
+                : file_(path)
+                , encoding_(encoding)
+            {
+            }
+
+            bool done() const
+            {
+                return pos_ == file_.size();
+            }
+
+            // Decodes into out, stops before the end of the file only at invalid input or when
+            // out is full.
+            conversion_result decode(char32_t* out, size_t out_capacity)
+            {
+                size_t avail {};
+                auto in = file_.view(pos_, avail);
+
+                conversion_result result {};
+                if (encoding_.is_charset())
+                {
+                    result = convert(in, avail, out, out_capacity, encoding_.charset());
+                }
+                else if (encoding_.unicode() == unicode_t::UTF_8)
+                {
+                    result = decoder_.feed(in, avail, out, out_capacity);
+                }
+                else
+                {
+                    result = decode_units(in, avail, pos_ + avail == file_.size(), out, out_capacity);
+                }
+
+                pos_ += result.read;
+                return result;
+            }
+
+            // Flushes a UTF-8 sequence cut short by the end of the file as U+FFFD.
+            conversion_result finish(char32_t* out, size_t out_capacity)
+            {
+                return decoder_.finish(out, out_capacity);
+            }
+
+        private:
+            conversion_result decode_units(const char* in, size_t avail, bool at_end, char32_t* out, size_t out_capacity)
+            {
+                const auto encoding = encoding_.unicode();
+                const bool utf16 = encoding == unicode_t::UTF_16LE || encoding == unicode_t::UTF_16BE;
+                const size_t unit_size = utf16 ? 2 : 4;
+
+                const auto whole = avail - avail % unit_size;
+                const auto len = std::min(whole, out_capacity * unit_size);
+                if (len == whole && at_end)
+                {
+                    return convert(in, avail, out, out_capacity, encoding);
+                }
+
+                // a surrogate pair split here is decoded with the next part, the UTF-8 encoder
+                // merges the pairs of UTF-32 input too
+                auto last = in + len - unit_size;
+                const bool big_endian = !is_little_endian(encoding);
+                auto unit = utf16 ? char32_t(big_endian ? details::load_utf16_unit<true>(last) : details::load_utf16_unit<false>(last))
+                                  : big_endian ? details::load_utf32_unit<true>(last) : details::load_utf32_unit<false>(last);
+                return convert(in, is_high_surrogate(unit) ? len - unit_size : len, out, out_capacity, encoding);
+            }
+
+            mapped_file file_;
+            file_encoding encoding_;
+            utf8_decoder decoder_;
+            size_t pos_ {};
+        };
+
+        // Encodes UTF-32 buffers into the destination file.
+        class destination_encoder
+        {
+        public:
+            destination_encoder(const std::string& path, file_encoding encoding)
+                : file_(path)
+                , encoding_(encoding)
+                , bytes_(4 * buffer_size)
+                , units_(buffer_size * 2)
+                , swapped_(buffer_size)
+            {
+            }
+
+            void encode(const char32_t* in, size_t in_len)
+            {
+                if (encoding_.is_charset())
+                {
+                    auto result = convert(in, in_len, &bytes_[0], bytes_.size(), encoding_.charset());
+                    file_.write(bytes_.data(), result.written);
+                    return;
+                }
+
+                switch (encoding_.unicode())
+                {
+                case unicode_t::UTF_8:
+                {
+                    auto result = convert(in, in_len, &bytes_[0], bytes_.size());
+                    file_.write(bytes_.data(), result.written);
+                    break;
+                }
+                case unicode_t::UTF_16LE:
+                case unicode_t::UTF_16BE:
+                {
+                    auto result = convert(in, in_len, units_.data(), units_.size());
+                    if (is_little_endian(encoding_.unicode()) != is_little_endian())
+                    {
+                        swap_bytes(units_.data(), result.written);
+                    }
+                    file_.write(units_.data(), result.written * 2);
+                    break;
+                }
+                default:
+                {
+                    if (is_little_endian(encoding_.unicode()) != is_little_endian())
+                    {
+                        std::copy_n(in, in_len, swapped_.data());
+                        swap_bytes(swapped_.data(), in_len);
+                        in = swapped_.data();
+                    }
+                    file_.write(in, in_len * 4);
+                    break;
+                }
+                }
+            }
+
+            void close()
+            {
+                file_.close();
+            }
+
+        private:
+            output_file file_;
+            file_encoding encoding_;
+            std::vector<char> bytes_;
+            std::vector<char16_t> units_;
+            std::vector<char32_t> swapped_;
+        };
+    }
+
+    conversion_status convert_file(const std::string& src, file_encoding src_encoding, const std::string& dst,
+                                   file_encoding dst_encoding)
+    {
+        source_decoder source(src, src_encoding);
+        destination_encoder destination(dst, dst_encoding);
+
+        std::vector<char32_t> buffer(buffer_size);
+        auto status = conversion_status::ok;
+        while (!source.done() && status == conversion_status::ok)
+        {
+            auto result = source.decode(buffer.data(), buffer.size());
+            destination.encode(buffer.data(), result.written);
+            if (result.status == conversion_status::invalid_input)
+            {
+                status = result.status;
+            }
+        }
+
+        if (status == conversion_status::ok)
+        {
+            auto result = source.finish(buffer.data(), buffer.size());
+            destination.encode(buffer.data(), result.written);
+            status = result.status;
+        }
+
+        destination.close();
+        return status;
+    }
+}
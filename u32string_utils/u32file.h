@@ -0,0 +1,54 @@
+#pragma once
+
+#include "u32charset.h"
+#include "u32utils.h"
+
+#include <string>
+
+namespace u32
+{
+    // Encoding of a file, a Unicode encoding form or one of the legacy charsets.
+    class file_encoding
+    {
+    public:
+        file_encoding(unicode_t unicode)
+            : unicode_(unicode)
+        {
+        }
+
+        file_encoding(charset_t charset)
+            : is_charset_(true)
+            , charset_(charset)
+        {
+        }
+
+        bool is_charset() const
+        {
+            return is_charset_;
+        }
+
+        unicode_t unicode() const
+        {
+            return unicode_;
+        }
+
+        charset_t charset() const
+        {
+            return charset_;
+        }
+
+    private:
+        bool is_charset_ {};
+        unicode_t unicode_ {unicode_t::UTF_8};
+        charset_t charset_ {charset_t::US_ASCII};
+    };
+
+    // Transcodes the file src into dst. The source is memory-mapped a window at a time and
+    // converted through fixed-size buffers, so memory use does not depend on the file size.
+    // Decoding follows the in-memory convert() overloads: invalid_input is returned at input
+    // they stop at (a byte that cannot start a UTF-8 sequence, an unpaired UTF-16 surrogate, an
+    // incomplete code unit) or for a file ending inside a UTF-8 sequence, everything before is
+    // written. I/O errors throw std::system_error.
+    conversion_status convert_file(const std::string& src, file_encoding src_encoding, const std::string& dst,
+                                   file_encoding dst_encoding);
+}
@@ -0,0 +1,131 @@
+#include "u32parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace u32
+{
+    namespace
+    {
+        // The serial decoder starts a sequence at pos when no lead byte of the three before
+        // claims a sequence reaching past pos. A decode start before them is a 4 byte lead at
+        // pos - 4 at the latest, which ends exactly at pos.
+        bool is_sequence_boundary(const char* in, size_t pos)
+        {
+            for (size_t back = 1; back <= 3 && back <= pos; ++back)
+            {
+                if (get_utf8_char_len(in + pos - back) > back)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // First boundary in [pos, pos + 64), 0 when malformed input has none.
+        size_t find_sequence_boundary(const char* in, size_t in_len, size_t pos)
+        {
+            for (auto end = std::min(in_len, pos + 64); pos < end; ++pos)
+            {
+                if (is_sequence_boundary(in, pos))
+                {
+                    return pos;
+                }
+            }
+            return 0;
+        }
+
+        void run_on_threads(size_t thread_count, size_t task_count, const std::function<void(size_t)>& task)
+        {
+            std::atomic<size_t> next {0};
+            auto worker = [&next, task_count, &task]() {
+                for (size_t i {}; (i = next++) < task_count;)
+                {
+                    task(i);
+                }
+            };
+
+            std::vector<std::thread> threads;
+            for (size_t i = 1; i < std::min(thread_count, task_count); ++i)
+            {
+                threads.emplace_back(worker);
+            }
+            worker();
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }
+
+    std::u32string convert_parallel(const std::string& str, const parallel_options& options)
+    {
+        auto thread_count = options.thread_count != 0 ? options.thread_count : size_t(std::thread::hardware_concurrency());
+        // a few chunks per thread even out the cost of malformed or non-ASCII heavy parts
+        auto chunk_count = std::min(str.size() / std::max<size_t>(options.min_chunk_size, 1), std::max<size_t>(thread_count, 1) * 4);
+        if (chunk_count <= 1)
+        {
+            return convert(str);
+        }
+
+        std::vector<size_t> bounds {0};
+        for (size_t i = 1; i < chunk_count; ++i)
+        {
+            auto pos = find_sequence_boundary(str.data(), str.size(), i * (str.size() / chunk_count));
+            if (pos > bounds.back())
+            {
+                bounds.push_back(pos);
+            }
+        }
+        bounds.push_back(str.size());
+        chunk_count = bounds.size() - 1;
+
+        auto run = [&options, thread_count, chunk_count](const std::function<void(size_t)>& task) {
+            if (options.executor)
+            {
+                options.executor(chunk_count, task);
+            }
+            else
+            {
+                run_on_threads(thread_count, chunk_count, task);
+            }
+        };
+
+        // code points of a chunk are bounded by its lead bytes, exact for valid input
+        std::vector<size_t> offsets(chunk_count + 1);
+        run([&str, &bounds, &offsets](size_t chunk) {
+            offsets[chunk + 1] = utf8_length_in_codepoints(str.data() + bounds[chunk], bounds[chunk + 1] - bounds[chunk]);
+        });
+        for (size_t i = 0; i < chunk_count; ++i)
+        {
+            offsets[i + 1] += offsets[i];
+        }
+
+        std::u32string result(offsets.back(), U'\0');
+        std::vector<conversion_result> converted(chunk_count);
+        run([&str, &bounds, &offsets, &result, &converted](size_t chunk) {
+            converted[chunk] = convert(str.data() + bounds[chunk], bounds[chunk + 1] - bounds[chunk], &result[0] + offsets[chunk],
+                                       offsets[chunk + 1] - offsets[chunk]);
+        });
+
+        // close the gaps left by replaced sequences, the serial decoder stops at the first invalid byte
+        size_t written {};
+        for (size_t i = 0; i < chunk_count; ++i)
+        {
+            if (written != offsets[i])
+            {
+                std::copy_n(result.begin() + offsets[i], converted[i].written, result.begin() + written);
+            }
+
+            written += converted[i].written;
+            if (converted[i].status != conversion_status::ok)
+            {
+                break;
+            }
+        }
+        result.resize(written);
+        return result;
+    }
+}
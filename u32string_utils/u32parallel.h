@@ -0,0 +1,26 @@
+#pragma once
+
+#include "u32utils.h"
+
+#include <functional>
+#include <string>
+
+namespace u32
+{
+    // Runs task(0) ... task(task_count - 1), possibly concurrently, and returns when all of them
+    // have finished. Lets a parallel conversion use the caller's thread pool.
+    using parallel_executor = std::function<void(size_t task_count, const std::function<void(size_t)>& task)>;
+
+    struct parallel_options
+    {
+        // threads started when no executor is given, 0 for std::thread::hardware_concurrency()
+        size_t thread_count {};
+        // inputs are split in chunks of at least this many bytes, smaller ones convert serially
+        size_t min_chunk_size {size_t(1) << 20};
+        parallel_executor executor;
+    };
+
+    // Same result as convert(str), decoded by several threads. The input is split where the serial
+    // decoder starts a sequence, every chunk is decoded into its place of the pre-sized output.
+    std::u32string convert_parallel(const std::string& str, const parallel_options& options = {});
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "details/utf8_decode.h"
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+
+namespace u32
+{
+    // Non-owning view of UTF-8 bytes as code points, decoded while iterating. Malformed input
+    // gives U+FFFD per maximal invalid subpart, exactly like convert<error_policy::replace>, which
+    // keeps forward and backward iteration on the same sequence boundaries.
+    class utf8_view
+    {
+    public:
+        class iterator
+        {
+        public:
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = char32_t;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const char32_t*;
+            using reference = char32_t;
+
+            iterator() = default;
+
+            char32_t operator*() const
+            {
+                return ch_;
+            }
+
+            iterator& operator++()
+            {
+                pos_ += len_;
+                decode();
+                return *this;
+            }
+
+            iterator operator++(int)
+            {
+                auto prev = *this;
+                ++*this;
+                return prev;
+            }
+
+            iterator& operator--()
+            {
+                pos_ = details::previous_utf8_sequence(begin_, pos_, end_);
+                decode();
+                return *this;
+            }
+
+            iterator operator--(int)
+            {
+                auto prev = *this;
+                --*this;
+                return prev;
+            }
+
+            bool operator==(const iterator& other) const
+            {
+                return pos_ == other.pos_;
+            }
+
+            bool operator!=(const iterator& other) const
+            {
+                return pos_ != other.pos_;
+            }
+
+            // first byte of the current code point
+            const char* base() const
+            {
+                return pos_;
+            }
+
+        private:
+            friend class utf8_view;
+
+            iterator(const char* begin, const char* pos, const char* end)
+                : begin_(begin)
+                , pos_(pos)
+                , end_(end)
+            {
+                decode();
+            }
+
+            void decode()
+            {
+                if (pos_ != end_)
+                {
+                    auto decoded = details::decode_utf8_strict(pos_, std::size_t(end_ - pos_));
+                    ch_ = decoded.ch;
+                    len_ = decoded.len;
+                }
+            }
+
+            const char* begin_ {};
+            const char* pos_ {};
+            const char* end_ {};
+            char32_t ch_ {};
+            std::size_t len_ {};
+        };
+
+        using const_iterator = iterator;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+
+        utf8_view() = default;
+
+        utf8_view(const char* data, std::size_t size)
+            : data_(data)
+            , size_(size)
+        {
+        }
+
+        utf8_view(const std::string& str)
+            : utf8_view(str.data(), str.size())
+        {
+        }
+
+        iterator begin() const
+        {
+            return {data_, data_, data_ + size_};
+        }
+
+        iterator end() const
+        {
+            return {data_, data_ + size_, data_ + size_};
+        }
+
+        reverse_iterator rbegin() const
+        {
+            return reverse_iterator(end());
+        }
+
+        reverse_iterator rend() const
+        {
+            return reverse_iterator(begin());
+        }
+
+        const char* data() const
+        {
+            return data_;
+        }
+
+        // size in bytes
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        bool empty() const
+        {
+            return size_ == 0;
+        }
+
+    private:
+        const char* data_ {};
+        std::size_t size_ {};
+    };
+}
@@ -1,287 +1,1851 @@
 #include "u32utils.h"
 
+#include "details/ascii.h"
+#include "details/byte_order.h"
+#include "details/utf8_decode.h"
+#include "details/utf8_validate.h"
+
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 namespace u32
 {
     namespace
     {
-        std::string unicode_to_utf8(const char32_t* in, const char32_t* in_end)
+        // Byte count unicode_to_utf8 produces for [in, in_end). A high surrogate is written
+        // only together with the low surrogate following it, begin gives the context for in[-1].
+        size_t utf8_length_scalar(const char32_t* begin, const char32_t* in, const char32_t* in_end)
         {
-            std::string out;
-            char32_t codepoint = 0;
-            for (; in != in_end;  ++in)
+            size_t len {};
+            for (; in != in_end; ++in)
             {
                 if (*in >= 0xd800 && *in <= 0xdbff)
                 {
-                    codepoint = ((*in - 0xd800) << 10) + 0x10000;
+                    continue;
                 }
-                else
+
+                if (*in >= 0xdc00 && *in <= 0xdfff)
                 {
-                    if (*in >= 0xdc00 && *in <= 0xdfff)
+                    if (in != begin && in[-1] >= 0xd800 && in[-1] <= 0xdbff)
                     {
-                        codepoint |= *in - 0xdc00;
+                        len += 4;
                     }
                     else
                     {
-                        codepoint = *in;
+                        len += (*in - 0xdc00) <= 0x7f ? 1 : 2;
+                    }
+                    continue;
+                }
+
+                len += 1 + (*in > 0x7f) + (*in > 0x7ff) + (*in > 0xffff);
+            }
+            return len;
+        }
+
+        size_t utf8_length(const char32_t* in, const char32_t* in_end)
+        {
+            const auto begin = in;
+            size_t len {};
+#if defined(U32_SIMD_AVX2)
+            const auto bias = _mm256_set1_epi32(int32_t(0x80000000));
+            const auto surrogate_base = _mm256_set1_epi32(0xd800);
+            const auto surrogate_limit = _mm256_set1_epi32(int32_t(0x800 ^ 0x80000000));
+            const auto limit1 = _mm256_set1_epi32(int32_t(0x7f ^ 0x80000000));
+            const auto limit2 = _mm256_set1_epi32(int32_t(0x7ff ^ 0x80000000));
+            const auto limit3 = _mm256_set1_epi32(int32_t(0xffff ^ 0x80000000));
+            while (in_end - in >= 8)
+            {
+                // lane counters grow by at most 3 per step, flush them long before they overflow
+                auto extra = _mm256_setzero_si256();
+                for (size_t steps = 0; steps < 0x10000 && in_end - in >= 8; ++steps, in += 8)
+                {
+                    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+                    auto biased = _mm256_xor_si256(v, bias);
+                    auto surrogate = _mm256_cmpgt_epi32(surrogate_limit, _mm256_xor_si256(_mm256_sub_epi32(v, surrogate_base), bias));
+                    if (!_mm256_testz_si256(surrogate, surrogate))
+                    {
+                        len += utf8_length_scalar(begin, in, in + 8);
+                        continue;
+                    }
+
+                    len += 8;
+                    extra = _mm256_sub_epi32(extra, _mm256_cmpgt_epi32(biased, limit1));
+                    extra = _mm256_sub_epi32(extra, _mm256_cmpgt_epi32(biased, limit2));
+                    extra = _mm256_sub_epi32(extra, _mm256_cmpgt_epi32(biased, limit3));
+                }
+
+                alignas(32) uint32_t lanes[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), extra);
+                for (auto lane : lanes)
+                {
+                    len += lane;
+                }
+            }
+#elif defined(U32_SIMD_SSE2)
+            const auto bias = _mm_set1_epi32(int32_t(0x80000000));
+            const auto surrogate_base = _mm_set1_epi32(0xd800);
+            const auto surrogate_limit = _mm_set1_epi32(int32_t(0x800 ^ 0x80000000));
+            const auto limit1 = _mm_set1_epi32(int32_t(0x7f ^ 0x80000000));
+            const auto limit2 = _mm_set1_epi32(int32_t(0x7ff ^ 0x80000000));
+            const auto limit3 = _mm_set1_epi32(int32_t(0xffff ^ 0x80000000));
+            while (in_end - in >= 4)
+            {
+                // lane counters grow by at most 3 per step, flush them long before they overflow
+                auto extra = _mm_setzero_si128();
+                for (size_t steps = 0; steps < 0x10000 && in_end - in >= 4; ++steps, in += 4)
+                {
+                    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+                    auto biased = _mm_xor_si128(v, bias);
+                    auto surrogate = _mm_cmplt_epi32(_mm_xor_si128(_mm_sub_epi32(v, surrogate_base), bias), surrogate_limit);
+                    if (_mm_movemask_epi8(surrogate))
+                    {
+                        len += utf8_length_scalar(begin, in, in + 4);
+                        continue;
+                    }
+
+                    len += 4;
+                    extra = _mm_sub_epi32(extra, _mm_cmpgt_epi32(biased, limit1));
+                    extra = _mm_sub_epi32(extra, _mm_cmpgt_epi32(biased, limit2));
+                    extra = _mm_sub_epi32(extra, _mm_cmpgt_epi32(biased, limit3));
+                }
+
+                alignas(16) uint32_t lanes[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanes), extra);
+                for (auto lane : lanes)
+                {
+                    len += lane;
+                }
+            }
+#endif
+            return len + utf8_length_scalar(begin, in, in_end);
+        }
+
+        // Bytes that start a sequence, i.e. everything but 10xxxxxx continuation bytes.
+        size_t count_utf8_leads(const char* in, size_t in_len)
+        {
+            size_t i {}, count {};
+#if defined(U32_SIMD_AVX2)
+            const auto continuation_limit = _mm256_set1_epi8(-65);
+            while (in_len - i >= 32)
+            {
+                // per byte counters are summed up before they can wrap
+                auto leads = _mm256_setzero_si256();
+                for (size_t steps = 0; steps < 255 && in_len - i >= 32; ++steps, i += 32)
+                {
+                    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+                    leads = _mm256_sub_epi8(leads, _mm256_cmpgt_epi8(v, continuation_limit));
+                }
+
+                alignas(32) uint64_t sums[4];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(sums), _mm256_sad_epu8(leads, _mm256_setzero_si256()));
+                count += size_t(sums[0] + sums[1] + sums[2] + sums[3]);
+            }
+#elif defined(U32_SIMD_SSE2)
+            const auto continuation_limit = _mm_set1_epi8(-65);
+            while (in_len - i >= 16)
+            {
+                // per byte counters are summed up before they can wrap
+                auto leads = _mm_setzero_si128();
+                for (size_t steps = 0; steps < 255 && in_len - i >= 16; ++steps, i += 16)
+                {
+                    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    leads = _mm_sub_epi8(leads, _mm_cmpgt_epi8(v, continuation_limit));
+                }
+
+                alignas(16) uint64_t sums[2];
+                _mm_store_si128(reinterpret_cast<__m128i*>(sums), _mm_sad_epu8(leads, _mm_setzero_si128()));
+                count += size_t(sums[0] + sums[1]);
+            }
+#endif
+            for (; i < in_len; ++i)
+            {
+                count += (static_cast<uint8_t>(in[i]) & 0xc0) != 0x80;
+            }
+            return count;
+        }
+
+        // Code points above U+FFFF, each of them takes a surrogate pair in UTF-16.
+        size_t count_supplementary(const char32_t* in, size_t in_len)
+        {
+            size_t i {}, count {};
+#if defined(U32_SIMD_SSE2)
+            const auto bias = _mm_set1_epi32(int32_t(0x80000000));
+            const auto limit = _mm_set1_epi32(int32_t(0xffff ^ 0x80000000));
+            while (in_len - i >= 4)
+            {
+                // lane counters are summed up before they can wrap
+                auto pairs = _mm_setzero_si128();
+                for (size_t steps = 0; steps < 0x10000 && in_len - i >= 4; ++steps, i += 4)
+                {
+                    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    pairs = _mm_sub_epi32(pairs, _mm_cmpgt_epi32(_mm_xor_si128(v, bias), limit));
+                }
+
+                alignas(16) uint32_t lanes[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanes), pairs);
+                count += size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+            }
+#endif
+            for (; i < in_len; ++i)
+            {
+                count += in[i] > 0xffff;
+            }
+            return count;
+        }
+
+        size_t count_low_surrogates(const char16_t* in, size_t in_len)
+        {
+            size_t i {}, count {};
+#if defined(U32_SIMD_SSE2)
+            const auto mask = _mm_set1_epi16(int16_t(0xfc00));
+            const auto low = _mm_set1_epi16(int16_t(0xdc00));
+            while (in_len - i >= 8)
+            {
+                // lane counters are summed up before they can wrap
+                auto lows = _mm_setzero_si128();
+                for (size_t steps = 0; steps < 0x7fff && in_len - i >= 8; ++steps, i += 8)
+                {
+                    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    lows = _mm_sub_epi16(lows, _mm_cmpeq_epi16(_mm_and_si128(v, mask), low));
+                }
+
+                alignas(16) uint32_t lanes[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_madd_epi16(lows, _mm_set1_epi16(1)));
+                count += size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+            }
+#endif
+            for (; i < in_len; ++i)
+            {
+                count += (in[i] & 0xfc00) == 0xdc00;
+            }
+            return count;
+        }
+
+        void write_utf8(char32_t codepoint, size_t len, char* dst)
+        {
+            switch (len)
+            {
+            case 1:
+                dst[0] = static_cast<char>(codepoint);
+                break;
+            case 2:
+                dst[0] = static_cast<char>(0xc0 | ((codepoint >> 6) & 0x1f));
+                dst[1] = static_cast<char>(0x80 | (codepoint & 0x3f));
+                break;
+            case 3:
+                dst[0] = static_cast<char>(0xe0 | ((codepoint >> 12) & 0x0f));
+                dst[1] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f));
+                dst[2] = static_cast<char>(0x80 | (codepoint & 0x3f));
+                break;
+            default:
+                dst[0] = static_cast<char>(0xf0 | ((codepoint >> 18) & 0x07));
+                dst[1] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f));
+                dst[2] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f));
+                dst[3] = static_cast<char>(0x80 | (codepoint & 0x3f));
+                break;
+            }
+        }
+
+        // Bit i is set when in[i] starts a sequence, for up to 32 bytes.
+        uint32_t utf8_lead_mask(const char* in, size_t in_len)
+        {
+#if defined(U32_SIMD_AVX2)
+            if (in_len >= 32)
+            {
+                auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+                return uint32_t(_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(-65))));
+            }
+#elif defined(U32_SIMD_SSE2)
+            if (in_len >= 32)
+            {
+                const auto continuation_limit = _mm_set1_epi8(-65);
+                auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+                auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16));
+                return uint32_t(_mm_movemask_epi8(_mm_cmpgt_epi8(low, continuation_limit)))
+                       | uint32_t(_mm_movemask_epi8(_mm_cmpgt_epi8(high, continuation_limit))) << 16;
+            }
+#endif
+            uint32_t mask {};
+            for (size_t i = 0; i < in_len && i < 32; ++i)
+            {
+                mask |= uint32_t((static_cast<uint8_t>(in[i]) & 0xc0) != 0x80) << i;
+            }
+            return mask;
+        }
+
+        // Position of set bit n (counting from 0) of mask, n has to be below its popcount.
+        unsigned nth_set_bit(uint32_t mask, size_t n)
+        {
+            for (; n != 0; --n)
+            {
+                mask &= mask - 1;
+            }
+            return details::count_trailing_zeros(mask);
+        }
+
+        // Four byte sequences, they take a surrogate pair in UTF-16.
+        size_t count_utf8_four_byte_leads(const char* in, size_t in_len)
+        {
+            size_t i {}, count {};
+#if defined(U32_SIMD_SSE2)
+            const auto lead_min = _mm_set1_epi8(char(0xf0));
+            while (in_len - i >= 16)
+            {
+                // per byte counters are summed up before they can wrap
+                auto leads = _mm_setzero_si128();
+                for (size_t steps = 0; steps < 255 && in_len - i >= 16; ++steps, i += 16)
+                {
+                    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    leads = _mm_sub_epi8(leads, _mm_cmpeq_epi8(_mm_max_epu8(v, lead_min), v));
+                }
+
+                alignas(16) uint64_t sums[2];
+                _mm_store_si128(reinterpret_cast<__m128i*>(sums), _mm_sad_epu8(leads, _mm_setzero_si128()));
+                count += size_t(sums[0] + sums[1]);
+            }
+#endif
+            for (; i < in_len; ++i)
+            {
+                count += static_cast<uint8_t>(in[i]) >= 0xf0;
+            }
+            return count;
+        }
+
+        // Bytes of the UTF-8 form of UTF-16 text, a surrogate counts for half of its pair.
+        size_t utf16_utf8_length(const char16_t* in, size_t in_len)
+        {
+            size_t i {}, len {in_len};
+#if defined(U32_SIMD_SSE2)
+            const auto bias = _mm_set1_epi16(int16_t(0x8000));
+            const auto limit1 = _mm_set1_epi16(int16_t(0x7f ^ 0x8000));
+            const auto limit2 = _mm_set1_epi16(int16_t(0x7ff ^ 0x8000));
+            const auto surrogate_mask = _mm_set1_epi16(int16_t(0xf800));
+            const auto surrogate = _mm_set1_epi16(int16_t(0xd800));
+            while (in_len - i >= 8)
+            {
+                // lane counters grow by at most 2 per step, sum them up before they can wrap
+                auto extra = _mm_setzero_si128();
+                for (size_t steps = 0; steps < 0x3fff && in_len - i >= 8; ++steps, i += 8)
+                {
+                    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                    auto biased = _mm_xor_si128(v, bias);
+                    extra = _mm_sub_epi16(extra, _mm_cmpgt_epi16(biased, limit1));
+                    extra = _mm_sub_epi16(extra, _mm_cmpgt_epi16(biased, limit2));
+                    extra = _mm_add_epi16(extra, _mm_cmpeq_epi16(_mm_and_si128(v, surrogate_mask), surrogate));
+                }
+
+                alignas(16) uint32_t lanes[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanes), _mm_madd_epi16(extra, _mm_set1_epi16(1)));
+                len += size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+            }
+#endif
+            for (; i < in_len; ++i)
+            {
+                len += (in[i] > 0x7f) + (in[i] > 0x7ff) - ((in[i] & 0xf800) == 0xd800);
+            }
+            return len;
+        }
+
+        // Encodes [in, in + in_len) into at most out_capacity bytes. A surrogate pair is
+        // written as a whole, the conversion stops before its high half if it does not fit.
+        conversion_result unicode_to_utf8(const char32_t* in, size_t in_len, char* out, size_t out_capacity)
+        {
+            conversion_result result {};
+            char32_t codepoint = 0;
+            for (; result.read != in_len; ++result.read)
+            {
+                auto ch = in[result.read];
+                if (ch < 0x80)
+                {
+                    auto ascii = details::narrow_ascii(in + result.read, std::min(in_len - result.read, out_capacity - result.written),
+                                                       out + result.written);
+                    if (ascii == 0)
+                    {
+                        result.status = conversion_status::output_too_small;
+                        return result;
+                    }
+
+                    result.read += ascii - 1;
+                    result.written += ascii;
+                    codepoint = 0;
+                    continue;
+                }
+
+                if (ch >= 0xd800 && ch <= 0xdbff)
+                {
+                    codepoint = ((ch - 0xd800) << 10) + 0x10000;
+                    continue;
+                }
+
+                if (ch >= 0xdc00 && ch <= 0xdfff)
+                {
+                    codepoint |= ch - 0xdc00;
+                }
+                else
+                {
+                    codepoint = ch;
+                }
+
+                auto len = size_t(1 + (codepoint > 0x7f) + (codepoint > 0x7ff) + (codepoint > 0xffff));
+                if (out_capacity - result.written < len)
+                {
+                    if (codepoint > 0xffff && ch >= 0xdc00 && ch <= 0xdfff)
+                    {
+                        --result.read;
+                    }
+                    result.status = conversion_status::output_too_small;
+                    return result;
+                }
+
+                write_utf8(codepoint, len, out + result.written);
+                result.written += len;
+                codepoint = 0;
+            }
+            return result;
+        }
+
+        std::string unicode_to_utf8(const char32_t* in, const char32_t* in_end)
+        {
+            std::string out(utf8_length(in, in_end), '\0');
+            unicode_to_utf8(in, size_t(in_end - in), &out[0], out.size());
+            return out;
+        }
+
+        // utf8_to_u32 that also takes the 3 byte forms of surrogates, as WTF-8 does.
+        size_t wtf8_to_u32(char32_t* out_char, const char* in_text, const char* in_text_end)
+        {
+            auto str = reinterpret_cast<const uint8_t*>(in_text);
+            if (str[0] == 0xed && in_text_end - in_text >= 3 && (str[1] & 0xe0) == 0xa0 && (str[2] & 0xc0) == 0x80)
+            {
+                *out_char = 0xd000 | char32_t(str[1] & 0x3f) << 6 | char32_t(str[2] & 0x3f);
+                return 3;
+            }
+            return utf8_to_u32(out_char, in_text, in_text_end);
+        }
+
+        // Encodes [in, in + in_len) as WTF-8: a surrogate pair is merged like unicode_to_utf8
+        // does, an unpaired surrogate gets its own 3 byte sequence.
+        conversion_result unicode_to_wtf8(const char32_t* in, size_t in_len, char* out, size_t out_capacity)
+        {
+            conversion_result result {};
+            while (result.read != in_len)
+            {
+                auto ch = in[result.read];
+                if (ch < 0x80)
+                {
+                    auto ascii = details::narrow_ascii(in + result.read, std::min(in_len - result.read, out_capacity - result.written),
+                                                       out + result.written);
+                    if (ascii == 0)
+                    {
+                        result.status = conversion_status::output_too_small;
+                        break;
+                    }
+
+                    result.read += ascii;
+                    result.written += ascii;
+                    continue;
+                }
+
+                size_t readed = 1;
+                if (ch >= 0xd800 && ch <= 0xdbff && in_len - result.read > 1 && in[result.read + 1] >= 0xdc00 && in[result.read + 1] <= 0xdfff)
+                {
+                    ch = ((ch - 0xd800) << 10) + (in[result.read + 1] - 0xdc00) + 0x10000;
+                    readed = 2;
+                }
+
+                auto len = size_t(2 + (ch > 0x7ff) + (ch > 0xffff));
+                if (out_capacity - result.written < len)
+                {
+                    result.status = conversion_status::output_too_small;
+                    break;
+                }
+
+                write_utf8(ch, len, out + result.written);
+                result.read += readed;
+                result.written += len;
+            }
+            return result;
+        }
+
+        // CESU-8, or Modified UTF-8 which also has U+0000 as C0 80. A surrogate pair of 3 byte
+        // sequences decodes to one code point, everything else like convert.
+        template<bool Modified>
+        conversion_result decode_cesu8(const char* in, size_t in_len, char32_t* out, size_t out_capacity)
+        {
+            conversion_result result {};
+            while (result.read != in_len)
+            {
+                if (result.written == out_capacity)
+                {
+                    result.status = conversion_status::output_too_small;
+                    break;
+                }
+
+                auto text = in + result.read;
+                if (!(*text & 0x80))
+                {
+                    auto ascii = details::widen_ascii(text, std::min(in_len - result.read, out_capacity - result.written),
+                                                      out + result.written);
+                    result.read += ascii;
+                    result.written += ascii;
+                    continue;
+                }
+
+                auto str = reinterpret_cast<const uint8_t*>(text);
+                const auto avail = in_len - result.read;
+                if (Modified && str[0] == 0xc0 && avail >= 2 && str[1] == 0x80)
+                {
+                    out[result.written++] = U'\0';
+                    result.read += 2;
+                    continue;
+                }
+
+                if (str[0] == 0xed && avail >= 6 && (str[1] & 0xf0) == 0xa0 && (str[2] & 0xc0) == 0x80
+                    && str[3] == 0xed && (str[4] & 0xf0) == 0xb0 && (str[5] & 0xc0) == 0x80)
+                {
+                    const auto high = char32_t(str[1] & 0x0f) << 6 | char32_t(str[2] & 0x3f);
+                    const auto low = char32_t(str[4] & 0x0f) << 6 | char32_t(str[5] & 0x3f);
+                    out[result.written++] = 0x10000 + (high << 10) + low;
+                    result.read += 6;
+                    continue;
+                }
+
+                char32_t ch {};
+                auto readed = utf8_to_u32(&ch, text, in + in_len);
+                if (readed == 0)
+                {
+                    result.status = conversion_status::invalid_input;
+                    break;
+                }
+
+                result.read += readed;
+                out[result.written++] = ch;
+            }
+            return result;
+        }
+
+        // Bytes encode_cesu8 writes for ch.
+        template<bool Modified>
+        size_t cesu8_char_length(char32_t ch)
+        {
+            return ch == 0 ? 1 + Modified : ch < 0x80 ? 1 : ch < 0x800 ? 2 : ch < 0x10000 || ch > 0x10ffff ? 3 : 6;
+        }
+
+        // Supplementary characters are written as their two surrogates, values above U+10FFFF
+        // as U+FFFD.
+        template<bool Modified>
+        conversion_result encode_cesu8(const char32_t* in, size_t in_len, char* out, size_t out_capacity)
+        {
+            conversion_result result {};
+            while (result.read != in_len)
+            {
+                auto ch = in[result.read];
+                if (ch < 0x80 && (!Modified || ch != 0))
+                {
+                    auto ascii = details::narrow_ascii(in + result.read, std::min(in_len - result.read, out_capacity - result.written),
+                                                       out + result.written);
+                    if (Modified)
+                    {
+                        // the run ends before a U+0000, which takes 2 bytes
+                        auto nul = std::memchr(out + result.written, 0, ascii);
+                        ascii = nul ? size_t(static_cast<char*>(nul) - (out + result.written)) : ascii;
+                    }
+
+                    if (ascii == 0)
+                    {
+                        result.status = conversion_status::output_too_small;
+                        break;
+                    }
+
+                    result.read += ascii;
+                    result.written += ascii;
+                    continue;
+                }
+
+                const auto len = cesu8_char_length<Modified>(ch);
+                if (out_capacity - result.written < len)
+                {
+                    result.status = conversion_status::output_too_small;
+                    break;
+                }
+
+                auto dst = out + result.written;
+                if (len == 6)
+                {
+                    ch -= 0x10000;
+                    write_utf8(0xd800 | (ch >> 10), 3, dst);
+                    write_utf8(0xdc00 | (ch & 0x3ff), 3, dst + 3);
+                }
+                else if (ch > 0x10ffff)
+                {
+                    write_utf8(get_unicode_invalid_codepoint_char_id(), 3, dst);
+                }
+                else if (ch == 0)
+                {
+                    dst[0] = static_cast<char>(0xc0);
+                    dst[1] = static_cast<char>(0x80);
+                }
+                else
+                {
+                    write_utf8(ch, len, dst);
+                }
+
+                ++result.read;
+                result.written += len;
+            }
+            return result;
+        }
+
+        template<bool Modified>
+        std::string encode_cesu8(const std::u32string& str)
+        {
+            size_t len {};
+            for (auto ch : str)
+            {
+                len += cesu8_char_length<Modified>(ch);
+            }
+
+            std::string result(len, '\0');
+            encode_cesu8<Modified>(str.data(), str.size(), &result[0], result.size());
+            return result;
+        }
+
+        template<bool Modified>
+        std::u32string decode_cesu8(const std::string& str)
+        {
+            // a code point starts at a lead byte, a 6 byte pair has two of them
+            std::u32string result(count_utf8_leads(str.data(), str.size()), U'\0');
+            auto converted = decode_cesu8<Modified>(str.data(), str.size(), &result[0], result.size());
+            result.resize(converted.written);
+            return result;
+        }
+
+        // Decodes like convert, or with Wtf8 like convert(..., wtf8). With stop_at_truncated a
+        // sequence cut short by the end of the input is left unread, instead of being replaced
+        // by U+FFFD, so that it can be resumed.
+        template<bool Wtf8 = false>
+        conversion_result decode_utf8(const char* in, size_t in_len, char32_t* out, size_t out_capacity, bool stop_at_truncated)
+        {
+            conversion_result result {};
+            while (result.read != in_len)
+            {
+                if (result.written == out_capacity)
+                {
+                    result.status = conversion_status::output_too_small;
+                    break;
+                }
+
+                auto text = in + result.read;
+                if (!(*text & 0x80))
+                {
+                    auto ascii = details::widen_ascii(text, std::min(in_len - result.read, out_capacity - result.written),
+                                                      out + result.written);
+                    result.read += ascii;
+                    result.written += ascii;
+                    continue;
+                }
+
+                if (stop_at_truncated && get_utf8_char_len(text) > in_len - result.read)
+                {
+                    break;
+                }
+
+                char32_t ch {};
+                auto readed = Wtf8 ? wtf8_to_u32(&ch, text, in + in_len) : utf8_to_u32(&ch, text, in + in_len);
+                if (readed == 0)
+                {
+                    result.status = conversion_status::invalid_input;
+                    break;
+                }
+
+                result.read += readed;
+                out[result.written++] = ch;
+            }
+            return result;
+        }
+
+        int is_surrogate(char16_t ch)
+        {
+            return (ch - 0xd800u) < 2048u;
+        }
+
+        int is_high_surrogate(char16_t ch)
+        {
+            return (ch & 0xfffffc00) == 0xd800;
+        }
+
+        int is_low_surrogate(char16_t ch)
+        {
+            return (ch & 0xfffffc00) == 0xdc00;
+        }
+
+        char32_t surrogate_to_utf32(char16_t high, char16_t low)
+        {
+            return (high << 10) + low - 0x35fdc00;
+        }
+
+        // Widens the leading run of non-surrogate units of [in, in + len) and returns its length.
+        size_t widen_utf16(const char16_t* in, size_t len, char32_t* out)
+        {
+            size_t i {};
+#if defined(U32_SIMD_SSE2)
+            const auto zero = _mm_setzero_si128();
+            const auto surrogate_mask = _mm_set1_epi16(int16_t(0xf800));
+            const auto surrogate = _mm_set1_epi16(int16_t(0xd800));
+            for (; i + 8 <= len; i += 8)
+            {
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, surrogate_mask), surrogate)))
+                {
+                    break;
+                }
+
+                auto dst = reinterpret_cast<__m128i*>(out + i);
+                _mm_storeu_si128(dst, _mm_unpacklo_epi16(v, zero));
+                _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(v, zero));
+            }
+#endif
+            for (; i < len && !is_surrogate(in[i]); ++i)
+            {
+                out[i] = in[i];
+            }
+            return i;
+        }
+
+        // Narrows the leading run of code points below U+10000 of [in, in + len) and returns
+        // its length. Only complete blocks are stored by the vector path.
+        size_t narrow_to_utf16(const char32_t* in, size_t len, char16_t* out)
+        {
+            size_t i {};
+#if defined(U32_SIMD_SSE2)
+            const auto zero = _mm_setzero_si128();
+            const auto high_half = _mm_set1_epi32(int32_t(0xffff0000));
+            const auto bias32 = _mm_set1_epi32(0x8000);
+            const auto bias16 = _mm_set1_epi16(int16_t(0x8000));
+            for (; i + 8 <= len; i += 8)
+            {
+                auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 4));
+                auto high = _mm_and_si128(_mm_or_si128(a, b), high_half);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xffff)
+                {
+                    break;
+                }
+
+                // packs saturates signed values, move the range below zero and back
+                auto packed = _mm_packs_epi32(_mm_sub_epi32(a, bias32), _mm_sub_epi32(b, bias32));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_add_epi16(packed, bias16));
+            }
+#endif
+            for (; i < len && in[i] < 0x10000; ++i)
+            {
+                out[i] = char16_t(in[i]);
+            }
+            return i;
+        }
+
+#if defined(U32_SIMD_SSE2)
+        // Reverses the bytes of each 16-bit lane, the vector paths run on little-endian hosts only.
+        __m128i swap_bytes16(__m128i v)
+        {
+#if defined(U32_SIMD_SSSE3)
+            return _mm_shuffle_epi8(v, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+#else
+            return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+#endif
+        }
+
+        __m128i swap_bytes32(__m128i v)
+        {
+#if defined(U32_SIMD_SSSE3)
+            return _mm_shuffle_epi8(v, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+#else
+            return swap_bytes16(_mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1));
+#endif
+        }
+#endif
+
+        // widen_utf16 for len units of UTF-16 bytes in the given byte order.
+        template<bool BigEndian>
+        size_t widen_utf16_bytes(const char* in, size_t len, char32_t* out)
+        {
+            size_t i {};
+#if defined(U32_SIMD_SSE2)
+            const auto zero = _mm_setzero_si128();
+            const auto surrogate_mask = _mm_set1_epi16(int16_t(0xf800));
+            const auto surrogate = _mm_set1_epi16(int16_t(0xd800));
+            for (; i + 8 <= len; i += 8)
+            {
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i));
+                if (BigEndian)
+                {
+                    v = swap_bytes16(v);
+                }
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, surrogate_mask), surrogate)))
+                {
+                    break;
+                }
+
+                auto dst = reinterpret_cast<__m128i*>(out + i);
+                _mm_storeu_si128(dst, _mm_unpacklo_epi16(v, zero));
+                _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(v, zero));
+            }
+#endif
+            for (; i < len; ++i)
+            {
+                auto unit = details::load_utf16_unit<BigEndian>(in + 2 * i);
+                if (is_surrogate(unit))
+                {
+                    break;
+                }
+                out[i] = unit;
+            }
+            return i;
+        }
+
+        template<bool BigEndian>
+        conversion_result decode_utf16_bytes(const char* in, size_t in_len, char32_t* out, size_t out_capacity)
+        {
+            conversion_result result {};
+            const auto units = in_len / 2;
+            size_t pos {};
+            while (pos != units)
+            {
+                if (result.written == out_capacity)
+                {
+                    result.status = conversion_status::output_too_small;
+                    break;
+                }
+
+                auto run = widen_utf16_bytes<BigEndian>(in + 2 * pos, std::min(units - pos, out_capacity - result.written),
+                                                        out + result.written);
+                if (run != 0)
+                {
+                    pos += run;
+                    result.written += run;
+                    continue;
+                }
+
+                auto high = details::load_utf16_unit<BigEndian>(in + 2 * pos);
+                char16_t low = pos + 1 != units ? details::load_utf16_unit<BigEndian>(in + 2 * pos + 2) : 0;
+                if (!is_high_surrogate(high) || !is_low_surrogate(low))
+                {
+                    result.status = conversion_status::invalid_input;
+                    break;
+                }
+
+                out[result.written++] = surrogate_to_utf32(high, low);
+                pos += 2;
+            }
+
+            result.read = 2 * pos;
+            if (result.status == conversion_status::ok && result.read != in_len)
+            {
+                result.status = conversion_status::invalid_input;
+            }
+            return result;
+        }
+
+        template<bool BigEndian>
+        conversion_result decode_utf32_bytes(const char* in, size_t in_len, char32_t* out, size_t out_capacity)
+        {
+            const auto count = std::min(in_len / 4, out_capacity);
+            size_t i {};
+#if defined(U32_SIMD_SSE2)
+            for (; i + 4 <= count; i += 4)
+            {
+                auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 4 * i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), BigEndian ? swap_bytes32(v) : v);
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                out[i] = details::load_utf32_unit<BigEndian>(in + 4 * i);
+            }
+
+            conversion_result result {4 * count, count, conversion_status::ok};
+            if (count != in_len / 4)
+            {
+                result.status = conversion_status::output_too_small;
+            }
+            else if (result.read != in_len)
+            {
+                result.status = conversion_status::invalid_input;
+            }
+            return result;
+        }
+
+        // What the error policies do with a malformed sequence. Only constants are tested in
+        // the decoding loops, so each instantiation keeps just its own error path.
+        template<typename ErrorPolicy>
+        struct policy_traits;
+
+        template<>
+        struct policy_traits<error_policy::replace>
+        {
+            static constexpr bool substitute = true;
+            static constexpr bool halt = false;
+            static void raise(const char*, size_t) {}
+        };
+
+        template<>
+        struct policy_traits<error_policy::skip>
+        {
+            static constexpr bool substitute = false;
+            static constexpr bool halt = false;
+            static void raise(const char*, size_t) {}
+        };
+
+        template<>
+        struct policy_traits<error_policy::stop>
+        {
+            static constexpr bool substitute = false;
+            static constexpr bool halt = true;
+            static void raise(const char*, size_t) {}
+        };
+
+        template<>
+        struct policy_traits<error_policy::raise>
+        {
+            static constexpr bool substitute = false;
+            static constexpr bool halt = true;
+            static void raise(const char* what, size_t offset)
+            {
+                throw conversion_error(what, offset);
+            }
+        };
+
+        // Applies the policy to a malformed sequence at result.read, false when decoding stops there.
+        template<typename ErrorPolicy>
+        bool on_malformed(conversion_result& result, size_t* error_count, const char* what)
+        {
+            if (error_count)
+            {
+                ++*error_count;
+            }
+
+            policy_traits<ErrorPolicy>::raise(what, result.read);
+            if (policy_traits<ErrorPolicy>::halt)
+            {
+                result.status = conversion_status::invalid_input;
+                return false;
+            }
+            return true;
+        }
+
+        // Runs a buffer conversion into a string of estimated size, growing it by
+        // units_per_input for each unread input unit until everything fits.
+        template<typename Out, typename In, typename Convert>
+        Out convert_to_string(const In& in, size_t estimate, size_t units_per_input, Convert convert)
+        {
+            Out out(estimate, typename Out::value_type {});
+            conversion_result total {};
+            for (;;)
+            {
+                auto converted = convert(in.data() + total.read, in.size() - total.read, &out[0] + total.written,
+                                         out.size() - total.written);
+                total.read += converted.read;
+                total.written += converted.written;
+                if (converted.status != conversion_status::output_too_small)
+                {
+                    break;
+                }
+                out.resize(out.size() + (in.size() - total.read) * units_per_input);
+            }
+            out.resize(total.written);
+            return out;
+        }
+    }
+
+    size_t utf8_to_u32_reverse(char32_t* out_char, const char* start_str, const char* curr_pos)
+    {
+        auto c = static_cast<char32_t>(-1);
+
+        if (curr_pos - 1 < start_str)
+        {
+            *out_char = c;
+            return 0;
+        }
+
+        auto end_pos = curr_pos;
+
+        do
+        {
+            --curr_pos;
+            if(!(*curr_pos & 0x80) || (*curr_pos & 0xe0) == 0xc0 || (*curr_pos & 0xf0) == 0xe0 || (*curr_pos & 0xf8) == 0xf0)
+            {
+                auto ptr = curr_pos;
+                return utf8_to_u32(out_char, ptr, end_pos);
+            }
+
+            if(start_str == curr_pos)
+            {
+                break;
+            }
+        }
+        while(true);
+
+        return 0;
+    }
+
+    size_t validate_utf8(const char* in, size_t in_len)
+    {
+        return details::validate_utf8(in, in_len);
+    }
+
+    size_t utf8_length_in_codepoints(const char* in, size_t in_len)
+    {
+        return count_utf8_leads(in, in_len);
+    }
+
+    size_t utf32_length_in_utf8(const char32_t* in, size_t in_len)
+    {
+        return utf8_length(in, in + in_len);
+    }
+
+    size_t utf32_length_in_utf16(const char32_t* in, size_t in_len)
+    {
+        return in_len + count_supplementary(in, in_len);
+    }
+
+    size_t utf16_length_in_codepoints(const char16_t* in, size_t in_len)
+    {
+        return in_len - count_low_surrogates(in, in_len);
+    }
+
+    size_t utf8_length_in_utf16(const char* in, size_t in_len)
+    {
+        return count_utf8_leads(in, in_len) + count_utf8_four_byte_leads(in, in_len);
+    }
+
+    size_t utf16_length_in_utf8(const char16_t* in, size_t in_len)
+    {
+        return utf16_utf8_length(in, in_len);
+    }
+
+    std::string u32_to_utf8(char32_t ch)
+    {
+        char buffer[4] {};
+        return std::string(buffer, encode_utf8(ch, buffer));
+    }
+
+    std::u16string u32_to_utf16(char32_t ch)
+    {
+        char16_t buffer[2] {};
+        return std::u16string(buffer, encode_utf16(ch, buffer));
+    }
+
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity)
+    {
+        return decode_utf8(in, in_len, out, out_capacity, false);
+    }
+
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity)
+    {
+        return unicode_to_utf8(in, in_len, out, out_capacity);
+    }
+
+    std::string convert(const std::u32string &str)
+    {
+        return unicode_to_utf8(str.data(), str.data() + str.size());
+    }
+
+    std::u32string convert(const std::string &str)
+    {
+        // every decoded code point starts at a lead byte, so their count bounds the output
+        std::u32string result(count_utf8_leads(str.data(), str.size()), U'\0');
+        auto converted = convert(str.data(), str.size(), &result[0], result.size());
+        result.resize(converted.written);
+        return result;
+    }
+
+    conversion_result convert(const char16_t* in, size_t in_len, char32_t* out, size_t out_capacity)
+    {
+        conversion_result result {};
+        while (result.read != in_len)
+        {
+            if (result.written == out_capacity)
+            {
+                result.status = conversion_status::output_too_small;
+                break;
+            }
+
+            if (!is_surrogate(in[result.read]))
+            {
+                auto units = widen_utf16(in + result.read, std::min(in_len - result.read, out_capacity - result.written),
+                                         out + result.written);
+                result.read += units;
+                result.written += units;
+                continue;
+            }
+
+            auto readed = utf16_to_u32(out + result.written, in + result.read, in + in_len);
+            if (readed == 0)
+            {
+                result.status = conversion_status::invalid_input;
+                break;
+            }
+
+            result.read += readed;
+            ++result.written;
+        }
+        return result;
+    }
+
+    conversion_result convert(const char32_t* in, size_t in_len, char16_t* out, size_t out_capacity)
+    {
+        conversion_result result {};
+        while (result.read != in_len)
+        {
+            if (result.written == out_capacity)
+            {
+                result.status = conversion_status::output_too_small;
+                break;
+            }
+
+            auto ch = in[result.read];
+            if (ch < 0x10000)
+            {
+                auto units = narrow_to_utf16(in + result.read, std::min(in_len - result.read, out_capacity - result.written),
+                                             out + result.written);
+                result.read += units;
+                result.written += units;
+                continue;
+            }
+
+            if (out_capacity - result.written < 2)
+            {
+                result.status = conversion_status::output_too_small;
+                break;
+            }
+
+            ch -= 0x10000;
+            out[result.written++] = char16_t(0xD800 | (ch >> 10));
+            out[result.written++] = char16_t(0xDC00 | (ch & 0x3FF));
+            ++result.read;
+        }
+        return result;
+    }
+
+    std::u32string convert(const std::u16string &str)
+    {
+        std::u32string result(utf16_length_in_codepoints(str.data(), str.size()), U'\0');
+        auto converted = convert(str.data(), str.size(), &result[0], result.size());
+        result.resize(converted.written);
+        return result;
+    }
+
+    std::u16string convert_to_u16(const std::u32string &str)
+    {
+        std::u16string result(utf32_length_in_utf16(str.data(), str.size()), u'\0');
+        convert(str.data(), str.size(), &result[0], result.size());
+        return result;
+    }
+
+    namespace
+    {
+        template<bool Wtf8>
+        conversion_result transcode_utf8_to_utf16(const char* in, size_t in_len, char16_t* out, size_t out_capacity)
+        {
+            conversion_result result {};
+            while (result.read != in_len)
+            {
+                if (result.written == out_capacity)
+                {
+                    result.status = conversion_status::output_too_small;
+                    break;
+                }
+
+                auto text = in + result.read;
+                if (!(*text & 0x80))
+                {
+                    auto ascii = details::widen_ascii(text, std::min(in_len - result.read, out_capacity - result.written),
+                                                      out + result.written);
+                    result.read += ascii;
+                    result.written += ascii;
+                    continue;
+                }
+
+                char32_t ch {};
+                auto readed = Wtf8 ? wtf8_to_u32(&ch, text, in + in_len) : utf8_to_u32(&ch, text, in + in_len);
+                if (readed == 0)
+                {
+                    result.status = conversion_status::invalid_input;
+                    break;
+                }
+
+                if (ch < 0x10000)
+                {
+                    out[result.written++] = char16_t(ch);
+                }
+                else
+                {
+                    if (out_capacity - result.written < 2)
+                    {
+                        result.status = conversion_status::output_too_small;
+                        break;
                     }
 
-                    if (codepoint <= 0x7f)
-                    {
-                        out.append(1, static_cast<char>(codepoint));
-                    }
-                    else if (codepoint <= 0x7ff)
-                    {
-                        out.append(1, static_cast<char>(0xc0 | ((codepoint >> 6) & 0x1f)));
-                        out.append(1, static_cast<char>(0x80 | (codepoint & 0x3f)));
-                    }
-                    else if (codepoint <= 0xffff)
+                    ch -= 0x10000;
+                    out[result.written++] = char16_t(0xD800 | (ch >> 10));
+                    out[result.written++] = char16_t(0xDC00 | (ch & 0x3FF));
+                }
+                result.read += readed;
+            }
+            return result;
+        }
+
+        template<bool Wtf8>
+        conversion_result transcode_utf16_to_utf8(const char16_t* in, size_t in_len, char* out, size_t out_capacity)
+        {
+            conversion_result result {};
+            while (result.read != in_len)
+            {
+                auto unit = in[result.read];
+                if (unit < 0x80)
+                {
+                    auto ascii = details::narrow_ascii(in + result.read, std::min(in_len - result.read, out_capacity - result.written),
+                                                       out + result.written);
+                    if (ascii == 0)
                     {
-                        out.append(1, static_cast<char>(0xe0 | ((codepoint >> 12) & 0x0f)));
-                        out.append(1, static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
-                        out.append(1, static_cast<char>(0x80 | (codepoint & 0x3f)));
+                        result.status = conversion_status::output_too_small;
+                        break;
                     }
-                    else
+
+                    result.read += ascii;
+                    result.written += ascii;
+                    continue;
+                }
+
+                char32_t ch = unit;
+                size_t readed = 1;
+                if (is_surrogate(unit))
+                {
+                    readed = utf16_to_u32(&ch, in + result.read, in + in_len);
+                    if (readed == 0)
                     {
-                        out.append(1, static_cast<char>(0xf0 | ((codepoint >> 18) & 0x07)));
-                        out.append(1, static_cast<char>(0x80 | ((codepoint >> 12) & 0x3f)));
-                        out.append(1, static_cast<char>(0x80 | ((codepoint >> 6) & 0x3f)));
-                        out.append(1, static_cast<char>(0x80 | (codepoint & 0x3f)));
+                        if (!Wtf8)
+                        {
+                            result.status = conversion_status::invalid_input;
+                            break;
+                        }
+                        // WTF-8 keeps the unpaired surrogate, ch is still the unit
+                        readed = 1;
                     }
-                    codepoint = 0;
                 }
+
+                auto len = size_t(2 + (ch > 0x7ff) + (ch > 0xffff));
+                if (out_capacity - result.written < len)
+                {
+                    result.status = conversion_status::output_too_small;
+                    break;
+                }
+
+                write_utf8(ch, len, out + result.written);
+                result.read += readed;
+                result.written += len;
             }
-            return out;
+            return result;
         }
+    }
 
-        int is_surrogate(char16_t ch)
-        {
-            return (ch - 0xd800u) < 2048u;
-        }
+    conversion_result utf8_to_utf16(const char* in, size_t in_len, char16_t* out, size_t out_capacity)
+    {
+        return transcode_utf8_to_utf16<false>(in, in_len, out, out_capacity);
+    }
 
-        int is_high_surrogate(char16_t ch)
+    conversion_result utf16_to_utf8(const char16_t* in, size_t in_len, char* out, size_t out_capacity)
+    {
+        return transcode_utf16_to_utf8<false>(in, in_len, out, out_capacity);
+    }
+
+    std::u16string utf8_to_utf16(const std::string &str)
+    {
+        std::u16string result(utf8_length_in_utf16(str.data(), str.size()), u'\0');
+        auto converted = utf8_to_utf16(str.data(), str.size(), &result[0], result.size());
+        result.resize(converted.written);
+        return result;
+    }
+
+    std::string utf16_to_utf8(const std::u16string &str)
+    {
+        std::string result(utf16_length_in_utf8(str.data(), str.size()), '\0');
+        auto converted = utf16_to_utf8(str.data(), str.size(), &result[0], result.size());
+        result.resize(converted.written);
+        return result;
+    }
+
+    unicode_t detect_bom(const char* in, size_t in_len, size_t* bom_length, unicode_t fallback)
+    {
+        struct bom
         {
-            return (ch & 0xfffffc00) == 0xd800;
-        }
+            const char* bytes;
+            size_t length;
+            unicode_t encoding;
+        };
 
-        int is_low_surrogate(char16_t ch)
+        // UTF-32LE first, its mark starts with the one of UTF-16LE
+        static const bom marks[] {
+            {"\xff\xfe\x00\x00", 4, unicode_t::UTF_32LE},
+            {"\x00\x00\xfe\xff", 4, unicode_t::UTF_32BE},
+            {"\xef\xbb\xbf", 3, unicode_t::UTF_8},
+            {"\xff\xfe", 2, unicode_t::UTF_16LE},
+            {"\xfe\xff", 2, unicode_t::UTF_16BE},
+        };
+
+        for (const auto& mark : marks)
         {
-            return (ch & 0xfffffc00) == 0xdc00;
+            if (in_len >= mark.length && std::equal(mark.bytes, mark.bytes + mark.length, in))
+            {
+                *bom_length = mark.length;
+                return mark.encoding;
+            }
         }
 
-        char32_t surrogate_to_utf32(char16_t high, char16_t low)
+        *bom_length = 0;
+        return fallback;
+    }
+
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, unicode_t encoding)
+    {
+        switch (encoding)
         {
-            return (high << 10) + low - 0x35fdc00;
+        case unicode_t::UTF_16LE:
+            return decode_utf16_bytes<false>(in, in_len, out, out_capacity);
+        case unicode_t::UTF_16BE:
+            return decode_utf16_bytes<true>(in, in_len, out, out_capacity);
+        case unicode_t::UTF_32LE:
+            return decode_utf32_bytes<false>(in, in_len, out, out_capacity);
+        case unicode_t::UTF_32BE:
+            return decode_utf32_bytes<true>(in, in_len, out, out_capacity);
+        default:
+            return convert(in, in_len, out, out_capacity);
         }
     }
 
-    size_t utf8_to_u32(char32_t* out_char, const char* in_text, const char* in_text_end)
+    std::u32string convert(const std::string& bytes, unicode_t encoding)
     {
-        auto c = static_cast<char32_t>(-1);
-        auto str = reinterpret_cast<const uint8_t*>(in_text);
-        if(!(*str & 0x80))
+        if (encoding == unicode_t::UTF_8)
         {
-            c = static_cast<char32_t>(*str++);
-            *out_char = c;
-            return 1;
+            return convert(bytes);
         }
-        if((*str & 0xe0) == 0xc0)
+
+        // a code point takes at least one unit
+        const auto unit_size = encoding == unicode_t::UTF_16LE || encoding == unicode_t::UTF_16BE ? 2 : 4;
+        std::u32string result(bytes.size() / unit_size, U'\0');
+        auto converted = convert(bytes.data(), bytes.size(), &result[0], result.size(), encoding);
+        result.resize(converted.written);
+        return result;
+    }
+
+    template<typename ErrorPolicy>
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, size_t* error_count)
+    {
+        conversion_result result {};
+        while (result.read != in_len)
         {
-            *out_char = get_unicode_invalid_codepoint_char_id(); // will be invalid but not end of string
-            if(in_text_end && in_text_end - reinterpret_cast<const char*>(str) < 2)
+            if (result.written == out_capacity)
             {
-                return 1;
+                result.status = conversion_status::output_too_small;
+                break;
             }
-            if(*str < 0xc2)
+
+            auto text = in + result.read;
+            if (!(*text & 0x80))
             {
-                return 2;
+                auto ascii = details::widen_ascii(text, std::min(in_len - result.read, out_capacity - result.written),
+                                                  out + result.written);
+                result.read += ascii;
+                result.written += ascii;
+                continue;
             }
-            c = static_cast<char32_t>((*str++ & 0x1f) << 6);
-            if((*str & 0xc0) != 0x80)
+
+            auto decoded = details::decode_utf8_strict(text, in_len - result.read);
+            if (!decoded.valid)
             {
-                return 2;
+                if (!on_malformed<ErrorPolicy>(result, error_count, "invalid UTF-8 sequence"))
+                {
+                    break;
+                }
+
+                if (!policy_traits<ErrorPolicy>::substitute)
+                {
+                    result.read += decoded.len;
+                    continue;
+                }
             }
-            c += (*str++ & 0x3f);
-            *out_char = c;
-            return 2;
+
+            out[result.written++] = decoded.ch;
+            result.read += decoded.len;
         }
-        if((*str & 0xf0) == 0xe0)
+        return result;
+    }
+
+    template<typename ErrorPolicy>
+    conversion_result convert(const char16_t* in, size_t in_len, char32_t* out, size_t out_capacity, size_t* error_count)
+    {
+        conversion_result result {};
+        while (result.read != in_len)
         {
-            *out_char = get_unicode_invalid_codepoint_char_id(); // will be invalid but not end of string
-            if(in_text_end && in_text_end - reinterpret_cast<const char*>(str) < 3)
+            if (result.written == out_capacity)
             {
-                return 1;
+                result.status = conversion_status::output_too_small;
+                break;
             }
-            if(*str == 0xe0 && (str[1] < 0xa0 || str[1] > 0xbf))
+
+            auto unit = in[result.read];
+            if (!is_surrogate(unit))
             {
-                return 3;
+                auto units = widen_utf16(in + result.read, std::min(in_len - result.read, out_capacity - result.written),
+                                         out + result.written);
+                result.read += units;
+                result.written += units;
+                continue;
             }
-            if(*str == 0xed && str[1] > 0x9f)
+
+            if (is_high_surrogate(unit) && in_len - result.read > 1 && is_low_surrogate(in[result.read + 1]))
             {
-                return 3; // str[1] < 0x80 is checked below
+                out[result.written++] = surrogate_to_utf32(unit, in[result.read + 1]);
+                result.read += 2;
+                continue;
             }
-            c = static_cast<char32_t>((*str++ & 0x0f) << 12);
-            if((*str & 0xc0) != 0x80)
+
+            if (!on_malformed<ErrorPolicy>(result, error_count, "unpaired UTF-16 surrogate"))
             {
-                return 3;
+                break;
             }
-            c += static_cast<char32_t>((*str++ & 0x3f) << 6);
-            if((*str & 0xc0) != 0x80)
+
+            if (policy_traits<ErrorPolicy>::substitute)
             {
-                return 3;
+                out[result.written++] = get_unicode_invalid_codepoint_char_id();
             }
-            c += (*str++ & 0x3f);
-            *out_char = c;
-            return 3;
+            ++result.read;
         }
-        if((*str & 0xf8) == 0xf0)
+        return result;
+    }
+
+    template<typename ErrorPolicy>
+    conversion_result utf8_to_utf16(const char* in, size_t in_len, char16_t* out, size_t out_capacity, size_t* error_count)
+    {
+        conversion_result result {};
+        while (result.read != in_len)
         {
-            *out_char = get_unicode_invalid_codepoint_char_id(); // will be invalid but not end of string
-            if(in_text_end && in_text_end - reinterpret_cast<const char*>(str) < 4)
+            if (result.written == out_capacity)
             {
-                return 1;
+                result.status = conversion_status::output_too_small;
+                break;
             }
-            if(*str > 0xf4)
+
+            auto text = in + result.read;
+            if (!(*text & 0x80))
             {
-                return 4;
+                auto ascii = details::widen_ascii(text, std::min(in_len - result.read, out_capacity - result.written),
+                                                  out + result.written);
+                result.read += ascii;
+                result.written += ascii;
+                continue;
             }
-            if(*str == 0xf0 && (str[1] < 0x90 || str[1] > 0xbf))
+
+            auto decoded = details::decode_utf8_strict(text, in_len - result.read);
+            if (!decoded.valid)
             {
-                return 4;
+                if (!on_malformed<ErrorPolicy>(result, error_count, "invalid UTF-8 sequence"))
+                {
+                    break;
+                }
+
+                if (!policy_traits<ErrorPolicy>::substitute)
+                {
+                    result.read += decoded.len;
+                    continue;
+                }
             }
-            if(*str == 0xf4 && str[1] > 0x8f)
+
+            auto ch = decoded.ch;
+            if (ch < 0x10000)
             {
-                return 4; // str[1] < 0x80 is checked below
+                out[result.written++] = char16_t(ch);
             }
-            c = static_cast<char32_t>((*str++ & 0x07) << 18);
-            if((*str & 0xc0) != 0x80)
+            else
             {
-                return 4;
+                if (out_capacity - result.written < 2)
+                {
+                    result.status = conversion_status::output_too_small;
+                    break;
+                }
+
+                ch -= 0x10000;
+                out[result.written++] = char16_t(0xD800 | (ch >> 10));
+                out[result.written++] = char16_t(0xDC00 | (ch & 0x3FF));
             }
-            c += static_cast<char32_t>((*str++ & 0x3f) << 12);
-            if((*str & 0xc0) != 0x80)
+            result.read += decoded.len;
+        }
+        return result;
+    }
+
+    template<typename ErrorPolicy>
+    conversion_result utf16_to_utf8(const char16_t* in, size_t in_len, char* out, size_t out_capacity, size_t* error_count)
+    {
+        conversion_result result {};
+        while (result.read != in_len)
+        {
+            auto unit = in[result.read];
+            if (unit < 0x80)
             {
-                return 4;
+                auto ascii = details::narrow_ascii(in + result.read, std::min(in_len - result.read, out_capacity - result.written),
+                                                   out + result.written);
+                if (ascii == 0)
+                {
+                    result.status = conversion_status::output_too_small;
+                    break;
+                }
+
+                result.read += ascii;
+                result.written += ascii;
+                continue;
             }
-            c += static_cast<char32_t>((*str++ & 0x3f) << 6);
-            if((*str & 0xc0) != 0x80)
+
+            char32_t ch = unit;
+            size_t readed = 1;
+            if (is_surrogate(unit))
             {
-                return 4;
+                if (is_high_surrogate(unit) && in_len - result.read > 1 && is_low_surrogate(in[result.read + 1]))
+                {
+                    ch = surrogate_to_utf32(unit, in[result.read + 1]);
+                    readed = 2;
+                }
+                else
+                {
+                    // room for U+FFFD first, a resumed call would count the surrogate again
+                    if (policy_traits<ErrorPolicy>::substitute && out_capacity - result.written < 3)
+                    {
+                        result.status = conversion_status::output_too_small;
+                        break;
+                    }
+
+                    if (!on_malformed<ErrorPolicy>(result, error_count, "unpaired UTF-16 surrogate"))
+                    {
+                        break;
+                    }
+
+                    if (!policy_traits<ErrorPolicy>::substitute)
+                    {
+                        ++result.read;
+                        continue;
+                    }
+                    ch = get_unicode_invalid_codepoint_char_id();
+                }
             }
-            c += (*str++ & 0x3f);
-            // utf-8 encodings of values used in surrogate pairs are invalid
-            if((c & 0xFFFFF800) == 0xD800)
+
+            auto len = size_t(2 + (ch > 0x7ff) + (ch > 0xffff));
+            if (out_capacity - result.written < len)
             {
-                return 4;
+                result.status = conversion_status::output_too_small;
+                break;
             }
-            // If codepoint does not fit in ImWchar, use replacement character U+FFFD instead
-            if (c > get_unicode_max_codepoint_char_id()) c = get_unicode_invalid_codepoint_char_id();
-            *out_char = c;
-            return 4;
+
+            write_utf8(ch, len, out + result.written);
+            result.read += readed;
+            result.written += len;
         }
-        *out_char = 0;
-        return 0;
+        return result;
     }
 
-    size_t utf8_to_u32_reverse(char32_t* out_char, const char* start_str, const char* curr_pos)
+    template<typename ErrorPolicy>
+    std::u32string convert(const std::string& str, size_t* error_count)
     {
-        auto c = static_cast<char32_t>(-1);
+        // only replacements of stray continuation bytes do not start at a lead byte
+        return convert_to_string<std::u32string>(str, count_utf8_leads(str.data(), str.size()), 1,
+            [error_count](const char* in, size_t in_len, char32_t* out, size_t out_capacity) {
+                return convert<ErrorPolicy>(in, in_len, out, out_capacity, error_count);
+            });
+    }
 
-        if (curr_pos - 1 < start_str)
-        {
-            *out_char = c;
-            return 0;
-        }
+    template<typename ErrorPolicy>
+    std::u32string convert(const std::u16string& str, size_t* error_count)
+    {
+        return convert_to_string<std::u32string>(str, utf16_length_in_codepoints(str.data(), str.size()), 1,
+            [error_count](const char16_t* in, size_t in_len, char32_t* out, size_t out_capacity) {
+                return convert<ErrorPolicy>(in, in_len, out, out_capacity, error_count);
+            });
+    }
 
-        auto end_pos = curr_pos;
+    template<typename ErrorPolicy>
+    std::u16string utf8_to_utf16(const std::string& str, size_t* error_count)
+    {
+        return convert_to_string<std::u16string>(str, utf8_length_in_utf16(str.data(), str.size()), 1,
+            [error_count](const char* in, size_t in_len, char16_t* out, size_t out_capacity) {
+                return utf8_to_utf16<ErrorPolicy>(in, in_len, out, out_capacity, error_count);
+            });
+    }
 
-        do
+    template<typename ErrorPolicy>
+    std::string utf16_to_utf8(const std::u16string& str, size_t* error_count)
+    {
+        // a replaced lone surrogate takes 3 bytes
+        return convert_to_string<std::string>(str, utf16_length_in_utf8(str.data(), str.size()), 3,
+            [error_count](const char16_t* in, size_t in_len, char* out, size_t out_capacity) {
+                return utf16_to_utf8<ErrorPolicy>(in, in_len, out, out_capacity, error_count);
+            });
+    }
+
+#define U32_INSTANTIATE_ERROR_POLICY(Policy)                                                                              \
+    template std::u32string convert<Policy>(const std::string&, size_t*);                                                \
+    template std::u32string convert<Policy>(const std::u16string&, size_t*);                                             \
+    template std::u16string utf8_to_utf16<Policy>(const std::string&, size_t*);                                          \
+    template std::string utf16_to_utf8<Policy>(const std::u16string&, size_t*);                                          \
+    template conversion_result convert<Policy>(const char*, size_t, char32_t*, size_t, size_t*);                         \
+    template conversion_result convert<Policy>(const char16_t*, size_t, char32_t*, size_t, size_t*);                     \
+    template conversion_result utf8_to_utf16<Policy>(const char*, size_t, char16_t*, size_t, size_t*);                   \
+    template conversion_result utf16_to_utf8<Policy>(const char16_t*, size_t, char*, size_t, size_t*);
+
+    U32_INSTANTIATE_ERROR_POLICY(error_policy::replace)
+    U32_INSTANTIATE_ERROR_POLICY(error_policy::skip)
+    U32_INSTANTIATE_ERROR_POLICY(error_policy::stop)
+    U32_INSTANTIATE_ERROR_POLICY(error_policy::raise)
+
+#undef U32_INSTANTIATE_ERROR_POLICY
+
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, wtf8_t)
+    {
+        return decode_utf8<true>(in, in_len, out, out_capacity, false);
+    }
+
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity, wtf8_t)
+    {
+        return unicode_to_wtf8(in, in_len, out, out_capacity);
+    }
+
+    conversion_result utf8_to_utf16(const char* in, size_t in_len, char16_t* out, size_t out_capacity, wtf8_t)
+    {
+        return transcode_utf8_to_utf16<true>(in, in_len, out, out_capacity);
+    }
+
+    conversion_result utf16_to_utf8(const char16_t* in, size_t in_len, char* out, size_t out_capacity, wtf8_t)
+    {
+        return transcode_utf16_to_utf8<true>(in, in_len, out, out_capacity);
+    }
+
+    std::u32string convert(const std::string &str, wtf8_t)
+    {
+        std::u32string result(count_utf8_leads(str.data(), str.size()), U'\0');
+        auto converted = convert(str.data(), str.size(), &result[0], result.size(), wtf8);
+        result.resize(converted.written);
+        return result;
+    }
+
+    std::string convert(const std::u32string &str, wtf8_t)
+    {
+        // an unpaired surrogate takes 3 bytes instead of the 2 utf8_length counts for it
+        return convert_to_string<std::string>(str, utf8_length(str.data(), str.data() + str.size()), 4,
+            [](const char32_t* in, size_t in_len, char* out, size_t out_capacity) {
+                return convert(in, in_len, out, out_capacity, wtf8);
+            });
+    }
+
+    std::u16string utf8_to_utf16(const std::string &str, wtf8_t)
+    {
+        std::u16string result(utf8_length_in_utf16(str.data(), str.size()), u'\0');
+        auto converted = utf8_to_utf16(str.data(), str.size(), &result[0], result.size(), wtf8);
+        result.resize(converted.written);
+        return result;
+    }
+
+    std::string utf16_to_utf8(const std::u16string &str, wtf8_t)
+    {
+        return convert_to_string<std::string>(str, utf16_length_in_utf8(str.data(), str.size()), 3,
+            [](const char16_t* in, size_t in_len, char* out, size_t out_capacity) {
+                return utf16_to_utf8(in, in_len, out, out_capacity, wtf8);
+            });
+    }
+
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, cesu8_t)
+    {
+        return decode_cesu8<false>(in, in_len, out, out_capacity);
+    }
+
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity, cesu8_t)
+    {
+        return encode_cesu8<false>(in, in_len, out, out_capacity);
+    }
+
+    std::u32string convert(const std::string &str, cesu8_t)
+    {
+        return decode_cesu8<false>(str);
+    }
+
+    std::string convert(const std::u32string &str, cesu8_t)
+    {
+        return encode_cesu8<false>(str);
+    }
+
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, modified_utf8_t)
+    {
+        return decode_cesu8<true>(in, in_len, out, out_capacity);
+    }
+
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity, modified_utf8_t)
+    {
+        return encode_cesu8<true>(in, in_len, out, out_capacity);
+    }
+
+    std::u32string convert(const std::string &str, modified_utf8_t)
+    {
+        return decode_cesu8<true>(str);
+    }
+
+    std::string convert(const std::u32string &str, modified_utf8_t)
+    {
+        return encode_cesu8<true>(str);
+    }
+
+    conversion_result utf8_decoder::feed(const char* in, size_t in_len, char32_t* out, size_t out_capacity)
+    {
+        conversion_result result {};
+        if (pending_size_ != 0)
         {
-            --curr_pos;
-            if(!(*curr_pos & 0x80) || (*curr_pos & 0xe0) == 0xc0 || (*curr_pos & 0xf0) == 0xe0 || (*curr_pos & 0xf8) == 0xf0)
+            const auto need = get_utf8_char_len(pending_);
+            while (pending_size_ < need && result.read < in_len)
             {
-                auto ptr = curr_pos;
-                return utf8_to_u32(out_char, ptr, end_pos);
+                pending_[pending_size_++] = in[result.read++];
             }
 
-            if(start_str == curr_pos)
+            if (pending_size_ < need)
             {
-                break;
+                return result;
+            }
+
+            if (out_capacity == 0)
+            {
+                result.status = conversion_status::output_too_small;
+                return result;
             }
+
+            utf8_to_u32(out, pending_, pending_ + pending_size_);
+            pending_size_ = 0;
+            result.written = 1;
         }
-        while(true);
 
-        return 0;
+        auto decoded = decode_utf8(in + result.read, in_len - result.read, out + result.written, out_capacity - result.written, true);
+        result.read += decoded.read;
+        result.written += decoded.written;
+        result.status = decoded.status;
+
+        if (result.status == conversion_status::ok && result.read != in_len)
+        {
+            // an incomplete sequence at the end of the chunk, at most 3 bytes
+            while (result.read != in_len)
+            {
+                pending_[pending_size_++] = in[result.read++];
+            }
+        }
+        return result;
     }
 
-    std::string u32_to_utf8(char32_t ch)
+    conversion_status utf8_decoder::feed(const char* in, size_t in_len, std::u32string& out)
     {
-        return unicode_to_utf8(&ch, &ch + 1);
+        // pending bytes complete at most one code point
+        const auto offset = out.size();
+        out.resize(offset + in_len + 1);
+        auto result = feed(in, in_len, &out[offset], in_len + 1);
+        out.resize(offset + result.written);
+        return result.status;
     }
 
-    size_t utf16_to_u32(char32_t *out_char, const char16_t *in_text, const char16_t *in_text_end)
+    conversion_result utf8_decoder::finish(char32_t* out, size_t out_capacity)
     {
-        auto uc = *in_text;
-        if (!is_surrogate(uc))
+        // the tail is decoded the same way convert decodes the end of a whole string
+        auto result = decode_utf8(pending_, pending_size_, out, out_capacity, false);
+        if (result.status == conversion_status::output_too_small)
         {
-            *out_char = uc;
-            return 1;
+            return {0, 0, result.status};
         }
-        else
+
+        result.read = pending_size_;
+        if (pending_size_ != 0)
         {
-            in_text++;
-            if (is_high_surrogate(uc) && in_text < in_text_end && is_low_surrogate(*in_text))
-            {
-                *out_char = surrogate_to_utf32(uc, *in_text);
-                return 2;
-            }
-            else
-            {
-                return 0;
-            }
+            result.status = conversion_status::invalid_input;
         }
+        pending_size_ = 0;
+        return result;
     }
 
-    std::u16string u32_to_utf16(char32_t ch)
+    conversion_status utf8_decoder::finish(std::u32string& out)
     {
-        if (ch < 0x10000)
-        {
-            return std::u16string{char16_t(ch)};
-        }
+        char32_t tail[sizeof(pending_)] {};
+        auto result = finish(tail, sizeof(pending_));
+        out.append(tail, result.written);
+        return result.status;
+    }
 
-        ch -= 0x10000;
-        char16_t arr[2] {};
-        arr[0] = char16_t(0xD800 | (ch >> 10));
-        arr[1] = char16_t(0xDC00 | (ch & 0x3FF));
+    void utf8_decoder::reset()
+    {
+        pending_size_ = 0;
+    }
 
-        return std::u16string{std::begin(arr), std::end(arr)};
+    utf8_offset_index::utf8_offset_index(size_t stride)
+        : stride_(std::max<size_t>(stride, 1))
+    {
     }
 
-    std::string convert(const std::u32string &str)
+    utf8_offset_index::utf8_offset_index(const char* text, size_t size, size_t stride)
+        : utf8_offset_index(stride)
     {
-        return unicode_to_utf8(str.data(), str.data() + str.size());
+        samples_.reserve(size / stride_ + 1);
+        append(text, size);
     }
 
-    std::u32string convert(const std::string &str)
+    void utf8_offset_index::append(const char* in, size_t in_len)
+    {
+        for (size_t i = 0; i < in_len; i += 32)
+        {
+            const auto mask = utf8_lead_mask(in + i, in_len - i);
+            const auto leads = details::popcount(mask);
+            // samples_.size() * stride_ is the next code point to sample
+            while (samples_.size() * stride_ < codepoints_ + leads)
+            {
+                samples_.push_back(bytes_ + i + nth_set_bit(mask, samples_.size() * stride_ - codepoints_));
+            }
+            codepoints_ += leads;
+        }
+        bytes_ += in_len;
+    }
+
+    size_t utf8_offset_index::byte_offset(const char* text, size_t n) const
     {
-        std::u32string result {};
-        result.reserve(str.size());
+        if (n >= codepoints_)
+        {
+            return bytes_;
+        }
 
-        size_t move {};
-        while(move < str.size())
+        auto pos = samples_[n / stride_];
+        auto remaining = n % stride_;
+        for (;;)
         {
-            char32_t out {};
-            auto readed = utf8_to_u32(&out, str.data() + move, str.data() + str.size());
-            if (readed == 0)
+            const auto mask = utf8_lead_mask(text + pos, bytes_ - pos);
+            const auto leads = details::popcount(mask);
+            if (remaining < leads)
             {
-                break;
+                return pos + nth_set_bit(mask, remaining);
             }
+            remaining -= leads;
+            pos += 32;
+        }
+    }
 
-            move += readed;
-            result.push_back(out);
+    size_t utf8_offset_index::codepoint_index(const char* text, size_t offset) const
+    {
+        offset = std::min(offset, bytes_);
+        auto sample = std::upper_bound(samples_.begin(), samples_.end(), offset);
+        if (sample == samples_.begin())
+        {
+            // no sequence starts before the first sample
+            return 0;
         }
 
-        return result;
+        --sample;
+        return size_t(sample - samples_.begin()) * stride_ + count_utf8_leads(text + *sample, offset - *sample);
     }
 }
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace u32
 {
@@ -14,16 +17,444 @@ namespace u32
         return 0x10FFFF;
     }
 
-    size_t get_utf8_char_len(const char* text);
+    enum class conversion_status
+    {
+        ok,
+        output_too_small,
+        invalid_input,
+    };
+
+    // Outcome of a conversion into a caller-provided buffer: read input units, written
+    // output units and why the conversion stopped. Output past written may be clobbered.
+    struct conversion_result
+    {
+        size_t read {};
+        size_t written {};
+        conversion_status status {conversion_status::ok};
+    };
+
+    // Sequence length claimed by a lead byte, 0 for continuation bytes and 0xF8 and above.
+    inline constexpr size_t get_utf8_char_len(const char* text)
+    {
+        const auto lead = static_cast<unsigned char>(*text);
+        return !(lead & 0x80) ? 1 : (lead & 0xe0) == 0xc0 ? 2 : (lead & 0xf0) == 0xe0 ? 3 : (lead & 0xf8) == 0xf0 ? 4 : 0;
+    }
+
+    // Decodes the sequence at in_text and returns its length, in_text_end may be null for NUL
+    // terminated text. A malformed sequence gives U+FFFD and consumes the length its lead byte
+    // claims, or 1 when it is cut short by in_text_end. A byte that cannot start a sequence
+    // gives 0.
+    inline constexpr size_t utf8_to_u32(char32_t* out_char, const char* in_text, const char* in_text_end)
+    {
+        const auto lead = static_cast<unsigned char>(in_text[0]);
+        const auto len = get_utf8_char_len(in_text);
+        if (len == 1)
+        {
+            *out_char = lead;
+            return 1;
+        }
+
+        *out_char = len == 0 ? 0 : get_unicode_invalid_codepoint_char_id();
+        if (len == 0)
+        {
+            return 0;
+        }
+
+        if (in_text_end && in_text_end - in_text < std::ptrdiff_t(len))
+        {
+            return 1;
+        }
+
+        // overlong forms, surrogates and values above U+10FFFF
+        const auto second = static_cast<unsigned char>(in_text[1]);
+        if ((len == 2 && lead < 0xc2) || (lead == 0xe0 && second < 0xa0) || (lead == 0xed && second > 0x9f)
+            || lead > 0xf4 || (lead == 0xf0 && second < 0x90) || (lead == 0xf4 && second > 0x8f))
+        {
+            return len;
+        }
+
+        char32_t c = lead & (0x7f >> len);
+        for (size_t i = 1; i < len; ++i)
+        {
+            const auto next = static_cast<unsigned char>(in_text[i]);
+            if ((next & 0xc0) != 0x80)
+            {
+                return len;
+            }
+            c = (c << 6) | (next & 0x3f);
+        }
+
+        *out_char = c;
+        return len;
+    }
 
-    size_t utf8_to_u32(char32_t* out_char, const char* in_text, const char* in_text_end);
     size_t utf8_to_u32_reverse(char32_t* out_char, const char* start_str, const char* curr_pos);
 
+    // Writes the UTF-8 form of ch (up to 4 bytes) and returns the byte count. Surrogates and
+    // values above U+10FFFF are not scalar values and give 0 with nothing written, the bulk
+    // encoder merges surrogate pairs but a single code point cannot be paired.
+    inline constexpr size_t encode_utf8(char32_t ch, char* out)
+    {
+        if (ch < 0x80)
+        {
+            out[0] = static_cast<char>(ch);
+            return 1;
+        }
+
+        if (ch < 0x800)
+        {
+            out[0] = static_cast<char>(0xc0 | (ch >> 6));
+            out[1] = static_cast<char>(0x80 | (ch & 0x3f));
+            return 2;
+        }
+
+        if ((ch >= 0xd800 && ch <= 0xdfff) || ch > get_unicode_max_codepoint_char_id())
+        {
+            return 0;
+        }
+
+        if (ch < 0x10000)
+        {
+            out[0] = static_cast<char>(0xe0 | (ch >> 12));
+            out[1] = static_cast<char>(0x80 | ((ch >> 6) & 0x3f));
+            out[2] = static_cast<char>(0x80 | (ch & 0x3f));
+            return 3;
+        }
+
+        out[0] = static_cast<char>(0xf0 | (ch >> 18));
+        out[1] = static_cast<char>(0x80 | ((ch >> 12) & 0x3f));
+        out[2] = static_cast<char>(0x80 | ((ch >> 6) & 0x3f));
+        out[3] = static_cast<char>(0x80 | (ch & 0x3f));
+        return 4;
+    }
+
     std::string u32_to_utf8(char32_t ch);
 
-    size_t utf16_to_u32(char32_t* out_char, const char16_t* in_text, const char16_t* in_text_end);
+    // Offset of the first byte starting an invalid UTF-8 sequence (one utf8_to_u32 would
+    // replace or reject), in_len for valid input.
+    size_t validate_utf8(const char* in, size_t in_len);
+
+    // Output sizes of well-formed input. For malformed UTF-8, utf8_length_in_codepoints is an
+    // upper bound of what convert() decodes.
+    size_t utf8_length_in_codepoints(const char* in, size_t in_len);
+    size_t utf32_length_in_utf8(const char32_t* in, size_t in_len);
+    size_t utf32_length_in_utf16(const char32_t* in, size_t in_len);
+    size_t utf16_length_in_codepoints(const char16_t* in, size_t in_len);
+    size_t utf8_length_in_utf16(const char* in, size_t in_len);
+    size_t utf16_length_in_utf8(const char16_t* in, size_t in_len);
+
+    // Decodes the unit or surrogate pair at in_text and returns its length, 0 for an unpaired
+    // surrogate.
+    inline constexpr size_t utf16_to_u32(char32_t* out_char, const char16_t* in_text, const char16_t* in_text_end)
+    {
+        const auto unit = in_text[0];
+        if (unit < 0xd800 || unit > 0xdfff)
+        {
+            *out_char = unit;
+            return 1;
+        }
+
+        if (unit <= 0xdbff && in_text + 1 < in_text_end && in_text[1] >= 0xdc00 && in_text[1] <= 0xdfff)
+        {
+            *out_char = (char32_t(unit) << 10) + in_text[1] - 0x35fdc00;
+            return 2;
+        }
+        return 0;
+    }
+
+    // Code points of a string literal decoded at compile time:
+    //   constexpr auto key = u32::decode_literal(u8"ключ");
+    // Decoding stops like convert() does, size excludes the terminating NUL.
+    template<size_t N>
+    struct u32_literal
+    {
+        char32_t data[N] {};
+        size_t size {};
+
+        std::u32string str() const
+        {
+            return std::u32string(data, size);
+        }
+    };
+
+    template<size_t N>
+    inline constexpr u32_literal<N> decode_literal(const char (&str)[N])
+    {
+        u32_literal<N> result {};
+        for (size_t pos = 0; pos + 1 < N; ++result.size)
+        {
+            const auto len = utf8_to_u32(&result.data[result.size], str + pos, str + N - 1);
+            if (len == 0)
+            {
+                break;
+            }
+            pos += len;
+        }
+        return result;
+    }
+
+    template<size_t N>
+    inline constexpr u32_literal<N> decode_literal(const char16_t (&str)[N])
+    {
+        u32_literal<N> result {};
+        for (size_t pos = 0; pos + 1 < N; ++result.size)
+        {
+            const auto len = utf16_to_u32(&result.data[result.size], str + pos, str + N - 1);
+            if (len == 0)
+            {
+                break;
+            }
+            pos += len;
+        }
+        return result;
+    }
+
+    // Writes the UTF-16 form of ch (up to 2 units) and returns the unit count, 0 above U+10FFFF.
+    // Surrogates are copied as one unit, like convert_to_u16 does.
+    inline constexpr size_t encode_utf16(char32_t ch, char16_t* out)
+    {
+        if (ch < 0x10000)
+        {
+            out[0] = char16_t(ch);
+            return 1;
+        }
+
+        if (ch > get_unicode_max_codepoint_char_id())
+        {
+            return 0;
+        }
+
+        ch -= 0x10000;
+        out[0] = char16_t(0xD800 | (ch >> 10));
+        out[1] = char16_t(0xDC00 | (ch & 0x3FF));
+        return 2;
+    }
+
     std::u16string u32_to_utf16(char32_t ch);
 
     std::string convert(const std::u32string& str);
     std::u32string convert(const std::string& str);
+
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity);
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity);
+
+    std::u32string convert(const std::u16string& str);
+    std::u16string convert_to_u16(const std::u32string& str);
+
+    conversion_result convert(const char16_t* in, size_t in_len, char32_t* out, size_t out_capacity);
+    conversion_result convert(const char32_t* in, size_t in_len, char16_t* out, size_t out_capacity);
+
+    // Direct UTF-8 <-> UTF-16 transcoding, with the error handling of utf8_to_u32 and utf16_to_u32.
+    std::u16string utf8_to_utf16(const std::string& str);
+    std::string utf16_to_utf8(const std::u16string& str);
+
+    conversion_result utf8_to_utf16(const char* in, size_t in_len, char16_t* out, size_t out_capacity);
+    conversion_result utf16_to_utf8(const char16_t* in, size_t in_len, char* out, size_t out_capacity);
+
+    // WTF-8, the superset of UTF-8 that also encodes unpaired surrogates (in their 3 byte
+    // generalized UTF-8 form), so that ill-formed UTF-16 such as Windows file names or JavaScript
+    // strings survives a round trip. The overloads taking the u32::wtf8 tag differ from the plain
+    // ones only there: encoded surrogates decode to surrogate code points or units, unpaired
+    // surrogates are encoded instead of being dropped or stopping the conversion. A surrogate pair
+    // is still merged into one 4 byte sequence.
+    struct wtf8_t
+    {
+    };
+
+    constexpr wtf8_t wtf8 {};
+
+    std::string convert(const std::u32string& str, wtf8_t);
+    std::u32string convert(const std::string& str, wtf8_t);
+    std::u16string utf8_to_utf16(const std::string& str, wtf8_t);
+    std::string utf16_to_utf8(const std::u16string& str, wtf8_t);
+
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, wtf8_t);
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity, wtf8_t);
+    conversion_result utf8_to_utf16(const char* in, size_t in_len, char16_t* out, size_t out_capacity, wtf8_t);
+    conversion_result utf16_to_utf8(const char16_t* in, size_t in_len, char* out, size_t out_capacity, wtf8_t);
+
+    // CESU-8 and Java's Modified UTF-8 write a supplementary character as the two 3 byte
+    // sequences of its surrogates, Modified UTF-8 also writes U+0000 as C0 80. Selected with the
+    // u32::cesu8 and u32::modified_utf8 tags. Decoding otherwise follows convert(), including
+    // 4 byte sequences, encoding writes U+FFFD for values above U+10FFFF.
+    struct cesu8_t
+    {
+    };
+
+    struct modified_utf8_t
+    {
+    };
+
+    constexpr cesu8_t cesu8 {};
+    constexpr modified_utf8_t modified_utf8 {};
+
+    std::string convert(const std::u32string& str, cesu8_t);
+    std::u32string convert(const std::string& str, cesu8_t);
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, cesu8_t);
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity, cesu8_t);
+
+    std::string convert(const std::u32string& str, modified_utf8_t);
+    std::u32string convert(const std::string& str, modified_utf8_t);
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, modified_utf8_t);
+    conversion_result convert(const char32_t* in, size_t in_len, char* out, size_t out_capacity, modified_utf8_t);
+
+    // Unicode encoding forms of byte streams.
+    enum class unicode_t
+    {
+        UTF_8,
+        UTF_16LE,
+        UTF_16BE,
+        UTF_32LE,
+        UTF_32BE,
+    };
+
+    // Encoding announced by a byte order mark at the start of in. bom_length is set to the
+    // size of the mark, 0 when there is none and fallback is returned.
+    unicode_t detect_bom(const char* in, size_t in_len, size_t* bom_length, unicode_t fallback = unicode_t::UTF_8);
+
+    // Decodes raw bytes in the given encoding form, without copying UTF-16/UTF-32 input into
+    // host byte order first. UTF-8 and UTF-16 decode like the convert overloads above, UTF-32 is
+    // taken as is. Bytes of an incomplete trailing unit give invalid_input.
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, unicode_t encoding);
+    std::u32string convert(const std::string& bytes, unicode_t encoding);
+
+    // Error policies of the policy decoders below, selected at compile time:
+    //   convert<u32::error_policy::skip>(text, &errors)
+    namespace error_policy
+    {
+        // U+FFFD for every malformed sequence
+        struct replace {};
+        // malformed sequences are dropped
+        struct skip {};
+        // stops with invalid_input, read is the offset of the malformed sequence
+        struct stop {};
+        // throws conversion_error
+        struct raise {};
+    }
+
+    class conversion_error : public std::invalid_argument
+    {
+    public:
+        conversion_error(const char* what, size_t offset)
+            : std::invalid_argument(what)
+            , offset_(offset)
+        {
+        }
+
+        // offset of the malformed sequence in the input units of the failed call
+        size_t offset() const noexcept
+        {
+            return offset_;
+        }
+
+    private:
+        size_t offset_ {};
+    };
+
+    // Decoders with a compile-time error policy. Malformed UTF-8 is split into maximal invalid
+    // subparts as the Unicode standard recommends (one error per subpart), a malformed UTF-16
+    // sequence is an unpaired surrogate. When error_count is given it is increased by the number
+    // of malformed sequences met.
+    template<typename ErrorPolicy>
+    std::u32string convert(const std::string& str, size_t* error_count = nullptr);
+    template<typename ErrorPolicy>
+    std::u32string convert(const std::u16string& str, size_t* error_count = nullptr);
+    template<typename ErrorPolicy>
+    std::u16string utf8_to_utf16(const std::string& str, size_t* error_count = nullptr);
+    template<typename ErrorPolicy>
+    std::string utf16_to_utf8(const std::u16string& str, size_t* error_count = nullptr);
+
+    template<typename ErrorPolicy>
+    conversion_result convert(const char* in, size_t in_len, char32_t* out, size_t out_capacity, size_t* error_count = nullptr);
+    template<typename ErrorPolicy>
+    conversion_result convert(const char16_t* in, size_t in_len, char32_t* out, size_t out_capacity, size_t* error_count = nullptr);
+    template<typename ErrorPolicy>
+    conversion_result utf8_to_utf16(const char* in, size_t in_len, char16_t* out, size_t out_capacity, size_t* error_count = nullptr);
+    template<typename ErrorPolicy>
+    conversion_result utf16_to_utf8(const char16_t* in, size_t in_len, char* out, size_t out_capacity, size_t* error_count = nullptr);
+
+    // Incremental UTF-8 decoder. A sequence split between two feed() calls is carried over
+    // (up to 3 bytes), so chunked input decodes exactly like convert() on the whole text.
+    class utf8_decoder
+    {
+    public:
+        // Stops with invalid_input at a byte that cannot start a sequence, the caller may
+        // skip it and feed the rest.
+        conversion_result feed(const char* in, size_t in_len, char32_t* out, size_t out_capacity);
+        conversion_status feed(const char* in, size_t in_len, std::u32string& out);
+
+        template<typename Sink>
+        conversion_status feed(const char* in, size_t in_len, Sink&& sink)
+        {
+            char32_t buffer[256];
+            for (;;)
+            {
+                auto result = feed(in, in_len, buffer, sizeof(buffer) / sizeof(buffer[0]));
+                sink(static_cast<const char32_t*>(buffer), result.written);
+                in += result.read;
+                in_len -= result.read;
+                if (result.status != conversion_status::output_too_small)
+                {
+                    return result.status;
+                }
+            }
+        }
+
+        // Flushes a truncated tail as U+FFFD and reports it with invalid_input.
+        conversion_result finish(char32_t* out, size_t out_capacity);
+        conversion_status finish(std::u32string& out);
+
+        bool has_pending() const
+        {
+            return pending_size_ != 0;
+        }
+
+        void reset();
+
+    private:
+        char pending_[4] {};
+        size_t pending_size_ {};
+    };
+
+    // Byte offsets of every stride-th code point of a UTF-8 text, for positional lookups in
+    // large buffers in O(stride). Code points are counted like utf8_length_in_codepoints does,
+    // each byte that is not a continuation byte starts one. The index does not keep the text,
+    // lookups take the buffer holding all the bytes appended so far.
+    class utf8_offset_index
+    {
+    public:
+        explicit utf8_offset_index(size_t stride = 1024);
+        utf8_offset_index(const char* text, size_t size, size_t stride = 1024);
+
+        // Indexes the bytes following the ones indexed so far.
+        void append(const char* in, size_t in_len);
+
+        // Byte offset of code point n, size() for n >= codepoints().
+        size_t byte_offset(const char* text, size_t n) const;
+
+        // Number of code points starting before offset, the index of the code point at offset
+        // when a sequence starts there.
+        size_t codepoint_index(const char* text, size_t offset) const;
+
+        size_t size() const
+        {
+            return bytes_;
+        }
+
+        size_t codepoints() const
+        {
+            return codepoints_;
+        }
+
+        size_t stride() const
+        {
+            return stride_;
+        }
+
+    private:
+        size_t stride_ {};
+        size_t bytes_ {};
+        size_t codepoints_ {};
+        std::vector<size_t> samples_;
+    };
 }